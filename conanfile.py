@@ -36,11 +36,11 @@ class NarengineRecipe(ConanFile):
     def requirements(self):
         self.requires("glfw/3.4")
         self.requires("glm/1.0.1", transitive_headers=True)
+        self.requires("stb/cci.20240213")
         if self.options.with_tools_flatbuffers:
             self.requires("flatbuffers/24.3.25")
         if self.options.with_tools_json:
             self.requires("nlohmann_json/3.11.3")
-            self.requires("stb/cci.20240213")
         if self.options.with_render_opengl:
             self.requires("opengl/system")
 
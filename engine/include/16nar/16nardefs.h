@@ -38,6 +38,7 @@ enum class RenderApiType
 #if defined( NARENGINE_RENDER_OPENGL )
      OpenGl,             ///< OpenGL render API.
 #endif // NARENGINE_RENDER_OPENGL
+     Null,               ///< render API without graphics, for headless runs and benchmarks.
      Unknown             ///< unknown render API, set on error.
 };
 
@@ -51,6 +52,11 @@ enum class ResourceType
      VertexBuffer,       ///< buffer or group of buffers for vertices.
      RenderBuffer,       ///< write-only render buffer.
      Cubemap,            ///< 3D texture.
+     Material,           ///< shader program with uniform values and textures.
+     UniformBuffer,      ///< buffer with uniform block data, shared by shader programs.
+     StreamBuffer,       ///< ring of buffer regions for vertices written every frame.
+     Atlas,              ///< names of sub-images in texture pages, resolved by package manager.
+     TextureArray,       ///< array of 2D textures of the same size, layer is selected in shader.
      Unknown             ///< unknown resource type for default initialization.
 };
 
@@ -81,10 +87,14 @@ struct TypedResource : public Resource
 };
 
 
-using Shader       = TypedResource< ResourceType::Shader       >;
-using Texture      = TypedResource< ResourceType::Texture      >;
-using FrameBuffer  = TypedResource< ResourceType::FrameBuffer  >;
-using VertexBuffer = TypedResource< ResourceType::VertexBuffer >;
+using Shader        = TypedResource< ResourceType::Shader        >;
+using Texture       = TypedResource< ResourceType::Texture       >;
+using FrameBuffer   = TypedResource< ResourceType::FrameBuffer   >;
+using VertexBuffer  = TypedResource< ResourceType::VertexBuffer  >;
+using Material      = TypedResource< ResourceType::Material      >;
+using UniformBuffer = TypedResource< ResourceType::UniformBuffer >;
+using StreamBuffer  = TypedResource< ResourceType::StreamBuffer  >;
+using TextureArray  = TypedResource< ResourceType::TextureArray  >;
 
 } // namespace _16nar
 
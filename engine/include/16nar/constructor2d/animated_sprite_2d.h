@@ -0,0 +1,82 @@
+/// @file
+/// @brief Header file with AnimatedSprite2D class definition.
+#ifndef _16NAR_CONSTRUCTOR_2D_ANIMATED_SPRITE_2D_H
+#define _16NAR_CONSTRUCTOR_2D_ANIMATED_SPRITE_2D_H
+
+#include <16nar/constructor2d/drawable_node_2d.h>
+
+namespace _16nar
+{
+
+class AnimationTable;
+
+} // namespace _16nar
+
+
+namespace _16nar::constructor2d
+{
+
+/// @brief Sprite node playing animation clips from animation table.
+/// @details Frame is selected by shader from time of the table, start time and playback rate
+/// of the sprite, so the sprite is changed on CPU only when playback starts, stops or its rate
+/// changes. Shader gets uniforms "model_matr", "animation_clip" and "animation_loop", see AnimationBlock.
+/// Rate is applied to frame rate of the clip, so "animation_clip" always contains the actual rate.
+class ENGINE_API AnimatedSprite2D : public DrawableNode2D
+{
+public:
+     /// @brief Constructor.
+     /// @param[in] material material used to draw the sprite, its shader selects the frame.
+     /// @param[in] quad vertex buffer with quad drawn as triangle strip of 4 vertices.
+     /// @param[in] size size of the sprite in its own coordinates.
+     /// @param[in] table animation table with clips of the sprite, it must outlive the sprite.
+     AnimatedSprite2D( const Material& material, const VertexBuffer& quad, const Vec2f& size,
+          const AnimationTable& table );
+
+     /// @brief Start playing the clip from its first frame.
+     /// @param[in] clip animation clip from the animation table.
+     /// @param[in] rate playback rate, 1 is normal speed.
+     void play( const AnimationClip& clip, float rate = 1.0f ) noexcept;
+
+     /// @brief Stop playing, current frame stays on the screen.
+     void stop() noexcept;
+
+     /// @brief Check if the clip is playing.
+     /// @return true if the clip is playing, false if it is stopped.
+     bool is_playing() const noexcept;
+
+     /// @brief Set playback rate, current frame is kept.
+     /// @param[in] rate playback rate, 1 is normal speed.
+     void set_playback_rate( float rate ) noexcept;
+
+     /// @brief Get playback rate.
+     /// @return playback rate.
+     float get_playback_rate() const noexcept;
+
+     /// @brief Get current clip.
+     /// @return animation clip played by the sprite.
+     const AnimationClip& get_clip() const noexcept;
+
+     /// @brief Get current frame, the same as selected by shader.
+     /// @return index of current frame in the clip.
+     std::size_t get_current_frame() const noexcept;
+
+     /// @copydoc Drawable::get_draw_info() const noexcept
+     DrawInfo get_draw_info() const noexcept override;
+
+     /// @copydoc Drawable2D::get_local_bounds() const
+     FloatRect get_local_bounds() const override;
+
+private:
+     VertexBuffer quad_;                ///< vertex buffer with quad of the sprite.
+     Vec2f size_;                       ///< size of the sprite.
+     const AnimationTable& table_;      ///< animation table with clips.
+     AnimationClip clip_;               ///< current clip.
+     float start_time_;                 ///< time of the table when clip started from the first frame.
+     float rate_;                       ///< playback rate.
+     std::size_t stopped_frame_;        ///< frame shown after stop.
+     bool playing_;                     ///< is the clip playing.
+};
+
+} // namespace _16nar::constructor2d
+
+#endif // #ifndef _16NAR_CONSTRUCTOR_2D_ANIMATED_SPRITE_2D_H
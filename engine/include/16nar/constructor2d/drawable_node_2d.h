@@ -6,6 +6,8 @@
 #include <16nar/constructor2d/render/drawable_2d.h>
 #include <16nar/constructor2d/node_2d.h>
 
+#include <cstdint>
+
 namespace _16nar::constructor2d
 {
 
@@ -13,14 +15,24 @@ namespace _16nar::constructor2d
 class ENGINE_API DrawableNode2D : public Drawable2D, public Node2D
 {
 public:
-     /// @copydoc Drawable2D::Drawable2D(const Shader&) noexcept
-     explicit DrawableNode2D( const Shader& shader ) noexcept;
+     /// @copydoc Drawable2D::Drawable2D(const Shader&)
+     explicit DrawableNode2D( const Shader& shader );
+
+     /// @copydoc Drawable2D::Drawable2D(const Material&)
+     explicit DrawableNode2D( const Material& material );
 
-     /// @copydoc Drawable2D::get_global_bounds() const
+     /// @brief Get bounds of the object in global coordinates.
+     /// @details Bounds are cached until world matrix or local bounds of the node change.
+     /// @return bounding rectangle in global coordinates.
      FloatRect get_global_bounds() const override;
 
      /// @copydoc Node2D::loop_call(SceneState&, float, bool)
      void loop_call( SceneState& state, float delta, bool updated ) override;
+
+private:
+     mutable FloatRect world_bounds_;        ///< cached bounds in global coordinates.
+     mutable std::uint32_t bounds_version_;  ///< version of world matrix used for cached bounds.
+     mutable bool bounds_valid_;             ///< are cached bounds calculated for current local bounds.
 };
 
 } // namespace _16nar::constructor2d
@@ -33,6 +33,9 @@ public:
      /// @brief Default constructor.
      Node2D();
 
+     /// @brief Virtual destructor, nodes are owned and deleted by pointers to Node2D.
+     virtual ~Node2D() = default;
+
      /// @brief Get current node's parent node.
      /// @return pointer to current node's parent node, nullptr of there is no parent.
      Node2D *get_parent() noexcept;
@@ -47,12 +50,24 @@ public:
      /// @brief Get global transformation matrix.
      /// @param[in] include_self true if should include local matrix in result, false otherwise.
      /// @return global transformation matrix.
-     TransformMatrix get_global_transform_matr( bool include_self = true ) const noexcept;
+     Affine2D get_global_transform_matr( bool include_self = true ) const noexcept;
 
      /// @brief Get set of direct children of this node.
      /// @return set of direct children of this node.
      const NodesSet& get_children() const noexcept;
 
+     /// @brief Mark subtree of the node as independent from the rest of the scene.
+     /// @details In parallel update mode of the scene, independent subtrees are updated
+     /// concurrently with each other, after their dependent siblings. Loop functions of such
+     /// subtree must not access nodes outside of it, so they must not change transformations
+     /// of ancestors, and must not change the scene tree.
+     /// @param[in] independent true if the subtree is independent, false otherwise.
+     void set_independent( bool independent ) noexcept;
+
+     /// @brief Check if subtree of the node is marked as independent.
+     /// @return true if the subtree is independent, false otherwise.
+     bool is_independent() const noexcept;
+
      // Member functions not for user to call
 
      /// @brief Set order of scene state to which current node belongs.
@@ -78,6 +93,16 @@ public:
      /// @param[in] updated true if node needs to be rerendered after update, false otherwise.
      virtual void loop_call( SceneState& state, float delta, bool updated );
 
+     /// @brief Execute loop functions of all nodes in the set recursively.
+     /// @details Independent nodes are updated in jobs if state has job system. Dependent nodes
+     /// are updated first by calling thread, so they may change common parent before jobs read it.
+     /// Should not be called by user, unless you are sure about that.
+     /// @param[in] nodes set of nodes.
+     /// @param[in] state scene state of the nodes.
+     /// @param[in] delta time passed since previous loop call, in seconds.
+     /// @param[in] updated true if nodes need to be rerendered after update, false otherwise.
+     static void loop_call_all( const NodesSet& nodes, SceneState& state, float delta, bool updated );
+
      /// @brief Add node to set of children.
      /// @details Should not be called by user, unless you are sure about that.
      /// @param[in] node pointer to node to be added.
@@ -95,6 +120,7 @@ private:
      Node2D *parent_;              ///< parent of current node.
      int state_order_;             ///< order of scene state to which current node belongs,
                                    ///< makes sesnse only if node is direct child of state.
+     bool independent_;            ///< can subtree of the node be updated concurrently.
 protected:
      SetupFuncPtr setup_func_;     ///< pointer to current scene's setup function.
      LoopFuncPtr loop_func_;       ///< pointer to current scene's loop function.
@@ -0,0 +1,93 @@
+/// @file
+/// @brief Header file with ParticleEmitter2D class definition.
+#ifndef _16NAR_CONSTRUCTOR_2D_PARTICLE_EMITTER_2D_H
+#define _16NAR_CONSTRUCTOR_2D_PARTICLE_EMITTER_2D_H
+
+#include <16nar/constructor2d/drawable_node_2d.h>
+#include <16nar/render/particle_pool.h>
+
+namespace _16nar::constructor2d
+{
+
+/// @brief Settings of particle emission and simulation.
+struct ParticleSettings
+{
+     float emission_rate = 100.0f;      ///< number of particles emitted per second.
+     float lifetime = 1.0f;             ///< lifetime of particles, in seconds.
+     Vec2f velocity{};                  ///< average initial velocity of particles.
+     Vec2f spread{};                    ///< maximal deviation of initial velocity in each dimension.
+     Vec2f acceleration{};              ///< acceleration of all particles, for example, gravity.
+     Vec2f size{ 1.0f, 1.0f };          ///< size of quad of one particle.
+     std::size_t max_particles = 1024;  ///< maximal number of alive particles.
+};
+
+
+/// @brief Node emitting particles, drawn with one instanced draw call.
+/// @details Particles are simulated on CPU in coordinates of the emitter, which emits them
+/// from its origin. The emitter is one object in render system, its bounds contain all particles.
+/// Every frame position and fraction of lifetime passed of each particle are written to stream
+/// buffer as per-instance attributes (vec2 and float), shader builds quad of 4 vertices
+/// of triangle strip from gl_VertexID. Shader gets uniform "model_matr" with each draw call,
+/// and uniform "particle_size" from material, see @ref add_material_uniforms.
+class ENGINE_API ParticleEmitter2D : public DrawableNode2D
+{
+public:
+     /// @brief Get parameters of stream buffer for instance data of particles.
+     /// @param[in] max_particles maximal number of particles drawn per frame from the buffer.
+     /// @return parameters for loading stream buffer.
+     static LoadParams< ResourceType::StreamBuffer > get_stream_params( std::size_t max_particles );
+
+     /// @brief Add uniforms which do not change between draw calls to parameters of material.
+     /// @param[in,out] params parameters for loading material of emitters.
+     /// @param[in] settings settings of emitters which use the material.
+     static void add_material_uniforms( LoadParams< ResourceType::Material >& params, const ParticleSettings& settings );
+
+     /// @brief Constructor.
+     /// @param[in] material material used to draw particles, loaded with parameters
+     /// completed by @ref add_material_uniforms.
+     /// @param[in] stream stream buffer loaded with parameters from @ref get_stream_params,
+     /// it may be shared by emitters if it has space for all their particles.
+     /// @param[in] settings settings of emission and simulation.
+     ParticleEmitter2D( const Material& material, const StreamBuffer& stream, const ParticleSettings& settings );
+
+     /// @brief Start or stop emission, alive particles are simulated anyway.
+     /// @param[in] emitting should new particles be emitted.
+     void set_emitting( bool emitting ) noexcept;
+
+     /// @brief Check if new particles are emitted.
+     /// @return true if new particles are emitted, false otherwise.
+     bool is_emitting() const noexcept;
+
+     /// @brief Emit particles immediately, for example, for explosion.
+     /// @param[in] count number of particles.
+     void burst( std::size_t count );
+
+     /// @brief Get settings of the emitter.
+     /// @return settings of emission and simulation.
+     const ParticleSettings& get_settings() const noexcept;
+
+     /// @brief Get pool with alive particles.
+     /// @return pool of particles.
+     const ParticlePool& get_pool() const noexcept;
+
+     /// @copydoc Drawable::get_draw_info() const noexcept
+     DrawInfo get_draw_info() const noexcept override;
+
+     /// @copydoc Drawable2D::get_local_bounds() const
+     FloatRect get_local_bounds() const override;
+
+     /// @copydoc Node2D::loop_call(SceneState&, float, bool)
+     void loop_call( SceneState& state, float delta, bool updated ) override;
+
+private:
+     ParticleSettings settings_;        ///< settings of emission and simulation.
+     ParticlePool pool_;                ///< alive particles.
+     StreamBuffer stream_;              ///< stream buffer for instance data.
+     float emission_debt_;              ///< fraction of particle not emitted yet.
+     bool emitting_;                    ///< are new particles emitted.
+     bool had_particles_;               ///< were there particles after previous update.
+};
+
+} // namespace _16nar::constructor2d
+
+#endif // #ifndef _16NAR_CONSTRUCTOR_2D_PARTICLE_EMITTER_2D_H
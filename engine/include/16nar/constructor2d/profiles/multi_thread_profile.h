@@ -0,0 +1,130 @@
+/// @file
+/// @brief Header file with MultiThreadProfile class definition.
+#ifndef _16NAR_CONSTRUCTOR_2D_MULTI_THREAD_PROFILE_H
+#define _16NAR_CONSTRUCTOR_2D_MULTI_THREAD_PROFILE_H
+
+#include <16nar/constructor2d/system/scene.h>
+#include <16nar/system/iprofile.h>
+#include <16nar/system/frame_scheduler.h>
+#include <16nar/system/thread_settings.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace _16nar::constructor2d
+{
+
+/// @brief Profile which runs the application update and render in two pipelined threads.
+/// @details Update thread (the one which called @ref run) updates scene with fixed time step
+/// and records frame N+1 into render API, while render thread, owning the graphics context,
+/// executes frame N. Frames are exchanged by handshake: update thread waits until render thread
+/// finishes the previous frame and takes the recorded one, so at most one frame is in flight.
+/// The executed scene is the current scene returned by constructor2d::get_scene(),
+/// it is touched only by update thread.
+/// The profile must be used with render API created for ProfileType::MultiThreaded.
+class ENGINE_API MultiThreadProfile : public IProfile
+{
+public:
+     /// @brief Constructor.
+     MultiThreadProfile();
+
+     /// @brief Destructor, stops render thread if it is running.
+     ~MultiThreadProfile();
+
+     /// @copydoc IProfile::run()
+     /// @throws May rethrow exception thrown in render thread.
+     virtual void run() override;
+
+     /// @copydoc IProfile::switch_scene(std::string_view)
+     virtual void switch_scene( std::string_view name ) override;
+
+     /// @copydoc IProfile::exit()
+     virtual void exit() override;
+
+     /// @copydoc IProfile::set_time_per_frame(float)
+     virtual void set_time_per_frame( float time_per_frame ) override;
+
+     /// @brief Set maximal number of update steps run in one frame to catch up with time.
+     /// @param[in] max_steps maximal number of update steps.
+     void set_max_steps_per_frame( std::size_t max_steps ) noexcept;
+
+     /// @brief Set settings of update thread, applied to the thread calling @ref run.
+     /// @param[in] settings settings of update thread.
+     void set_update_thread_settings( const ThreadSettings& settings );
+
+     /// @brief Set settings of render thread, applied when the thread is started.
+     /// @param[in] settings settings of render thread.
+     void set_render_thread_settings( const ThreadSettings& settings );
+
+     /// @brief Get scene executed by the profile.
+     /// @details It is the current scene returned by constructor2d::get_scene(), where scene
+     /// reader places activated scene. Must not be changed while scene is running,
+     /// except from update thread.
+     /// @return executed scene.
+     Scene& get_scene() noexcept;
+
+     /// @brief Get statistics of update thread frames of current scene.
+     /// @details Must be called from update thread.
+     /// @return frame statistics.
+     const FrameStats& get_frame_stats() const noexcept;
+
+private:
+     /// @brief Type of current execution task.
+     enum class TaskType
+     {
+          Running,       ///< Execution of a scene.
+          Loading,       ///< Loading a scene.
+          Exiting        ///< Exiting from application.
+     };
+
+     /// @brief Load scene with name set by @ref switch_scene and set it up.
+     /// @details Scene is read by scene reader of the game. If no name was set,
+     /// current scene filled before @ref run is executed.
+     void load_scene();
+
+     /// @brief Records frame of the scene into render API.
+     /// @details Screen is cleared and visible objects of rendered scene states are drawn.
+     /// @param[in] alpha interpolation factor between the previous and the current update step.
+     void record( float alpha );
+
+     /// @brief Pass recorded frame to render thread.
+     /// @details Waits until render thread takes the frame.
+     /// @return true if the frame was taken, false if render thread has stopped.
+     bool submit_frame();
+
+     /// @brief Start render thread.
+     void start_render_thread();
+
+     /// @brief Stop render thread and wait for it.
+     /// @throws Rethrows exception thrown in render thread.
+     void stop_render_thread();
+
+     /// @brief Main function of render thread.
+     void render_loop();
+
+     /// @brief Run scene with the profile.
+     /// @details Render thread is stopped on each exit, including exceptions.
+     void run_scene();
+
+private:
+     std::string scene_name_;                          ///< name of current scene.
+     std::atomic< TaskType > current_task_;            ///< current task executed by profile.
+     FrameScheduler scheduler_;                        ///< scheduler of update steps and frames.
+     std::atomic_bool finish_;                         ///< should the profile finish scene.
+     ThreadSettings update_settings_;                  ///< settings of update thread.
+     ThreadSettings render_settings_;                  ///< settings of render thread.
+     std::thread render_thread_;                       ///< thread executing recorded frames.
+     std::mutex frame_mutex_;                          ///< mutex guarding frame exchange.
+     std::condition_variable frame_cv_;                ///< condition of frame exchange.
+     bool frame_ready_;                                ///< is recorded frame waiting for render thread.
+     bool stop_render_;                                ///< should render thread stop.
+     std::exception_ptr render_error_;                 ///< exception thrown in render thread.
+};
+
+} // namespace _16nar::constructor2d
+
+#endif // #ifndef _16NAR_CONSTRUCTOR_2D_MULTI_THREAD_PROFILE_H
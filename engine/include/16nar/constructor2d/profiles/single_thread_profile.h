@@ -4,6 +4,7 @@
 #define _16NAR_CONSTRUCTOR_2D_SINGLE_THREAD_PROFILE_H
 
 #include <16nar/system/iprofile.h>
+#include <16nar/system/frame_scheduler.h>
 
 #include <memory>
 #include <string>
@@ -22,6 +23,8 @@ namespace _16nar::constructor2d
 {
 
 /// @brief Profile which runs the application update and render in single (main) thread.
+/// @details Scene is updated with fixed time step, rendering happens once per frame
+/// and gets interpolation factor between update steps. The thread sleeps until the next step is due.
 class ENGINE_API SingleThreadProfile : public IProfile
 {
 public:
@@ -40,6 +43,14 @@ public:
      /// @copydoc IProfile::set_time_per_frame(float)
      virtual void set_time_per_frame( float time_per_frame ) override;
 
+     /// @brief Set maximal number of update steps run in one frame to catch up with time.
+     /// @param[in] max_steps maximal number of update steps.
+     void set_max_steps_per_frame( std::size_t max_steps ) noexcept;
+
+     /// @brief Get statistics of frames of current scene.
+     /// @return frame statistics.
+     const FrameStats& get_frame_stats() const noexcept;
+
 private:
      /// @brief Type of current execution task.
      enum class TaskType
@@ -50,7 +61,8 @@ private:
      };
 
      /// @brief Renders scene on the window.
-     void render();
+     /// @param[in] alpha interpolation factor between the previous and the current update step.
+     void render( float alpha );
 
      /// @brief Run scene with the profile.
      void run_scene();
@@ -58,7 +70,7 @@ private:
 private:
      std::string scene_name_;                          ///< name of current scene.
      TaskType current_task_;                           ///< current task executed by profile.
-     float time_per_frame_;                            ///< minimal time of one rendering frame.
+     FrameScheduler scheduler_;                        ///< scheduler of update steps and frames.
      bool finish_;                                     ///< should the profile finish scene.
 };
 
@@ -17,7 +17,11 @@ class ENGINE_API Drawable2D : public Drawable
 public:
      /// @brief Constructor.
      /// @param[in] shader shader used to draw this object.
-     explicit Drawable2D( const Shader& shader ) noexcept;
+     explicit Drawable2D( const Shader& shader );
+
+     /// @brief Constructor.
+     /// @param[in] material material used to draw this object.
+     explicit Drawable2D( const Material& material );
 
      /// @brief Destructor.
      /// @details Destructor removes object from render system, which means that
@@ -4,6 +4,7 @@
 #define _16NAR_CONSTRUCTOR_2D_QTREE_RENDER_SYSTEM_H
 
 #include <unordered_map>
+#include <vector>
 
 #include <16nar/constructor2d/render/irender_system_2d.h>
 #include <16nar/constructor2d/render/quadrant.h>
@@ -14,6 +15,7 @@ namespace _16nar
 {
 
 class Window;
+class AnimationTable;
 
 } // namespace _16nar
 
@@ -61,6 +63,10 @@ public:
      /// @copydoc IRenderSystem2D::get_camera()
      virtual const Camera2D *get_camera() const override;
 
+     /// @brief Set animation table, its time is written once per frame before drawing.
+     /// @param[in] table animation table, may be nullptr if there are no animated objects.
+     void set_animation_table( AnimationTable *table ) noexcept;
+
      /// @brief Set render quadrant for next draw call.
      /// @param[in] root root quadrant for drawing.
      void set_root_quadrant( std::unique_ptr< Quadrant >&& root );
@@ -78,18 +84,25 @@ protected:
 
 private:
      /// @brief Call render API to draw the object.
-     /// @param[in] obj object to be drawn.
-     void draw_object( Drawable2D *obj );
+     /// @details Shader or material is bound only if it differs from the current one.
+     /// @param[in] info render data of the object.
+     void draw_object( const DrawInfo& info );
 
-     /// @brief Set shader parameters of render system.
-     void set_shader_params() const;
+     /// @brief Write camera matrices to the camera uniform buffer.
+     /// @details Buffer is written once per frame, so binding a shader does not need
+     /// to set camera uniforms. The buffer is created on the first call.
+     void update_camera_buffer();
 
 private:
      std::unordered_map< Drawable2D*, Quadrant* > quad_map_;     ///< map of drawable objects and their quadrants.
      Quadrant::LayerMap layers_;                                 ///< map of layers and selected drawables on them.
      std::unique_ptr< Quadrant > root_;                          ///< root quadrant, covering the whole scene.
+     std::vector< DrawInfo > draw_queue_;                        ///< render data of selected objects on one layer.
      Shader current_shader_;                                     ///< currently bound shader.
+     Material current_material_;                                 ///< currently bound material.
+     UniformBuffer camera_buffer_;                               ///< uniform buffer with camera matrices.
      Camera2D *camera_;                                          ///< camera of the render system.
+     AnimationTable *animation_table_ = nullptr;                 ///< animation table with time of animations.
 };
 
 } // namespace _16nar::constructor2d
@@ -8,6 +8,14 @@
 #include <map>
 #include <memory>
 
+namespace _16nar
+{
+
+class JobSystem;
+
+} // namespace _16nar
+
+
 namespace _16nar::constructor2d
 {
 
@@ -16,7 +24,9 @@ class Node2D;
 
 /// @brief Root object of the scene tree.
 /// @details Scene consists of scene states, each of which can be rendered and updated
-/// individually. States are handled sequentially in strict order.
+/// individually. States are handled sequentially in strict order, unless parallel
+/// update is enabled: then states and independent subtrees are updated concurrently,
+/// and changes of drawable objects are passed to render systems after all states are updated.
 class ENGINE_API Scene
 {
 public:
@@ -41,6 +51,17 @@ public:
      /// @param[in] delta time since previous loop call, in seconds.
      void loop( float delta );
 
+     /// @brief Select visible objects of all rendered states and record their draw calls.
+     /// @details Render systems only record draw calls into render API here, they are
+     /// executed when render API processes the frame, so it may be done in another thread.
+     void select_objects();
+
+     /// @brief Enable or disable parallel update of scene states and independent subtrees.
+     /// @details States are updated concurrently, so their loop functions must not access
+     /// nodes of other states and must not change the scene tree.
+     /// @param[in] jobs job system for parallel update, nullptr for sequential update (default).
+     void set_parallel_update( JobSystem *jobs ) noexcept;
+
      /// @brief Register new simple scene state.
      /// @param[in] order order value which defines order of state updating.
      /// @param[in] state pointer to scene state.
@@ -84,12 +105,15 @@ private:
      std::map< int, SceneState > states_;    ///< states of this scene with their order.
      SetupFuncPtr setup_func_;               ///< pointer to current scene's setup function.
      LoopFuncPtr loop_func_;                 ///< pointer to current scene's loop function.
+     JobSystem *jobs_;                       ///< job system for parallel update, nullptr for sequential update.
 };
 
 
 /// @brief Get current executing scene.
+/// @details Scene reader activates read scene by placing it here (for example, with Scene::swap),
+/// and profiles execute this scene.
 /// @return Current executing scene.
-static Scene& get_scene();
+ENGINE_API Scene& get_scene();
 
 } // namespace _16nar::constructor2d
 
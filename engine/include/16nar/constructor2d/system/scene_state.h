@@ -6,6 +6,17 @@
 #include <16nar/constructor2d/render/irender_system_2d.h>
 #include <16nar/constructor2d/node_2d.h>
 
+#include <mutex>
+#include <vector>
+
+namespace _16nar
+{
+
+class JobSystem;
+
+} // namespace _16nar
+
+
 namespace _16nar::constructor2d
 {
 
@@ -39,6 +50,16 @@ public:
      /// @brief Get reference to the render system.
      IRenderSystem2D& get_render_system();
 
+     /// @brief Get job system used for the current update.
+     /// @return job system, nullptr if the state is updated sequentially.
+     JobSystem *get_job_system() const noexcept;
+
+     /// @brief Register drawable object in render system and handle its change.
+     /// @details In parallel update changes are collected for each thread and applied
+     /// later by @ref apply_changes, because render system is not thread-safe.
+     /// @param[in] child changed object.
+     void handle_change( Drawable2D *child );
+
      // Member functions not for user to call
 
      /// @brief Execute all objects' setup functions.
@@ -48,7 +69,12 @@ public:
      /// @brief Execute all objects' loop functions.
      /// @details Should not be called by user, unless you are sure about that.
      /// @param[in] delta time since last update, in seconds.
-     void loop( float delta );
+     /// @param[in] jobs job system for parallel update of independent subtrees, nullptr for sequential update.
+     void loop( float delta, JobSystem *jobs = nullptr );
+
+     /// @brief Pass changes collected during parallel update to render system.
+     /// @details Should not be called by user, unless you are sure about that.
+     void apply_changes();
 
      /// @brief Add the node, it will have no parent.
      /// @details After this function is called, new state order must be saved in @b node.
@@ -66,7 +92,16 @@ public:
      std::unique_ptr< Node2D > remove_node( Node2D *node );
 
 private:
+     /// @brief Changed objects collected by one thread.
+     struct ChangeList
+     {
+          std::mutex mutex;                       ///< mutex for threads sharing the list.
+          std::vector< Drawable2D * > children;   ///< changed objects.
+     };
+
      std::unique_ptr< IRenderSystem2D > render_system_;     ///< render system of this state.
+     std::vector< std::unique_ptr< ChangeList > > changes_; ///< changes collected by each thread of job system.
+     JobSystem *jobs_;              ///< job system of current update, nullptr for sequential update.
      NodesSet nodes_;               ///< set of this state's direct children nodes.
      bool updating_;                ///< set if this state will be rendered in game loop.
      bool rendering_;               ///< set if this state will be rendered in game loop.
@@ -0,0 +1,78 @@
+/// @file
+/// @brief Header file with Text2D class definition.
+#ifndef _16NAR_CONSTRUCTOR_2D_TEXT_2D_H
+#define _16NAR_CONSTRUCTOR_2D_TEXT_2D_H
+
+#include <16nar/constructor2d/drawable_node_2d.h>
+
+#include <string>
+#include <vector>
+#include <memory>
+
+namespace _16nar
+{
+
+class GlyphAtlas;
+
+} // namespace _16nar
+
+
+namespace _16nar::constructor2d
+{
+
+/// @brief Node drawing text with glyphs of glyph atlas.
+/// @details Text is drawn with one draw call of triangles, two per glyph, written to stream
+/// buffer every frame. Vertex has position (vec2) and texture coordinates (vec2), texture of the atlas
+/// is bound to the first texture unit after material textures. Shader gets uniform "model_matr".
+/// Glyphs of the text are pinned in the atlas until the text changes, so changing text
+/// only rasterizes glyphs which are not in the atlas yet and never creates textures.
+/// Origin of the node is top left corner of the first line, lines are separated with '\n'.
+class ENGINE_API Text2D : public DrawableNode2D
+{
+public:
+     /// @brief Get parameters of stream buffer for vertices of text.
+     /// @param[in] max_glyphs maximal number of glyphs drawn per frame from the buffer.
+     /// @return parameters for loading stream buffer.
+     static LoadParams< ResourceType::StreamBuffer > get_stream_params( std::size_t max_glyphs );
+
+     /// @brief Constructor.
+     /// @param[in] material material used to draw the text.
+     /// @param[in] stream stream buffer loaded with parameters from @ref get_stream_params,
+     /// it may be shared by texts if it has space for all their glyphs.
+     /// @param[in] atlas atlas with glyphs of the font, it must outlive the text.
+     Text2D( const Material& material, const StreamBuffer& stream, GlyphAtlas& atlas );
+
+     /// @brief Destructor, which releases glyphs of the text.
+     ~Text2D();
+
+     /// @brief Set text to be drawn.
+     /// @param[in] text text in UTF-8, invalid sequences are replaced with U+FFFD.
+     /// @throws std::runtime_error if glyphs of the text do not fit into the atlas, text is not changed then.
+     void set_text( const std::string& text );
+
+     /// @brief Get text drawn by the node.
+     /// @return text in UTF-8.
+     const std::string& get_text() const noexcept;
+
+     /// @copydoc Drawable::get_draw_info() const noexcept
+     DrawInfo get_draw_info() const noexcept override;
+
+     /// @copydoc Drawable2D::get_local_bounds() const
+     FloatRect get_local_bounds() const override;
+
+private:
+     /// @brief Release glyphs of the text in atlas.
+     void release_glyphs() noexcept;
+
+     StreamBuffer stream_;                        ///< stream buffer for vertices.
+     GlyphAtlas& atlas_;                          ///< atlas with glyphs of the font.
+     std::string text_;                           ///< text in UTF-8.
+     std::vector< char32_t > codepoints_;         ///< code points of the text, acquired in atlas.
+     std::shared_ptr< float[] > vertices_;        ///< vertices of glyph quads.
+     std::size_t vertex_count_;                   ///< number of vertices.
+     FloatRect bounds_;                           ///< bounds of the text.
+};
+
+} // namespace _16nar::constructor2d
+
+#endif // #ifndef _16NAR_CONSTRUCTOR_2D_TEXT_2D_H
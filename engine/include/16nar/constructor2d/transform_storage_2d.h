@@ -0,0 +1,206 @@
+/// @file
+/// @brief Header file with TransformStorage2D class definition.
+#ifndef _16NAR_CONSTRUCTOR_2D_TRANSFORM_STORAGE_2D_H
+#define _16NAR_CONSTRUCTOR_2D_TRANSFORM_STORAGE_2D_H
+
+#include <16nar/16nardefs.h>
+#include <16nar/math/vec.h>
+#include <16nar/math/affine_2d.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace _16nar::constructor2d
+{
+
+/// @brief Storage of 2D transformations of all nodes in contiguous arrays.
+/// @details Transformations are kept in hierarchy order: parent is always stored before
+/// its children, and after reordering each subtree occupies a contiguous range. So world
+/// matrices are updated by one linear pass, where parent's world matrix is already known.
+///
+/// World matrices are also cached between updates: each one is recalculated lazily on
+/// request, only when the transformation or one of its ancestors has changed since the
+/// last calculation. Version of the world matrix grows with each recalculation, so objects
+/// may cache data derived from it, like bounding boxes. Each change of the storage starts
+/// a new epoch, and transformations checked in the current epoch are known to be actual
+/// together with their ancestors. So request walks up only to the first checked ancestor,
+/// and request of a checked transformation takes constant time.
+///
+/// Objects refer to transformations by stable handles, while positions in arrays change
+/// when hierarchy is reordered. References returned by getters are valid until next
+/// creation of transformation or update of the storage.
+///
+/// Different transformations may be changed from different threads, but creation,
+/// destruction, reparenting and update must not run concurrently with other calls.
+/// Request of world matrix writes caches only of changed transformations and only reads
+/// actual ones. So ancestors shared by different threads must be calculated before,
+/// and must not be changed while the threads request world matrices. Storage must be
+/// switched to parallel mode while it is used by different threads, requests walk up
+/// to the root and do not mark transformations as checked in this mode.
+class ENGINE_API TransformStorage2D
+{
+public:
+     using Handle = std::uint32_t;
+
+     /// @brief Handle which refers to no transformation, used for objects without parent.
+     static constexpr Handle invalid_handle = ~Handle{ 0 };
+
+     /// @brief Get storage of transformations of scene nodes.
+     /// @return storage of transformations of scene nodes.
+     static TransformStorage2D& instance();
+
+     /// @brief Constructor.
+     TransformStorage2D();
+
+     /// @brief Create identity transformation without parent.
+     /// @return handle of new transformation.
+     Handle create();
+
+     /// @brief Destroy the transformation, its handle may be reused.
+     /// @param[in] handle handle of the transformation.
+     void destroy( Handle handle ) noexcept;
+
+     /// @brief Set parent of the transformation.
+     /// @param[in] handle handle of the transformation.
+     /// @param[in] parent handle of parent transformation, @ref invalid_handle for no parent.
+     void set_parent( Handle handle, Handle parent ) noexcept;
+
+     /// @brief Get parent of the transformation.
+     /// @param[in] handle handle of the transformation.
+     /// @return handle of parent transformation, @ref invalid_handle if there is no parent.
+     Handle get_parent( Handle handle ) const noexcept;
+
+     /// @brief Get position of the transformation.
+     /// @param[in] handle handle of the transformation.
+     /// @return position.
+     const Vec2f& get_position( Handle handle ) const noexcept;
+
+     /// @brief Get rotation of the transformation.
+     /// @param[in] handle handle of the transformation.
+     /// @return clockwise rotation, in degrees.
+     float get_rotation( Handle handle ) const noexcept;
+
+     /// @brief Get scale of the transformation.
+     /// @param[in] handle handle of the transformation.
+     /// @return scale factors.
+     const Vec2f& get_scale( Handle handle ) const noexcept;
+
+     /// @brief Get origin of the transformation.
+     /// @param[in] handle handle of the transformation.
+     /// @return origin point.
+     const Vec2f& get_origin( Handle handle ) const noexcept;
+
+     /// @brief Set position of the transformation.
+     /// @param[in] handle handle of the transformation.
+     /// @param[in] position new position.
+     void set_position( Handle handle, const Vec2f& position ) noexcept;
+
+     /// @brief Set rotation of the transformation.
+     /// @param[in] handle handle of the transformation.
+     /// @param[in] rotation clockwise rotation, in degrees.
+     void set_rotation( Handle handle, float rotation ) noexcept;
+
+     /// @brief Set scale of the transformation.
+     /// @param[in] handle handle of the transformation.
+     /// @param[in] scale scale factors.
+     void set_scale( Handle handle, const Vec2f& scale ) noexcept;
+
+     /// @brief Set origin of the transformation.
+     /// @param[in] handle handle of the transformation.
+     /// @param[in] origin origin point.
+     void set_origin( Handle handle, const Vec2f& origin ) noexcept;
+
+     /// @brief Get local matrix of the transformation, calculated last time.
+     /// @param[in] handle handle of the transformation.
+     /// @return local matrix.
+     const Affine2D& get_local_matr( Handle handle ) const noexcept;
+
+     /// @brief Get world matrix of the transformation.
+     /// @details Cached matrix is recalculated if the transformation or its ancestors
+     /// have changed since the last calculation.
+     /// @param[in] handle handle of the transformation.
+     /// @return world matrix.
+     const Affine2D& get_world_matr( Handle handle ) noexcept;
+
+     /// @brief Get version of cached world matrix, it changes when the matrix is recalculated.
+     /// @param[in] handle handle of the transformation.
+     /// @return version of world matrix.
+     std::uint32_t get_world_version( Handle handle ) const noexcept;
+
+     /// @brief Calculate local matrix of the transformation, if its parameters have changed.
+     /// @param[in] handle handle of the transformation.
+     /// @return true if parameters were changed since the last call, false otherwise.
+     bool calculate_local( Handle handle ) noexcept;
+
+     /// @brief Calculate world matrix by multiplying local matrices of all ancestors.
+     /// @param[in] handle handle of the transformation.
+     /// @param[in] include_self true if local matrix of the transformation is included.
+     /// @return world matrix.
+     Affine2D calculate_world( Handle handle, bool include_self = true ) const noexcept;
+
+     /// @brief Update changed local matrices and world matrices of changed subtrees.
+     /// @details Hierarchy is reordered first if it was changed.
+     void update();
+
+     /// @brief Get number of stored transformations.
+     /// @return number of transformations.
+     std::size_t get_size() const noexcept;
+
+     /// @brief Switch parallel mode, in which the storage may be used by different threads.
+     /// @details Must not be called concurrently with other calls.
+     /// @param[in] parallel true to switch parallel mode on, false to switch it off.
+     void set_parallel( bool parallel ) noexcept;
+
+private:
+     TransformStorage2D( const TransformStorage2D& )            = delete;
+     TransformStorage2D& operator=( const TransformStorage2D& ) = delete;
+
+     /// @brief Flags of transformation state.
+     enum Flags : std::uint8_t
+     {
+          LocalDirty  = 1,              ///< parameters changed, local matrix is outdated.
+          WorldDirty  = 2,              ///< local matrix or parent changed, world matrix is outdated.
+          Transformed = 4               ///< parameters changed since the last @ref calculate_local call.
+     };
+
+     /// @brief Put transformations in depth-first order and remove destroyed ones.
+     void reorder();
+
+     /// @brief Calculate local matrix of transformation at given index.
+     /// @param[in] index index of the transformation in arrays.
+     void calculate_local_at( std::uint32_t index ) noexcept;
+
+     /// @brief Start new epoch, so all transformations have to be checked again.
+     void invalidate_checks() noexcept;
+
+     /// @brief Calculate world matrix at given index, if it or its ancestors have changed.
+     /// @param[in] index index of the transformation in arrays.
+     void calculate_world_at( std::uint32_t index ) noexcept;
+
+     /// @brief Recalculate world matrix at given index, parent's matrix must be actual.
+     /// @param[in] index index of the transformation in arrays.
+     void update_world_at( std::uint32_t index ) noexcept;
+
+private:
+     std::vector< Vec2f > positions_;             ///< positions of transformations.
+     std::vector< Vec2f > origins_;               ///< origin points of transformations.
+     std::vector< Vec2f > scales_;                ///< scale factors of transformations.
+     std::vector< float > rotations_;             ///< rotations of transformations, in degrees.
+     std::vector< Affine2D > local_;              ///< local matrices.
+     std::vector< Affine2D > world_;              ///< world matrices.
+     std::vector< std::uint32_t > parents_;       ///< indices of parents, invalid_handle for roots.
+     std::vector< std::uint8_t > flags_;          ///< flags of transformation state.
+     std::vector< std::uint32_t > versions_;      ///< versions of world matrices.
+     std::vector< std::uint32_t > parent_versions_; ///< versions of parents' world matrices used in calculation.
+     std::vector< std::uint32_t > checked_;       ///< epochs in which world matrices were checked to be actual.
+     std::vector< Handle > handles_;              ///< handles of transformations, invalid_handle if destroyed.
+     std::vector< std::uint32_t > indices_;       ///< indices of transformations by handle.
+     std::vector< Handle > free_handles_;         ///< handles which can be reused.
+     std::uint32_t epoch_;                        ///< current epoch, changes with each change of the storage.
+     bool order_dirty_;                           ///< should transformations be reordered.
+     bool parallel_;                              ///< is the storage used by different threads.
+};
+
+} // namespace _16nar::constructor2d
+
+#endif // #ifndef _16NAR_CONSTRUCTOR_2D_TRANSFORM_STORAGE_2D_H
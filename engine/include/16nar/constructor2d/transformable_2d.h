@@ -5,17 +5,25 @@
 
 #include <16nar/16nardefs.h>
 #include <16nar/math/vec.h>
-#include <16nar/math/transform_matrix.h>
+#include <16nar/math/affine_2d.h>
+#include <16nar/constructor2d/transform_storage_2d.h>
 
 namespace _16nar::constructor2d
 {
 
 /// @brief Base class providing functionality for 2D transformations.
+/// @details Transformation is kept in @ref TransformStorage2D, the object stores only its handle.
 class ENGINE_API Transformable2D
 {
 public:
      /// @brief Default constructor.
-     Transformable2D() noexcept;
+     Transformable2D();
+
+     /// @brief Destructor, releases the transformation.
+     ~Transformable2D();
+
+     Transformable2D( const Transformable2D& )            = delete;
+     Transformable2D& operator=( const Transformable2D& ) = delete;
 
      /// @brief Get current object's position.
      /// @return current object's position.
@@ -35,11 +43,11 @@ public:
 
      /// @brief Get current object's transformation matrix.
      /// @return current object's transformation matrix.
-     const TransformMatrix& get_transform_matr() const noexcept;
+     const Affine2D& get_transform_matr() const noexcept;
 
      /// @brief Get current object's inverse transformation matrix.
      /// @return current object's inverse transformation matrix.
-     TransformMatrix get_inv_transform_matr() const noexcept;
+     Affine2D get_inv_transform_matr() const noexcept;
 
      /// @brief Set current object position.
      /// @param[in] x object's x coordinate.
@@ -94,6 +102,10 @@ public:
      /// @param[in] factors object's scale factor vector.
      void scale( const Vec2f& factor ) noexcept;
 
+     /// @brief Get handle of the transformation in storage.
+     /// @return handle of the transformation.
+     TransformStorage2D::Handle get_transform_handle() const noexcept;
+
 protected:
      /// @brief Calculate transformation matrix, if needed.
      /// @details Transformation matrix is calculated if any parameters
@@ -102,12 +114,7 @@ protected:
      bool calculate_matr() noexcept;
 
 private:
-     TransformMatrix matr_;        ///< matrix with transformation of this object.
-     Vec2f position_;              ///< position of this object.
-     Vec2f origin_;                ///< transformation origin point of this object.
-     Vec2f scale_;                 ///< scale of this object.
-     float rotation_;              ///< clockwise rotation of this object, in degrees.
-	bool transformed_;            ///< indicator of object being transformed.
+     TransformStorage2D::Handle handle_;    ///< handle of this object's transformation.
 };
 
 } // namespace _16nar::constructor2d
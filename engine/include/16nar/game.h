@@ -16,6 +16,7 @@ namespace _16nar
 
 class IProfile;
 class IRenderApi;
+class JobSystem;
 class ISceneReader;
 class Window;
 
@@ -79,6 +80,11 @@ public:
      /// @details The application will fail if window is not set when calling this function.
      Window& get_window() noexcept;
 
+     /// @brief Check if window of the game is set.
+     /// @details Headless game, for example with null render API, has no window.
+     /// @return true if window is set, false otherwise.
+     bool has_window() const noexcept;
+
      /// @brief Get reader of the game's scenes.
      /// @return reader of the game's scenes.
      /// @details The application will fail if scene reader is not set when calling this function.
@@ -88,6 +94,10 @@ public:
      /// @return package manager of the game.
      PackageManager& get_pkg_manager() noexcept;
 
+     /// @brief Get job system of the game, shared by all engine systems.
+     /// @return job system of the game.
+     JobSystem& get_job_system() noexcept;
+
 private:
      Game( const Game& )               = delete;
      void operator=( const Game& )     = delete;
@@ -99,6 +109,7 @@ private:
      static bool initialized_;                         ///< engine initialization status.
      static GameConfig config_;                        ///< common application configuration.
 
+     std::unique_ptr< JobSystem > job_system_;         ///< job system of the game.
      std::unique_ptr< PackageManager > pkg_manager_;   ///< package manager of the game.
      std::unique_ptr< IProfile > profile_;             ///< profile of selected architecture.
      std::unique_ptr< IRenderApi > render_api_;        ///< render API for drawing game objects.
@@ -0,0 +1,162 @@
+/// @file Header file with Affine2D class declaration.
+#ifndef _16NAR_AFFINE_2D_H
+#define _16NAR_AFFINE_2D_H
+
+#include <16nar/16nardefs.h>
+#include <16nar/math/vec.h>
+#include <16nar/math/rectangle.h>
+#include <16nar/math/transform_matrix.h>
+
+namespace _16nar
+{
+
+/// @brief Affine transformation matrix (2x3) for 2D transformations.
+/// @details Keeps only linear part and translation, so it is much smaller and faster
+/// than TransformMatrix. Has the same semantics as 2D API of TransformMatrix, and is
+/// converted to it only when passed to shaders.
+class ENGINE_API Affine2D
+{
+public:
+     /// @brief Constructor which makes identity matrix.
+     Affine2D() noexcept : m_{ 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f } {}
+
+     /// @brief Constructor which makes matrix of values.
+     /// @param[in] x0 value (0, 0).
+     /// @param[in] y0 value (0, 1).
+     /// @param[in] x1 value (1, 0).
+     /// @param[in] y1 value (1, 1).
+     /// @param[in] x2 value (2, 0), translation along X axis.
+     /// @param[in] y2 value (2, 1), translation along Y axis.
+     Affine2D( float x0, float y0, float x1, float y1, float x2, float y2 ) noexcept:
+          m_{ x0, y0, x1, y1, x2, y2 }
+     {}
+
+     /// @brief Make matrix of translation, clockwise rotation and scale.
+     /// @details Result is the same as of Affine2D{}.move( position ).rotate( angle ).scale( factors ),
+     /// but it is calculated without matrix multiplications.
+     /// @param[in] position translation.
+     /// @param[in] angle rotation angle, in radians.
+     /// @param[in] factors scale factors.
+     /// @return transformation matrix.
+     static Affine2D compose( const Vec2f& position, float angle, const Vec2f& factors ) noexcept;
+
+     /// @brief Get element of matrix (const).
+     /// @param[in] i index of a column.
+     /// @param[in] j index of a row.
+     /// @return element of matrix.
+     inline const float& get( std::size_t i, std::size_t j ) const noexcept
+     {
+          return m_[ i * 2 + j ];
+     }
+
+     /// @brief Get element of matrix.
+     /// @param[in] i index of a column.
+     /// @param[in] j index of a row.
+     /// @return element of matrix.
+     inline float& get( std::size_t i, std::size_t j ) noexcept
+     {
+          return m_[ i * 2 + j ];
+     }
+
+     /// @brief Multiply-assignment operator.
+     /// @param[in] other other matrix to be multiplied.
+     /// @return product of matrices.
+     Affine2D& operator*=( const Affine2D& other ) noexcept;
+
+     /// @brief Vector multiplication operator.
+     /// @param[in] vector right operand, a point.
+     /// @return transformed vector.
+     inline Vec2f operator*( const Vec2f& vector ) const noexcept
+     {
+          return Vec2f{ m_[ 0 ] * vector.x() + m_[ 2 ] * vector.y() + m_[ 4 ],
+                        m_[ 1 ] * vector.x() + m_[ 3 ] * vector.y() + m_[ 5 ] };
+     }
+
+     /// @brief Rectangle multiplication operator.
+     /// @details Keeps rectangle axis aligned, made of bounds of transformed rectangle.
+     /// Center and half size are transformed instead of four corners.
+     /// @param[in] rect right operand.
+     /// @return transformed rectangle.
+     FloatRect operator*( const FloatRect& rect ) const noexcept;
+
+     /// @brief Get determinant of the matrix.
+     /// @return determinant of the matrix.
+     inline float det() const noexcept
+     {
+          return m_[ 0 ] * m_[ 3 ] - m_[ 2 ] * m_[ 1 ];
+     }
+
+     /// @brief Get inverse matrix.
+     /// @return inverse matrix.
+     Affine2D inv() const noexcept;
+
+     /// @brief Get matrix (4x4) with the same transformation, to be passed to shaders.
+     /// @return transformation matrix (4x4).
+     TransformMatrix to_matr() const noexcept;
+
+     /// @brief Get underlying matrix data, columns are stored one after another.
+     /// @return underlying matrix data.
+     inline const float *data() const noexcept
+     {
+          return m_;
+     }
+
+     /// @brief Check equality of matrices with given precision.
+     /// @param[in] mat matrix to check equality.
+     /// @param[in] precision precision to compare with.
+     /// @return true if matrices are equal with precision, false otherwise.
+     bool equals( const Affine2D& mat, float precision = 0.0f ) const noexcept;
+
+     /// @brief Add translation.
+     /// @param[in] offset move offset.
+     /// @return current matrix after movement.
+     Affine2D& move( const Vec2f& offset ) noexcept;
+
+     /// @brief Add scale.
+     /// @param[in] factors scale factors.
+     /// @return current matrix after scale.
+     Affine2D& scale( const Vec2f& factors ) noexcept;
+
+     /// @brief Add scale with a pivot.
+     /// @param[in] factors scale factors.
+     /// @param[in] pivot transform origin point.
+     /// @return current matrix after scale.
+     Affine2D& scale( const Vec2f& factors, const Vec2f& pivot ) noexcept;
+
+     /// @brief Add clockwise rotation.
+     /// @param[in] angle rotation angle, in radians.
+     /// @return current matrix after rotation.
+     Affine2D& rotate( float angle ) noexcept;
+
+     /// @brief Add clockwise rotation with a pivot.
+     /// @param[in] angle rotation angle, in radians.
+     /// @param[in] pivot transform origin point.
+     /// @return current matrix after rotation.
+     Affine2D& rotate( float angle, const Vec2f& pivot ) noexcept;
+
+private:
+     float m_[ 6 ];      ///< columns of linear part, then translation.
+};
+
+
+/// @brief Matrix multiplication operator.
+/// @param[in] lhs left operand.
+/// @param[in] rhs right operand.
+/// @return matrix product.
+ENGINE_API Affine2D operator*( const Affine2D& lhs, const Affine2D& rhs ) noexcept;
+
+/// @brief Matrix comprasion operator.
+/// @param[in] lhs left operand.
+/// @param[in] rhs right operand.
+/// @return true if matrices are equal, false otherwise.
+ENGINE_API bool operator==( const Affine2D& lhs, const Affine2D& rhs ) noexcept;
+
+/// @brief Matrix inverse comprasion operator.
+/// @param[in] lhs left operand.
+/// @param[in] rhs right operand.
+/// @return true if matrices are not equal, false otherwise.
+ENGINE_API bool operator!=( const Affine2D& lhs, const Affine2D& rhs ) noexcept;
+
+} // namespace _16nar
+
+#endif // #ifndef _16NAR_AFFINE_2D_H
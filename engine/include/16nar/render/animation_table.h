@@ -0,0 +1,64 @@
+/// @file
+/// @brief Header file with AnimationTable class definition.
+#ifndef _16NAR_ANIMATION_TABLE_H
+#define _16NAR_ANIMATION_TABLE_H
+
+#include <16nar/render/render_defs.h>
+
+#include <vector>
+#include <chrono>
+
+namespace _16nar
+{
+
+/// @brief Get frame of animation clip shown after given time since start of playback.
+/// @details This is the same selection as the one made by shader, see AnimationBlock.
+/// @param[in] clip animation clip.
+/// @param[in] elapsed time since start of playback, in seconds.
+/// @return index of frame in the clip (not in the frame table), 0 for empty clip.
+ENGINE_API std::size_t get_animation_frame( const AnimationClip& clip, float elapsed ) noexcept;
+
+
+/// @brief Table of frames of all animation clips, stored in uniform buffer "Animation".
+/// @details Frames of clips are written to the buffer once, when clip is added,
+/// after that only time is written every frame, so animated objects are not updated
+/// on CPU while they play the same clip.
+class ENGINE_API AnimationTable
+{
+public:
+     /// @brief Constructor, time starts from 0.
+     AnimationTable();
+
+     /// @brief Add clip to the table.
+     /// @details Uniform buffer is created on the first call. Frames must not be rotated.
+     /// @param[in] frames regions of texture, all of them must have the same texture.
+     /// @param[in] frame_rate number of frames per second.
+     /// @param[in] loop does the clip start again after the last frame.
+     /// @throws std::runtime_error if frames are wrong or there is no space for them.
+     /// @return added clip.
+     AnimationClip add_clip( const std::vector< TextureRegion >& frames, float frame_rate, bool loop = true );
+
+     /// @brief Get time of animations.
+     /// @return time since construction or reset of the table, in seconds.
+     float get_time() const noexcept;
+
+     /// @brief Write current time to the uniform buffer.
+     /// @details It is called by render system once per frame. Nothing is done if there are no clips.
+     void update();
+
+     /// @brief Remove all clips, unload uniform buffer and start time from 0.
+     void reset();
+
+     /// @brief Get number of frames of all clips.
+     /// @return number of frames in the table.
+     std::size_t get_frame_count() const noexcept;
+
+private:
+     std::chrono::steady_clock::time_point start_;     ///< time point of construction or reset.
+     UniformBuffer buffer_;                            ///< uniform buffer with frames and time.
+     std::size_t frame_count_;                         ///< number of frames in the table.
+};
+
+} // namespace _16nar
+
+#endif // #ifndef _16NAR_ANIMATION_TABLE_H
@@ -4,7 +4,7 @@
 #define _16NAR_CAMERA_2D_H
 
 #include <16nar/math/rectangle.h>
-#include <16nar/math/transform_matrix.h>
+#include <16nar/math/affine_2d.h>
 
 namespace _16nar
 {
@@ -77,18 +77,18 @@ public:
 
      /// @brief Get camera transformation matrix.
      /// @return camera transformation matrix.
-     const TransformMatrix& get_transform_matr() const noexcept;
+     const Affine2D& get_transform_matr() const noexcept;
 
      /// @brief Get camera inverse transformation matrix.
      /// @return camera inverse transformation matrix.
-     TransformMatrix get_inverse_transform_matr() const noexcept;
+     Affine2D get_inverse_transform_matr() const noexcept;
 
 private:
      /// @brief Do calculations of transofrmation matrix and global bounds.
      void params_calculate() noexcept;
 
 private:
-     TransformMatrix matr_;        ///< transformation matrix of the view.
+     Affine2D matr_;               ///< transformation matrix of the view.
      FloatRect global_bounds_;     ///< bounding rectangle of the camera in the world.
      Vec2f center_;                ///< view rectangle of the camera.
      float half_width_;            ///< half of width of camera rectangle.
@@ -34,8 +34,18 @@ public:
      /// @return shader of the object.
      const Shader& get_shader() const noexcept;
 
+     /// @brief Get material of the object.
+     /// @return material of the object, its ID is 0 if the object is drawn with shader only.
+     const Material& get_material() const noexcept;
+
+     /// @brief Set material of the object.
+     /// @details If material is set, it is used for rendering instead of shader.
+     /// @param[in] material material of the object.
+     void set_material( const Material& material ) noexcept;
+
 protected:
      Shader shader_;          ///< shader for rendering this object.
+     Material material_;      ///< material for rendering this object.
      bool visible_ = true;    ///< visibility of the object.
 };
 
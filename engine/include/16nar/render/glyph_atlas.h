@@ -0,0 +1,140 @@
+/// @file
+/// @brief Header file with GlyphAtlas class definition.
+#ifndef _16NAR_GLYPH_ATLAS_H
+#define _16NAR_GLYPH_ATLAS_H
+
+#include <16nar/render/render_defs.h>
+
+#include <list>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace _16nar
+{
+
+namespace tools
+{
+
+class FontRasterizer;
+
+} // namespace tools
+
+
+/// @brief Cells of glyph atlas, assigned to glyphs on demand.
+/// @details Glyph is pinned while it has users, so its cell is not reassigned.
+/// When there is no free cell, the least recently released glyph is evicted.
+class ENGINE_API GlyphCells
+{
+public:
+     /// @brief Constructor.
+     /// @param[in] count number of cells.
+     explicit GlyphCells( std::size_t count );
+
+     /// @brief Get cell of the glyph and add a user to it.
+     /// @param[in] codepoint code point of the glyph.
+     /// @throws std::runtime_error if all cells are pinned.
+     /// @return index of the cell and true if the glyph was assigned to it by this call,
+     /// so its image must be written to the cell.
+     std::pair< std::size_t, bool > acquire( char32_t codepoint );
+
+     /// @brief Remove a user of the glyph, glyph without users may be evicted.
+     /// @param[in] codepoint code point of the glyph, nothing is done if it has no cell or no users.
+     void release( char32_t codepoint ) noexcept;
+
+     /// @brief Check if the glyph has a cell.
+     /// @param[in] codepoint code point of the glyph.
+     /// @return true if the glyph has a cell, false otherwise.
+     bool contains( char32_t codepoint ) const noexcept;
+
+     /// @brief Get number of users of the glyph.
+     /// @param[in] codepoint code point of the glyph.
+     /// @return number of users, 0 if the glyph has no cell.
+     std::size_t get_users( char32_t codepoint ) const noexcept;
+
+     /// @brief Get number of cells.
+     /// @return number of cells.
+     std::size_t get_count() const noexcept;
+
+     /// @brief Free all cells.
+     void clear() noexcept;
+
+private:
+     /// @brief State of a cell.
+     struct Cell
+     {
+          char32_t codepoint = 0;                           ///< code point of the glyph in the cell.
+          std::size_t users = 0;                            ///< number of users of the glyph.
+          bool assigned = false;                            ///< does the cell contain a glyph.
+          std::list< std::size_t >::iterator unpinned;      ///< position in list of unpinned cells, if users == 0.
+     };
+
+     std::vector< Cell > cells_;                            ///< all cells.
+     std::list< std::size_t > unpinned_;                    ///< cells without users, least recently released first.
+     std::unordered_map< char32_t, std::size_t > glyphs_;   ///< cells of glyphs.
+};
+
+
+/// @brief Glyph placed in atlas texture.
+struct Glyph
+{
+     TextureRegion region;         ///< region of atlas texture with image of the glyph.
+     Vec2f offset;                 ///< position of top left corner of the image relative to pen on baseline.
+     Vec2f size;                   ///< size of the image in pixels.
+     float advance = 0.0f;         ///< horizontal distance to pen position of the next glyph.
+};
+
+
+/// @brief Texture with glyphs of one font, rasterized on demand.
+/// @details Texture is divided into square cells of line height. Glyph image is rasterized
+/// and written to its cell when the glyph is acquired the first time, and is kept in texture
+/// while the glyph has users. Unused glyphs are evicted when new ones need space,
+/// so changing text does not create textures. Texture has white color and coverage in alpha channel.
+class ENGINE_API GlyphAtlas
+{
+public:
+     /// @brief Constructor.
+     /// @param[in] font rasterizer of font glyphs.
+     /// @param[in] texture_size width and height of atlas texture in texels.
+     /// @throws std::runtime_error if texture cannot contain even one glyph.
+     GlyphAtlas( std::shared_ptr< const tools::FontRasterizer > font, int texture_size = 512 );
+
+     /// @brief Get glyph and pin it in the atlas, texture is loaded on first call.
+     /// @param[in] codepoint code point of the glyph.
+     /// @throws std::runtime_error if all cells are used by other glyphs.
+     /// @return glyph placed in the atlas, valid until the glyph is released.
+     const Glyph& acquire( char32_t codepoint );
+
+     /// @brief Release glyph acquired before.
+     /// @param[in] codepoint code point of the glyph.
+     void release( char32_t codepoint ) noexcept;
+
+     /// @brief Get rasterizer of the font.
+     /// @return rasterizer of the font.
+     const tools::FontRasterizer& get_font() const noexcept;
+
+     /// @brief Get atlas texture.
+     /// @return atlas texture, its ID is 0 before the first glyph is acquired.
+     Texture get_texture() const noexcept;
+
+     /// @brief Get number of glyphs which can be placed in the atlas at the same time.
+     /// @return number of cells.
+     std::size_t get_capacity() const noexcept;
+
+     /// @brief Unload atlas texture and forget all glyphs, glyphs must not be used anymore.
+     void reset();
+
+private:
+     std::shared_ptr< const tools::FontRasterizer > font_;  ///< rasterizer of the font.
+     int texture_size_;                                     ///< size of atlas texture.
+     int cell_size_;                                        ///< size of a cell, including padding.
+     int cells_per_row_;                                    ///< number of cells in a row of texture.
+     GlyphCells cells_;                                     ///< cells assigned to glyphs.
+     std::vector< Glyph > glyphs_;                          ///< glyphs placed in cells.
+     Texture texture_;                                      ///< atlas texture.
+};
+
+} // namespace _16nar
+
+#endif // #ifndef _16NAR_GLYPH_ATLAS_H
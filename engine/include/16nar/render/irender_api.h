@@ -36,6 +36,15 @@ public:
      /// Current implementations may throw ResourceException.
      virtual void unload( const Resource& resource ) = 0;
 
+     /// @brief Update a part of loaded resource in place.
+     /// @details Update is applied in the same frame as loads requested
+     /// at the same time, after the loads.
+     /// @param[in] resource identifier of a resource with type.
+     /// @param[in] params parameters for updating a resource.
+     /// @throws May throw implementation-defined exceptions.
+     /// Current implementations may throw ResourceException.
+     virtual void update( const Resource& resource, const std::any& params ) = 0;
+
      /// @brief Get render device of current graphics API.
      /// @return render device of current graphics API.
      virtual IRenderDevice& get_device() const noexcept = 0;
@@ -52,6 +52,47 @@ public:
      /// @throws May throw implementation-defined exceptions.
      virtual void set_shader_params( const ShaderSetupFunction& setup ) = 0;
 
+     /// @brief Set uniforms of one object to currently bound shader program.
+     /// @param[in] uniforms values of uniforms.
+     /// @throws May throw implementation-defined exceptions.
+     virtual void set_object_uniforms( const ObjectUniforms& uniforms ) = 0;
+
+     /// @brief Bind material: its shader program, uniform values and textures.
+     /// @details Material textures occupy first texture units, textures of render
+     /// parameters are bound after them. Binding the same material again does nothing,
+     /// binding a shader resets current material. Material ID 0 can be specified
+     /// to reset current material.
+     /// @param[in] material target material resource identifier.
+     /// @throws May throw implementation-defined exceptions.
+     /// Current implementations may throw ResourceException.
+     virtual void bind_material( const Material& material ) = 0;
+
+     /// @brief Write data to the uniform buffer.
+     /// @details Data may be read in other thread and in other frame,
+     /// so it must not be modified after the call.
+     /// @param[in] buffer target uniform buffer resource identifier.
+     /// @param[in] offset offset of written data in the buffer, in bytes.
+     /// @param[in] size size of written data, in bytes.
+     /// @param[in] data data to be written.
+     /// @throws May throw implementation-defined exceptions.
+     /// Current implementations may throw ResourceException.
+     virtual void update_uniform_buffer( const UniformBuffer& buffer, std::size_t offset,
+          std::size_t size, const DataSharedPtr& data ) = 0;
+
+     /// @brief Append vertex data to the stream buffer.
+     /// @details Data is written to the region of current frame, after the data
+     /// appended earlier in this frame. Returned offset is used in RenderParams
+     /// for drawing the appended vertices. Data may be read in other thread and
+     /// in other frame, so it must not be modified after the call.
+     /// @param[in] buffer target stream buffer resource identifier.
+     /// @param[in] size size of appended data, in bytes, must contain whole vertices.
+     /// @param[in] data data to be appended.
+     /// @return offset of appended data in the region of current frame, in bytes.
+     /// @throws May throw implementation-defined exceptions.
+     /// Current implementations may throw ResourceException.
+     virtual std::size_t append_stream_data( const StreamBuffer& buffer, std::size_t size,
+          const DataSharedPtr& data ) = 0;
+
      /// @brief Bind framebuffer for rendering.
      /// @details Framebuffer ID 0 can be specified to bind default framebuffer.
      /// @param[in] framebuffer target framebuffer resource identifier.
@@ -33,6 +33,14 @@ public:
      /// Current implementations may throw ResourceException.
      virtual void unload( ResID id ) = 0;
 
+     /// @brief Request updating a part of loaded resource in place.
+     /// @details Resource keeps its ID, only given part of its data is replaced.
+     /// @param[in] id ID of resource to be updated.
+     /// @param[in] params parameters of updating the resource.
+     /// @throws May throw implementation-defined exceptions.
+     /// Current implementations may throw ResourceException.
+     virtual void update( ResID id, const std::any& params ) = 0;
+
      /// @brief Unload all resources.
      virtual void clear() = 0;
 
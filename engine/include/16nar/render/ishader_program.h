@@ -14,6 +14,41 @@ namespace _16nar
 
 class TransformMatrix;
 
+/// @brief Identifier of a shader program uniform.
+/// @details Identifier is a hash of uniform name, so it does not depend on
+/// shader program and can be computed at compile time.
+enum class UniformId : uint32_t {};
+
+
+/// @brief Get identifier of a uniform by its name.
+/// @details FNV-1a hash of the name is used.
+/// @param[in] name name of the uniform.
+/// @return identifier of the uniform.
+constexpr UniformId get_uniform_id( std::string_view name ) noexcept
+{
+     uint32_t hash = 2166136261u;
+     for ( char c : name )
+     {
+          hash = ( hash ^ static_cast< uint8_t >( c ) ) * 16777619u;
+     }
+     return static_cast< UniformId >( hash );
+}
+
+
+/// @brief Identifiers of uniforms set by the engine.
+namespace uniform_ids
+{
+
+constexpr UniformId view_matr = get_uniform_id( "view_matr" );    ///< view matrix of the camera.
+constexpr UniformId proj_matr = get_uniform_id( "proj_matr" );    ///< projection matrix of the camera.
+constexpr UniformId model_matr = get_uniform_id( "model_matr" );  ///< model matrix of the object.
+constexpr UniformId animation_clip = get_uniform_id( "animation_clip" );  ///< clip of animated object, see AnimationBlock.
+constexpr UniformId animation_loop = get_uniform_id( "animation_loop" );  ///< is the clip of animated object looped.
+constexpr UniformId particle_size = get_uniform_id( "particle_size" );    ///< size of quad of one particle.
+
+} // namespace uniform_ids
+
+
 /// @brief Interface for shader programs.
 /// @details This interface should be used to load various parameters to
 /// shader programs. Compilation and linking of shader program is out of scope of
@@ -55,6 +90,39 @@ public:
 
      /// @copydoc IShaderProgram::set_uniform(std::string_view, float) const noexcept
      virtual void set_uniform( std::string_view name, const TransformMatrix& value ) const noexcept = 0;
+
+     /// @brief Set value of the uniform.
+     /// @details Unlike setting by name, no string operations are performed.
+     /// @param[in] id identifier of the uniform.
+     /// @param[in] value value of the uniform.
+     virtual void set_uniform( UniformId id, float value ) const noexcept = 0;
+
+     /// @copydoc IShaderProgram::set_uniform(UniformId, float) const noexcept
+     virtual void set_uniform( UniformId id, int value ) const noexcept = 0;
+
+     /// @copydoc IShaderProgram::set_uniform(UniformId, float) const noexcept
+     virtual void set_uniform( UniformId id, bool value ) const noexcept = 0;
+
+     /// @copydoc IShaderProgram::set_uniform(UniformId, float) const noexcept
+     virtual void set_uniform( UniformId id, const Vec2i& value ) const noexcept = 0;
+
+     /// @copydoc IShaderProgram::set_uniform(UniformId, float) const noexcept
+     virtual void set_uniform( UniformId id, const Vec2f& value ) const noexcept = 0;
+
+     /// @copydoc IShaderProgram::set_uniform(UniformId, float) const noexcept
+     virtual void set_uniform( UniformId id, const Vec3i& value ) const noexcept = 0;
+
+     /// @copydoc IShaderProgram::set_uniform(UniformId, float) const noexcept
+     virtual void set_uniform( UniformId id, const Vec3f& value ) const noexcept = 0;
+
+     /// @copydoc IShaderProgram::set_uniform(UniformId, float) const noexcept
+     virtual void set_uniform( UniformId id, const Vec4i& value ) const noexcept = 0;
+
+     /// @copydoc IShaderProgram::set_uniform(UniformId, float) const noexcept
+     virtual void set_uniform( UniformId id, const Vec4f& value ) const noexcept = 0;
+
+     /// @copydoc IShaderProgram::set_uniform(UniformId, float) const noexcept
+     virtual void set_uniform( UniformId id, const TransformMatrix& value ) const noexcept = 0;
 };
 
 } // namespace _16nar
@@ -0,0 +1,60 @@
+/// @file
+/// @brief File with RenderApi class definition for null render API.
+#ifndef _16NAR_NULL_RENDER_API_H
+#define _16NAR_NULL_RENDER_API_H
+
+#include <16nar/render/irender_api.h>
+
+#include <16nar/render/iresource_manager.h>
+#include <16nar/render/irender_device.h>
+#include <16nar/render/render_defs.h>
+
+namespace _16nar::null
+{
+
+class RenderDevice;
+
+/// @brief Render API which does not use any graphics API.
+/// @details Resources are kept in memory as their loading parameters, render device
+/// records its calls, see @ref RenderDevice. It needs neither window nor graphics context,
+/// so it is used for headless runs, benchmarks of CPU side of rendering and tests.
+class ENGINE_API RenderApi : public IRenderApi
+{
+public:
+     /// @brief Constructor.
+     /// @details Null render API behaves the same way with any profile, all calls take effect immediately.
+     /// @param[in] profile type of profile used in application.
+     /// @throws std::runtime_error.
+     RenderApi( ProfileType profile );
+
+     /// @copydoc IRenderApi::load(ResourceType, const std::any&)
+     virtual Resource load( ResourceType type, const std::any& params ) override;
+
+     /// @copydoc IRenderApi::unload(const Resource&)
+     virtual void unload( const Resource& resource ) override;
+
+     /// @copydoc IRenderApi::update(const Resource&, const std::any&)
+     virtual void update( const Resource& resource, const std::any& params ) override;
+
+     /// @copydoc IRenderApi::get_device() const noexcept
+     virtual IRenderDevice& get_device() const noexcept override;
+
+     /// @copydoc IRenderApi::process()
+     virtual void process() override;
+
+     /// @copydoc IRenderApi::end_frame()
+     virtual void end_frame() override;
+
+     /// @brief Get render device with recorded commands and counters.
+     /// @return recording render device.
+     RenderDevice& get_recording_device() const noexcept;
+
+     /// @brief Get number of loaded resources of given type.
+     /// @param[in] type type of resources.
+     /// @return number of loaded resources, 0 for types which are not render resources.
+     std::size_t get_resource_count( ResourceType type ) const noexcept;
+};
+
+} // namespace _16nar::null
+
+#endif // _16NAR_NULL_RENDER_API_H
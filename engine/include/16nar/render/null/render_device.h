@@ -0,0 +1,165 @@
+/// @file
+/// @brief File with RenderDevice class definition for null render API.
+#ifndef _16NAR_NULL_RENDER_DEVICE_H
+#define _16NAR_NULL_RENDER_DEVICE_H
+
+#include <16nar/render/irender_device.h>
+#include <16nar/render/null/resource_manager.h>
+
+#include <array>
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
+
+namespace _16nar::null
+{
+
+/// @brief Type of recorded render device call.
+enum class CommandType : uint8_t
+{
+     Render,                  ///< draw from vertex buffer.
+     RenderStream,            ///< draw from stream buffer.
+     SetViewport,             ///< set viewport.
+     SetDepthTest,            ///< set state of depth testing.
+     BindShader,              ///< bind shader program.
+     SetShaderParams,         ///< set uniforms of bound shader program.
+     BindMaterial,            ///< bind material, recorded only if it differs from bound one.
+     UpdateUniformBuffer,     ///< write data to uniform buffer.
+     AppendStreamData,        ///< append data to stream buffer.
+     BindFramebuffer,         ///< bind framebuffer.
+     Clear,                   ///< clear bound framebuffer.
+     EndFrame                 ///< end of frame.
+};
+
+
+/// @brief Recorded render device call.
+/// @details Meaning of arguments depends on type of the call:
+/// - Render, RenderStream: primitive type, vertex count, instance count, stream offset;
+/// - SetViewport: x, y, width, height (signed values are stored as unsigned);
+/// - SetDepthTest: enable;
+/// - SetShaderParams: number of set uniforms;
+/// - UpdateUniformBuffer: offset, size;
+/// - AppendStreamData: size, returned offset;
+/// - Clear: color, depth, stencil.
+struct RenderCommand
+{
+     CommandType type = CommandType::EndFrame;    ///< type of the call.
+     ResID resource = 0;                          ///< identifier of used resource, 0 if there is no such.
+     std::array< uint32_t, 4 > args{};            ///< arguments of the call.
+};
+
+
+/// @brief Counters of render device calls since creation or reset.
+struct RenderCounters
+{
+     std::size_t frames = 0;                 ///< number of ended frames.
+     std::size_t draw_calls = 0;             ///< number of draw calls.
+     std::size_t vertices = 0;               ///< number of drawn vertices of all instances.
+     std::size_t instances = 0;              ///< number of drawn instances.
+     std::size_t shader_binds = 0;           ///< number of bound shaders, except of shader 0.
+     std::size_t material_binds = 0;         ///< number of bound materials which changed state.
+     std::size_t texture_binds = 0;          ///< number of textures and texture arrays bound by draw calls.
+     std::size_t framebuffer_binds = 0;      ///< number of bound framebuffers.
+     std::size_t uniforms = 0;               ///< number of uniforms set by shader setup functions.
+     std::size_t uniform_buffer_bytes = 0;   ///< number of bytes written to uniform buffers.
+     std::size_t stream_bytes = 0;           ///< number of bytes appended to stream buffers.
+     std::size_t clears = 0;                 ///< number of framebuffer clears.
+};
+
+
+/// @brief Render device which does not draw, but records its calls.
+/// @details Resources are checked the same way as in OpenGL render device, so errors
+/// in usage of resources are detected. Shader setup functions are called with a shader
+/// program which only counts uniforms. Recording is disabled by default, so long headless
+/// runs do not accumulate commands, and is enabled by tests. Recorded commands are accumulated
+/// until reset, counters are updated anyway.
+class ENGINE_API RenderDevice : public IRenderDevice
+{
+public:
+     /// @brief Constructor.
+     /// @param[in] managers resource managers of null render API.
+     RenderDevice( const ResourceManagerMap& managers );
+
+     /// @copydoc IRenderDevice::render(const RenderParams&)
+     virtual void render( const RenderParams& params ) override;
+
+     /// @copydoc IRenderDevice::set_viewport(const IntRect&)
+     virtual void set_viewport( const IntRect& rect ) override;
+
+     /// @copydoc IRenderDevice::set_depth_test_state(bool)
+     virtual void set_depth_test_state( bool enable ) override;
+
+     /// @copydoc IRenderDevice::bind_shader(const Shader&)
+     virtual void bind_shader( const Shader& shader ) override;
+
+     /// @copydoc IRenderDevice::set_shader_params(const ShaderSetupFunction&)
+     virtual void set_shader_params( const ShaderSetupFunction& setup ) override;
+
+     /// @copydoc IRenderDevice::set_object_uniforms(const ObjectUniforms&)
+     virtual void set_object_uniforms( const ObjectUniforms& uniforms ) override;
+
+     /// @copydoc IRenderDevice::bind_material(const Material&)
+     virtual void bind_material( const Material& material ) override;
+
+     /// @copydoc IRenderDevice::update_uniform_buffer(const UniformBuffer&, std::size_t, std::size_t, const DataSharedPtr&)
+     virtual void update_uniform_buffer( const UniformBuffer& buffer, std::size_t offset,
+          std::size_t size, const DataSharedPtr& data ) override;
+
+     /// @copydoc IRenderDevice::append_stream_data(const StreamBuffer&, std::size_t, const DataSharedPtr&)
+     virtual std::size_t append_stream_data( const StreamBuffer& buffer, std::size_t size,
+          const DataSharedPtr& data ) override;
+
+     /// @copydoc IRenderDevice::bind_framebuffer(const FrameBuffer&)
+     virtual void bind_framebuffer( const FrameBuffer& framebuffer ) override;
+
+     /// @copydoc IRenderDevice::clear(bool, bool, bool)
+     virtual void clear( bool color, bool depth, bool stencil ) override;
+
+     /// @copydoc IRenderDevice::end_frame()
+     virtual void end_frame() override;
+
+     /// @brief Enable or disable recording of commands, it is disabled by default.
+     /// @param[in] recording should the commands be recorded.
+     void set_recording( bool recording ) noexcept;
+
+     /// @brief Check if commands are recorded.
+     /// @return true if commands are recorded, false otherwise.
+     bool is_recording() const noexcept;
+
+     /// @brief Get recorded commands.
+     /// @return commands in order of calls.
+     const std::vector< RenderCommand >& get_commands() const noexcept;
+
+     /// @brief Get counters of calls.
+     /// @return counters of calls.
+     const RenderCounters& get_counters() const noexcept;
+
+     /// @brief Remove recorded commands and reset counters.
+     void reset() noexcept;
+
+private:
+     /// @brief Record command, if recording is enabled.
+     /// @param[in] type type of the call.
+     /// @param[in] resource identifier of used resource.
+     /// @param[in] args arguments of the call.
+     void record( CommandType type, ResID resource, const std::array< uint32_t, 4 >& args = {} );
+
+     const ResourceManager< ResourceType::Texture > *textures_;              ///< manager of textures.
+     const ResourceManager< ResourceType::TextureArray > *texture_arrays_;   ///< manager of texture arrays.
+     const ResourceManager< ResourceType::VertexBuffer > *vertex_buffers_;   ///< manager of vertex buffers.
+     const ResourceManager< ResourceType::Shader > *shaders_;                ///< manager of shaders.
+     const ResourceManager< ResourceType::FrameBuffer > *framebuffers_;      ///< manager of framebuffers.
+     const ResourceManager< ResourceType::Material > *materials_;            ///< manager of materials.
+     const ResourceManager< ResourceType::UniformBuffer > *uniform_buffers_; ///< manager of uniform buffers.
+     const ResourceManager< ResourceType::StreamBuffer > *stream_buffers_;   ///< manager of stream buffers.
+     std::vector< RenderCommand > commands_;                                 ///< recorded commands.
+     RenderCounters counters_;                                               ///< counters of calls.
+     std::unordered_map< ResID, std::size_t > stream_offsets_;               ///< free offsets in stream buffers in this frame.
+     Material current_material_;                                             ///< currently bound material.
+     bool shader_bound_;                                                     ///< is any shader program bound.
+     bool recording_;                                                        ///< are commands recorded.
+};
+
+} // namespace _16nar::null
+
+#endif // #ifndef _16NAR_NULL_RENDER_DEVICE_H
@@ -0,0 +1,84 @@
+/// @file
+/// @brief File with ResourceManager class definition for null render API.
+#ifndef _16NAR_NULL_RESOURCE_MANAGER_H
+#define _16NAR_NULL_RESOURCE_MANAGER_H
+
+#include <16nar/render/render_defs.h>
+#include <16nar/render/iresource_manager.h>
+#include <16nar/render/opengl/handle_table.h>
+
+#include <any>
+
+namespace _16nar::null
+{
+
+/// @brief Class for tracking resources without graphics API.
+/// @details Resource is not created anywhere, its handler is a copy of its loading parameters,
+/// kept in memory until the resource is unloaded. IDs are issued the same way as in OpenGL
+/// render API, so stale IDs are detected. Updates only check their parameters.
+/// @tparam T type of resource.
+template < ResourceType T >
+class ResourceManager : public IResourceManager
+{
+public:
+     /// @brief Loading parameters of the resource, used as its handler.
+     using LoadParamsType = LoadParams< T >;
+
+     /// @brief Parameters of updating the resource.
+     using UpdateParamsType = UpdateParams< T >;
+
+     /// @brief Constructor.
+     ResourceManager();
+
+     /// @copydoc IResourceManager::load(const std::any&)
+     virtual ResID load( const std::any& params ) override;
+
+     /// @copydoc IResourceManager::unload(ResId)
+     virtual void unload( ResID id ) override;
+
+     /// @copydoc IResourceManager::update(ResID, const std::any&)
+     virtual void update( ResID id, const std::any& params ) override;
+
+     /// @copydoc IResourceManager::clear()
+     virtual void clear() override;
+
+     /// @copydoc IResourceManager::get_handler(ResID) const
+     virtual std::any get_handler( ResID id ) const override;
+
+     /// @brief Find loading parameters of the resource.
+     /// @param[in] id ID of resource.
+     /// @return pointer to loading parameters, nullptr if resource is not loaded.
+     const LoadParamsType *find_params( ResID id ) const noexcept;
+
+     /// @brief Get number of loaded resources.
+     /// @return number of loaded resources.
+     std::size_t get_size() const noexcept;
+
+private:
+     opengl::HandleTable< LoadParamsType > handlers_;  ///< loading parameters of loaded resources.
+     std::size_t size_;                                ///< number of loaded resources.
+};
+
+
+/// @brief Get null resource manager of given resource type.
+/// @details Managers are created by null render API, so manager of resource type R
+/// is always ResourceManager of R.
+/// @tparam R type of resource.
+/// @param[in] managers all resource managers.
+/// @return pointer to resource manager, nullptr if there is no manager for R.
+template < ResourceType R >
+const ResourceManager< R > *get_typed_manager( const ResourceManagerMap& managers ) noexcept
+{
+     const auto iter = managers.find( R );
+     if ( iter == managers.cend() )
+     {
+          return nullptr;
+     }
+     return static_cast< const ResourceManager< R > * >( iter->second.get() );
+}
+
+} // namespace _16nar::null
+
+#include <16nar/render/null/resource_manager.inl>
+
+#endif // #ifndef _16NAR_NULL_RESOURCE_MANAGER_H
@@ -0,0 +1,107 @@
+#ifndef _16NAR_NULL_RESOURCE_MANAGER_INL
+#define _16NAR_NULL_RESOURCE_MANAGER_INL
+
+#include <16nar/system/exceptions.h>
+#include <16nar/logger/logger.h>
+
+#include <type_traits>
+
+namespace _16nar::null
+{
+
+template < ResourceType T >
+ResourceManager< T >::ResourceManager():
+     handlers_{}, size_{ 0 }
+{}
+
+
+template < ResourceType T >
+ResID ResourceManager< T >::load( const std::any& params )
+{
+     const auto *params_ptr = std::any_cast< LoadParamsType >( &params );
+     if ( !params_ptr )
+     {
+          throw ResourceException{ "wrong resource load parameters" };
+     }
+     ResID id = handlers_.acquire();
+     if ( !handlers_.emplace( id, *params_ptr ) )
+     {
+          handlers_.release( id );
+          throw ResourceException{ "resource slot is already occupied, id ", id };
+     }
+     size_++;
+     return id;
+}
+
+
+template < ResourceType T >
+void ResourceManager< T >::unload( ResID id )
+{
+     if ( handlers_.erase( id ) )
+     {
+          handlers_.release( id );
+          size_--;
+     }
+     else
+     {
+          LOG_16NAR_WARNING( "Resource with id " << id << " does not exist, won't unload" );
+     }
+}
+
+
+template < ResourceType T >
+void ResourceManager< T >::update( ResID id, const std::any& params )
+{
+     if ( !handlers_.find( id ) )
+     {
+          throw ResourceException{ "no resource with such id ", id };
+     }
+     // only specializations of update parameters have fields
+     if constexpr ( std::is_empty_v< UpdateParamsType > )
+     {
+          throw ResourceException{ "resource of this type cannot be updated" };
+     }
+     else if ( !std::any_cast< UpdateParamsType >( &params ) )
+     {
+          throw ResourceException{ "wrong resource update parameters" };
+     }
+}
+
+
+template < ResourceType T >
+void ResourceManager< T >::clear()
+{
+     handlers_.clear();
+     handlers_.reset();
+     size_ = 0;
+}
+
+
+template < ResourceType T >
+std::any ResourceManager< T >::get_handler( ResID id ) const
+{
+     const LoadParamsType *params = handlers_.find( id );
+     if ( !params )
+     {
+          throw ResourceException{ "no resource with such id ", id };
+     }
+     return *params;
+}
+
+
+template < ResourceType T >
+const typename ResourceManager< T >::LoadParamsType *ResourceManager< T >::find_params( ResID id ) const noexcept
+{
+     return handlers_.find( id );
+}
+
+
+template < ResourceType T >
+std::size_t ResourceManager< T >::get_size() const noexcept
+{
+     return size_;
+}
+
+} // namespace _16nar::null
+
+#endif // #ifndef _16NAR_NULL_RESOURCE_MANAGER_INL
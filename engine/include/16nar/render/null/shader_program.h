@@ -0,0 +1,91 @@
+/// @file
+/// @brief Header file with ShaderProgram class definition for null render API.
+#ifndef _16NAR_NULL_SHADER_PROGRAM_H
+#define _16NAR_NULL_SHADER_PROGRAM_H
+
+#include <16nar/render/ishader_program.h>
+
+#include <cstddef>
+
+namespace _16nar::null
+{
+
+/// @brief Implementation of shader program interface which only counts set uniforms.
+class ENGINE_API ShaderProgram : public IShaderProgram
+{
+public:
+     /// @brief Constructor.
+     /// @details Counter must outlive the shader program object.
+     /// @param[in] counter counter incremented for each set uniform.
+     ShaderProgram( std::size_t& counter ) noexcept;
+
+     /// @copydoc IShaderProgram::set_uniform(std::string_view, float) const noexcept
+     virtual void set_uniform( std::string_view name, float value ) const noexcept override;
+
+     /// @copydoc IShaderProgram::set_uniform(std::string_view, int) const noexcept
+     virtual void set_uniform( std::string_view name, int value ) const noexcept override;
+
+     /// @copydoc IShaderProgram::set_uniform(std::string_view, bool) const noexcept
+     virtual void set_uniform( std::string_view name, bool value ) const noexcept override;
+
+     /// @copydoc IShaderProgram::set_uniform(std::string_view, const Vec2i&) const noexcept
+     virtual void set_uniform( std::string_view name, const Vec2i& value ) const noexcept override;
+
+     /// @copydoc IShaderProgram::set_uniform(std::string_view, const Vec2f&) const noexcept
+     virtual void set_uniform( std::string_view name, const Vec2f& value ) const noexcept override;
+
+     /// @copydoc IShaderProgram::set_uniform(std::string_view, const Vec3i&) const noexcept
+     virtual void set_uniform( std::string_view name, const Vec3i& value ) const noexcept override;
+
+     /// @copydoc IShaderProgram::set_uniform(std::string_view, const Vec3f&) const noexcept
+     virtual void set_uniform( std::string_view name, const Vec3f& value ) const noexcept override;
+
+     /// @copydoc IShaderProgram::set_uniform(std::string_view, const Vec4i&) const noexcept
+     virtual void set_uniform( std::string_view name, const Vec4i& value ) const noexcept override;
+
+     /// @copydoc IShaderProgram::set_uniform(std::string_view, const Vec4f&) const noexcept
+     virtual void set_uniform( std::string_view name, const Vec4f& value ) const noexcept override;
+
+     /// @copydoc IShaderProgram::set_uniform(std::string_view, const TransformMatrix&) const noexcept
+     virtual void set_uniform( std::string_view name, const TransformMatrix& value ) const noexcept override;
+
+     /// @copydoc IShaderProgram::set_uniform(UniformId, float) const noexcept
+     virtual void set_uniform( UniformId id, float value ) const noexcept override;
+
+     /// @copydoc IShaderProgram::set_uniform(UniformId, int) const noexcept
+     virtual void set_uniform( UniformId id, int value ) const noexcept override;
+
+     /// @copydoc IShaderProgram::set_uniform(UniformId, bool) const noexcept
+     virtual void set_uniform( UniformId id, bool value ) const noexcept override;
+
+     /// @copydoc IShaderProgram::set_uniform(UniformId, const Vec2i&) const noexcept
+     virtual void set_uniform( UniformId id, const Vec2i& value ) const noexcept override;
+
+     /// @copydoc IShaderProgram::set_uniform(UniformId, const Vec2f&) const noexcept
+     virtual void set_uniform( UniformId id, const Vec2f& value ) const noexcept override;
+
+     /// @copydoc IShaderProgram::set_uniform(UniformId, const Vec3i&) const noexcept
+     virtual void set_uniform( UniformId id, const Vec3i& value ) const noexcept override;
+
+     /// @copydoc IShaderProgram::set_uniform(UniformId, const Vec3f&) const noexcept
+     virtual void set_uniform( UniformId id, const Vec3f& value ) const noexcept override;
+
+     /// @copydoc IShaderProgram::set_uniform(UniformId, const Vec4i&) const noexcept
+     virtual void set_uniform( UniformId id, const Vec4i& value ) const noexcept override;
+
+     /// @copydoc IShaderProgram::set_uniform(UniformId, const Vec4f&) const noexcept
+     virtual void set_uniform( UniformId id, const Vec4f& value ) const noexcept override;
+
+     /// @copydoc IShaderProgram::set_uniform(UniformId, const TransformMatrix&) const noexcept
+     virtual void set_uniform( UniformId id, const TransformMatrix& value ) const noexcept override;
+
+private:
+     /// @brief Count one set uniform.
+     void count() const noexcept;
+
+     std::size_t *counter_;   ///< counter of set uniforms.
+};
+
+} // namespace _16nar::null
+
+#endif // #ifndef _16NAR_NULL_SHADER_PROGRAM_H
@@ -0,0 +1,125 @@
+/// @file
+/// @brief File with HandleTable class definition.
+#ifndef _16NAR_OPENGL_HANDLE_TABLE_H
+#define _16NAR_OPENGL_HANDLE_TABLE_H
+
+#include <16nar/16nardefs.h>
+
+#include <vector>
+#include <queue>
+
+namespace _16nar::opengl
+{
+
+/// @brief Dense table of resource handlers, addressed by generational IDs.
+/// @details Lower @ref index_bits bits of an ID hold index of a slot in the table,
+/// higher bits hold generation of the slot. Generation is incremented every time
+/// the slot is released, so ID of unloaded resource does not match a new resource
+/// placed into the same slot. Slot with index 0 is never used, so 0 is never a valid ID.
+///
+/// Generation has 12 bits, so a slot may be released 4096 times. After that it is
+/// retired and never reused, instead of wrapping its generation, which would make
+/// old IDs of this slot valid again. So wrap-around is traded for a hard limit: a table
+/// hands out at most about 2^32 IDs in total (2^20 slots of 4096 generations) during
+/// its lifetime, or until @ref reset. When no slot is left, @ref acquire throws
+/// ExceededIdException, and @ref get_retired_count shows how close the table is to it.
+///
+/// ID allocation (acquire, release, reset) and handler storage (emplace, erase,
+/// find, clear, for_each) work with different data, so these groups may be used from
+/// different threads, as long as calls inside each group are synchronized.
+/// @tparam T type of handler.
+template < typename T >
+class HandleTable
+{
+public:
+     /// @brief Number of bits in ID used for slot index.
+     static constexpr std::size_t index_bits = 20;
+
+     /// @brief Mask of slot index in ID.
+     static constexpr ResID index_mask = ( ResID{ 1 } << index_bits ) - 1;
+
+     /// @brief Mask of generation, shifted to the lower bits.
+     static constexpr ResID generation_mask = ~ResID{} >> index_bits;
+
+     /// @brief Get slot index from ID.
+     /// @param[in] id ID of resource.
+     /// @return slot index.
+     static constexpr std::size_t get_index( ResID id ) noexcept
+     {
+          return id & index_mask;
+     }
+
+     /// @brief Get slot generation from ID.
+     /// @param[in] id ID of resource.
+     /// @return slot generation.
+     static constexpr ResID get_generation( ResID id ) noexcept
+     {
+          return ( id >> index_bits ) & generation_mask;
+     }
+
+     /// @brief Allocate ID for a new resource, released slots are reused first.
+     /// @throws ExceededIdException if all slots are in use or retired, std::bad_alloc.
+     /// @return ID of the new resource.
+     ResID acquire();
+
+     /// @brief Release ID, so its slot may be reused with next generation.
+     /// @param[in] id ID to be released.
+     /// @throws std::bad_alloc.
+     /// @return true if ID was acquired and not released yet, otherwise false.
+     bool release( ResID id );
+
+     /// @brief Forget all acquired IDs, retired slots become available again.
+     void reset() noexcept;
+
+     /// @brief Get number of slots retired after their last generation.
+     /// @return number of retired slots, they are not counted in available slots.
+     std::size_t get_retired_count() const noexcept;
+
+     /// @brief Store handler of the resource with acquired ID.
+     /// @param[in] id ID of the resource.
+     /// @param[in] handler handler of the resource.
+     /// @throws std::bad_alloc.
+     /// @return true if handler was stored, false if slot is already occupied.
+     bool emplace( ResID id, const T& handler );
+
+     /// @brief Remove handler of the resource.
+     /// @param[in] id ID of the resource.
+     /// @return true if handler was removed, false if there is no handler with such ID.
+     bool erase( ResID id ) noexcept;
+
+     /// @brief Remove all handlers.
+     void clear() noexcept;
+
+     /// @brief Find handler of the resource.
+     /// @param[in] id ID of the resource.
+     /// @return pointer to handler, nullptr if there is no handler with such ID.
+     const T *find( ResID id ) const noexcept;
+
+     /// @brief Call function for each stored handler.
+     /// @tparam F type of function, must be callable as f( ResID, const T& ).
+     /// @param[in] func function to be called.
+     template < typename F >
+     void for_each( F&& func ) const;
+
+private:
+     /// @brief Slot of the table.
+     struct Slot
+     {
+          ResID id = 0;  ///< ID of resource in the slot, 0 if slot is empty.
+          T handler{};   ///< handler of the resource.
+     };
+
+     std::vector< Slot > slots_;              ///< dense array of handlers, indexed by slot index.
+     std::vector< ResID > generations_;       ///< current generations of allocated slots.
+     std::queue< std::size_t > free_;         ///< released slot indices, reused in order of release.
+     std::size_t retired_count_ = 0;          ///< number of retired slots.
+
+     /// @brief Generation of retired slot, it does not match generation of any ID.
+     static constexpr ResID retired_generation = generation_mask + 1;
+};
+
+} // namespace _16nar::opengl
+
+#include <16nar/render/opengl/handle_table.inl>
+
+#endif // #ifndef _16NAR_OPENGL_HANDLE_TABLE_H
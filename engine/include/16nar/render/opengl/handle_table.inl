@@ -0,0 +1,143 @@
+#ifndef _16NAR_OPENGL_HANDLE_TABLE_INL
+#define _16NAR_OPENGL_HANDLE_TABLE_INL
+
+#include <16nar/system/exceptions.h>
+
+namespace _16nar::opengl
+{
+
+template < typename T >
+ResID HandleTable< T >::acquire()
+{
+     std::size_t index = 0;
+     if ( !free_.empty() )
+     {
+          index = free_.front();
+          free_.pop();
+     }
+     else
+     {
+          if ( generations_.empty() )
+          {
+               generations_.push_back( 0 );  // slot 0 is reserved for invalid ID
+          }
+          index = generations_.size();
+          if ( index > index_mask )
+          {
+               // all slots are in use or retired, generations are not wrapped even then
+               throw ExceededIdException{};
+          }
+          generations_.push_back( 0 );
+     }
+     return static_cast< ResID >( ( generations_[ index ] << index_bits ) | index );
+}
+
+
+template < typename T >
+bool HandleTable< T >::release( ResID id )
+{
+     std::size_t index = get_index( id );
+     if ( index == 0 || index >= generations_.size() || generations_[ index ] != get_generation( id ) )
+     {
+          return false;
+     }
+     if ( generations_[ index ] == generation_mask )
+     {
+          // wrapped generation would validate stale IDs, so the slot is not reused
+          generations_[ index ] = retired_generation;
+          retired_count_++;
+          return true;
+     }
+     free_.push( index );
+     generations_[ index ]++;
+     return true;
+}
+
+
+template < typename T >
+void HandleTable< T >::reset() noexcept
+{
+     generations_.clear();
+     std::queue< std::size_t >{}.swap( free_ );
+     retired_count_ = 0;
+}
+
+
+template < typename T >
+std::size_t HandleTable< T >::get_retired_count() const noexcept
+{
+     return retired_count_;
+}
+
+
+template < typename T >
+bool HandleTable< T >::emplace( ResID id, const T& handler )
+{
+     std::size_t index = get_index( id );
+     if ( index == 0 )
+     {
+          return false;
+     }
+     if ( index >= slots_.size() )
+     {
+          slots_.resize( index + 1 );
+     }
+     Slot& slot = slots_[ index ];
+     if ( slot.id != 0 )
+     {
+          return false;
+     }
+     slot.id = id;
+     slot.handler = handler;
+     return true;
+}
+
+
+template < typename T >
+bool HandleTable< T >::erase( ResID id ) noexcept
+{
+     std::size_t index = get_index( id );
+     if ( id == 0 || index >= slots_.size() || slots_[ index ].id != id )
+     {
+          return false;
+     }
+     slots_[ index ] = Slot{};
+     return true;
+}
+
+
+template < typename T >
+void HandleTable< T >::clear() noexcept
+{
+     slots_.clear();
+}
+
+
+template < typename T >
+const T *HandleTable< T >::find( ResID id ) const noexcept
+{
+     std::size_t index = get_index( id );
+     if ( id == 0 || index >= slots_.size() || slots_[ index ].id != id )
+     {
+          return nullptr;
+     }
+     return &slots_[ index ].handler;
+}
+
+
+template < typename T >
+template < typename F >
+void HandleTable< T >::for_each( F&& func ) const
+{
+     for ( const auto& slot : slots_ )
+     {
+          if ( slot.id != 0 )
+          {
+               func( slot.id, slot.handler );
+          }
+     }
+}
+
+} // namespace _16nar::opengl
+
+#endif // #ifndef _16NAR_OPENGL_HANDLE_TABLE_INL
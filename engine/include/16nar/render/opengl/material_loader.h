@@ -0,0 +1,41 @@
+/// @file
+/// @brief Header file with MaterialLoader class definition.
+#ifndef _16NAR_OPENGL_MATERIAL_LOADER_H
+#define _16NAR_OPENGL_MATERIAL_LOADER_H
+
+#include <16nar/render/opengl/utils.h>
+
+namespace _16nar::opengl
+{
+
+/// @brief Class for loading the material.
+/// @details Material does not own OpenGL objects, it refers to loaded shader program
+/// and textures by identifiers, they are resolved when material is bound.
+class MaterialLoader
+{
+public:
+     /// @brief Parameters of material loading.
+     using LoadParamsType = LoadParams< ResourceType::Material >;
+
+     /// @brief Handler of loaded material.
+     using HandlerType = Handler< ResourceType::Material >;
+
+     /// @brief Check shader program and textures of the material and fill its handler.
+     /// @param[in] managers resource managers for getting related resources.
+     /// @param[in] params parameters of material loading.
+     /// @param[out] handler handler of the material.
+     /// @return true on success, false otherwise.
+     /// @throws std::bad_alloc.
+     static bool load( const ResourceManagerMap& managers, const LoadParamsType& params, HandlerType& handler );
+
+     /// @brief Unload material.
+     /// @details Referred shader program and textures are not unloaded.
+     /// @param[in] handler handler of the material.
+     /// @return true on success, false otherwise.
+     static bool unload( const HandlerType& handler );
+
+};
+
+} // namespace _16nar::opengl
+
+#endif // #ifndef _16NAR_OPENGL_MATERIAL_LOADER_H
@@ -9,6 +9,7 @@
 #include <array>
 #include <queue>
 #include <functional>
+#include <unordered_map>
 
 namespace _16nar::opengl
 {
@@ -37,6 +38,20 @@ public:
      /// @copydoc IRenderDevice::set_shader_params(const ShaderSetupFunction&)
      virtual void set_shader_params( const ShaderSetupFunction& setup ) override;
 
+     /// @copydoc IRenderDevice::set_object_uniforms(const ObjectUniforms&)
+     virtual void set_object_uniforms( const ObjectUniforms& uniforms ) override;
+
+     /// @copydoc IRenderDevice::bind_material(const Material&)
+     virtual void bind_material( const Material& material ) override;
+
+     /// @copydoc IRenderDevice::update_uniform_buffer(const UniformBuffer&, std::size_t, std::size_t, const DataSharedPtr&)
+     virtual void update_uniform_buffer( const UniformBuffer& buffer, std::size_t offset,
+          std::size_t size, const DataSharedPtr& data ) override;
+
+     /// @copydoc IRenderDevice::append_stream_data(const StreamBuffer&, std::size_t, const DataSharedPtr&)
+     virtual std::size_t append_stream_data( const StreamBuffer& buffer, std::size_t size,
+          const DataSharedPtr& data ) override;
+
      /// @copydoc IRenderDevice::bind_framebuffer(const FrameBuffer&)
      virtual void bind_framebuffer( const FrameBuffer& framebuffer ) override;
 
@@ -54,6 +69,8 @@ private:
      using Request = std::function< void() >;
 
      std::array< std::queue< Request >, _16nar_saved_frames > render_queue_;    ///< queue of render requests.
+     /// @brief Offsets of free space in stream buffers, for each saved frame.
+     std::array< std::unordered_map< ResID, std::size_t >, _16nar_saved_frames > frame_stream_offsets_;
      std::atomic_size_t frame_index_;                                           ///< index of the frame being rendered.
 };
 
@@ -4,12 +4,12 @@
 #define _16NAR_OPENGL_MT_RESOURCE_MANAGER_H
 
 #include <16nar/render/render_defs.h>
-#include <16nar/render/iresource_manager.h>
+#include <16nar/render/opengl/typed_resource_manager.h>
 
-#include <unordered_map>
 #include <array>
 #include <queue>
 #include <atomic>
+#include <mutex>
 
 namespace _16nar::opengl
 {
@@ -21,13 +21,14 @@ namespace _16nar::opengl
 /// manager will keep its data without loading it into GPU.
 ///
 /// MtResourceManager keeps IDs of resources and some
-/// information about them.
+/// information about them. IDs of unloaded resources are reused
+/// with new generation, see @ref HandleTable.
 ///
 /// All functions, except load and unload must be called from
 /// render thread.
 /// @tparam T type of resource.
 template < typename T >
-class MtResourceManager : public IResourceManager
+class MtResourceManager : public TypedResourceManager< typename T::HandlerType >
 {
 public:
      /// @brief Constructor.
@@ -62,14 +63,19 @@ public:
      /// due to game loop the load is not made immediately, but request is saved.
      virtual void unload( ResID id ) override;
 
+     /// @brief Implementation of @ref IResourceManager::update(ResID, const std::any&)
+     /// @details The resource will be updated during render processing, after
+     /// loads of the same frame, so the update is not made immediately, but request is saved.
+     /// @param[in] id ID of resource to be updated.
+     /// @param[in] params resource update params.
+     /// @throws ResourceException.
+     virtual void update( ResID id, const std::any& params ) override;
+
      /// @copydoc IResourceManager::clear()
      virtual void clear() override;
 
-     /// @copydoc IResourceManager::get_handler(ResID) const
-     virtual std::any get_handler( ResID id ) const override;
-
-     /// @brief Process all requests in load queue.
-     /// @throws ResourceException, ExceededIdException.
+     /// @brief Process all requests in load queue, then all requests in update queue.
+     /// @throws ResourceException.
      virtual void process_load_queue() override;
 
      /// @brief Process all requests in unload queue.
@@ -89,11 +95,16 @@ private:
      /// @brief Element of load queue.
      using Request = std::pair< ResID, LoadParamsType >;
 
-     std::unordered_map< ResID, HandlerType > resources_;                  ///< resources loaded in previous frames.
+     /// @brief Element of update queue.
+     using UpdateRequest = std::pair< ResID, std::any >;
+
+     using TypedResourceManager< HandlerType >::handlers_;
+
      std::array< std::queue< Request >, _16nar_saved_frames > load_queue_; ///< requests to load resources.
      std::array< std::queue< ResID >, _16nar_saved_frames > unload_queue_; ///< requests to unload resources.
+     std::array< std::queue< UpdateRequest >, _16nar_saved_frames > update_queue_;  ///< requests to update resources.
      const ResourceManagerMap& managers_;                                  ///< resource managers for access to related resources.
-     ResID next_;                                                          ///< next ID to be assigned.
+     std::mutex id_mutex_;                                                 ///< mutex for IDs acquiring and releasing.
      std::atomic_size_t frame_index_;                                      ///< index of the frame being rendered.
 };
 
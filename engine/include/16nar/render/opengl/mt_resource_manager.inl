@@ -9,18 +9,17 @@ namespace _16nar::opengl
 
 template < typename T >
 MtResourceManager< T >::MtResourceManager( const ResourceManagerMap& managers ):
-     resources_{}, load_queue_{}, unload_queue_{}, managers_{ managers },
-     next_{ 1 }, frame_index_{ 0 }
+     load_queue_{}, unload_queue_{}, update_queue_{}, managers_{ managers }, id_mutex_{}, frame_index_{ 0 }
 {}
 
 
 template < typename T >
 MtResourceManager< T >::MtResourceManager( MtResourceManager&& other ):
-     resources_{ std::move( other.resources_ ) }, load_queue_{ std::move( other.load_queue_ ) },
-     unload_queue_{ std::move( other.unload_queue_ ) }, managers_{ other.managers_ },
-     next_{ other.next_ }, frame_index_{ other.frame_index_ }
+     load_queue_{ std::move( other.load_queue_ ) }, unload_queue_{ std::move( other.unload_queue_ ) },
+     update_queue_{ std::move( other.update_queue_ ) }, managers_{ other.managers_ },
+     id_mutex_{}, frame_index_{ other.frame_index_.load() }
 {
-     other.next_ = 1; // reset default value
+     std::swap( handlers_, other.handlers_ );
      other.frame_index_ = 0;
 }
 
@@ -33,13 +32,12 @@ MtResourceManager< T >& MtResourceManager< T >::operator=( MtResourceManager&& r
           return *this;
      }
      clear();
-     std::swap( resources_, rhs.resources_ );
+     std::swap( handlers_, rhs.handlers_ );
      std::swap( load_queue_, rhs.load_queue_ );
      std::swap( unload_queue_, rhs.unload_queue_ );
-     std::swap( next_, rhs.next_ );
-     frame_index_ = rhs.frame_index_;
+     std::swap( update_queue_, rhs.update_queue_ );
+     frame_index_ = rhs.frame_index_.load();
      rhs.frame_index_ = 0;
-     resources_ = rhs.resources_;
      return *this;
 }
 
@@ -59,10 +57,10 @@ ResID MtResourceManager< T >::load( const std::any& params )
      {
           throw ResourceException{ "wrong resource load parameters" };
      }
-     ResID id = next_++;
-     if ( id == ResID{} )     // overflow
+     ResID id = 0;
      {
-          throw ExceededIdException{};
+          std::lock_guard< std::mutex > lock{ id_mutex_ };
+          id = handlers_.acquire();
      }
      size_t next_index = ( frame_index_ + 1 ) % _16nar_saved_frames;
      load_queue_[ next_index ].push( std::make_pair( id, *params_ptr ) );
@@ -78,10 +76,18 @@ void MtResourceManager< T >::unload( ResID id )
 }
 
 
+template < typename T >
+void MtResourceManager< T >::update( ResID id, const std::any& params )
+{
+     check_update_params< T >( params );
+     size_t next_index = ( frame_index_ + 1 ) % _16nar_saved_frames;
+     update_queue_[ next_index ].push( std::make_pair( id, params ) );
+}
+
+
 template < typename T >
 void MtResourceManager< T >::clear()
 {
-     next_ = 1;
      frame_index_ = 0;
      for ( auto& queue : unload_queue_ )
      {
@@ -91,26 +97,20 @@ void MtResourceManager< T >::clear()
      {
           std::queue< Request >{}.swap( queue );
      }
-     for ( const auto& [ id, res ] : resources_ )
+     for ( auto& queue : update_queue_ )
+     {
+          std::queue< UpdateRequest >{}.swap( queue );
+     }
+     handlers_.for_each( []( ResID id, const HandlerType& handler )
      {
-          if ( !T::unload( res ) )
+          if ( !T::unload( handler ) )
           {
                LOG_16NAR_ERROR( "Unable to unload resource with id " << id );
           }
-     }
-     resources_.clear();
-}
-
-
-template < typename T >
-std::any MtResourceManager< T >::get_handler( ResID id ) const
-{
-     const auto iter = resources_.find( id );
-     if ( iter == resources_.cend() )
-     {
-          throw ResourceException{ "no resource with such id ", id };
-     }
-     return iter->second;
+     } );
+     handlers_.clear();
+     std::lock_guard< std::mutex > lock{ id_mutex_ };
+     handlers_.reset();
 }
 
 
@@ -120,20 +120,43 @@ void MtResourceManager< T >::process_load_queue()
      auto& queue = load_queue_[ frame_index_ ];
      while ( !queue.empty() )
      {
-          auto& request = queue.front();
+          ResID id = queue.front().first;
           HandlerType handler;
-          if ( !T::load( managers_, request.second, handler ) )
+          bool loaded = T::load( managers_, queue.front().second, handler );
+          if ( loaded && handlers_.emplace( id, handler ) )
           {
-               throw ResourceException{ "cannot load resource ", request.first };
+               queue.pop();
+               continue;
           }
-          auto [ it, result ] = resources_.try_emplace( request.first, handler );
-          if ( !result )
+          if ( loaded )
           {
                T::unload( handler );
-               queue.pop();
-               throw ExceededIdException{};
           }
           queue.pop();
+          {
+               std::lock_guard< std::mutex > lock{ id_mutex_ };
+               handlers_.release( id );
+          }
+          throw ResourceException{ "cannot load resource ", id };
+     }
+
+     auto& updates = update_queue_[ frame_index_ ];
+     while ( !updates.empty() )
+     {
+          ResID id = updates.front().first;
+          const HandlerType *handler = handlers_.find( id );
+          if ( !handler )
+          {
+               LOG_16NAR_WARNING( "Resource with id " << id << " does not exist, won't update" );
+               updates.pop();
+               continue;
+          }
+          bool ok = update_resource< T >( *handler, updates.front().second );
+          updates.pop();
+          if ( !ok )
+          {
+               throw ResourceException{ "cannot update resource ", id };
+          }
      }
 }
 
@@ -146,14 +169,18 @@ void MtResourceManager< T >::process_unload_queue()
      {
           ResID id = queue.front();
           queue.pop();
-          auto iter = resources_.find( id );
-          if ( iter == resources_.end() )
+          const HandlerType *handler = handlers_.find( id );
+          if ( !handler )
           {
                LOG_16NAR_WARNING( "Resource with id " << id << " does not exist, won't unload" );
                continue;
           }
-          bool ok = T::unload( iter->second );
-          resources_.erase( iter );
+          bool ok = T::unload( *handler );
+          handlers_.erase( id );
+          {
+               std::lock_guard< std::mutex > lock{ id_mutex_ };
+               handlers_.release( id );
+          }
           if ( !ok )
           {
                throw ResourceException{ "cannot unload resource ", id };
@@ -165,8 +192,17 @@ void MtResourceManager< T >::process_unload_queue()
 template < typename T >
 void MtResourceManager< T >::end_frame()
 {
-     std::queue< Request >{}.swap( load_queue_[ frame_index_ ] );
+     auto& queue = load_queue_[ frame_index_ ];
+     if ( !queue.empty() )    // requests left after load error, their IDs will never be used
+     {
+          std::lock_guard< std::mutex > lock{ id_mutex_ };
+          for ( ; !queue.empty(); queue.pop() )
+          {
+               handlers_.release( queue.front().first );
+          }
+     }
      std::queue< ResID >{}.swap( unload_queue_[ frame_index_ ] );
+     std::queue< UpdateRequest >{}.swap( update_queue_[ frame_index_ ] );
      frame_index_ = ( frame_index_ + 1 ) % _16nar_saved_frames;
 }
 
@@ -30,6 +30,9 @@ public:
      /// @copydoc IRenderApi::unload(const Resource&)
      virtual void unload( const Resource& resource ) override;
 
+     /// @copydoc IRenderApi::update(const Resource&, const std::any&)
+     virtual void update( const Resource& resource, const std::any& params ) override;
+
      /// @copydoc IRenderApi::get_device() const noexcept
      virtual IRenderDevice& get_device() const noexcept override;
 
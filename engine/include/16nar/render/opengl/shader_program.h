@@ -4,6 +4,7 @@
 #define _16NAR_OPENGL_SHADER_PROGRAM_H
 
 #include <16nar/render/ishader_program.h>
+#include <16nar/render/opengl/utils.h>
 
 namespace _16nar::opengl
 {
@@ -13,8 +14,9 @@ class ShaderProgram : public IShaderProgram
 {
 public:
      /// @brief Constructor.
-     /// @param[in] descriptor descriptor of compiled and linked shader program.
-     ShaderProgram( unsigned int descriptor ) noexcept;
+     /// @details Handler must outlive the shader program object.
+     /// @param[in] handler handler of compiled and linked shader program.
+     ShaderProgram( const Handler< ResourceType::Shader >& handler ) noexcept;
 
      /// @copydoc IShaderProgram::set_uniform(std::string_view, float) const noexcept
      virtual void set_uniform( std::string_view name, float value ) const noexcept override;
@@ -46,8 +48,51 @@ public:
      /// @copydoc IShaderProgram::set_uniform(std::string_view, const TransformMatrix&) const noexcept
      virtual void set_uniform( std::string_view name, const TransformMatrix& value ) const noexcept override;
 
+     /// @copydoc IShaderProgram::set_uniform(UniformId, float) const noexcept
+     virtual void set_uniform( UniformId id, float value ) const noexcept override;
+
+     /// @copydoc IShaderProgram::set_uniform(UniformId, int) const noexcept
+     virtual void set_uniform( UniformId id, int value ) const noexcept override;
+
+     /// @copydoc IShaderProgram::set_uniform(UniformId, bool) const noexcept
+     virtual void set_uniform( UniformId id, bool value ) const noexcept override;
+
+     /// @copydoc IShaderProgram::set_uniform(UniformId, const Vec2i&) const noexcept
+     virtual void set_uniform( UniformId id, const Vec2i& value ) const noexcept override;
+
+     /// @copydoc IShaderProgram::set_uniform(UniformId, const Vec2f&) const noexcept
+     virtual void set_uniform( UniformId id, const Vec2f& value ) const noexcept override;
+
+     /// @copydoc IShaderProgram::set_uniform(UniformId, const Vec3i&) const noexcept
+     virtual void set_uniform( UniformId id, const Vec3i& value ) const noexcept override;
+
+     /// @copydoc IShaderProgram::set_uniform(UniformId, const Vec3f&) const noexcept
+     virtual void set_uniform( UniformId id, const Vec3f& value ) const noexcept override;
+
+     /// @copydoc IShaderProgram::set_uniform(UniformId, const Vec4i&) const noexcept
+     virtual void set_uniform( UniformId id, const Vec4i& value ) const noexcept override;
+
+     /// @copydoc IShaderProgram::set_uniform(UniformId, const Vec4f&) const noexcept
+     virtual void set_uniform( UniformId id, const Vec4f& value ) const noexcept override;
+
+     /// @copydoc IShaderProgram::set_uniform(UniformId, const TransformMatrix&) const noexcept
+     virtual void set_uniform( UniformId id, const TransformMatrix& value ) const noexcept override;
+
 private:
+     /// @brief Get location of the uniform.
+     /// @details Uniforms missing in reflected locations, like elements of arrays,
+     /// are queried from shader program.
+     /// @param[in] name name of the uniform.
+     /// @return location of the uniform, -1 if it is not active.
+     int get_location( std::string_view name ) const noexcept;
+
+     /// @brief Get location of the uniform.
+     /// @param[in] id identifier of the uniform.
+     /// @return location of the uniform, -1 if it is not active.
+     int get_location( UniformId id ) const noexcept;
+
      unsigned int descriptor_;          ///< descriptor of shader program.
+     const UniformLocations *uniforms_; ///< locations of active uniforms, may be nullptr.
 };
 
 } // namespace _16nar::opengl
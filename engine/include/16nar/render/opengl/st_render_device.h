@@ -5,8 +5,12 @@
 
 #include <16nar/render/render_defs.h>
 #include <16nar/render/opengl/utils.h>
+#include <16nar/render/opengl/typed_resource_manager.h>
 #include <16nar/render/irender_device.h>
 
+#include <unordered_map>
+#include <vector>
+
 namespace _16nar::opengl
 {
  
@@ -15,6 +19,9 @@ class StRenderDevice : public IRenderDevice
 {
 public:
      /// @brief Constructor.
+     /// @details Managers of textures, texture arrays, vertex buffers, shaders, materials,
+     /// uniform buffers, stream buffers and framebuffers must be already created, they are
+     /// resolved once for typed access to handlers.
      /// @param[in] managers resource managers used in rendering.
      StRenderDevice( const ResourceManagerMap& managers );
 
@@ -33,15 +40,60 @@ public:
      /// @copydoc IRenderDevice::set_shader_params(const ShaderSetupFunction&)
      virtual void set_shader_params( const ShaderSetupFunction& setup ) override;
 
+     /// @copydoc IRenderDevice::set_object_uniforms(const ObjectUniforms&)
+     virtual void set_object_uniforms( const ObjectUniforms& uniforms ) override;
+
+     /// @copydoc IRenderDevice::bind_material(const Material&)
+     virtual void bind_material( const Material& material ) override;
+
+     /// @copydoc IRenderDevice::update_uniform_buffer(const UniformBuffer&, std::size_t, std::size_t, const DataSharedPtr&)
+     virtual void update_uniform_buffer( const UniformBuffer& buffer, std::size_t offset,
+          std::size_t size, const DataSharedPtr& data ) override;
+
+     /// @copydoc IRenderDevice::append_stream_data(const StreamBuffer&, std::size_t, const DataSharedPtr&)
+     virtual std::size_t append_stream_data( const StreamBuffer& buffer, std::size_t size,
+          const DataSharedPtr& data ) override;
+
      /// @copydoc IRenderDevice::bind_framebuffer(const FrameBuffer&)
      virtual void bind_framebuffer( const FrameBuffer& framebuffer ) override;
 
      /// @copydoc IRenderDevice::clear(bool, bool, bool)
      virtual void clear( bool color, bool depth, bool stencil ) override;
 
+     /// @copydoc IRenderDevice::end_frame()
+     virtual void end_frame() override;
+
+protected:
+     /// @brief Write vertex data to the region of current frame of the stream buffer.
+     /// @details Before the first write to the region in a frame, waits until
+     /// draw calls which read this region in previous frames are finished.
+     /// @param[in] buffer target stream buffer resource identifier.
+     /// @param[in] offset offset of data in the region, in bytes.
+     /// @param[in] size size of data, in bytes.
+     /// @param[in] data data to be written.
+     /// @throws ResourceException.
+     void write_stream_data( const StreamBuffer& buffer, std::size_t offset,
+          std::size_t size, const DataSharedPtr& data );
+
 private:
-     const ResourceManagerMap& managers_;              ///< all resource managers.
-     Handler< ResourceType::Shader > current_shader_;  ///< currently bound shader program handler.
+     /// @brief Pointer to typed manager of resources of type R.
+     template < ResourceType R >
+     using ManagerPtr = const TypedResourceManager< Handler< R > > *;
+
+     ManagerPtr< ResourceType::Texture > textures_;            ///< manager of textures.
+     ManagerPtr< ResourceType::TextureArray > texture_arrays_; ///< manager of texture arrays.
+     ManagerPtr< ResourceType::VertexBuffer > vertex_buffers_; ///< manager of vertex buffers.
+     ManagerPtr< ResourceType::Shader > shaders_;              ///< manager of shaders.
+     ManagerPtr< ResourceType::FrameBuffer > framebuffers_;    ///< manager of framebuffers.
+     ManagerPtr< ResourceType::Material > materials_;          ///< manager of materials.
+     ManagerPtr< ResourceType::UniformBuffer > uniform_buffers_;    ///< manager of uniform buffers.
+     ManagerPtr< ResourceType::StreamBuffer > stream_buffers_;      ///< manager of stream buffers.
+     Handler< ResourceType::Shader > current_shader_;          ///< currently bound shader program handler.
+     Material current_material_;                               ///< currently bound material.
+     std::size_t material_textures_;                           ///< number of texture units used by current material.
+     std::unordered_map< ResID, std::size_t > stream_offsets_; ///< offsets of free space in stream buffers.
+     std::vector< StreamBuffer > written_streams_;             ///< stream buffers written in current frame.
+     std::size_t stream_region_;                               ///< index of region of stream buffers for current frame.
 };
 
 } // namespace _16nar::opengl
@@ -4,17 +4,17 @@
 #define _16NAR_OPENGL_ST_RESOURCE_MANAGER_H
 
 #include <16nar/render/render_defs.h>
-#include <16nar/render/iresource_manager.h>
-
-#include <unordered_map>
+#include <16nar/render/opengl/typed_resource_manager.h>
 
 namespace _16nar::opengl
 {
 
 /// @brief Class for tracking resources for OpenGL, singlethread profile.
+/// @details IDs of unloaded resources are reused with new generation,
+/// see @ref HandleTable.
 /// @tparam T type of resource loader.
 template < typename T >
-class StResourceManager : public IResourceManager
+class StResourceManager : public TypedResourceManager< typename T::HandlerType >
 {
 public:
      /// @brief Constructor.
@@ -42,12 +42,12 @@ public:
      /// @copydoc IResourceManager::unload(ResId)
      virtual void unload( ResID id ) override;
 
+     /// @copydoc IResourceManager::update(ResID, const std::any&)
+     virtual void update( ResID id, const std::any& params ) override;
+
      /// @copydoc IResourceManager::clear()
      virtual void clear() override;
 
-     /// @copydoc IResourceManager::get_handler(ResID) const
-     virtual std::any get_handler( ResID id ) const override;
-
 private:
      /// @brief Handler of the resource.
      using HandlerType = typename T::HandlerType;
@@ -55,9 +55,9 @@ private:
      /// @brief Loading parameters of the resource.
      using LoadParamsType = typename T::LoadParamsType;
 
-     std::unordered_map< ResID, HandlerType > resources_;   ///< resources loaded in previous frames.
+     using TypedResourceManager< HandlerType >::handlers_;
+
      const ResourceManagerMap& managers_;                   ///< resource managers for access to related resources.
-     ResID next_ = 1;                                       ///< next ID to be assigned.
 };
 
 } // namespace _16nar::opengl
@@ -9,15 +9,15 @@ namespace _16nar::opengl
 
 template < typename T >
 StResourceManager< T >::StResourceManager( const ResourceManagerMap& managers ):
-     resources_{}, managers_{ managers }, next_{ 1 }
+     managers_{ managers }
 {}
 
 
 template < typename T >
 StResourceManager< T >::StResourceManager( StResourceManager&& other ):
-     resources_{ std::move( other.resources_ ) }, managers_{ other.managers_ }, next_{ other.next_ }
+     managers_{ other.managers_ }
 {
-     other.next_ = 1; // reset default value
+     std::swap( handlers_, other.handlers_ );
 }
 
 
@@ -29,9 +29,7 @@ StResourceManager< T >& StResourceManager< T >::operator=( StResourceManager&& r
           return *this;
      }
      clear();
-     std::swap( resources_, rhs.resources_ );
-     std::swap( next_, rhs.next_ );
-     resources_ = rhs.resources_;
+     std::swap( handlers_, rhs.handlers_ );
      return *this;
 }
 
@@ -52,22 +50,18 @@ ResID StResourceManager< T >::load( const std::any& params )
           throw ResourceException{ "wrong resource load parameters" };
      }
      HandlerType handler;
-     ResID id = next_;
-     if ( id == ResID{} )     // overflow
-     {
-          throw ExceededIdException{};
-     }
+     ResID id = handlers_.acquire();
      if ( !T::load( managers_, *params_ptr, handler ) )
      {
+          handlers_.release( id );
           throw ResourceException{ "cannot load resource ", id };
      }
-     auto [ it, result ] = resources_.try_emplace( id, handler );
-     if ( !result )
+     if ( !handlers_.emplace( id, handler ) )
      {
           T::unload( handler );
-          throw ExceededIdException{};
+          handlers_.release( id );
+          throw ResourceException{ "resource slot is already occupied, id ", id };
      }
-     ++next_;
      return id;
 }
 
@@ -75,15 +69,12 @@ ResID StResourceManager< T >::load( const std::any& params )
 template < typename T >
 void StResourceManager< T >::unload( ResID id )
 {
-     auto it = resources_.find( id );
-     if ( it != resources_.end() )
+     const HandlerType *handler = handlers_.find( id );
+     if ( handler )
      {
-          bool ok = T::unload( it->second );
-          if ( id + 1 == next_ )
-          {
-               --next_;
-          }
-          resources_.erase( it );
+          bool ok = T::unload( *handler );
+          handlers_.erase( id );
+          handlers_.release( id );
           if ( !ok )
           {
                throw ResourceException{ "cannot unload resource ", id };
@@ -97,29 +88,32 @@ void StResourceManager< T >::unload( ResID id )
 
 
 template < typename T >
-void StResourceManager< T >::clear()
+void StResourceManager< T >::update( ResID id, const std::any& params )
 {
-     next_ = 1;
-     for ( const auto& [ id, res ] : resources_ )
+     const HandlerType *handler = handlers_.find( id );
+     if ( !handler )
      {
-          if ( !T::unload( res ) )
-          {
-               LOG_16NAR_ERROR( "Unable to unload resource with id " << id );
-          }
+          throw ResourceException{ "no resource with such id ", id };
+     }
+     if ( !update_resource< T >( *handler, params ) )
+     {
+          throw ResourceException{ "cannot update resource ", id };
      }
-     resources_.clear();
 }
 
 
 template < typename T >
-std::any StResourceManager< T >::get_handler( ResID id ) const
+void StResourceManager< T >::clear()
 {
-     const auto iter = resources_.find( id );
-     if ( iter == resources_.cend() )
+     handlers_.for_each( []( ResID id, const HandlerType& handler )
      {
-          throw ResourceException{ "no resource with such id ", id };
-     }
-     return iter->second;
+          if ( !T::unload( handler ) )
+          {
+               LOG_16NAR_ERROR( "Unable to unload resource with id " << id );
+          }
+     } );
+     handlers_.clear();
+     handlers_.reset();
 }
 
 } // namespace _16nar::opengl
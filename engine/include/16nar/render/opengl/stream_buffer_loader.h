@@ -0,0 +1,41 @@
+/// @file
+/// @brief Header file with StreamBufferLoader class definition.
+#ifndef _16NAR_OPENGL_STREAM_BUFFER_LOADER_H
+#define _16NAR_OPENGL_STREAM_BUFFER_LOADER_H
+
+#include <16nar/render/opengl/utils.h>
+
+namespace _16nar::opengl
+{
+
+/// @brief Class for loading the stream buffer.
+/// @details Buffer storage is mapped persistently if OpenGL 4.4 is available,
+/// otherwise regions are mapped without synchronization on every write.
+/// In both cases reuse of a region is synchronized with fences.
+class StreamBufferLoader
+{
+public:
+     /// @brief Parameters of stream buffer loading.
+     using LoadParamsType = LoadParams< ResourceType::StreamBuffer >;
+
+     /// @brief Handler of stream buffer.
+     using HandlerType = Handler< ResourceType::StreamBuffer >;
+
+     /// @brief Allocate storage for all regions of stream buffer.
+     /// @param[in] managers resource managers for getting related resources.
+     /// @param[in] params parameters of stream buffer loading.
+     /// @param[out] handler handler of the stream buffer.
+     /// @return true on success, false otherwise.
+     /// @throws std::bad_alloc.
+     static bool load( const ResourceManagerMap& managers, const LoadParamsType& params, HandlerType& handler );
+
+     /// @brief Unload stream buffer.
+     /// @param[in] handler handler of the stream buffer.
+     /// @return true on success, false otherwise.
+     static bool unload( const HandlerType& handler );
+
+};
+
+} // namespace _16nar::opengl
+
+#endif // #ifndef _16NAR_OPENGL_STREAM_BUFFER_LOADER_H
@@ -0,0 +1,45 @@
+/// @file
+/// @brief Header file with TextureArrayLoader class definition.
+#ifndef _16NAR_OPENGL_TEXTURE_ARRAY_LOADER_H
+#define _16NAR_OPENGL_TEXTURE_ARRAY_LOADER_H
+
+#include <16nar/render/opengl/utils.h>
+
+namespace _16nar::opengl
+{
+
+/// @brief Class for loading the texture array.
+class TextureArrayLoader
+{
+public:
+     /// @brief Parameters of texture array loading.
+     using LoadParamsType = LoadParams< ResourceType::TextureArray >;
+
+     /// @brief Handler of texture array.
+     using HandlerType = Handler< ResourceType::TextureArray >;
+
+     /// @brief Parameters of texture array update.
+     using UpdateParamsType = UpdateParams< ResourceType::TextureArray >;
+
+     /// @brief Load texture array to OpenGL and fill its handler.
+     /// @param[in] params parameters of texture array loading.
+     /// @param[out] handler handler of the texture array.
+     /// @return true on success, false otherwise.
+     static bool load( const ResourceManagerMap&,
+          const LoadParamsType& params, HandlerType& handler );
+
+     /// @brief Replace a part of one layer of texture array in place.
+     /// @param[in] handler handler of the texture array.
+     /// @param[in] params parameters of texture array update.
+     /// @return true on success, false otherwise.
+     static bool update( const HandlerType& handler, const UpdateParamsType& params );
+
+     /// @brief Unload texture array from OpenGL.
+     /// @param[in] handler handler of the texture array.
+     /// @return true on success, false otherwise.
+     static bool unload( const HandlerType& handler );
+};
+
+} // namespace _16nar::opengl
+
+#endif // #ifndef _16NAR_OPENGL_TEXTURE_ARRAY_LOADER_H
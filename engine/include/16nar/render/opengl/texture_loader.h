@@ -18,6 +18,9 @@ public:
      /// @brief Handler of texture.
     using HandlerType = Handler< ResourceType::Texture >;
 
+     /// @brief Parameters of texture update.
+     using UpdateParamsType = UpdateParams< ResourceType::Texture >;
+
      /// @brief Load texture to OpenGL and fill its handler.
      /// @param[in] params parameters of texture loading.
      /// @param[out] handler handler of the texture.
@@ -25,6 +28,12 @@ public:
      static bool load( const ResourceManagerMap&,
           const LoadParamsType& params, HandlerType& handler );
 
+     /// @brief Replace a part of texture data in place.
+     /// @param[in] handler handler of the texture.
+     /// @param[in] params parameters of texture update.
+     /// @return true on success, false otherwise.
+     static bool update( const HandlerType& handler, const UpdateParamsType& params );
+
      /// @brief Unload texture from OpenGL.
      /// @param[in] handler handler of the texture.
      /// @return true on success, false otherwise.
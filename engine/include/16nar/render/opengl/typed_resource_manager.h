@@ -0,0 +1,118 @@
+/// @file
+/// @brief File with TypedResourceManager class definition.
+#ifndef _16NAR_OPENGL_TYPED_RESOURCE_MANAGER_H
+#define _16NAR_OPENGL_TYPED_RESOURCE_MANAGER_H
+
+#include <16nar/render/render_defs.h>
+#include <16nar/render/iresource_manager.h>
+#include <16nar/render/opengl/handle_table.h>
+#include <16nar/render/opengl/utils.h>
+#include <16nar/system/exceptions.h>
+
+#include <any>
+#include <type_traits>
+
+namespace _16nar::opengl
+{
+
+/// @brief Base class of OpenGL resource managers, gives access to handlers without type erasure.
+/// @tparam H type of resource handler.
+template < typename H >
+class TypedResourceManager : public IResourceManager
+{
+public:
+     /// @brief Find handler of the resource.
+     /// @details Must be called from render thread.
+     /// @param[in] id ID of resource.
+     /// @return pointer to handler, nullptr if resource is not loaded.
+     const H *find_handler( ResID id ) const noexcept
+     {
+          return handlers_.find( id );
+     }
+
+     /// @copydoc IResourceManager::get_handler(ResID) const
+     virtual std::any get_handler( ResID id ) const override
+     {
+          const H *handler = handlers_.find( id );
+          if ( !handler )
+          {
+               throw ResourceException{ "no resource with such id ", id };
+          }
+          return *handler;
+     }
+
+protected:
+     HandleTable< H > handlers_;   ///< handlers of loaded resources.
+};
+
+
+/// @brief Check if loader supports updating resources in place.
+/// @details Loader supports updates if it defines UpdateParamsType and static update function.
+/// @tparam T type of resource loader.
+template < typename T, typename = void >
+struct IsUpdatable : std::false_type {};
+
+/// @copydoc IsUpdatable
+template < typename T >
+struct IsUpdatable< T, std::void_t< typename T::UpdateParamsType > > : std::true_type {};
+
+
+/// @brief Check type of update parameters for given loader.
+/// @tparam T type of resource loader.
+/// @param[in] params parameters of resource update.
+/// @throws ResourceException if parameters have wrong type or resource cannot be updated.
+template < typename T >
+void check_update_params( const std::any& params )
+{
+     if constexpr ( IsUpdatable< T >::value )
+     {
+          if ( !std::any_cast< typename T::UpdateParamsType >( &params ) )
+          {
+               throw ResourceException{ "wrong resource update parameters" };
+          }
+     }
+     else
+     {
+          throw ResourceException{ "resource of this type cannot be updated" };
+     }
+}
+
+
+/// @brief Update resource with given loader.
+/// @tparam T type of resource loader.
+/// @param[in] handler handler of the resource.
+/// @param[in] params parameters of resource update, checked by check_update_params.
+/// @return true on success, false otherwise.
+/// @throws ResourceException if parameters have wrong type or resource cannot be updated.
+template < typename T >
+bool update_resource( const typename T::HandlerType& handler, const std::any& params )
+{
+     check_update_params< T >( params );
+     if constexpr ( IsUpdatable< T >::value )
+     {
+          return T::update( handler, *std::any_cast< typename T::UpdateParamsType >( &params ) );
+     }
+     return false;
+}
+
+
+/// @brief Get typed OpenGL resource manager of given resource type.
+/// @details Managers are created by render API, so manager of resource type R
+/// is always derived from TypedResourceManager with handler of R.
+/// @tparam R type of resource.
+/// @param[in] managers all resource managers.
+/// @return pointer to resource manager, nullptr if there is no manager for R.
+template < ResourceType R >
+const TypedResourceManager< Handler< R > > *get_typed_manager( const ResourceManagerMap& managers ) noexcept
+{
+     const auto iter = managers.find( R );
+     if ( iter == managers.cend() )
+     {
+          return nullptr;
+     }
+     return static_cast< const TypedResourceManager< Handler< R > > * >( iter->second.get() );
+}
+
+} // namespace _16nar::opengl
+
+#endif // #ifndef _16NAR_OPENGL_TYPED_RESOURCE_MANAGER_H
@@ -0,0 +1,46 @@
+/// @file
+/// @brief Header file with UniformBufferLoader class definition.
+#ifndef _16NAR_OPENGL_UNIFORM_BUFFER_LOADER_H
+#define _16NAR_OPENGL_UNIFORM_BUFFER_LOADER_H
+
+#include <16nar/render/opengl/utils.h>
+
+namespace _16nar::opengl
+{
+
+/// @brief Class for loading the uniform buffer.
+class UniformBufferLoader
+{
+public:
+     /// @brief Parameters of uniform buffer loading.
+     using LoadParamsType = LoadParams< ResourceType::UniformBuffer >;
+
+     /// @brief Handler of uniform buffer.
+     using HandlerType = Handler< ResourceType::UniformBuffer >;
+
+     /// @brief Parameters of uniform buffer update.
+     using UpdateParamsType = UpdateParams< ResourceType::UniformBuffer >;
+
+     /// @brief Load uniform buffer and bind it to its binding point.
+     /// @param[in] managers resource managers for getting related resources.
+     /// @param[in] params parameters of uniform buffer loading.
+     /// @param[out] handler handler of the uniform buffer.
+     /// @return true on success, false otherwise.
+     static bool load( const ResourceManagerMap& managers, const LoadParamsType& params, HandlerType& handler );
+
+     /// @brief Replace a part of uniform buffer data in place.
+     /// @param[in] handler handler of the uniform buffer.
+     /// @param[in] params parameters of uniform buffer update.
+     /// @return true on success, false otherwise.
+     static bool update( const HandlerType& handler, const UpdateParamsType& params );
+
+     /// @brief Unload uniform buffer.
+     /// @param[in] handler handler of the uniform buffer.
+     /// @return true on success, false otherwise.
+     static bool unload( const HandlerType& handler );
+
+};
+
+} // namespace _16nar::opengl
+
+#endif // #ifndef _16NAR_OPENGL_UNIFORM_BUFFER_LOADER_H
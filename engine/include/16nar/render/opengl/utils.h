@@ -4,8 +4,13 @@
 #define _16NAR_GL_RENDER_DEFS_H
 
 #include <16nar/render/render_defs.h>
+#include <16nar/render/ishader_program.h>
 
 #include <vector>
+#include <array>
+#include <utility>
+#include <memory>
+#include <string_view>
 
 namespace _16nar::opengl
 {
@@ -18,6 +23,39 @@ template < ResourceType T > struct Handler
 };
 
 
+/// @brief Handler of texture.
+template <>
+struct Handler< ResourceType::Texture >
+{
+     unsigned int descriptor = 0;  ///< texture descriptor.
+     Vec2i size;                   ///< size of base level of the texture, in pixels.
+     bool multisample = false;     ///< is texture multisampled, so it cannot be updated.
+};
+
+
+/// @brief Handler of texture array.
+template <>
+struct Handler< ResourceType::TextureArray >
+{
+     unsigned int descriptor = 0;  ///< texture array descriptor.
+     Vec2i size;                   ///< size of each layer, in pixels.
+     std::size_t layers = 0;       ///< number of layers.
+};
+
+
+/// @brief Locations of active uniforms of a shader program, sorted by uniform identifier.
+using UniformLocations = std::vector< std::pair< UniformId, int > >;
+
+
+/// @brief Handler of shader program.
+template <>
+struct Handler< ResourceType::Shader >
+{
+     unsigned int descriptor = 0;                           ///< shader program descriptor.
+     std::shared_ptr< const UniformLocations > uniforms;    ///< locations of active uniforms, shared between copies.
+};
+
+
 /// @brief Handler of vertex buffer.
 template <>
 struct Handler< ResourceType::VertexBuffer >
@@ -25,9 +63,91 @@ struct Handler< ResourceType::VertexBuffer >
      unsigned int vbo_descriptor = 0;   ///< vertex buffer object descriptor.
      unsigned int vao_descriptor = 0;   ///< vertex array object descriptor.
      unsigned int ebo_descriptor = 0;   ///< element buffer object descriptor.
+     unsigned int index_type = 0;       ///< OpenGL type of indexes in element buffer.
+     std::size_t vbo_size = 0;          ///< size of vertex buffer object, in bytes.
+     std::size_t ebo_size = 0;          ///< size of element buffer object, in bytes.
 };
 
 
+/// @brief Handler of material.
+/// @details Related resources are stored by identifiers and resolved when the material
+/// is bound, so reloaded shader program or textures are used by the material.
+template <>
+struct Handler< ResourceType::Material >
+{
+     Shader shader;                                                   ///< shader program.
+     std::vector< Texture > textures;                                 ///< textures, in order of texture units.
+     std::vector< TextureArray > texture_arrays;                      ///< texture arrays, bound after textures.
+     std::vector< std::pair< UniformId, UniformValue > > uniforms;    ///< uniform identifiers and values.
+};
+
+
+/// @brief Handler of uniform buffer.
+template <>
+struct Handler< ResourceType::UniformBuffer >
+{
+     unsigned int descriptor = 0;  ///< buffer descriptor.
+     std::size_t size = 0;         ///< size of the buffer, in bytes.
+};
+
+
+/// @brief Number of regions in ring of stream buffer.
+/// @details One region is written by CPU while GPU reads the others,
+/// so writes do not wait for draw calls of previous frames.
+constexpr std::size_t stream_buffer_regions = _16nar_saved_frames + 1;
+
+
+/// @brief State of stream buffer, changed when the buffer is written.
+struct StreamBufferState
+{
+     std::byte *mapped = nullptr;                                ///< persistently mapped memory, nullptr if not supported.
+     std::array< void *, stream_buffer_regions > fences{};       ///< fences of draw calls reading regions, nullptr if none.
+};
+
+
+/// @brief Handler of stream buffer.
+template <>
+struct Handler< ResourceType::StreamBuffer >
+{
+     unsigned int vbo_descriptor = 0;                 ///< vertex buffer object descriptor.
+     unsigned int vao_descriptor = 0;                 ///< vertex array object descriptor.
+     std::size_t region_size = 0;                     ///< size of one region, in bytes.
+     std::size_t vertex_size = 0;                     ///< size of one vertex, in bytes.
+     bool instanced = false;                          ///< are attributes per-instance, so offsets select instances.
+     std::shared_ptr< StreamBufferState > state;      ///< state of the buffer, shared between copies.
+     std::shared_ptr< const std::vector< LoadParams< ResourceType::StreamBuffer >::AttribParams > >
+          attributes;                                 ///< attributes of a vertex, shared between copies.
+};
+
+
+/// @brief Check that updated region of a texture lies inside the texture.
+/// @param[in] offset position of the region, in texels.
+/// @param[in] size size of the region, in texels.
+/// @param[in] bounds size of the texture, in texels.
+/// @return true if region is not empty and lies inside the texture, false otherwise.
+bool is_region_inside( const Vec2i& offset, const Vec2i& size, const Vec2i& bounds ) noexcept;
+
+/// @brief Find binding point of uniform block declared by engine.
+/// @param[in] name name of the uniform block.
+/// @return binding point of the block, -1 if the block is not declared by engine.
+int find_uniform_block_binding( std::string_view name ) noexcept;
+
+/// @brief Find location of the uniform.
+/// @param[in] locations locations of active uniforms of a shader program.
+/// @param[in] id identifier of the uniform.
+/// @return location of the uniform, -1 if shader program has no active uniform with such identifier.
+int find_uniform_location( const UniformLocations& locations, UniformId id ) noexcept;
+
+/// @brief Set value of uniform in currently used shader program.
+/// @param[in] location location of the uniform.
+/// @param[in] value value of the uniform.
+void set_uniform_value( int location, const UniformValue& value ) noexcept;
+
+/// @brief Set pointers of attributes of stream buffer in currently bound vertex array.
+/// @param[in] handler handler of stream buffer, its buffer object must be bound to GL_ARRAY_BUFFER.
+/// @param[in] base offset of the first vertex in the buffer, in bytes.
+void set_stream_attributes( const Handler< ResourceType::StreamBuffer >& handler, std::size_t base ) noexcept;
+
 /// @brief Convert TextureWrap value to unsigned integer for OpenGL API.
 /// @param[in] wrap texture wrap.
 /// @return value acceptable by OpenGL.
@@ -48,6 +168,11 @@ unsigned int data_format_to_int( BufferDataFormat format );
 /// @return value acceptable by OpenGL.
 unsigned int data_type_to_int( DataType type );
 
+/// @brief Get size of one element of given data type.
+/// @param[in] type data type.
+/// @return size of element in bytes.
+std::size_t data_type_size( DataType type );
+
 /// @brief Convert BufferType value to unsigned integer for OpenGL API.
 /// @param[in] type buffer type.
 /// @return value acceptable by OpenGL.
@@ -18,6 +18,9 @@ public:
      /// @brief Handler of vertex buffer.
      using HandlerType = Handler< ResourceType::VertexBuffer >;
 
+     /// @brief Parameters of vertex buffer update.
+     using UpdateParamsType = UpdateParams< ResourceType::VertexBuffer >;
+
      /// @brief Load vertex buffer to OpenGL and fill its handler.
      /// @param[in] params parameters of vertex buffer loading.
      /// @param[out] handler handler of the vertex buffer.
@@ -25,6 +28,12 @@ public:
      static bool load( const ResourceManagerMap&,
           const LoadParamsType& params, HandlerType& handler );
 
+     /// @brief Replace a part of vertex buffer data in place.
+     /// @param[in] handler handler of the vertex buffer.
+     /// @param[in] params parameters of vertex buffer update.
+     /// @return true on success, false otherwise.
+     static bool update( const HandlerType& handler, const UpdateParamsType& params );
+
      /// @brief Unload vertex buffer from OpenGL.
      /// @param[in] handler handler of the vertex buffer.
      /// @return true on success, false otherwise.
@@ -0,0 +1,88 @@
+/// @file
+/// @brief Header file with ParticlePool class definition.
+#ifndef _16NAR_PARTICLE_POOL_H
+#define _16NAR_PARTICLE_POOL_H
+
+#include <16nar/16nardefs.h>
+#include <16nar/math/rectangle.h>
+
+#include <vector>
+#include <cstdint>
+
+namespace _16nar
+{
+
+/// @brief Pool of particles stored as structure of arrays.
+/// @details Each property of particles is stored in a separate array, so simulation
+/// processes several particles with one SIMD instruction (SSE is used if it is available).
+/// Order of particles is not preserved: dead particle is replaced by the last one.
+class ENGINE_API ParticlePool
+{
+public:
+     /// @brief Number of floats written per particle by @ref write_instances.
+     static constexpr std::size_t instance_floats = 3;
+
+     /// @brief Constructor.
+     /// @param[in] capacity maximal number of alive particles.
+     /// @param[in] seed seed of random generator used for velocity spread.
+     explicit ParticlePool( std::size_t capacity, uint32_t seed = 1 );
+
+     /// @brief Emit particles, particles which do not fit into the pool are discarded.
+     /// @param[in] count number of new particles.
+     /// @param[in] position position of new particles.
+     /// @param[in] velocity average velocity of new particles.
+     /// @param[in] spread maximal deviation of velocity in each dimension.
+     /// @param[in] lifetime lifetime of new particles, in seconds.
+     /// @return number of emitted particles.
+     std::size_t emit( std::size_t count, const Vec2f& position, const Vec2f& velocity,
+          const Vec2f& spread, float lifetime );
+
+     /// @brief Move particles, make them older and remove dead ones.
+     /// @param[in] delta time since previous update, in seconds.
+     /// @param[in] acceleration acceleration of all particles, for example, gravity.
+     void update( float delta, const Vec2f& acceleration );
+
+     /// @brief Remove all particles.
+     void clear() noexcept;
+
+     /// @brief Get bounds of positions of all particles.
+     /// @return bounds of particles, empty rectangle at origin if there are no particles.
+     FloatRect get_bounds() const noexcept;
+
+     /// @brief Write instance data of particles: position and fraction of lifetime passed.
+     /// @param[out] out array of at least @ref instance_floats * @ref get_size() floats.
+     void write_instances( float *out ) const noexcept;
+
+     /// @brief Get number of alive particles.
+     /// @return number of alive particles.
+     std::size_t get_size() const noexcept;
+
+     /// @brief Get maximal number of alive particles.
+     /// @return capacity of the pool.
+     std::size_t get_capacity() const noexcept;
+
+     /// @brief Get X coordinates of alive particles.
+     /// @return pointer to array of @ref get_size() elements.
+     const float *get_x() const noexcept;
+
+     /// @brief Get Y coordinates of alive particles.
+     /// @return pointer to array of @ref get_size() elements.
+     const float *get_y() const noexcept;
+
+private:
+     /// @brief Get random number in range [-1; 1].
+     float random() noexcept;
+
+     std::vector< float > x_;           ///< X coordinates of particles.
+     std::vector< float > y_;           ///< Y coordinates of particles.
+     std::vector< float > vx_;          ///< X components of velocities.
+     std::vector< float > vy_;          ///< Y components of velocities.
+     std::vector< float > age_;         ///< time since emission, in seconds.
+     std::vector< float > lifetime_;    ///< lifetime of particles, in seconds.
+     std::size_t size_;                 ///< number of alive particles.
+     uint32_t random_state_;            ///< state of xorshift random generator.
+};
+
+} // namespace _16nar
+
+#endif // #ifndef _16NAR_PARTICLE_POOL_H
@@ -0,0 +1,211 @@
+/// @file
+/// @brief File with CaptureRenderApi and RenderReplay class definitions.
+#ifndef _16NAR_RENDER_CAPTURE_H
+#define _16NAR_RENDER_CAPTURE_H
+
+#include <16nar/16nardefs.h>
+#include <16nar/render/irender_api.h>
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <istream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace _16nar
+{
+
+/// @brief Type of record in render capture.
+enum class CaptureRecordType : uint8_t
+{
+     Load,                    ///< resource load.
+     Unload,                  ///< resource unload.
+     Update,                  ///< resource update.
+     Process,                 ///< processing of render API.
+     EndFrame,                ///< end of frame.
+     Render,                  ///< draw call.
+     SetViewport,             ///< viewport change.
+     SetDepthTest,            ///< depth test state change.
+     BindShader,              ///< shader program bind.
+     SetShaderParams,         ///< uniforms of bound shader program.
+     BindMaterial,            ///< material bind.
+     UpdateUniformBuffer,     ///< write to uniform buffer.
+     AppendStreamData,        ///< append to stream buffer.
+     BindFramebuffer,         ///< framebuffer bind.
+     Clear                    ///< framebuffer clear.
+};
+
+
+/// @brief Get name of capture record type.
+/// @param[in] type type of capture record.
+/// @return name of the type.
+ENGINE_API const char *get_capture_record_name( CaptureRecordType type ) noexcept;
+
+
+/// @brief Render API which records calls to another render API into a capture stream.
+/// @details Calls are always forwarded to the wrapped render API. Capture covers given
+/// number of frames and may be started at any moment. If tracking of live resources is enabled,
+/// loading parameters of all live resources are serialized and kept, even when no capture is
+/// running, so capture begins with loads of resources created earlier. Otherwise only resources
+/// loaded during captures are kept, and capture using older resources cannot be replayed.
+/// Updates made before the capture are not kept, so such resources are replayed with their initial data.
+///
+/// Payloads (texel, vertex, shader and uniform data) are stored as size and FNV-1a hash,
+/// or also as data itself if payloads are enabled, then data of kept resources is held
+/// in memory until they are unloaded. Shader setup functions are called once more on capture,
+/// with a shader program which records uniforms, so they must not have side effects.
+///
+/// Capture is written in native byte order, with format version in its header.
+class ENGINE_API CaptureRenderApi : public IRenderApi
+{
+public:
+     /// @brief Constructor.
+     /// @param[in] api render API which executes the calls.
+     /// @param[in] payloads should payloads be stored in capture.
+     /// @param[in] track_live should loads of all live resources be kept for captures,
+     /// it costs serialization of each load and memory for its parameters.
+     /// @throws std::runtime_error if render API is not set.
+     CaptureRenderApi( std::unique_ptr< IRenderApi >&& api, bool payloads = false, bool track_live = false );
+
+     /// @brief Destructor, finishes active capture.
+     ~CaptureRenderApi();
+
+     /// @copydoc IRenderApi::load(ResourceType, const std::any&)
+     virtual Resource load( ResourceType type, const std::any& params ) override;
+
+     /// @copydoc IRenderApi::unload(const Resource&)
+     virtual void unload( const Resource& resource ) override;
+
+     /// @copydoc IRenderApi::update(const Resource&, const std::any&)
+     virtual void update( const Resource& resource, const std::any& params ) override;
+
+     /// @copydoc IRenderApi::get_device() const noexcept
+     virtual IRenderDevice& get_device() const noexcept override;
+
+     /// @copydoc IRenderApi::process()
+     virtual void process() override;
+
+     /// @copydoc IRenderApi::end_frame()
+     virtual void end_frame() override;
+
+     /// @brief Start capture of given number of frames.
+     /// @details Output stream must outlive the capture.
+     /// @param[in] output stream for capture data, opened in binary mode.
+     /// @param[in] frames number of frames to be captured.
+     /// @throws std::runtime_error if capture is already active or frame count is 0.
+     void start_capture( std::ostream& output, std::size_t frames );
+
+     /// @brief Finish capture before all requested frames are captured.
+     void stop_capture();
+
+     /// @brief Check if capture is active.
+     /// @return true if calls are captured, false otherwise.
+     bool is_capturing() const noexcept;
+
+     /// @brief Get render API which executes the calls.
+     /// @return wrapped render API.
+     IRenderApi& get_api() const noexcept;
+
+     /// @brief Check if payloads are stored in capture.
+     /// @return true if payloads are stored, false if only their sizes and hashes are.
+     bool has_payloads() const noexcept;
+
+private:
+     friend class CaptureRenderDevice;
+
+     /// @brief Write the record if capture is active.
+     /// @param[in] type type of the record.
+     /// @param[in] data serialized data of the record.
+     void write_record( CaptureRecordType type, const std::string& data );
+
+     std::unique_ptr< IRenderApi > api_;                         ///< render API executing the calls.
+     std::map< std::size_t, std::string > live_loads_;           ///< serialized loads of live resources, in load order.
+     std::unordered_map< Resource, std::size_t > live_order_;    ///< order of live resource loads.
+     std::size_t load_count_;                                    ///< number of loads, used for ordering.
+     std::ostream *output_;                                      ///< stream of active capture.
+     std::size_t frames_left_;                                   ///< number of frames left in active capture.
+     bool payloads_;                                             ///< are payloads stored.
+     bool track_live_;                                           ///< are loads of all live resources kept.
+     mutable std::mutex mutex_;                                  ///< mutex for calls from render thread.
+};
+
+
+/// @brief Time spent on one replayed record.
+struct ReplayTiming
+{
+     CaptureRecordType type;                 ///< type of the record.
+     std::size_t frame;                      ///< index of frame of the record.
+     std::chrono::nanoseconds duration;      ///< time spent on executing the record.
+};
+
+
+/// @brief Replay of render capture.
+/// @details Capture is parsed completely on construction, so replay measures only
+/// execution of the calls. Payloads missing from capture are replaced by zeros of the same size.
+/// Resource identifiers are mapped to the ones given by render API on replay.
+class ENGINE_API RenderReplay
+{
+public:
+     /// @brief Constructor, reads the capture.
+     /// @param[in] input stream with capture data, opened in binary mode.
+     /// @throws std::runtime_error if capture is malformed or has unsupported version.
+     explicit RenderReplay( std::istream& input );
+
+     /// @brief Execute all records against render API as fast as possible.
+     /// @details Timings of previous run are discarded.
+     /// Resources loaded by replay are unloaded after it.
+     /// @param[in] api render API executing the records.
+     /// @throws May throw exceptions of render API.
+     void run( IRenderApi& api );
+
+     /// @brief Get timings of records executed by last run.
+     /// @return timings in order of records.
+     const std::vector< ReplayTiming >& get_timings() const noexcept;
+
+     /// @brief Get number of records in capture.
+     /// @return number of records.
+     std::size_t get_record_count() const noexcept;
+
+     /// @brief Get number of frames in capture.
+     /// @return number of ended frames.
+     std::size_t get_frame_count() const noexcept;
+
+     /// @brief Get total size of payloads in capture.
+     /// @return size of payloads in bytes, including missing ones.
+     std::size_t get_payload_size() const noexcept;
+
+     /// @brief Check if capture contains payloads.
+     /// @return true if payloads are stored in capture, false otherwise.
+     bool has_payloads() const noexcept;
+
+     /// @brief Context of replay, maps captured resource identifiers.
+     struct Context
+     {
+          IRenderApi *api = nullptr;                        ///< render API executing the records.
+          std::unordered_map< Resource, ResID > ids;        ///< identifiers of loaded resources by captured ones.
+     };
+
+private:
+     /// @brief Replayed record.
+     struct Record
+     {
+          CaptureRecordType type;                           ///< type of the record.
+          std::function< void( Context& ) > execute;        ///< function executing the record.
+     };
+
+     std::vector< Record > records_;           ///< parsed records.
+     std::vector< ReplayTiming > timings_;     ///< timings of last run.
+     std::size_t frame_count_;                 ///< number of frames.
+     std::size_t payload_size_;                ///< total size of payloads.
+     bool payloads_;                           ///< does capture contain payloads.
+};
+
+} // namespace _16nar
+
+#endif // #ifndef _16NAR_RENDER_CAPTURE_H
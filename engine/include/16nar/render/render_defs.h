@@ -5,7 +5,9 @@
 
 #include <16nar/16nardefs.h>
 #include <16nar/math/vec.h>
+#include <16nar/math/transform_matrix.h>
 #include <16nar/render/iresource_manager.h>
+#include <16nar/render/ishader_program.h>
 
 #include <string>
 #include <vector>
@@ -13,12 +15,13 @@
 #include <functional>
 #include <unordered_map>
 #include <memory>
+#include <optional>
+#include <variant>
+#include <cassert>
 
 namespace _16nar
 {
 
-class IShaderProgram; // forward declaration
-
 /// @brief Map of resource types to respective resource manager.
 using ResourceManagerMap = std::unordered_map< ResourceType, std::unique_ptr< IResourceManager > >;
 
@@ -28,9 +31,22 @@ using ShaderSetupFunction = std::function< void( const IShaderProgram& ) >;
 /// @brief Shared pointer to raw data.
 using DataSharedPtr = std::shared_ptr< std::byte >;
 
+/// @brief Value of a shader program uniform, stored in material.
+using UniformValue = std::variant< float, int, bool, Vec2i, Vec2f, Vec3i, Vec3f, Vec4i, Vec4f >;
+
 /// @brief Frames saved for profiles with multiple threads.
 constexpr std::size_t _16nar_saved_frames = 2;
 
+/// @brief Binding points of uniform blocks, shared by all shader programs.
+/// @details Shader programs get their blocks bound to these points by name on load.
+namespace uniform_bindings
+{
+
+constexpr unsigned int camera = 0;      ///< block "Camera", see CameraBlock.
+constexpr unsigned int animation = 1;   ///< block "Animation", see AnimationBlock.
+
+} // namespace uniform_bindings
+
 /// @brief Method of texture wrapping.
 /// @details Wrapping is used when rendering resource with
 /// resource coordinates outside the range [0;1].
@@ -69,11 +85,14 @@ enum class BufferDataFormat
 };
 
 
-/// @brief Type of data representing pixels.
+/// @brief Type of data representing pixels, vertex attributes or indices.
 enum class DataType
 {
      Byte,               ///< buffer is array of bytes (unsigned chars).
-     Float               ///< buffer is array of floats.
+     Float,              ///< buffer is array of floats.
+     HalfFloat,          ///< buffer is array of 16-bit floats (vertex attributes only).
+     UnsignedShort,      ///< buffer is array of unsigned 16-bit integers (vertex attributes and indices only).
+     UnsignedInt         ///< buffer is array of unsigned 32-bit integers (vertex attributes and indices only).
 };
 
 
@@ -146,6 +165,7 @@ struct LoadParams< ResourceType::Texture >
      Vec2i            size;                                 ///< size of texture in texels.
      std::size_t      samples = 0;                          ///< number of samples for texture (texture cannot have data, 0 if not used).
      DataSharedPtr    data{};                               ///< data of a texture.
+     std::vector< DataSharedPtr > mipmaps{};                ///< data of mipmap levels starting from level 1, each level is half the size of previous one.
 };
 
 
@@ -166,6 +186,24 @@ struct LoadParams< ResourceType::Cubemap >
 };
 
 
+/// @brief Parameters of texture array loading.
+/// @details All layers have the same size and format, so textures of different layers
+/// can be used in one draw call without bleeding between them.
+template <>
+struct LoadParams< ResourceType::TextureArray >
+{
+     BufferDataFormat format = BufferDataFormat::Rgb;       ///< format of texel data.
+     TextureFilter    min_filter = TextureFilter::Linear;   ///< filter used when minifying the image.
+     TextureFilter    mag_filter = TextureFilter::Linear;   ///< filter used when magnifying the image.
+     TextureWrap      wrap_x = TextureWrap::ClampToEdge;    ///< wrap method for horizontal coordinate.
+     TextureWrap      wrap_y = TextureWrap::ClampToEdge;    ///< wrap method for vertical coordinate.
+     DataType         data_type = DataType::Byte;           ///< type of texels data.
+     Vec4f            border_color;                         ///< color of the border, for ClampToBorder wrapping only.
+     Vec2i            size;                                 ///< size of each layer in texels.
+     std::vector< DataSharedPtr > data{};                   ///< data of layers, layer without data is left uninitialized.
+};
+
+
 /// @brief Parameters of render buffer loading.
 template <>
 struct LoadParams< ResourceType::RenderBuffer >
@@ -216,12 +254,18 @@ template <>
 struct LoadParams< ResourceType::VertexBuffer >
 {
      /// @brief Parameters of a buffer attribute.
-     /// @details Attributes are always tightly packed.
+     /// @details Offset and stride describe both interleaved layout (all attributes
+     /// of a vertex are stored together) and planar one (values of each attribute are
+     /// stored in a separate block). Integer attributes with normalization are mapped
+     /// to [0; 1] range, so UnsignedShort can replace Float for colors and texture coordinates.
      struct AttribParams
      {
           std::size_t size = Vec4f::size;         ///< size of an attribute (number of dimensions).
           DataType data_type = DataType::Float;   ///< type of buffer elements.
           bool normalized = false;                ///< should the data be normalized when loading.
+          std::size_t divisor = 0;                ///< number of instances sharing one value, 0 for per-vertex attribute.
+          std::size_t offset = 0;                 ///< offset of the first value in the buffer, in bytes.
+          std::size_t stride = 0;                 ///< distance between consecutive values in bytes, 0 if they are tightly packed.
      };
 
      /// @brief Parameters of a buffer.
@@ -235,6 +279,217 @@ struct LoadParams< ResourceType::VertexBuffer >
      std::vector< AttribParams > attributes;      ///< parameters of attributes.
      BufferParams buffer;                         ///< buffer with data, interpreted with help of attributes.
      BufferParams index_buffer;                   ///< buffer with index data, contains array of indexes.
+     DataType index_type = DataType::UnsignedInt; ///< type of indexes: Byte, UnsignedShort or UnsignedInt.
+};
+
+
+/// @brief Parameters of material loading.
+/// @details Material is a shader program with values of its uniforms and textures,
+/// which are applied together when the material is bound.
+template <>
+struct LoadParams< ResourceType::Material >
+{
+     /// @brief Parameters of a uniform.
+     struct UniformParams
+     {
+          std::string name;                       ///< name of the uniform in shader program.
+          UniformValue value;                     ///< value of the uniform.
+     };
+
+     Shader shader;                                    ///< shader program of the material.
+     std::vector< Texture > textures;                  ///< textures, bound to texture units in order.
+     std::vector< TextureArray > texture_arrays;       ///< texture arrays, bound to texture units after textures.
+     std::vector< UniformParams > uniforms;            ///< values of uniforms.
+
+     std::string shader_name;                          ///< name of shader in package, resolved by PackageManager.
+     std::vector< std::string > texture_names;         ///< names of textures in package, resolved by PackageManager.
+     std::vector< std::string > texture_array_names;   ///< names of texture arrays in package, resolved by PackageManager.
+};
+
+
+/// @brief Parameters of uniform buffer loading.
+/// @details Buffer is bound to its binding point on load, so all shader programs
+/// with uniform block bound to the same point read data from this buffer.
+template <>
+struct LoadParams< ResourceType::UniformBuffer >
+{
+     std::size_t size = 0;                        ///< size of the buffer, in bytes.
+     unsigned int binding = 0;                    ///< binding point of the buffer.
+     BufferType type = BufferType::DynamicDraw;   ///< type of memory used by buffer.
+     DataSharedPtr data{};                        ///< initial data of the buffer, may be empty.
+};
+
+
+/// @brief Parameters of stream buffer loading.
+/// @details Stream buffer is a ring of regions, one region is written every frame
+/// while GPU may still read the previous ones. Attributes are interleaved,
+/// so data of each vertex is stored contiguously, their offsets and strides are ignored.
+/// If attributes have non-zero divisor, they all must have it, then each "vertex" of the buffer
+/// is data of one instance and stream offset selects the first instance of draw call.
+template <>
+struct LoadParams< ResourceType::StreamBuffer >
+{
+     /// @brief Parameters of a buffer attribute.
+     using AttribParams = LoadParams< ResourceType::VertexBuffer >::AttribParams;
+
+     std::vector< AttribParams > attributes;      ///< parameters of attributes of a vertex.
+     std::size_t size = 0;                        ///< maximum size of data written per frame, in bytes.
+};
+
+
+/// @brief Parameters of texture atlas loading.
+/// @details Atlas is not a render resource, it maps names of sub-images
+/// to rectangles in page textures. Pages are textures of the same package,
+/// referred by names and resolved by PackageManager.
+template <>
+struct LoadParams< ResourceType::Atlas >
+{
+     /// @brief Parameters of a sub-image.
+     struct RegionParams
+     {
+          std::string name;                       ///< name of the sub-image.
+          std::size_t page = 0;                   ///< index of page containing the sub-image.
+          Vec2f position;                         ///< texture coordinates of top left corner of the sub-image.
+          Vec2f size;                             ///< size of the sub-image in texture coordinates, as stored in page.
+          bool rotated = false;                   ///< is the sub-image stored rotated 90 degrees clockwise.
+     };
+
+     std::vector< std::string > page_names;       ///< names of page textures in package.
+     std::vector< RegionParams > regions;         ///< sub-images of the atlas.
+};
+
+
+/// @brief Parameters for updating a part of loaded resource.
+/// @tparam T type of resource.
+template < ResourceType T > struct UpdateParams {};
+
+
+/// @brief Parameters of texture region update.
+/// @details Multisample textures cannot be updated.
+template <>
+struct UpdateParams< ResourceType::Texture >
+{
+     BufferDataFormat format = BufferDataFormat::Rgb;       ///< format of texel data.
+     DataType         data_type = DataType::Byte;           ///< type of texels data.
+     Vec2i            offset;                               ///< position of updated region in texels.
+     Vec2i            size;                                 ///< size of updated region in texels.
+     DataSharedPtr    data{};                               ///< new data of the region.
+};
+
+
+/// @brief Parameters of texture array update.
+template <>
+struct UpdateParams< ResourceType::TextureArray >
+{
+     BufferDataFormat format = BufferDataFormat::Rgb;       ///< format of texel data.
+     DataType         data_type = DataType::Byte;           ///< type of texels data.
+     std::size_t      layer = 0;                            ///< index of updated layer.
+     Vec2i            offset;                               ///< position of updated region in texels.
+     Vec2i            size;                                 ///< size of updated region in texels.
+     DataSharedPtr    data{};                               ///< new data of the region.
+};
+
+
+/// @brief Parameters of vertex buffer update.
+template <>
+struct UpdateParams< ResourceType::VertexBuffer >
+{
+     std::size_t offset = 0;                      ///< offset of updated data in the buffer, in bytes.
+     std::size_t size = 0;                        ///< size of updated data, in bytes.
+     DataSharedPtr data{};                        ///< new data of the buffer part.
+     bool index_buffer = false;                   ///< update index buffer instead of vertex data.
+};
+
+
+/// @brief Parameters of uniform buffer update.
+template <>
+struct UpdateParams< ResourceType::UniformBuffer >
+{
+     std::size_t offset = 0;                      ///< offset of updated data in the buffer, in bytes.
+     std::size_t size = 0;                        ///< size of updated data, in bytes.
+     DataSharedPtr data{};                        ///< new data of the buffer part.
+};
+
+
+/// @brief Data of uniform block "Camera", written once per frame.
+/// @details Block replaces separate view_matr and proj_matr uniforms, it is bound to
+/// uniform_bindings::camera by name when shader program is loaded.
+/// Layout matches the following block declaration in GLSL:
+/// @code
+/// layout (std140) uniform Camera
+/// {
+///      mat4 view_matr;
+///      mat4 proj_matr;
+/// };
+/// @endcode
+struct CameraBlock
+{
+     float view_matr[ 16 ];   ///< view matrix, column-major.
+     float proj_matr[ 16 ];   ///< projection matrix, column-major.
+};
+
+
+/// @brief Data of uniform block "Animation" with frame table of all animation clips.
+/// @details Time is written once per frame, frames are written only when a clip is added,
+/// so shader selects frame of animation without per-object work on CPU.
+/// Layout matches the following block declaration in GLSL:
+/// @code
+/// layout (std140) uniform Animation
+/// {
+///      vec4 time;             // x is time in seconds
+///      vec4 frames[ 1023 ];   // xy is position, zw is size of frame in texture coordinates
+/// };
+/// uniform vec4 animation_clip;   // first frame, frame count, frame rate, start time
+/// uniform bool animation_loop;
+///
+/// int frame = int( floor( ( time.x - animation_clip.w ) * animation_clip.z ) );
+/// int count = int( animation_clip.y );
+/// frame = animation_loop ? ( ( frame % count ) + count ) % count : clamp( frame, 0, count - 1 );
+/// vec4 rect = frames[ int( animation_clip.x ) + frame ];
+/// @endcode
+struct AnimationBlock
+{
+     static constexpr std::size_t max_frames = 1023;   ///< maximal number of frames, block fits in 16 KiB.
+
+     float time[ 4 ];                   ///< time in seconds in the first component.
+     float frames[ max_frames ][ 4 ];   ///< position and size of frames in texture coordinates.
+};
+
+
+/// @brief Animation clip, sequence of frames in the frame table.
+struct AnimationClip
+{
+     Texture texture;                   ///< texture containing all frames of the clip.
+     std::size_t first_frame = 0;       ///< index of the first frame in the frame table.
+     std::size_t frame_count = 0;       ///< number of frames.
+     float frame_rate = 1.0f;           ///< number of frames per second.
+     bool loop = true;                  ///< does the clip start again after the last frame.
+};
+
+
+/// @brief Rectangular part of a texture, for example, sub-image of an atlas.
+struct TextureRegion
+{
+     Texture texture;                   ///< texture containing the region.
+     Vec2f position;                    ///< texture coordinates of top left corner of the region.
+     Vec2f size{ 1.0f, 1.0f };          ///< size of the region in texture coordinates, as stored in texture.
+     bool rotated = false;              ///< is the region stored rotated 90 degrees clockwise.
+
+     /// @brief Get texture coordinates of corners of the image, rotation of stored region is undone.
+     /// @return texture coordinates of top left, top right, bottom right and bottom left corners of the image.
+     inline std::array< Vec2f, 4 > get_tex_coords() const noexcept
+     {
+          Vec2f top_left = position;
+          Vec2f top_right = position + Vec2f{ size.x(), 0.0f };
+          Vec2f bottom_right = position + size;
+          Vec2f bottom_left = position + Vec2f{ 0.0f, size.y() };
+          if ( rotated )
+          {
+               // top left corner of the image is stored at top right corner of the region
+               return { top_right, bottom_right, bottom_left, top_left };
+          }
+          return { top_left, top_right, bottom_right, bottom_left };
+     }
 };
 
 
@@ -242,21 +497,81 @@ struct LoadParams< ResourceType::VertexBuffer >
 struct RenderParams
 {
      std::vector< Texture > textures;                  ///< active textures for rendering.
+     std::vector< TextureArray > texture_arrays;       ///< active texture arrays for rendering, bound after textures.
      VertexBuffer vertex_buffer;                       ///< vertex buffer for rendering.
      PrimitiveType primitive = PrimitiveType::Points;  ///< type of primitive to draw.
      std::size_t vertex_count = 0;                     ///< number of vertices in each instance.
      std::size_t instance_count = 1;                   ///< number of instances to draw.
+     StreamBuffer stream_buffer;                       ///< stream buffer for rendering, used instead of vertex buffer if set.
+     std::size_t stream_offset = 0;                    ///< offset of vertex data in stream buffer, returned on append.
+};
+
+
+/// @brief Uniform values of one drawn object.
+/// @details Values are stored in place, so unlike shader setup function they are
+/// passed to render device without memory allocation. Values which are the same
+/// for all objects should be kept in material.
+struct ObjectUniforms
+{
+     /// @brief Maximal number of values besides model matrix.
+     static constexpr std::size_t max_values = 2;
+
+     TransformMatrix model_matr;                                                ///< model matrix of the object.
+     std::array< std::pair< UniformId, UniformValue >, max_values > values{};  ///< other values of uniforms.
+     std::size_t value_count = 0;                                               ///< number of used values.
+
+     /// @brief Add value of a uniform.
+     /// @details Value is dropped if all @ref max_values places are used, it is asserted in debug builds.
+     /// @param[in] id identifier of the uniform.
+     /// @param[in] value value of the uniform.
+     /// @return true if value was added, false if it was dropped.
+     inline bool add( UniformId id, const UniformValue& value ) noexcept
+     {
+          assert( value_count < max_values && "too many uniform values of an object" );
+          if ( value_count >= max_values )
+          {
+               return false;
+          }
+          values[ value_count++ ] = { id, value };
+          return true;
+     }
+
+     /// @brief Set values of uniforms to shader program.
+     /// @param[in] program shader program.
+     inline void apply( const IShaderProgram& program ) const noexcept
+     {
+          program.set_uniform( uniform_ids::model_matr, model_matr );
+          for ( std::size_t i = 0; i < value_count; i++ )
+          {
+               UniformId id = values[ i ].first;
+               std::visit( [ &program, id ]( const auto& value ){ program.set_uniform( id, value ); }, values[ i ].second );
+          }
+     }
 };
 
 
 /// @brief Information needed to render one object.
+/// @details If material is set, it is bound instead of shader.
 struct DrawInfo
 {
-     RenderParams render_params;        ///< parameters of a render call.
-     ShaderSetupFunction shader_setup;  ///< shader program setup function.
+     RenderParams render_params;                  ///< parameters of a render call.
+     std::optional< ObjectUniforms > uniforms;    ///< uniforms of the object, set before shader setup function.
+     ShaderSetupFunction shader_setup;            ///< shader program setup function, may be empty.
      Shader shader;                     ///< shader program used to render object.
+     Material material;                 ///< material used to render object.
 };
 
+
+/// @brief Get key for sorting draw calls to minimize state changes.
+/// @details Objects with the same material (or shader, if material is not set)
+/// have equal keys, so they are drawn one after another.
+/// @param[in] info information needed to render an object.
+/// @return sort key.
+inline uint64_t get_sort_key( const DrawInfo& info ) noexcept
+{
+     return ( static_cast< uint64_t >( info.material.id ) << 32 ) | info.shader.id;
+}
+
 } // namespace _16nar
 
 #endif // #ifndef _16NAR_RENDER_DEFS_H
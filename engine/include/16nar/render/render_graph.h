@@ -0,0 +1,143 @@
+/// @file
+/// @brief Header file with RenderGraph class definition.
+#ifndef _16NAR_RENDER_GRAPH_H
+#define _16NAR_RENDER_GRAPH_H
+
+#include <16nar/render/render_defs.h>
+
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace _16nar
+{
+
+class RenderGraph;
+
+/// @brief Identifier of render target of render graph.
+using RenderTargetId = std::size_t;
+
+
+/// @brief Description of transient render target, targets with equal descriptions may share a texture.
+struct RenderTargetDesc
+{
+     Vec2i size;                                            ///< size of target in texels.
+     BufferDataFormat format = BufferDataFormat::Rgba;      ///< format of texels, depth formats make depth attachments.
+     DataType data_type = DataType::Byte;                   ///< type of texels data.
+
+     inline bool operator==( const RenderTargetDesc& rhs ) const noexcept
+     {
+          return size == rhs.size && format == rhs.format && data_type == rhs.data_type;
+     }
+     inline bool operator!=( const RenderTargetDesc& rhs ) const noexcept { return !( *this == rhs ); }
+};
+
+
+/// @brief Pass of render graph.
+struct RenderPass
+{
+     std::string name;                                      ///< name of the pass, for error messages.
+     std::vector< RenderTargetId > reads;                   ///< targets sampled by the pass.
+     std::vector< RenderTargetId > writes;                  ///< targets attached to framebuffer of the pass, colors in order.
+     std::function< void( const RenderGraph& ) > execute;   ///< function drawing the pass, its framebuffer is already bound.
+};
+
+
+/// @brief Graph of render passes with transient render targets.
+/// @details Passes declare targets they read and write. On compilation passes are ordered
+/// so writers of a target run before its readers (writers of the same target keep order of
+/// addition), and passes whose results are not used by the screen or output targets are culled.
+/// Transient targets get textures from a pool keyed by description, targets whose lifetimes
+/// do not overlap share a texture. The pool and framebuffers are kept between compilations,
+/// so graph may be rebuilt when effects are toggled without loading new resources.
+class ENGINE_API RenderGraph
+{
+public:
+     /// @brief Target meaning default framebuffer, it cannot be read.
+     static constexpr RenderTargetId screen = 0;
+
+     /// @brief Constructor.
+     RenderGraph();
+
+     /// @brief Declare transient render target.
+     /// @param[in] desc description of the target.
+     /// @return identifier of the target.
+     RenderTargetId create_target( const RenderTargetDesc& desc );
+
+     /// @brief Add pass to the graph.
+     /// @param[in] pass pass to be added.
+     void add_pass( const RenderPass& pass );
+
+     /// @brief Mark target as used outside of the graph, so its writers are not culled
+     /// and its texture is not shared with other targets.
+     /// @param[in] target identifier of the target.
+     void set_output( RenderTargetId target );
+
+     /// @brief Order and cull passes, assign textures of the pool to targets.
+     /// @throws std::runtime_error if passes have cyclic dependencies, target is unknown,
+     /// read before being written, or pass reads its own target.
+     void compile();
+
+     /// @brief Execute compiled passes, textures and framebuffers are loaded on first use.
+     /// @details Viewport is set to size of the target for each pass, and is restored
+     /// to size of the screen for passes drawing the screen and after the last pass.
+     /// @param[in] screen_size size of default framebuffer, in pixels.
+     void execute( const Vec2i& screen_size );
+
+     /// @brief Remove passes and targets, textures of the pool are kept.
+     void clear() noexcept;
+
+     /// @brief Get passes in order of execution.
+     /// @return indexes of passes in order of addition, culled passes are not included.
+     const std::vector< std::size_t >& get_order() const noexcept;
+
+     /// @brief Get index of texture of the pool assigned to the target.
+     /// @param[in] target identifier of the target.
+     /// @throws std::runtime_error if target has no texture, for example, its writers are culled.
+     /// @return index of texture in the pool.
+     std::size_t get_slot( RenderTargetId target ) const;
+
+     /// @brief Get number of textures in the pool.
+     /// @return number of textures in the pool.
+     std::size_t get_pool_size() const noexcept;
+
+     /// @brief Get texture assigned to the target, may be used by passes to sample the target.
+     /// @param[in] target identifier of the target.
+     /// @throws std::runtime_error if target has no texture.
+     /// @return texture of the target, its ID is 0 before the first execution.
+     Texture get_texture( RenderTargetId target ) const;
+
+     /// @brief Unload textures of the pool which are not used by compiled graph.
+     void trim_pool();
+
+     /// @brief Unload all textures and framebuffers, remove passes and targets.
+     void reset();
+
+private:
+     /// @brief Texture of the pool.
+     struct Slot
+     {
+          RenderTargetDesc desc;                  ///< description of targets using the texture.
+          Texture texture;                        ///< texture, ID is 0 if it is not loaded yet.
+          bool used = false;                      ///< is the texture used by compiled graph.
+     };
+
+     /// @brief Get framebuffer with given textures attached, load it if needed.
+     FrameBuffer get_framebuffer( const std::vector< RenderTargetId >& targets );
+
+     /// @brief Check that target exists.
+     void check_target( RenderTargetId target, const std::string& pass ) const;
+
+     std::vector< RenderTargetDesc > targets_;                   ///< descriptions of targets, except the screen.
+     std::vector< RenderPass > passes_;                          ///< passes in order of addition.
+     std::vector< bool > outputs_;                               ///< is target used outside of the graph.
+     std::vector< std::size_t > order_;                          ///< compiled order of passes.
+     std::vector< std::size_t > target_slots_;                   ///< slots of targets, npos if not assigned.
+     std::vector< Slot > pool_;                                  ///< pool of textures.
+     std::map< std::vector< ResID >, FrameBuffer > framebuffers_; ///< framebuffers by attached textures.
+};
+
+} // namespace _16nar
+
+#endif // #ifndef _16NAR_RENDER_GRAPH_H
@@ -0,0 +1,100 @@
+/// @file
+/// @brief Header file with FrameScheduler class definition.
+#ifndef _16NAR_FRAME_SCHEDULER_H
+#define _16NAR_FRAME_SCHEDULER_H
+
+#include <16nar/16nardefs.h>
+
+#include <chrono>
+#include <cstddef>
+
+namespace _16nar
+{
+
+/// @brief Statistics of frames measured by scheduler, times are in seconds.
+struct FrameStats
+{
+     std::size_t frame_count = 0;       ///< number of measured frames.
+     std::size_t step_count = 0;        ///< number of fixed update steps.
+     std::size_t dropped_steps = 0;     ///< number of steps skipped because of catch-up limit.
+     float last_frame_time = 0.0f;      ///< time of the last frame.
+     float average_frame_time = 0.0f;   ///< exponential moving average of frame time.
+     float min_frame_time = 0.0f;       ///< minimal frame time.
+     float max_frame_time = 0.0f;       ///< maximal frame time.
+};
+
+
+/// @brief Scheduler of frames with fixed update step.
+/// @details Time passed between frames is accumulated and consumed by fixed update steps.
+/// If frame takes too long, at most given number of steps is run and the rest of time is dropped,
+/// so slow updates do not cause a spiral of ever longer frames. Part of the step left in
+/// accumulator is given to rendering as interpolation factor.
+///
+/// Between frames the scheduler waits until the next step is due: it sleeps while
+/// the deadline is far away and spins for the last part, because sleep is not precise.
+class ENGINE_API FrameScheduler
+{
+public:
+     using Clock = std::chrono::steady_clock;
+
+     /// @brief Constructor.
+     /// @param[in] step time of one update step, in seconds.
+     /// @param[in] max_steps maximal number of update steps in one frame.
+     explicit FrameScheduler( float step = 1.0f / 60.0f, std::size_t max_steps = 5 ) noexcept;
+
+     /// @brief Set time of one update step.
+     /// @param[in] step time of one update step, in seconds.
+     void set_step( float step ) noexcept;
+
+     /// @brief Get time of one update step.
+     /// @return time of one update step, in seconds.
+     float get_step() const noexcept;
+
+     /// @brief Set maximal number of update steps in one frame.
+     /// @param[in] max_steps maximal number of update steps, at least one step is run.
+     void set_max_steps( std::size_t max_steps ) noexcept;
+
+     /// @brief Set time before deadline when scheduler stops sleeping and starts spinning.
+     /// @param[in] margin time of spinning, in seconds.
+     void set_spin_margin( float margin ) noexcept;
+
+     /// @brief Start measuring time from now, accumulated time and statistics are discarded.
+     void reset() noexcept;
+
+     /// @brief Start a frame, measuring time since the previous one.
+     /// @return number of update steps to be run in this frame.
+     std::size_t begin_frame() noexcept;
+
+     /// @brief Add time passed since the previous frame.
+     /// @details Called by @ref begin_frame, may be used to drive the scheduler by external clock.
+     /// @param[in] elapsed time since the previous frame.
+     /// @return number of update steps to be run in this frame.
+     std::size_t advance( Clock::duration elapsed ) noexcept;
+
+     /// @brief Get interpolation factor between the previous and the current update step.
+     /// @return part of the step left in accumulator, in range [0; 1).
+     float get_alpha() const noexcept;
+
+     /// @brief Get time left until the next update step is due.
+     /// @return time until the next step, zero if it is already due.
+     Clock::duration get_time_to_next_step() const noexcept;
+
+     /// @brief Wait until the next update step is due.
+     void wait_next_step() const;
+
+     /// @brief Get frame statistics.
+     /// @return statistics of frames since the last reset.
+     const FrameStats& get_stats() const noexcept;
+
+private:
+     Clock::duration step_;             ///< time of one update step.
+     Clock::duration accumulator_;      ///< time not yet consumed by update steps.
+     Clock::duration spin_margin_;      ///< time of spinning before deadline.
+     Clock::time_point frame_start_;    ///< start time of the current frame.
+     std::size_t max_steps_;            ///< maximal number of update steps in one frame.
+     FrameStats stats_;                 ///< frame statistics.
+};
+
+} // namespace _16nar
+
+#endif // #ifndef _16NAR_FRAME_SCHEDULER_H
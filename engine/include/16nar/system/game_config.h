@@ -5,8 +5,10 @@
 
 #include <16nar/16nardefs.h>
 #include <16nar/logger/ilog_writer.h>
+#include <16nar/system/thread_settings.h>
 #include <16nar/tools/resource_package.h>
 
+#include <cstddef>
 #include <string>
 #include <iosfwd>
 #include <filesystem>
@@ -55,6 +57,8 @@ struct ENGINE_API GameConfig
      tools::PackageFormat resources_format;  ///< format of resources (default is FlatBuffers).
      tools::PackageFormat scene_format;      ///< format of scene data (default is FlatBuffers).
      bool resources_unpacked;                ///< read unpacked or packed resources (default is false).
+     std::size_t worker_threads;             ///< number of job system workers (default is hardware threads except main).
+     ThreadPriority worker_priority;         ///< priority of job system workers (default is inherited from the process).
 };
 
 } // namespace _16nar
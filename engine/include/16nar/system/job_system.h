@@ -0,0 +1,182 @@
+/// @file
+/// @brief Header file with JobSystem and JobGroup class definitions.
+#ifndef _16NAR_JOB_SYSTEM_H
+#define _16NAR_JOB_SYSTEM_H
+
+#include <16nar/16nardefs.h>
+#include <16nar/system/thread_settings.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace _16nar
+{
+
+class JobSystem;
+
+/// @brief Group of jobs which can be waited for together (fork/join).
+/// @details Group must not be destroyed while it has unfinished jobs.
+class ENGINE_API JobGroup
+{
+public:
+     /// @brief Constructor.
+     JobGroup() noexcept;
+
+     /// @brief Check if all jobs of the group are finished.
+     /// @return true if there are no unfinished jobs, false otherwise.
+     bool is_done() const noexcept;
+
+private:
+     JobGroup( const JobGroup& )            = delete;
+     JobGroup& operator=( const JobGroup& ) = delete;
+
+     friend class JobSystem;
+
+     std::atomic_size_t pending_;                      ///< number of unfinished jobs.
+     std::mutex error_mutex_;                          ///< mutex guarding the exception.
+     std::exception_ptr error_;                        ///< first exception thrown by jobs of the group.
+};
+
+
+/// @brief Scheduler of jobs executed by pool of worker threads with work stealing.
+/// @details Each worker has its own deque: jobs submitted from a worker are pushed to its deque
+/// and taken back in LIFO order, so nested jobs run while their data is hot. Idle workers steal
+/// oldest jobs from deques of other workers. Jobs submitted from other threads go to shared queue.
+///
+/// Thread waiting for a group executes pending jobs until the group is done, and sleeps
+/// only when all remaining jobs of the group are taken by other threads.
+/// So the main thread participates in work, and system with zero workers runs all jobs
+/// in waiting threads.
+class ENGINE_API JobSystem
+{
+public:
+     using Job = std::function< void() >;
+
+     /// @brief Get number of workers recommended for this machine.
+     /// @return number of hardware threads except the main one.
+     static std::size_t get_default_worker_count() noexcept;
+
+     /// @brief Constructor, starts worker threads.
+     /// @param[in] worker_count number of worker threads, may be zero.
+     /// @param[in] worker_priority priority of worker threads, by default it is inherited from the process.
+     explicit JobSystem( std::size_t worker_count, ThreadPriority worker_priority = ThreadPriority::Inherit );
+
+     /// @brief Destructor, finishes queued jobs and stops worker threads.
+     ~JobSystem();
+
+     /// @brief Get number of worker threads.
+     /// @return number of worker threads.
+     std::size_t get_worker_count() const noexcept;
+
+     /// @brief Add job to the group and schedule it for execution.
+     /// @param[in] group group of the job.
+     /// @param[in] job job to be executed.
+     void submit( JobGroup& group, Job job );
+
+     /// @brief Execute jobs until all jobs of the group are finished.
+     /// @param[in] group group to be waited for.
+     /// @throws Rethrows the first exception thrown by jobs of the group.
+     void wait( JobGroup& group );
+
+     /// @brief Execute one pending job in calling thread, if there is any.
+     /// @details Allows the main thread to help workers between its own tasks.
+     /// @return true if a job was executed, false if there were no pending jobs.
+     bool run_pending();
+
+     /// @brief Get index of calling thread in the system.
+     /// @details Allows jobs to collect results in per-thread storage of size worker count + 1.
+     /// All threads which are not workers of this system share the last index.
+     /// @return index of worker, or worker count if calling thread is not a worker of this system.
+     std::size_t get_thread_index() const noexcept;
+
+     /// @brief Call function for all subranges of [begin; end) in parallel and wait for them.
+     /// @param[in] begin start of the range.
+     /// @param[in] end end of the range, not included.
+     /// @param[in] grain size of one subrange, chosen by number of workers if zero.
+     /// @param[in] func function called as func( sub_begin, sub_end ).
+     /// @throws Rethrows the first exception thrown by the function.
+     template < typename Function >
+     void parallel_for( std::size_t begin, std::size_t end, std::size_t grain, Function&& func );
+
+private:
+     JobSystem( const JobSystem& )            = delete;
+     JobSystem& operator=( const JobSystem& ) = delete;
+
+     /// @brief Job with its group.
+     struct Task
+     {
+          Job job;                                     ///< job to be executed.
+          JobGroup *group;                             ///< group of the job.
+     };
+
+     /// @brief Deque of tasks.
+     struct TaskQueue
+     {
+          std::mutex mutex;                            ///< mutex guarding the deque.
+          std::deque< Task > tasks;                    ///< queued tasks.
+     };
+
+     /// @brief Get grain of range splitting, so each thread gets several subranges.
+     /// @param[in] size size of the range.
+     /// @return size of one subrange.
+     std::size_t get_default_grain( std::size_t size ) const noexcept;
+
+     /// @brief Take task from own deque, shared queue or other workers.
+     /// @param[in] index index of calling worker, worker count for other threads.
+     /// @param[out] task taken task.
+     /// @return true if task was taken, false otherwise.
+     bool take_task( std::size_t index, Task& task );
+
+     /// @brief Execute task and finish it in its group.
+     /// @param[in] task task to be executed.
+     void execute( Task& task ) noexcept;
+
+     /// @brief Main function of worker thread.
+     /// @param[in] index index of the worker.
+     void worker_loop( std::size_t index );
+
+private:
+     std::vector< std::unique_ptr< TaskQueue > > queues_;   ///< deques of workers, the last one is shared.
+     std::vector< std::thread > workers_;                   ///< worker threads.
+     std::atomic_size_t queued_;                            ///< number of queued tasks.
+     std::atomic_bool stop_;                                ///< should workers stop.
+     ThreadPriority worker_priority_;                       ///< priority of worker threads.
+     std::mutex sleep_mutex_;                               ///< mutex of sleeping workers and waiting threads.
+     std::condition_variable sleep_cv_;                     ///< condition of sleeping workers.
+     std::condition_variable wait_cv_;                      ///< condition of threads waiting for groups.
+     std::size_t waiting_;                                  ///< number of threads waiting for groups, guarded by sleep_mutex_.
+};
+
+
+template < typename Function >
+void JobSystem::parallel_for( std::size_t begin, std::size_t end, std::size_t grain, Function&& func )
+{
+     if ( begin >= end )
+     {
+          return;
+     }
+     if ( grain == 0 )
+     {
+          grain = get_default_grain( end - begin );
+     }
+     JobGroup group;
+     for ( std::size_t chunk = begin; chunk < end; )
+     {
+          std::size_t chunk_end = end - chunk > grain ? chunk + grain : end;
+          submit( group, [ &func, chunk, chunk_end ](){ func( chunk, chunk_end ); } );
+          chunk = chunk_end;
+     }
+     wait( group );
+}
+
+} // namespace _16nar
+
+#endif // #ifndef _16NAR_JOB_SYSTEM_H
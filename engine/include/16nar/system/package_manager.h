@@ -4,6 +4,7 @@
 #define _16NAR_PACKAGE_MANAGER_H
 
 #include <16nar/16nardefs.h>
+#include <16nar/render/render_defs.h>
 #include <16nar/tools/iasset_reader.h>
 
 #include <string_view>
@@ -34,6 +35,9 @@ public:
 
      /// @brief Load resource package and create all its resources.
      /// @details Package can be packed into single file.
+     /// Atlases and materials are loaded after all other resources of the package, their shaders,
+     /// textures and pages are referred by names: "resource_name" for resources of the same package,
+     /// "package_name/resource_name" for resources of already loaded packages.
      /// If package is unpacked, then resources should be in directory with the name of package.
      /// If load of a resource from a package fails, then all previously loaded resources
      /// from this package should be unloaded. If this unload fails (exception is thrown
@@ -67,10 +71,19 @@ public:
      void set_package_dir( const std::string& dirname );
 
      /// @brief Get loaded resource.
+     /// @details Sub-image of an atlas is not returned, because it is only a part of the page
+     /// texture, it is got by @ref get_texture_region.
      /// @param[in] name name of resource in format "package_name/resource_name".
      /// @return valid resource if it exists, empty resource otherwise.
      Resource get_resource( const std::string& name ) const;
 
+     /// @brief Get region of loaded texture.
+     /// @details For sub-image of an atlas its rectangle in the page texture is returned,
+     /// for ordinary texture the region covers the whole texture.
+     /// @param[in] name name of texture or sub-image in format "package_name/resource_name".
+     /// @return region of texture if it exists, region with empty texture otherwise.
+     TextureRegion get_texture_region( const std::string& name ) const;
+
      /// @brief Release all saved information.
      /// @details Unload may throw, exception is not caught in this function.
      void clear();
@@ -82,6 +95,9 @@ private:
      /// @brief Map of resource names and resource handlers (names of form "package_name/resource_name").
      using ResourceMap = std::map< std::string, Resource >;
 
+     /// @brief Map of sub-image names and their regions (names of form "package_name/resource_name").
+     using RegionMap = std::map< std::string, TextureRegion >;
+
      /// @brief Map of resource handlers and iterators to their names.
      using NameMap = std::unordered_map< Resource, ResourceMap::const_iterator >;
 
@@ -92,9 +108,50 @@ private:
      /// @return true if package is loaded successfully, false otherwise.
      bool load_unpacked( const std::string& dirname );
 
+     /// @brief Load single resource of the package.
+     /// @details Atlas does not create a render resource, its sub-images are saved as regions.
+     /// @param[in] package name of the package.
+     /// @param[in] load_data data of the resource.
+     /// @param[in,out] loaded resources of the package loaded so far.
+     /// @param[in,out] loaded_names names of resources of the package loaded so far.
+     /// @param[in,out] loaded_regions sub-images of atlases of the package loaded so far.
+     /// @return true if resource is loaded successfully, false otherwise.
+     bool load_resource( const std::string& package, const tools::ResourceData& load_data,
+          ResourceMap& loaded, NameMap& loaded_names, RegionMap& loaded_regions ) const;
+
+     /// @brief Resolve page names of atlas and save its sub-images.
+     /// @param[in] package name of the package containing the atlas.
+     /// @param[in] load_data data of the atlas.
+     /// @param[in] loaded resources of the package loaded so far.
+     /// @param[in,out] loaded_regions sub-images of atlases of the package loaded so far.
+     /// @throws ResourceException if some page is not found or sub-image name is duplicated.
+     void load_atlas( const std::string& package, const tools::ResourceData& load_data,
+          const ResourceMap& loaded, RegionMap& loaded_regions ) const;
+
+     /// @brief Find resource by name used inside a package.
+     /// @param[in] package name of the package referring to the resource.
+     /// @param[in] name name of the resource, "resource_name" for resources of the same package,
+     /// "package_name/resource_name" for resources of already loaded packages.
+     /// @param[in] type required type of the resource.
+     /// @param[in] loaded resources of the package loaded so far.
+     /// @return identifier of the resource.
+     /// @throws ResourceException if the resource is not found.
+     ResID find_package_resource( const std::string& package, const std::string& name,
+          ResourceType type, const ResourceMap& loaded ) const;
+
+     /// @brief Resolve names of shader and textures of material to resources.
+     /// @param[in] package name of the package containing the material.
+     /// @param[in] load_data data of the material.
+     /// @param[in] loaded resources of the package loaded so far.
+     /// @return material load parameters with resolved resources.
+     /// @throws ResourceException if some resource is not found.
+     LoadParams< ResourceType::Material > resolve_material( const std::string& package,
+          const tools::ResourceData& load_data, const ResourceMap& loaded ) const;
+
 private:
      ResourceMap resources_;                      ///< all currently loaded resources.
      NameMap names_;                              ///< names of all currently loaded resources.
+     RegionMap regions_;                          ///< all currently loaded sub-images of atlases.
      std::unordered_set< std::string > packages_; ///< all currently loaded packages.
      std::string pkg_dir_;                        ///< path to directory containig resource packages.
      AssetReaderPtr reader_;                      ///< asset reaer.
@@ -0,0 +1,147 @@
+/// @file
+/// @brief Header file with Profiler and ProfileZone class definitions.
+#ifndef _16NAR_PROFILER_H
+#define _16NAR_PROFILER_H
+
+#include <16nar/16nardefs.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string_view>
+#include <vector>
+
+namespace _16nar
+{
+
+/// @brief Class-singleton collecting CPU time zones of all threads.
+/// @details Each thread writes its zones to its own buffer without locks,
+/// the lock is taken only when a thread writes its first zone. Buffer of a finished
+/// thread is reused by the next new thread, so number of buffers does not exceed
+/// number of threads running at once. Zones of finished threads are kept until
+/// the next capture, or appended by the thread which reuses the buffer.
+/// Zones which do not fit into buffer are dropped and counted.
+///
+/// Capture should be exported after it is stopped, when other threads do not
+/// leave zones started during the capture.
+class ENGINE_API Profiler
+{
+public:
+     /// @brief Maximal number of zones stored per thread during one capture.
+     static constexpr std::size_t zones_per_thread = 1 << 16;
+
+     /// @brief Get single instance of profiler.
+     /// @return Single instance of profiler.
+     static Profiler& instance();
+
+     /// @brief Start new capture, zones of previous capture are discarded.
+     void start() noexcept;
+
+     /// @brief Stop capture, zones are not written after this.
+     void stop() noexcept;
+
+     /// @brief Check if capture is active.
+     /// @return true if zones are written, false otherwise.
+     bool is_enabled() const noexcept;
+
+     /// @brief Set name of calling thread, shown in exported trace.
+     /// @param[in] name name of the thread.
+     /// @throws std::bad_alloc.
+     void set_thread_name( std::string_view name );
+
+     /// @brief Write zone of calling thread.
+     /// @param[in] name name of the zone, must be a string with static storage duration.
+     /// @param[in] begin time of zone start.
+     /// @param[in] end time of zone end.
+     void add_zone( const char *name, std::chrono::steady_clock::time_point begin,
+          std::chrono::steady_clock::time_point end ) noexcept;
+
+     /// @brief Get number of zones of the capture, including dropped ones.
+     /// @return number of zones of all threads.
+     std::size_t get_zone_count() const noexcept;
+
+     /// @brief Get number of zones which did not fit into buffers.
+     /// @return number of dropped zones.
+     std::size_t get_dropped_count() const noexcept;
+
+     /// @brief Write the capture in Chrome trace event format, readable by chrome://tracing and Perfetto.
+     /// @details Zones are written as complete events with time in microseconds since capture start.
+     /// @param[in] output stream for trace data.
+     void write_chrome_trace( std::ostream& output ) const;
+
+private:
+     Profiler() = default;
+     Profiler( const Profiler& ) = delete;
+     Profiler& operator=( const Profiler& ) = delete;
+
+     struct ThreadBuffer;
+     struct ThreadBufferOwner;
+
+     /// @brief Get buffer of calling thread, take a free one or create it if it does not exist.
+     /// @return buffer of calling thread, nullptr if it cannot be created.
+     ThreadBuffer *get_thread_buffer() noexcept;
+
+     /// @brief Return buffer of finished thread, so it can be reused by another thread.
+     /// @param[in] buffer buffer of the thread.
+     void release_thread_buffer( ThreadBuffer *buffer ) noexcept;
+
+private:
+     std::vector< std::unique_ptr< ThreadBuffer > > buffers_;     ///< buffers of all threads.
+     std::vector< ThreadBuffer * > free_buffers_;                ///< buffers of finished threads.
+     mutable std::mutex mutex_;                                  ///< mutex for list of buffers.
+     std::atomic< uint32_t > capture_{ 0 };                      ///< index of current capture.
+     std::atomic< bool > enabled_{ false };                      ///< is capture active.
+     std::atomic< int64_t > start_time_{ 0 };                    ///< start time of capture, in nanoseconds.
+};
+
+
+/// @brief Zone of CPU time, measured from construction to destruction.
+/// @details Zone is written only if it was started during capture.
+class ENGINE_API ProfileZone
+{
+public:
+     /// @brief Constructor, starts the zone.
+     /// @param[in] name name of the zone, must be a string with static storage duration.
+     explicit ProfileZone( const char *name ) noexcept;
+
+     /// @brief Destructor, finishes the zone.
+     ~ProfileZone();
+
+     ProfileZone( const ProfileZone& ) = delete;
+     ProfileZone& operator=( const ProfileZone& ) = delete;
+
+private:
+     const char *name_;                                     ///< name of the zone, nullptr if it is not written.
+     std::chrono::steady_clock::time_point begin_;          ///< start time of the zone.
+};
+
+} // namespace _16nar
+
+
+#define __NARENGINE_PROFILE_CONCAT_IMPL( A, B ) A##B
+#define __NARENGINE_PROFILE_CONCAT( A, B ) __NARENGINE_PROFILE_CONCAT_IMPL( A, B )
+#define __NARENGINE_PROFILE_IMPL( NAME ) \
+     _16nar::ProfileZone __NARENGINE_PROFILE_CONCAT( __narengine_zone_, __LINE__ ){ NAME }
+
+
+// level 1: main stages of frame and loading, level 2: subsystems, level 3: fine-grained zones
+#if NARENGINE_PROFILE_LEVEL >= 1
+#    define PROFILE_16NAR_MAIN( NAME ) __NARENGINE_PROFILE_IMPL( NAME )
+#else
+#    define PROFILE_16NAR_MAIN( NAME )
+#endif
+#if NARENGINE_PROFILE_LEVEL >= 2
+#    define PROFILE_16NAR_ZONE( NAME ) __NARENGINE_PROFILE_IMPL( NAME )
+#else
+#    define PROFILE_16NAR_ZONE( NAME )
+#endif
+#if NARENGINE_PROFILE_LEVEL >= 3
+#    define PROFILE_16NAR_DETAIL( NAME ) __NARENGINE_PROFILE_IMPL( NAME )
+#else
+#    define PROFILE_16NAR_DETAIL( NAME )
+#endif
+
+#endif // #ifndef _16NAR_PROFILER_H
@@ -0,0 +1,43 @@
+/// @file
+/// @brief Header file with thread settings and function to apply them.
+#ifndef _16NAR_THREAD_SETTINGS_H
+#define _16NAR_THREAD_SETTINGS_H
+
+#include <16nar/16nardefs.h>
+
+#include <cstdint>
+#include <string>
+
+namespace _16nar
+{
+
+/// @brief Scheduling priority of a thread, relative to other threads of the process.
+enum class ThreadPriority
+{
+     Inherit,            ///< priority is not changed, thread keeps priority inherited from the process.
+     Lowest,             ///< lowest priority.
+     Low,                ///< priority below normal.
+     Normal,             ///< default priority of the system.
+     High,               ///< priority above normal, may require privileges.
+     Highest             ///< highest non-realtime priority, may require privileges.
+};
+
+
+/// @brief Settings of an engine thread.
+struct ThreadSettings
+{
+     std::string name;                                 ///< name of the thread, empty to keep the default one.
+     ThreadPriority priority = ThreadPriority::Inherit; ///< scheduling priority of the thread.
+     std::uint64_t affinity = 0;                       ///< mask of allowed CPUs, bit i is CPU i; 0 allows any CPU.
+};
+
+
+/// @brief Apply settings to calling thread.
+/// @details Name is also given to the profiler. Settings not supported by platform are skipped.
+/// @param[in] settings settings of the thread.
+/// @return true if all settings were applied, false if some of them were rejected by the system.
+ENGINE_API bool apply_thread_settings( const ThreadSettings& settings );
+
+} // namespace _16nar
+
+#endif // #ifndef _16NAR_THREAD_SETTINGS_H
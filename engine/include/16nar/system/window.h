@@ -116,6 +116,10 @@ public:
      /// @brief Make context of the window to be current for OpenGL rendering.
      void make_context_current();
 
+     /// @brief Detach context of the window from calling thread, so other thread can make it current.
+     /// @details Does nothing if context of the window is not current for calling thread.
+     void release_context();
+
      /// @brief Switch buffers for OpenGL rendering.
      /// @details Terminates application if there is no current context on the window,
      /// so use this function with caution. Does nothing if window is not opened.
@@ -0,0 +1,109 @@
+#include <16nar/constructor2d/animated_sprite_2d.h>
+
+#include <16nar/render/animation_table.h>
+#include <16nar/render/ishader_program.h>
+
+namespace _16nar::constructor2d
+{
+
+AnimatedSprite2D::AnimatedSprite2D( const Material& material, const VertexBuffer& quad, const Vec2f& size,
+     const AnimationTable& table ):
+     DrawableNode2D::DrawableNode2D( material ), quad_{ quad }, size_{ size }, table_{ table },
+     clip_{}, start_time_{ 0.0f }, rate_{ 1.0f }, stopped_frame_{ 0 }, playing_{ false }
+{}
+
+
+void AnimatedSprite2D::play( const AnimationClip& clip, float rate ) noexcept
+{
+     clip_ = clip;
+     rate_ = rate;
+     start_time_ = table_.get_time();
+     stopped_frame_ = 0;
+     playing_ = ( rate != 0.0f );
+}
+
+
+void AnimatedSprite2D::stop() noexcept
+{
+     stopped_frame_ = get_current_frame();
+     playing_ = false;
+}
+
+
+bool AnimatedSprite2D::is_playing() const noexcept
+{
+     return playing_;
+}
+
+
+void AnimatedSprite2D::set_playback_rate( float rate ) noexcept
+{
+     if ( !playing_ || rate == 0.0f )
+     {
+          stop();
+          rate_ = rate;
+          return;
+     }
+     // move start time, so the same position in the clip is reached with new rate
+     float now = table_.get_time();
+     start_time_ = now - ( now - start_time_ ) * rate_ / rate;
+     rate_ = rate;
+}
+
+
+float AnimatedSprite2D::get_playback_rate() const noexcept
+{
+     return rate_;
+}
+
+
+const AnimationClip& AnimatedSprite2D::get_clip() const noexcept
+{
+     return clip_;
+}
+
+
+std::size_t AnimatedSprite2D::get_current_frame() const noexcept
+{
+     if ( !playing_ )
+     {
+          return stopped_frame_;
+     }
+     AnimationClip clip = clip_;
+     clip.frame_rate *= rate_;
+     return get_animation_frame( clip, table_.get_time() - start_time_ );
+}
+
+
+DrawInfo AnimatedSprite2D::get_draw_info() const noexcept
+{
+     DrawInfo info{};
+     info.shader = shader_;
+     info.material = material_;
+     if ( clip_.texture.id != 0 )
+     {
+          info.render_params.textures.push_back( clip_.texture );
+     }
+     info.render_params.vertex_buffer = quad_;
+     info.render_params.primitive = PrimitiveType::TriangleStrip;
+     info.render_params.vertex_count = 4;
+
+     // stopped sprite shows clip of one frame
+     Vec4f clip = playing_ ?
+          Vec4f{ static_cast< float >( clip_.first_frame ), static_cast< float >( clip_.frame_count ),
+               clip_.frame_rate * rate_, start_time_ } :
+          Vec4f{ static_cast< float >( clip_.first_frame + stopped_frame_ ), 1.0f, 0.0f, 0.0f };
+     info.uniforms.emplace();
+     info.uniforms->model_matr = get_global_transform_matr().to_matr();
+     info.uniforms->add( uniform_ids::animation_clip, clip );
+     info.uniforms->add( uniform_ids::animation_loop, clip_.loop );
+     return info;
+}
+
+
+FloatRect AnimatedSprite2D::get_local_bounds() const
+{
+     return FloatRect{ Vec2f{}, size_.x(), size_.y() };
+}
+
+} // namespace _16nar::constructor2d
@@ -1,18 +1,34 @@
 #include <16nar/constructor2d/drawable_node_2d.h>
 
 #include <16nar/constructor2d/system/scene_state.h>
+#include <16nar/constructor2d/transform_storage_2d.h>
 
 namespace _16nar::constructor2d
 {
 
-DrawableNode2D::DrawableNode2D( const Shader& shader ) noexcept:
-     Drawable2D::Drawable2D( shader )
+DrawableNode2D::DrawableNode2D( const Shader& shader ):
+     Drawable2D::Drawable2D( shader ), world_bounds_{ Vec2f{}, 0.0f, 0.0f }, bounds_version_{ 0 }, bounds_valid_{ false }
+{}
+
+
+DrawableNode2D::DrawableNode2D( const Material& material ):
+     Drawable2D::Drawable2D( material ), world_bounds_{ Vec2f{}, 0.0f, 0.0f }, bounds_version_{ 0 }, bounds_valid_{ false }
 {}
 
 
 FloatRect DrawableNode2D::get_global_bounds() const
 {
-     return get_global_transform_matr() * get_local_bounds();
+     auto& storage = TransformStorage2D::instance();
+     const Affine2D& world = storage.get_world_matr( get_transform_handle() );
+     std::uint32_t version = storage.get_world_version( get_transform_handle() );
+     // local bounds may be changed by node logic until the next loop call
+     if ( !bounds_valid_ || updated_ || bounds_version_ != version )
+     {
+          world_bounds_ = world * get_local_bounds();
+          bounds_version_ = version;
+          bounds_valid_ = true;
+     }
+     return world_bounds_;
 }
 
 
@@ -27,13 +43,10 @@ void DrawableNode2D::loop_call( SceneState& state, float delta, bool updated )
      updated_ = false;
      if ( updated )
      {
-          set_render_system( &( state.get_render_system() ) ); // no effect if already set
-          state.get_render_system().handle_change( this );
-     }
-     for ( auto& child : get_children() )
-     {
-          child->loop_call( state, delta, updated );
+          bounds_valid_ = false;
+          state.handle_change( this );
      }
+     loop_call_all( get_children(), state, delta, updated );
 }
 
 } // namespace _16nar::constructor2d
@@ -1,13 +1,14 @@
 #include <16nar/constructor2d/node_2d.h>
 
 #include <16nar/constructor2d/system/scene_state.h>
+#include <16nar/system/job_system.h>
 
 namespace _16nar::constructor2d
 {
 
 Node2D::Node2D():
      children_{}, name_{}, parent_{ nullptr }, setup_func_{ nullptr },
-     loop_func_{ nullptr }, state_order_{ -1 }
+     loop_func_{ nullptr }, state_order_{ -1 }, independent_{ false }, updated_{ false }
 {}
 
 
@@ -29,14 +30,14 @@ const std::string& Node2D::get_name() const noexcept
 }
 
 
-TransformMatrix Node2D::get_global_transform_matr( bool include_self ) const noexcept
+Affine2D Node2D::get_global_transform_matr( bool include_self ) const noexcept
 {
-     TransformMatrix transform = include_self ? get_transform_matr() : TransformMatrix{};
-     for ( const Node2D *node = get_parent(); node != nullptr; node = node->get_parent() )
+     auto& storage = TransformStorage2D::instance();
+     if ( include_self )
      {
-          transform = node->get_transform_matr() * transform;
+          return storage.get_world_matr( get_transform_handle() );
      }
-     return transform;
+     return parent_ ? storage.get_world_matr( parent_->get_transform_handle() ) : Affine2D{};
 }
 
 
@@ -46,6 +47,18 @@ const NodesSet& Node2D::get_children() const noexcept
 }
 
 
+void Node2D::set_independent( bool independent ) noexcept
+{
+     independent_ = independent;
+}
+
+
+bool Node2D::is_independent() const noexcept
+{
+     return independent_;
+}
+
+
 // Member functions not for user to call
 
 
@@ -83,10 +96,44 @@ void Node2D::loop_call( SceneState& state, float delta, bool updated )
      bool transformed = calculate_matr();
      updated = updated || transformed || updated_;
      updated_ = false;
-     for ( auto& child : children_ )
+     loop_call_all( children_, state, delta, updated );
+}
+
+
+void Node2D::loop_call_all( const NodesSet& nodes, SceneState& state, float delta, bool updated )
+{
+     JobSystem *jobs = state.get_job_system();
+     if ( !jobs )
+     {
+          for ( auto& node : nodes )
+          {
+               node->loop_call( state, delta, updated );
+          }
+          return;
+     }
+     // dependent nodes may change their parent, so they are updated before jobs are started
+     for ( auto& node : nodes )
+     {
+          if ( !node->independent_ )
+          {
+               node->loop_call( state, delta, updated );
+          }
+     }
+     if ( !nodes.empty() && ( *nodes.begin() )->parent_ )
+     {
+          // world matrices of common ancestors are actual before jobs start, so jobs only read them
+          ( *nodes.begin() )->parent_->get_global_transform_matr();
+     }
+     JobGroup group;
+     for ( auto& node : nodes )
      {
-          child->loop_call( state, delta, updated );
+          if ( node->independent_ )
+          {
+               Node2D *ptr = node.get();
+               jobs->submit( group, [ ptr, &state, delta, updated ](){ ptr->loop_call( state, delta, updated ); } );
+          }
      }
+     jobs->wait( group );
 }
 
 
@@ -94,6 +141,7 @@ void Node2D::add_child( std::unique_ptr< Node2D >&& node )
 {
      auto pair = children_.insert( std::move( node ) );
      ( *pair.first )->parent_ = this;
+     TransformStorage2D::instance().set_parent( ( *pair.first )->get_transform_handle(), get_transform_handle() );
      ( *pair.first )->state_order_ = state_order_;
      ( *pair.first )->updated_ = true;
 }
@@ -107,6 +155,7 @@ std::unique_ptr< Node2D > Node2D::remove_child( Node2D *node )
           auto handle = children_.extract( iter );
           auto ptr{ std::move( handle.value() ) };
           ptr->parent_ = nullptr;
+          TransformStorage2D::instance().set_parent( ptr->get_transform_handle(), TransformStorage2D::invalid_handle );
           return ptr;
      }
      return std::unique_ptr< Node2D >{};
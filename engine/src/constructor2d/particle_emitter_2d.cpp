@@ -0,0 +1,133 @@
+#include <16nar/constructor2d/particle_emitter_2d.h>
+
+#include <16nar/game.h>
+#include <16nar/render/irender_api.h>
+#include <16nar/render/irender_device.h>
+#include <16nar/render/ishader_program.h>
+#include <16nar/logger/logger.h>
+
+#include <cmath>
+#include <exception>
+
+namespace _16nar::constructor2d
+{
+
+LoadParams< ResourceType::StreamBuffer > ParticleEmitter2D::get_stream_params( std::size_t max_particles )
+{
+     LoadParams< ResourceType::StreamBuffer > params{};
+     LoadParams< ResourceType::StreamBuffer >::AttribParams position{};
+     position.size = 2;
+     position.divisor = 1;
+     LoadParams< ResourceType::StreamBuffer >::AttribParams age{};
+     age.size = 1;
+     age.divisor = 1;
+     params.attributes = { position, age };
+     params.size = max_particles * ParticlePool::instance_floats * sizeof( float );
+     return params;
+}
+
+
+void ParticleEmitter2D::add_material_uniforms( LoadParams< ResourceType::Material >& params,
+     const ParticleSettings& settings )
+{
+     params.uniforms.push_back( { "particle_size", settings.size } );
+}
+
+
+ParticleEmitter2D::ParticleEmitter2D( const Material& material, const StreamBuffer& stream,
+     const ParticleSettings& settings ):
+     DrawableNode2D::DrawableNode2D( material ), settings_{ settings }, pool_{ settings.max_particles },
+     stream_{ stream }, emission_debt_{ 0.0f }, emitting_{ true }, had_particles_{ false }
+{}
+
+
+void ParticleEmitter2D::set_emitting( bool emitting ) noexcept
+{
+     emitting_ = emitting;
+     emission_debt_ = 0.0f;
+}
+
+
+bool ParticleEmitter2D::is_emitting() const noexcept
+{
+     return emitting_;
+}
+
+
+void ParticleEmitter2D::burst( std::size_t count )
+{
+     pool_.emit( count, Vec2f{}, settings_.velocity, settings_.spread, settings_.lifetime );
+}
+
+
+const ParticleSettings& ParticleEmitter2D::get_settings() const noexcept
+{
+     return settings_;
+}
+
+
+const ParticlePool& ParticleEmitter2D::get_pool() const noexcept
+{
+     return pool_;
+}
+
+
+DrawInfo ParticleEmitter2D::get_draw_info() const noexcept
+{
+     DrawInfo info{};
+     info.shader = shader_;
+     info.material = material_;
+     info.render_params.stream_buffer = stream_;
+     info.render_params.primitive = PrimitiveType::TriangleStrip;
+     info.render_params.vertex_count = 4;
+     info.render_params.instance_count = 0;
+     std::size_t count = pool_.get_size();
+     if ( count > 0 )
+     {
+          try
+          {
+               std::size_t size = count * ParticlePool::instance_floats;
+               auto data = std::shared_ptr< float[] >( new float[ size ] );
+               pool_.write_instances( data.get() );
+               info.render_params.stream_offset = get_game().get_render_api().get_device().append_stream_data(
+                    stream_, size * sizeof( float ), DataSharedPtr{ data, reinterpret_cast< std::byte * >( data.get() ) } );
+               info.render_params.instance_count = count;
+          }
+          catch ( const std::exception& ex )
+          {
+               LOG_16NAR_ERROR( "Cannot write " << count << " particles to stream buffer: " << ex.what() );
+          }
+     }
+
+     info.uniforms.emplace();
+     info.uniforms->model_matr = get_global_transform_matr().to_matr();
+     return info;
+}
+
+
+FloatRect ParticleEmitter2D::get_local_bounds() const
+{
+     FloatRect bounds = pool_.get_bounds();
+     return FloatRect{ bounds.get_pos() - settings_.size * 0.5f,
+          bounds.get_width() + settings_.size.x(), bounds.get_height() + settings_.size.y() };
+}
+
+
+void ParticleEmitter2D::loop_call( SceneState& state, float delta, bool updated )
+{
+     pool_.update( delta, settings_.acceleration );
+     if ( emitting_ )
+     {
+          emission_debt_ += settings_.emission_rate * delta;
+          float count = std::floor( emission_debt_ );
+          emission_debt_ -= count;
+          burst( static_cast< std::size_t >( count ) );
+     }
+     // bounds change while particles move, and shrink once more when the last one dies
+     bool has_particles = ( pool_.get_size() > 0 );
+     updated_ = updated_ || has_particles || had_particles_;
+     had_particles_ = has_particles;
+     DrawableNode2D::loop_call( state, delta, updated );
+}
+
+} // namespace _16nar::constructor2d
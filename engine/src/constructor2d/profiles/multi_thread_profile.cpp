@@ -0,0 +1,276 @@
+#include <16nar/constructor2d/profiles/multi_thread_profile.h>
+
+#include <16nar/constructor2d/system/scene_state.h>
+#include <16nar/game.h>
+#include <16nar/render/irender_api.h>
+#include <16nar/render/irender_device.h>
+#include <16nar/system/iscene_reader.h>
+#include <16nar/system/window.h>
+#include <16nar/system/profiler.h>
+#include <16nar/logger/logger.h>
+
+#include <stdexcept>
+
+namespace _16nar::constructor2d
+{
+
+MultiThreadProfile::MultiThreadProfile():
+     scene_name_{}, current_task_{ TaskType::Loading }, scheduler_{}, finish_{ false },
+     update_settings_{ "update", ThreadPriority::Inherit, 0 }, render_settings_{ "render", ThreadPriority::Inherit, 0 },
+     render_thread_{}, frame_mutex_{}, frame_cv_{}, frame_ready_{ false }, stop_render_{ false }, render_error_{}
+{}
+
+
+MultiThreadProfile::~MultiThreadProfile()
+{
+     if ( render_thread_.joinable() )
+     {
+          {
+               std::lock_guard< std::mutex > lock{ frame_mutex_ };
+               stop_render_ = true;
+          }
+          frame_cv_.notify_all();
+          render_thread_.join();
+     }
+}
+
+
+void MultiThreadProfile::run()
+{
+     if ( get_game().get_config().profile != ProfileType::MultiThreaded )
+     {
+          throw std::logic_error{ "MultiThreadProfile requires multithreaded render API" };
+     }
+     apply_thread_settings( update_settings_ );
+     current_task_ = TaskType::Loading;
+     finish_ = false;
+     while ( current_task_ != TaskType::Exiting )
+     {
+          if ( current_task_ == TaskType::Loading )
+          {
+               load_scene();
+               current_task_ = TaskType::Running;
+               finish_ = false;
+          }
+          run_scene();
+          if ( current_task_ == TaskType::Exiting )
+          {
+               {
+                    // nodes release their resources while render API still exists
+                    Scene empty{};
+                    get_scene().swap( empty );
+               }
+               // profile is destroyed here, so no members are accessed after it
+               get_game().finalize();
+               return;
+          }
+     }
+}
+
+
+void MultiThreadProfile::switch_scene( std::string_view name )
+{
+     scene_name_ = std::string{ name };
+     current_task_ = TaskType::Loading;
+     finish_ = true;
+}
+
+
+void MultiThreadProfile::exit()
+{
+     current_task_ = TaskType::Exiting;
+     finish_ = true;
+}
+
+
+void MultiThreadProfile::set_time_per_frame( float time_per_frame )
+{
+     scheduler_.set_step( time_per_frame );
+}
+
+
+void MultiThreadProfile::set_max_steps_per_frame( std::size_t max_steps ) noexcept
+{
+     scheduler_.set_max_steps( max_steps );
+}
+
+
+void MultiThreadProfile::set_update_thread_settings( const ThreadSettings& settings )
+{
+     update_settings_ = settings;
+}
+
+
+void MultiThreadProfile::set_render_thread_settings( const ThreadSettings& settings )
+{
+     render_settings_ = settings;
+}
+
+
+Scene& MultiThreadProfile::get_scene() noexcept
+{
+     return constructor2d::get_scene();
+}
+
+
+const FrameStats& MultiThreadProfile::get_frame_stats() const noexcept
+{
+     return scheduler_.get_stats();
+}
+
+
+void MultiThreadProfile::load_scene()
+{
+     PROFILE_16NAR_MAIN( "MultiThreadProfile::load_scene" );
+     if ( !scene_name_.empty() )
+     {
+          ISceneReader& reader = get_game().get_scene_reader();
+          reader.set_file( scene_name_ );
+          reader.create_scene();
+          reader.activate_scene();
+          scene_name_.clear();
+     }
+     get_scene().setup();
+}
+
+
+void MultiThreadProfile::record( float )
+{
+     PROFILE_16NAR_ZONE( "MultiThreadProfile::record" );
+     // Mt render device only enqueues commands, they are executed by render thread
+     get_game().get_render_api().get_device().clear( true, true, false );
+     get_scene().select_objects();
+}
+
+
+bool MultiThreadProfile::submit_frame()
+{
+     PROFILE_16NAR_ZONE( "wait for render thread" );
+     std::unique_lock< std::mutex > lock{ frame_mutex_ };
+     frame_ready_ = true;
+     frame_cv_.notify_all();
+     frame_cv_.wait( lock, [ this ](){ return !frame_ready_ || stop_render_; } );
+     return !stop_render_;
+}
+
+
+void MultiThreadProfile::start_render_thread()
+{
+     frame_ready_ = false;
+     stop_render_ = false;
+     render_error_ = nullptr;
+     if ( get_game().has_window() )
+     {
+          // context may be current only for one thread
+          get_game().get_window().release_context();
+     }
+     render_thread_ = std::thread{ &MultiThreadProfile::render_loop, this };
+}
+
+
+void MultiThreadProfile::stop_render_thread()
+{
+     {
+          std::lock_guard< std::mutex > lock{ frame_mutex_ };
+          stop_render_ = true;
+     }
+     frame_cv_.notify_all();
+     render_thread_.join();
+     if ( get_game().has_window() )
+     {
+          // resources are released from update thread when game is finalized
+          get_game().get_window().make_context_current();
+     }
+     if ( render_error_ )
+     {
+          std::rethrow_exception( render_error_ );
+     }
+}
+
+
+void MultiThreadProfile::render_loop()
+{
+     apply_thread_settings( render_settings_ );
+     Game& game = get_game();
+     try
+     {
+          if ( game.has_window() )
+          {
+               game.get_window().make_context_current();
+          }
+          IRenderApi& render_api = game.get_render_api();
+          while ( true )
+          {
+               {
+                    std::unique_lock< std::mutex > lock{ frame_mutex_ };
+                    frame_cv_.wait( lock, [ this ](){ return frame_ready_ || stop_render_; } );
+                    if ( stop_render_ )
+                    {
+                         break;
+                    }
+                    // update thread is blocked here, so recorded frame can be made current
+                    render_api.end_frame();
+                    frame_ready_ = false;
+               }
+               frame_cv_.notify_all();
+               render_api.process();
+               if ( game.has_window() )
+               {
+                    PROFILE_16NAR_ZONE( "swap buffers" );
+                    game.get_window().swap_buffers();
+               }
+          }
+     }
+     catch ( ... )
+     {
+          LOG_16NAR_ERROR( "Render thread stopped with exception" );
+          std::lock_guard< std::mutex > lock{ frame_mutex_ };
+          render_error_ = std::current_exception();
+          stop_render_ = true;
+          frame_cv_.notify_all();
+     }
+     if ( game.has_window() )
+     {
+          game.get_window().release_context();
+     }
+}
+
+
+void MultiThreadProfile::run_scene()
+{
+     scheduler_.reset();
+     start_render_thread();
+     try
+     {
+          while ( !finish_ )
+          {
+               std::size_t steps = scheduler_.begin_frame();
+               for ( std::size_t i = 0; i < steps && !finish_; i++ )
+               {
+                    PROFILE_16NAR_ZONE( "update step" );
+                    get_scene().loop( scheduler_.get_step() );
+               }
+               record( scheduler_.get_alpha() );
+               if ( !submit_frame() )
+               {
+                    break;
+               }
+               PROFILE_16NAR_ZONE( "wait for next step" );
+               scheduler_.wait_next_step();
+          }
+     }
+     catch ( ... )
+     {
+          // context is given back to this thread, exception of update is more relevant
+          try
+          {
+               stop_render_thread();
+          }
+          catch ( ... )
+          {}
+          throw;
+     }
+     stop_render_thread();
+}
+
+} // namespace _16nar::constructor2d
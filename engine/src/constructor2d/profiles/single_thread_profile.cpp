@@ -2,15 +2,14 @@
 
 #include <16nar/game.h>
 #include <16nar/system/window.h>
-
-#include <chrono>
+#include <16nar/system/profiler.h>
 
 namespace _16nar::constructor2d
 {
 
 SingleThreadProfile::SingleThreadProfile():
      scene_name_{}, current_task_{ TaskType::Loading },
-     time_per_frame_{ 1.0f / 60.0f }, finish_{ false }
+     scheduler_{}, finish_{ false }
 {}
 
 
@@ -51,11 +50,23 @@ void SingleThreadProfile::exit()
 
 void SingleThreadProfile::set_time_per_frame( float time_per_frame )
 {
-     time_per_frame_ = time_per_frame;
+     scheduler_.set_step( time_per_frame );
+}
+
+
+void SingleThreadProfile::set_max_steps_per_frame( std::size_t max_steps ) noexcept
+{
+     scheduler_.set_max_steps( max_steps );
+}
+
+
+const FrameStats& SingleThreadProfile::get_frame_stats() const noexcept
+{
+     return scheduler_.get_stats();
 }
 
 
-void SingleThreadProfile::render()
+void SingleThreadProfile::render( float )
 {
      // use render_system_ to render all world states
 }
@@ -63,20 +74,20 @@ void SingleThreadProfile::render()
 
 void SingleThreadProfile::run_scene()
 {
-     std::chrono::steady_clock clock;
      // setup scene
-     auto prev_time = clock.now();
+     scheduler_.reset();
      while ( !finish_ )
      {
-          std::chrono::duration< float > delta = clock.now() - prev_time;
-          while ( delta.count() >= time_per_frame_ )
+          std::size_t steps = scheduler_.begin_frame();
+          for ( std::size_t i = 0; i < steps && !finish_; i++ )
           {
+               PROFILE_16NAR_ZONE( "update step" );
                // read_events
-               // update scene
-               prev_time = clock.now();
-               delta = clock.now() - prev_time;
+               // update scene with scheduler_.get_step()
           }
-          render();
+          render( scheduler_.get_alpha() );
+          PROFILE_16NAR_ZONE( "wait for next step" );
+          scheduler_.wait_next_step();
      }
 }
 
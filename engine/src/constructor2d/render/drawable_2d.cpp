@@ -7,13 +7,20 @@
 namespace _16nar::constructor2d
 {
 
-Drawable2D::Drawable2D( const Shader& shader ) noexcept:
+Drawable2D::Drawable2D( const Shader& shader ):
      render_system_{ nullptr }, layer_{ 0 }
 {
      shader_ = shader;
 }
 
 
+Drawable2D::Drawable2D( const Material& material ):
+     render_system_{ nullptr }, layer_{ 0 }
+{
+     material_ = material;
+}
+
+
 Drawable2D::~Drawable2D()
 {
      if ( render_system_ )
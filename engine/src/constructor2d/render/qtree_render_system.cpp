@@ -4,11 +4,14 @@
 
 #include <16nar/game.h>
 #include <16nar/render/irender_device.h>
-#include <16nar/render/ishader_program.h>
 #include <16nar/render/camera_2d.h>
+#include <16nar/render/animation_table.h>
 #include <16nar/system/window.h>
+#include <16nar/system/profiler.h>
 #include <16nar/logger/logger.h>
 
+#include <algorithm>
+#include <cstring>
 #include <stdexcept>
 
 namespace _16nar::constructor2d
@@ -18,9 +21,17 @@ void QTreeRenderSystem::reset()
 {
      quad_map_.clear();
      layers_.clear();
+     draw_queue_.clear();
      current_shader_ = 0;
+     current_material_ = 0;
+     if ( camera_buffer_.id != 0 )
+     {
+          get_game().get_render_api().unload( camera_buffer_ );
+          camera_buffer_ = 0;
+     }
      root_ = nullptr;
      camera_ = nullptr;
+     animation_table_ = nullptr;
 }
 
 
@@ -33,6 +44,7 @@ void QTreeRenderSystem::clear_screen()
 
 void QTreeRenderSystem::select_objects()
 {
+     PROFILE_16NAR_MAIN( "QTreeRenderSystem::select_objects" );
      if ( !root_ )
      {
           LOG_16NAR_ERROR( "Root quadrant is not set for render system" );
@@ -43,18 +55,38 @@ void QTreeRenderSystem::select_objects()
           LOG_16NAR_ERROR( "Camera is not set for render system" );
           return;
      }
-     root_->find_objects( camera_->get_global_bounds(), layers_ );
+     {
+          PROFILE_16NAR_ZONE( "Quadrant::find_objects" );
+          root_->find_objects( camera_->get_global_bounds(), layers_ );
+     }
      if ( layers_.empty() )
      {
           return;
      }
+     update_camera_buffer();
+     if ( animation_table_ )
+     {
+          animation_table_->update();
+     }
      for ( const auto& [ lay, objs ] : layers_ )
      {
+          draw_queue_.clear();
           for ( const auto drawable : objs )
           {
-               draw_object( drawable );
+               draw_queue_.push_back( drawable->get_draw_info() );
+          }
+          // order of objects inside a layer is not defined, so group them to reduce state changes
+          std::stable_sort( draw_queue_.begin(), draw_queue_.end(),
+               []( const DrawInfo& lhs, const DrawInfo& rhs )
+               {
+                    return get_sort_key( lhs ) < get_sort_key( rhs );
+               } );
+          for ( const auto& info : draw_queue_ )
+          {
+               draw_object( info );
           }
      }
+     draw_queue_.clear();
      layers_.clear();
 }
 
@@ -64,8 +96,13 @@ void QTreeRenderSystem::draw_objects()
      auto& render_api = get_game().get_render_api();
      render_api.process();
      render_api.end_frame();
-     get_game().get_window().swap_buffers();
+     if ( get_game().has_window() )
+     {
+          PROFILE_16NAR_ZONE( "Window::swap_buffers" );
+          get_game().get_window().swap_buffers();
+     }
      current_shader_ = 0;
+     current_material_ = 0;
 }
 
 
@@ -144,6 +181,12 @@ const Camera2D* QTreeRenderSystem::get_camera() const
 }
 
 
+void QTreeRenderSystem::set_animation_table( AnimationTable *table ) noexcept
+{
+     animation_table_ = table;
+}
+
+
 void QTreeRenderSystem::set_root_quadrant( std::unique_ptr< Quadrant >&& root )
 {
      root_ = std::move( root );
@@ -169,15 +212,27 @@ bool QTreeRenderSystem::check_quadrant( const Drawable2D *obj, const Quadrant *q
 }
 
 
-void QTreeRenderSystem::draw_object( Drawable2D *obj )
+void QTreeRenderSystem::draw_object( const DrawInfo& info )
 {
-     auto info = obj->get_draw_info();
      auto& device = get_game().get_render_api().get_device();
-     if ( info.shader != current_shader_ )
+     if ( info.material.id != 0 )
+     {
+          if ( info.material != current_material_ )
+          {
+               current_material_ = info.material;
+               current_shader_ = 0;
+               device.bind_material( info.material );
+          }
+     }
+     else if ( info.shader != current_shader_ || current_material_.id != 0 )
      {
           current_shader_ = info.shader;
+          current_material_ = 0;
           device.bind_shader( info.shader );
-          set_shader_params();
+     }
+     if ( info.uniforms )
+     {
+          device.set_object_uniforms( *info.uniforms );
      }
      if ( info.shader_setup )
      {
@@ -187,23 +242,24 @@ void QTreeRenderSystem::draw_object( Drawable2D *obj )
 }
 
 
-void QTreeRenderSystem::set_shader_params() const
+void QTreeRenderSystem::update_camera_buffer()
 {
-     if ( !camera_ )
+     auto& render_api = get_game().get_render_api();
+     if ( camera_buffer_.id == 0 )
      {
-          LOG_16NAR_ERROR( "Camera is not set for render system" );
-          return;
+          LoadParams< ResourceType::UniformBuffer > params{};
+          params.size = sizeof( CameraBlock );
+          params.binding = uniform_bindings::camera;
+          camera_buffer_ = render_api.load( ResourceType::UniformBuffer, params ).id;
      }
      Vec2f size = camera_->get_size();
      TransformMatrix proj = TransformMatrix{}.scale( Vec2f{ 1.0f / size.x(), 1.0f / size.y() } );
-     TransformMatrix view = camera_->get_transform_matr();
-     get_game().get_render_api().get_device().set_shader_params(
-          [ view, proj ]( const IShaderProgram& shader )
-          {
-               shader.set_uniform( "view_matr", view );
-               shader.set_uniform( "proj_matr", proj );
-          }
-     );
+     TransformMatrix view = camera_->get_transform_matr().to_matr();
+     auto block = std::make_shared< CameraBlock >();
+     std::memcpy( block->view_matr, view.data(), sizeof( block->view_matr ) );
+     std::memcpy( block->proj_matr, proj.data(), sizeof( block->proj_matr ) );
+     render_api.get_device().update_uniform_buffer( camera_buffer_, 0, sizeof( CameraBlock ),
+          DataSharedPtr{ block, reinterpret_cast< std::byte * >( block.get() ) } );
 }
 
 } // namespace _16nar::constructor2d
@@ -2,6 +2,9 @@
 
 #include <16nar/constructor2d/node_2d.h>
 #include <16nar/constructor2d/system/scene_state.h>
+#include <16nar/constructor2d/transform_storage_2d.h>
+#include <16nar/system/job_system.h>
+#include <16nar/system/profiler.h>
 
 #include <stdexcept>
 #include <cassert>
@@ -45,7 +48,7 @@ std::unique_ptr< Node2D > extract_node( std::map< int, SceneState >& states, Nod
 } // anonymous namespace
 
 Scene::Scene():
-     states_{}, setup_func_{ nullptr }, loop_func_{ nullptr }
+     states_{}, setup_func_{ nullptr }, loop_func_{ nullptr }, jobs_{ nullptr }
 {}
 
 
@@ -55,6 +58,7 @@ void Scene::swap( Scene& other )
      other.states_.swap( states_ );
      std::swap( other.setup_func_, setup_func_ );
      std::swap( other.loop_func_, loop_func_ );
+     std::swap( other.jobs_, jobs_ );
 }
 
 
@@ -73,20 +77,72 @@ void Scene::setup()
 
 void Scene::loop( float delta )
 {
+     PROFILE_16NAR_MAIN( "Scene::loop" );
      if ( loop_func_ )
      {
           loop_func_( delta );
      }
+     if ( !jobs_ )
+     {
+          for ( auto& [ order, state ] : states_ )
+          {
+               if ( state.get_updating() )
+               {
+                    state.loop( delta );
+               }
+          }
+          TransformStorage2D::instance().update();
+          return;
+     }
+     auto& storage = TransformStorage2D::instance();
+     storage.set_parallel( true );
+     try
+     {
+          JobGroup group;
+          for ( auto& [ order, state ] : states_ )
+          {
+               if ( state.get_updating() )
+               {
+                    SceneState *ptr = &state;
+                    JobSystem *jobs = jobs_;
+                    jobs_->submit( group, [ ptr, jobs, delta ](){ ptr->loop( delta, jobs ); } );
+               }
+          }
+          jobs_->wait( group );
+     }
+     catch ( ... )
+     {
+          storage.set_parallel( false );
+          throw;
+     }
+     storage.set_parallel( false );
+     storage.update();
+     // render systems are not thread-safe, so changes are applied after update
      for ( auto& [ order, state ] : states_ )
      {
-          if ( state.get_updating() )
+          state.apply_changes();
+     }
+}
+
+
+void Scene::select_objects()
+{
+     for ( auto& [ order, state ] : states_ )
+     {
+          if ( state.get_rendering() )
           {
-               state.loop( delta );
+               state.get_render_system().select_objects();
           }
      }
 }
 
 
+void Scene::set_parallel_update( JobSystem *jobs ) noexcept
+{
+     jobs_ = jobs;
+}
+
+
 void Scene::register_state( int order, SceneState&& state )
 {
      states_.emplace( order, std::move( state ) );
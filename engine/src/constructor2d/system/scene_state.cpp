@@ -1,5 +1,9 @@
 #include <16nar/constructor2d/system/scene_state.h>
 
+#include <16nar/constructor2d/render/drawable_2d.h>
+#include <16nar/system/job_system.h>
+#include <16nar/system/profiler.h>
+
 #include <cassert>
 
 namespace _16nar::constructor2d
@@ -7,7 +11,7 @@ namespace _16nar::constructor2d
 
 SceneState::SceneState( std::unique_ptr< IRenderSystem2D >&& render_system,
                         bool updating, bool rendering ):
-     render_system_{ std::move( render_system ) }, nodes_{},
+     render_system_{ std::move( render_system ) }, changes_{}, jobs_{ nullptr }, nodes_{},
      updating_{ updating }, rendering_{ rendering } {}
 
 
@@ -42,6 +46,27 @@ IRenderSystem2D& SceneState::get_render_system()
 }
 
 
+JobSystem *SceneState::get_job_system() const noexcept
+{
+     return jobs_;
+}
+
+
+void SceneState::handle_change( Drawable2D *child )
+{
+     if ( !jobs_ )
+     {
+          child->set_render_system( &get_render_system() ); // no effect if already set
+          get_render_system().handle_change( child );
+          return;
+     }
+     // threads which are not workers share one list
+     ChangeList& list = *changes_[ jobs_->get_thread_index() ];
+     std::lock_guard< std::mutex > lock{ list.mutex };
+     list.children.push_back( child );
+}
+
+
 void SceneState::setup()
 {
      for ( auto& node : nodes_ )
@@ -51,11 +76,46 @@ void SceneState::setup()
 }
 
 
-void SceneState::loop( float delta )
+void SceneState::loop( float delta, JobSystem *jobs )
 {
-     for ( auto& node : nodes_ )
+     PROFILE_16NAR_ZONE( "SceneState::loop" );
+     if ( jobs )
+     {
+          while ( changes_.size() <= jobs->get_worker_count() )
+          {
+               changes_.push_back( std::make_unique< ChangeList >() );
+          }
+     }
+     jobs_ = jobs;
+     try
+     {
+          Node2D::loop_call_all( nodes_, *this, delta, false );
+     }
+     catch ( ... )
+     {
+          // update is interrupted, changed objects may be destroyed before the next update
+          for ( auto& list : changes_ )
+          {
+               list->children.clear();
+          }
+          jobs_ = nullptr;
+          throw;
+     }
+     jobs_ = nullptr;
+}
+
+
+void SceneState::apply_changes()
+{
+     PROFILE_16NAR_DETAIL( "SceneState::apply_changes" );
+     for ( auto& list : changes_ )
      {
-          node->loop_call( *this, delta, false );
+          for ( Drawable2D *child : list->children )
+          {
+               child->set_render_system( &get_render_system() ); // no effect if already set
+               get_render_system().handle_change( child );
+          }
+          list->children.clear();
      }
 }
 
@@ -0,0 +1,245 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <16nar/constructor2d/system/scene.h>
+#include <16nar/constructor2d/system/scene_state.h>
+#include <16nar/constructor2d/drawable_node_2d.h>
+#include <16nar/system/job_system.h>
+
+#include <atomic>
+#include <map>
+#include <stdexcept>
+
+namespace
+{
+
+/// @brief Render system counting changes, it is not thread-safe like real render systems.
+class MockRenderSystem : public _16nar::constructor2d::IRenderSystem2D
+{
+public:
+     void reset() override {}
+     void clear_screen() override {}
+     void select_objects() override {}
+     void draw_objects() override {}
+     void add_draw_child( _16nar::constructor2d::Drawable2D * ) override {}
+     void delete_draw_child( _16nar::constructor2d::Drawable2D * ) override {}
+     void set_camera( _16nar::Camera2D * ) override {}
+     const _16nar::Camera2D *get_camera() const override { return nullptr; }
+
+     void handle_change( _16nar::constructor2d::Drawable2D *child ) override
+     {
+          changes[ child ]++;
+     }
+
+     std::map< _16nar::constructor2d::Drawable2D *, int > changes;
+};
+
+
+std::atomic_int loop_calls{ 0 };
+
+
+class MockNode2D : public _16nar::constructor2d::DrawableNode2D
+{
+public:
+     MockNode2D():
+          _16nar::constructor2d::DrawableNode2D( _16nar::Shader{} )
+     {
+          loop_func_ = []( Node2D *node, _16nar::constructor2d::SceneState&, float delta )
+          {
+               node->move( delta, 0.0f );
+               loop_calls++;
+          };
+     }
+
+     _16nar::DrawInfo get_draw_info() const noexcept override
+     {
+          return _16nar::DrawInfo{};
+     }
+
+     _16nar::FloatRect get_local_bounds() const override
+     {
+          return _16nar::FloatRect{ { 0.0f, 0.0f }, 1.0f, 1.0f };
+     }
+};
+
+
+/// @brief Node which saves world position of its parent, seen in loop function.
+class ProbeNode2D : public MockNode2D
+{
+public:
+     ProbeNode2D()
+     {
+          loop_func_ = []( Node2D *node, _16nar::constructor2d::SceneState&, float )
+          {
+               static_cast< ProbeNode2D * >( node )->seen_x = node->get_global_transform_matr( false ).get( 2, 0 );
+          };
+     }
+
+     float seen_x = 0.0f;
+};
+
+
+/// @brief Node which moves its parent in loop function.
+class MoverNode2D : public MockNode2D
+{
+public:
+     MoverNode2D()
+     {
+          loop_func_ = []( Node2D *node, _16nar::constructor2d::SceneState&, float )
+          {
+               node->get_parent()->move( 1.0f, 0.0f );
+          };
+     }
+};
+
+
+/// @brief Node which throws exception in loop function.
+class ThrowingNode2D : public MockNode2D
+{
+public:
+     ThrowingNode2D()
+     {
+          loop_func_ = []( Node2D *, _16nar::constructor2d::SceneState&, float )
+          {
+               throw std::runtime_error{ "loop failed" };
+          };
+     }
+};
+
+
+/// @brief Fill scene with states, each having independent subtrees of drawable nodes.
+void fill_scene( _16nar::constructor2d::Scene& scene )
+{
+     using namespace _16nar::constructor2d;
+
+     for ( int order = 0; order < 3; order++ )
+     {
+          scene.register_state( order, SceneState{ std::make_unique< MockRenderSystem >() } );
+          auto& state = scene.get_state( order );
+          for ( int i = 0; i < 4; i++ )
+          {
+               auto root = std::make_unique< MockNode2D >();
+               root->set_independent( true );
+               for ( int j = 0; j < 10; j++ )
+               {
+                    auto child = std::make_unique< MockNode2D >();
+                    child->set_independent( j % 2 == 0 );
+                    root->add_child( std::move( child ) );
+               }
+               root->set_state_order( order );
+               state.add_node( std::move( root ) );
+          }
+     }
+}
+
+} // anonymous namespace
+
+
+TEST_CASE( "Parallel scene update gives the same changes as sequential one", "[scene]" )
+{
+     using namespace _16nar;
+     using namespace _16nar::constructor2d;
+
+     JobSystem jobs{ 3 };
+     for ( JobSystem *scene_jobs : { static_cast< JobSystem * >( nullptr ), &jobs } )
+     {
+          Scene scene;
+          fill_scene( scene );
+          scene.set_parallel_update( scene_jobs );
+          loop_calls = 0;
+          for ( int frame = 0; frame < 2; frame++ )
+          {
+               scene.loop( 0.5f );
+          }
+          REQUIRE( loop_calls == 3 * 4 * 11 * 2 );
+          for ( int order = 0; order < 3; order++ )
+          {
+               auto& render_system = static_cast< MockRenderSystem& >( scene.get_state( order ).get_render_system() );
+               REQUIRE( render_system.changes.size() == 4 * 11 );
+               for ( const auto& [ child, count ] : render_system.changes )
+               {
+                    // each node moves in both frames
+                    REQUIRE( count == 2 );
+                    REQUIRE( child->get_render_system() == &render_system );
+               }
+          }
+     }
+}
+
+
+TEST_CASE( "Global bounds of drawable node follow its transformations", "[scene]" )
+{
+     using namespace _16nar;
+     using namespace _16nar::constructor2d;
+
+     MockNode2D parent;
+     parent.add_child( std::make_unique< MockNode2D >() );
+     auto *child = static_cast< MockNode2D * >( parent.get_children().begin()->get() );
+     child->set_position( 1.0f, 0.0f );
+     REQUIRE( child->get_global_bounds().get_pos().x() == 1.0f );
+     REQUIRE( child->get_global_bounds().get_pos().x() == 1.0f );
+
+     // moving parent changes cached bounds of child
+     parent.set_position( 2.0f, 3.0f );
+     FloatRect bounds = child->get_global_bounds();
+     REQUIRE( bounds.get_pos().x() == 3.0f );
+     REQUIRE( bounds.get_pos().y() == 3.0f );
+}
+
+
+TEST_CASE( "Dependent siblings are updated before independent ones", "[scene]" )
+{
+     using namespace _16nar;
+     using namespace _16nar::constructor2d;
+
+     JobSystem jobs{ 3 };
+     Scene scene;
+     scene.register_state( 0, SceneState{ std::make_unique< MockRenderSystem >() } );
+     auto root = std::make_unique< ProbeNode2D >();
+     root->add_child( std::make_unique< MoverNode2D >() );
+     std::vector< ProbeNode2D * > probes;
+     for ( int i = 0; i < 8; i++ )
+     {
+          auto probe = std::make_unique< ProbeNode2D >();
+          probe->set_independent( true );
+          probes.push_back( probe.get() );
+          root->add_child( std::move( probe ) );
+     }
+     root->set_state_order( 0 );
+     scene.get_state( 0 ).add_node( std::move( root ) );
+     scene.set_parallel_update( &jobs );
+     scene.loop( 1.0f );
+     for ( const auto probe : probes )
+     {
+          // parent is moved by dependent sibling before jobs read it
+          REQUIRE( probe->seen_x == 1.0f );
+     }
+}
+
+
+TEST_CASE( "Interrupted parallel update does not keep changes", "[scene]" )
+{
+     using namespace _16nar;
+     using namespace _16nar::constructor2d;
+
+     JobSystem jobs{ 2 };
+     Scene scene;
+     scene.register_state( 0, SceneState{ std::make_unique< MockRenderSystem >() } );
+     auto& state = scene.get_state( 0 );
+     for ( int i = 0; i < 4; i++ )
+     {
+          auto node = std::make_unique< MockNode2D >();
+          node->set_independent( true );
+          node->set_state_order( 0 );
+          state.add_node( std::move( node ) );
+     }
+     auto thrower = std::make_unique< ThrowingNode2D >();
+     thrower->set_independent( true );
+     thrower->set_state_order( 0 );
+     state.add_node( std::move( thrower ) );
+     scene.set_parallel_update( &jobs );
+     REQUIRE_THROWS_AS( scene.loop( 1.0f ), std::runtime_error );
+
+     // changes of failed update are discarded, so nodes may be destroyed safely
+     state.apply_changes();
+     REQUIRE( static_cast< MockRenderSystem& >( state.get_render_system() ).changes.empty() );
+}
@@ -0,0 +1,60 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <16nar/constructor2d/transform_storage_2d.h>
+
+#include <vector>
+
+TEST_CASE( "Transform storage propagation benchmark", "[transform_storage_2d][!benchmark]" )
+{
+     using namespace _16nar;
+     using namespace _16nar::constructor2d;
+
+     constexpr std::size_t node_count = 100'000;
+     constexpr std::size_t children_per_node = 4;
+     TransformStorage2D storage;
+     std::vector< TransformStorage2D::Handle > handles;
+     handles.reserve( node_count );
+     for ( std::size_t i = 0; i < node_count; i++ )
+     {
+          handles.push_back( storage.create() );
+          if ( i > 0 )
+          {
+               // tree where each node has a few children, about 8 levels deep
+               storage.set_parent( handles[ i ], handles[ ( i - 1 ) / children_per_node ] );
+          }
+          storage.set_position( handles[ i ], Vec2f{ 1.0f, 0.5f } );
+          storage.set_rotation( handles[ i ], 1.0f );
+     }
+     storage.update();
+
+     BENCHMARK( "update 100000 nodes, root moved" )
+     {
+          storage.set_position( handles[ 0 ], Vec2f{ 2.0f, 1.0f } );
+          storage.update();
+          return storage.get_world_matr( handles.back() ).get( 2, 0 );
+     };
+     BENCHMARK( "update 100000 nodes, all changed" )
+     {
+          for ( auto handle : handles )
+          {
+               storage.set_rotation( handle, 2.0f );
+          }
+          storage.update();
+          return storage.get_world_matr( handles.back() ).get( 2, 0 );
+     };
+     BENCHMARK( "update 100000 nodes, nothing changed" )
+     {
+          storage.update();
+          return storage.get_world_matr( handles.back() ).get( 2, 0 );
+     };
+     BENCHMARK( "parent chain walk for 100000 nodes" )
+     {
+          float sum = 0.0f;
+          for ( auto handle : handles )
+          {
+               sum += storage.calculate_world( handle ).get( 2, 0 );
+          }
+          return sum;
+     };
+}
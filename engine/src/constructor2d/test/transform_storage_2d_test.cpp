@@ -0,0 +1,220 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <16nar/constructor2d/transform_storage_2d.h>
+#include <16nar/constructor2d/node_2d.h>
+
+#include <cmath>
+#include <vector>
+
+#ifndef TEST_PRECISION
+#    define TEST_PRECISION 0.0001f
+#endif
+
+
+TEST_CASE( "Transform storage updates world matrices in one pass", "[transform_storage_2d]" )
+{
+     using namespace _16nar;
+     using namespace _16nar::constructor2d;
+
+     TransformStorage2D storage;
+     auto root = storage.create();
+     auto child = storage.create();
+     auto grandchild = storage.create();
+     storage.set_parent( child, root );
+     storage.set_parent( grandchild, child );
+     REQUIRE( storage.get_parent( grandchild ) == child );
+     REQUIRE( storage.get_parent( root ) == TransformStorage2D::invalid_handle );
+
+     storage.set_position( root, Vec2f{ 10.0f, 0.0f } );
+     storage.set_rotation( child, 90.0f );
+     storage.set_scale( grandchild, Vec2f{ 2.0f, 2.0f } );
+     storage.set_position( grandchild, Vec2f{ 1.0f, 0.0f } );
+     REQUIRE( storage.calculate_local( root ) );
+     REQUIRE_FALSE( storage.calculate_local( root ) );
+     storage.update();
+
+     Affine2D expected = storage.get_local_matr( root ) * storage.get_local_matr( child )
+                              * storage.get_local_matr( grandchild );
+     REQUIRE( storage.get_world_matr( grandchild ).equals( expected, TEST_PRECISION ) );
+     REQUIRE( storage.calculate_world( grandchild ).equals( expected, TEST_PRECISION ) );
+     REQUIRE( storage.calculate_world( grandchild, false ).equals( storage.get_world_matr( child ), TEST_PRECISION ) );
+     Vec2f point = storage.get_world_matr( grandchild ) * Vec2f{ 0.0f, 0.0f };
+     REQUIRE( std::fabs( point.x() - 10.0f ) <= TEST_PRECISION );
+     REQUIRE( std::fabs( point.y() - 1.0f ) <= TEST_PRECISION );
+
+     // change of parent moves the whole subtree
+     storage.set_position( root, Vec2f{ 0.0f, 0.0f } );
+     storage.update();
+     point = storage.get_world_matr( grandchild ) * Vec2f{ 0.0f, 0.0f };
+     REQUIRE( std::fabs( point.x() ) <= TEST_PRECISION );
+}
+
+
+TEST_CASE( "Transform storage reorders hierarchy and reuses handles", "[transform_storage_2d]" )
+{
+     using namespace _16nar;
+     using namespace _16nar::constructor2d;
+
+     TransformStorage2D storage;
+     auto child = storage.create();
+     auto parent = storage.create();
+     auto other = storage.create();
+     // parent is stored after child, so order is fixed by update
+     storage.set_parent( child, parent );
+     storage.set_position( parent, Vec2f{ 5.0f, 5.0f } );
+     storage.set_position( child, Vec2f{ 1.0f, 0.0f } );
+     storage.update();
+     Vec2f point = storage.get_world_matr( child ) * Vec2f{ 0.0f, 0.0f };
+     REQUIRE( std::fabs( point.x() - 6.0f ) <= TEST_PRECISION );
+     REQUIRE( std::fabs( point.y() - 5.0f ) <= TEST_PRECISION );
+     REQUIRE( storage.get_position( child ).x() == 1.0f );
+
+     storage.destroy( other );
+     storage.update();
+     REQUIRE( storage.get_size() == 2 );
+     REQUIRE( storage.create() == other );
+
+     // destroyed parent makes its children roots
+     storage.destroy( parent );
+     storage.update();
+     point = storage.get_world_matr( child ) * Vec2f{ 0.0f, 0.0f };
+     REQUIRE( std::fabs( point.x() - 1.0f ) <= TEST_PRECISION );
+     REQUIRE( storage.get_parent( child ) == TransformStorage2D::invalid_handle );
+}
+
+
+TEST_CASE( "Nodes keep transformations in storage", "[transform_storage_2d]" )
+{
+     using namespace _16nar;
+     using namespace _16nar::constructor2d;
+
+     auto& storage = TransformStorage2D::instance();
+     std::size_t size = storage.get_size();
+     {
+          Node2D parent;
+          parent.add_child( std::make_unique< Node2D >() );
+          Node2D *child = parent.get_children().begin()->get();
+          REQUIRE( storage.get_parent( child->get_transform_handle() ) == parent.get_transform_handle() );
+
+          parent.set_position( 3.0f, 4.0f );
+          child->move( 1.0f, 0.0f );
+          storage.update();
+          Vec2f point = child->get_global_transform_matr() * Vec2f{ 0.0f, 0.0f };
+          REQUIRE( std::fabs( point.x() - 4.0f ) <= TEST_PRECISION );
+          REQUIRE( std::fabs( point.y() - 4.0f ) <= TEST_PRECISION );
+          child->rotate( -90.0f );
+          REQUIRE( std::fabs( child->get_rotation() - 270.0f ) <= TEST_PRECISION );
+
+          auto removed = parent.remove_child( child );
+          REQUIRE( storage.get_parent( removed->get_transform_handle() ) == TransformStorage2D::invalid_handle );
+     }
+     storage.update();
+     REQUIRE( storage.get_size() == size );
+}
+
+
+TEST_CASE( "Transform storage caches world matrices between updates", "[transform_storage_2d]" )
+{
+     using namespace _16nar;
+     using namespace _16nar::constructor2d;
+
+     TransformStorage2D storage;
+     auto root = storage.create();
+     auto first = storage.create();
+     auto second = storage.create();
+     storage.set_parent( first, root );
+     storage.set_parent( second, root );
+     storage.set_position( first, Vec2f{ 1.0f, 0.0f } );
+     storage.set_position( second, Vec2f{ 0.0f, 1.0f } );
+     storage.update();
+     std::uint32_t version = storage.get_world_version( second );
+     storage.get_world_matr( second );
+     REQUIRE( storage.get_world_version( second ) == version );
+
+     // matrices are recalculated on request, without update
+     storage.set_position( root, Vec2f{ 10.0f, 0.0f } );
+     Vec2f point = storage.get_world_matr( first ) * Vec2f{ 0.0f, 0.0f };
+     REQUIRE( std::fabs( point.x() - 11.0f ) <= TEST_PRECISION );
+     // sibling sees the change of common parent, which was already recalculated
+     point = storage.get_world_matr( second ) * Vec2f{ 0.0f, 0.0f };
+     REQUIRE( std::fabs( point.x() - 10.0f ) <= TEST_PRECISION );
+     REQUIRE( std::fabs( point.y() - 1.0f ) <= TEST_PRECISION );
+     version = storage.get_world_version( second );
+     storage.update();
+     REQUIRE( storage.get_world_version( second ) == version );
+
+     // reparenting invalidates cached matrix
+     storage.set_parent( second, first );
+     point = storage.get_world_matr( second ) * Vec2f{ 0.0f, 0.0f };
+     REQUIRE( std::fabs( point.x() - 11.0f ) <= TEST_PRECISION );
+     REQUIRE( std::fabs( point.y() - 1.0f ) <= TEST_PRECISION );
+     REQUIRE( storage.get_world_version( second ) != version );
+
+     // change is reported once by local calculation, even if world matrix was requested before
+     REQUIRE( storage.calculate_local( root ) );
+     REQUIRE_FALSE( storage.calculate_local( root ) );
+}
+
+
+TEST_CASE( "Transform storage checks deep hierarchy up to the first checked ancestor", "[transform_storage_2d]" )
+{
+     using namespace _16nar;
+     using namespace _16nar::constructor2d;
+
+     // hierarchy is deeper than the part walked up without recursion
+     TransformStorage2D storage;
+     std::vector< TransformStorage2D::Handle > chain{ storage.create() };
+     for ( std::size_t i = 1; i < 100; i++ )
+     {
+          chain.push_back( storage.create() );
+          storage.set_parent( chain.back(), chain[ i - 1 ] );
+          storage.set_position( chain.back(), Vec2f{ 1.0f, 0.0f } );
+     }
+     storage.update();
+     Vec2f point = storage.get_world_matr( chain.back() ) * Vec2f{ 0.0f, 0.0f };
+     REQUIRE( std::fabs( point.x() - 99.0f ) <= TEST_PRECISION );
+
+     storage.set_position( chain.front(), Vec2f{ 1.0f, 0.0f } );
+     point = storage.get_world_matr( chain.back() ) * Vec2f{ 0.0f, 0.0f };
+     REQUIRE( std::fabs( point.x() - 100.0f ) <= TEST_PRECISION );
+     point = storage.get_world_matr( chain[ 50 ] ) * Vec2f{ 0.0f, 0.0f };
+     REQUIRE( std::fabs( point.x() - 51.0f ) <= TEST_PRECISION );
+
+     // checked matrix is neither walked up nor recalculated
+     std::uint32_t version = storage.get_world_version( chain.back() );
+     storage.get_world_matr( chain.back() );
+     REQUIRE( storage.get_world_version( chain.back() ) == version );
+
+     // change in the middle is seen by checked descendants
+     storage.set_position( chain[ 50 ], Vec2f{ 2.0f, 0.0f } );
+     point = storage.get_world_matr( chain.back() ) * Vec2f{ 0.0f, 0.0f };
+     REQUIRE( std::fabs( point.x() - 101.0f ) <= TEST_PRECISION );
+     REQUIRE( storage.get_world_version( chain.back() ) != version );
+}
+
+
+TEST_CASE( "Transform storage checks world matrices again after parallel mode", "[transform_storage_2d]" )
+{
+     using namespace _16nar;
+     using namespace _16nar::constructor2d;
+
+     TransformStorage2D storage;
+     auto root = storage.create();
+     auto child = storage.create();
+     auto grandchild = storage.create();
+     storage.set_parent( child, root );
+     storage.set_parent( grandchild, child );
+     storage.update();
+     storage.get_world_matr( grandchild );
+
+     // changes in parallel mode do not start new epochs, but requests still see them
+     storage.set_parallel( true );
+     storage.set_position( child, Vec2f{ 3.0f, 0.0f } );
+     Vec2f point = storage.get_world_matr( child ) * Vec2f{ 0.0f, 0.0f };
+     REQUIRE( std::fabs( point.x() - 3.0f ) <= TEST_PRECISION );
+     storage.set_parallel( false );
+
+     // grandchild was checked before parallel mode, so it must be checked again
+     point = storage.get_world_matr( grandchild ) * Vec2f{ 0.0f, 0.0f };
+     REQUIRE( std::fabs( point.x() - 3.0f ) <= TEST_PRECISION );
+}
@@ -0,0 +1,218 @@
+#include <16nar/constructor2d/text_2d.h>
+
+#include <16nar/game.h>
+#include <16nar/render/glyph_atlas.h>
+#include <16nar/render/irender_api.h>
+#include <16nar/render/irender_device.h>
+#include <16nar/render/ishader_program.h>
+#include <16nar/tools/font_rasterizer.h>
+#include <16nar/logger/logger.h>
+
+#include <algorithm>
+#include <exception>
+
+namespace
+{
+
+/// @brief Number of floats in a vertex: position and texture coordinates.
+constexpr std::size_t vertex_floats = 4;
+
+/// @brief Code point used instead of invalid UTF-8 sequences.
+constexpr char32_t replacement_char = 0xFFFD;
+
+
+/// @brief Decode UTF-8 text to code points.
+std::vector< char32_t > decode_utf8( const std::string& text )
+{
+     std::vector< char32_t > result;
+     result.reserve( text.size() );
+     std::size_t i = 0;
+     while ( i < text.size() )
+     {
+          unsigned char lead = static_cast< unsigned char >( text[ i ] );
+          std::size_t length = ( lead < 0x80 ) ? 1 : ( lead >> 5 ) == 0x6 ? 2 : ( lead >> 4 ) == 0xE ? 3 :
+               ( lead >> 3 ) == 0x1E ? 4 : 0;
+          if ( length == 0 || i + length > text.size() )
+          {
+               result.push_back( replacement_char );
+               i++;
+               continue;
+          }
+          char32_t codepoint = ( length == 1 ) ? lead : ( lead & ( 0x7F >> length ) );
+          std::size_t j = 1;
+          for ( ; j < length; j++ )
+          {
+               unsigned char next = static_cast< unsigned char >( text[ i + j ] );
+               if ( ( next & 0xC0 ) != 0x80 )
+               {
+                    break;
+               }
+               codepoint = ( codepoint << 6 ) | ( next & 0x3F );
+          }
+          result.push_back( j == length ? codepoint : replacement_char );
+          i += j;
+     }
+     return result;
+}
+
+} // anonymous namespace
+
+
+namespace _16nar::constructor2d
+{
+
+LoadParams< ResourceType::StreamBuffer > Text2D::get_stream_params( std::size_t max_glyphs )
+{
+     LoadParams< ResourceType::StreamBuffer > params{};
+     LoadParams< ResourceType::StreamBuffer >::AttribParams position{};
+     position.size = 2;
+     LoadParams< ResourceType::StreamBuffer >::AttribParams tex_coords{};
+     tex_coords.size = 2;
+     params.attributes = { position, tex_coords };
+     params.size = max_glyphs * 6 * vertex_floats * sizeof( float );
+     return params;
+}
+
+
+Text2D::Text2D( const Material& material, const StreamBuffer& stream, GlyphAtlas& atlas ):
+     DrawableNode2D::DrawableNode2D( material ), stream_{ stream }, atlas_{ atlas }, text_{}, codepoints_{},
+     vertices_{}, vertex_count_{ 0 }, bounds_{ Vec2f{}, 0.0f, 0.0f }
+{}
+
+
+Text2D::~Text2D()
+{
+     release_glyphs();
+}
+
+
+void Text2D::set_text( const std::string& text )
+{
+     std::vector< char32_t > codepoints = decode_utf8( text );
+     std::vector< const Glyph * > glyphs( codepoints.size(), nullptr );
+     // new glyphs are acquired before old ones are released, so common glyphs stay in atlas
+     std::size_t acquired = 0;
+     try
+     {
+          for ( ; acquired < codepoints.size(); acquired++ )
+          {
+               if ( codepoints[ acquired ] != U'\n' )
+               {
+                    glyphs[ acquired ] = &atlas_.acquire( codepoints[ acquired ] );
+               }
+          }
+     }
+     catch ( ... )
+     {
+          for ( std::size_t i = 0; i < acquired; i++ )
+          {
+               atlas_.release( codepoints[ i ] );
+          }
+          throw;
+     }
+     release_glyphs();
+     text_ = text;
+     codepoints_ = std::move( codepoints );
+
+     const auto& font = atlas_.get_font();
+     std::size_t quad_count = std::count_if( glyphs.cbegin(), glyphs.cend(),
+          []( const Glyph *glyph ) { return glyph && glyph->size.x() > 0.0f; } );
+     vertices_ = std::shared_ptr< float[] >( new float[ quad_count * 6 * vertex_floats ] );
+     vertex_count_ = quad_count * 6;
+     Vec2f pen{ 0.0f, font.get_ascent() };
+     Vec2f min{}, max{};
+     float *vertex = vertices_.get();
+     for ( std::size_t i = 0; i < codepoints_.size(); i++ )
+     {
+          if ( !glyphs[ i ] )
+          {
+               pen = Vec2f{ 0.0f, pen.y() + font.get_line_height() };
+               continue;
+          }
+          if ( i > 0 && glyphs[ i - 1 ] )
+          {
+               pen.x() += font.get_kerning( codepoints_[ i - 1 ], codepoints_[ i ] );
+          }
+          const Glyph& glyph = *glyphs[ i ];
+          max = Vec2f{ std::max( max.x(), pen.x() + glyph.advance ), pen.y() - font.get_ascent() + font.get_line_height() };
+          if ( glyph.size.x() > 0.0f )
+          {
+               Vec2f pos0 = pen + glyph.offset;
+               Vec2f pos1 = pos0 + glyph.size;
+               Vec2f tex0 = glyph.region.position;
+               Vec2f tex1 = tex0 + glyph.region.size;
+               const float quad[ 6 ][ vertex_floats ] = {
+                    { pos0.x(), pos0.y(), tex0.x(), tex0.y() },
+                    { pos1.x(), pos0.y(), tex1.x(), tex0.y() },
+                    { pos0.x(), pos1.y(), tex0.x(), tex1.y() },
+                    { pos1.x(), pos0.y(), tex1.x(), tex0.y() },
+                    { pos1.x(), pos1.y(), tex1.x(), tex1.y() },
+                    { pos0.x(), pos1.y(), tex0.x(), tex1.y() }
+               };
+               vertex = std::copy( &quad[ 0 ][ 0 ], &quad[ 0 ][ 0 ] + 6 * vertex_floats, vertex );
+               min = Vec2f{ std::min( min.x(), pos0.x() ), std::min( min.y(), pos0.y() ) };
+               max = Vec2f{ std::max( max.x(), pos1.x() ), std::max( max.y(), pos1.y() ) };
+          }
+          pen.x() += glyph.advance;
+     }
+     bounds_ = FloatRect{ min, max.x() - min.x(), max.y() - min.y() };
+     updated_ = true;
+}
+
+
+const std::string& Text2D::get_text() const noexcept
+{
+     return text_;
+}
+
+
+DrawInfo Text2D::get_draw_info() const noexcept
+{
+     DrawInfo info{};
+     info.shader = shader_;
+     info.material = material_;
+     if ( atlas_.get_texture().id != 0 )
+     {
+          info.render_params.textures.push_back( atlas_.get_texture() );
+     }
+     info.render_params.stream_buffer = stream_;
+     info.render_params.primitive = PrimitiveType::Triangles;
+     if ( vertex_count_ > 0 )
+     {
+          try
+          {
+               info.render_params.stream_offset = get_game().get_render_api().get_device().append_stream_data(
+                    stream_, vertex_count_ * vertex_floats * sizeof( float ),
+                    DataSharedPtr{ vertices_, reinterpret_cast< std::byte * >( vertices_.get() ) } );
+               info.render_params.vertex_count = vertex_count_;
+          }
+          catch ( const std::exception& ex )
+          {
+               LOG_16NAR_ERROR( "Cannot write text of " << vertex_count_ / 6 << " glyphs to stream buffer: " << ex.what() );
+          }
+     }
+
+     info.uniforms.emplace();
+     info.uniforms->model_matr = get_global_transform_matr().to_matr();
+     return info;
+}
+
+
+FloatRect Text2D::get_local_bounds() const
+{
+     return bounds_;
+}
+
+
+void Text2D::release_glyphs() noexcept
+{
+     for ( char32_t codepoint : codepoints_ )
+     {
+          if ( codepoint != U'\n' )
+          {
+               atlas_.release( codepoint );
+          }
+     }
+}
+
+} // namespace _16nar::constructor2d
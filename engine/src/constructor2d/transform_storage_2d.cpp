@@ -0,0 +1,423 @@
+#include <16nar/constructor2d/transform_storage_2d.h>
+
+#include <16nar/math/math_functions.h>
+#include <16nar/system/profiler.h>
+
+#include <cassert>
+#include <type_traits>
+
+namespace _16nar::constructor2d
+{
+
+namespace
+{
+
+/// @brief Number of transformations walked up by one request of world matrix without recursion.
+constexpr std::size_t world_chain_size = 32;
+
+} // anonymous namespace
+
+
+TransformStorage2D& TransformStorage2D::instance()
+{
+     static TransformStorage2D storage;
+     return storage;
+}
+
+
+TransformStorage2D::TransformStorage2D():
+     positions_{}, origins_{}, scales_{}, rotations_{}, local_{}, world_{}, parents_{},
+     flags_{}, versions_{}, parent_versions_{}, checked_{}, handles_{}, indices_{}, free_handles_{},
+     epoch_{ 1 }, order_dirty_{ false }, parallel_{ false }
+{}
+
+
+TransformStorage2D::Handle TransformStorage2D::create()
+{
+     Handle handle;
+     if ( free_handles_.empty() )
+     {
+          handle = static_cast< Handle >( indices_.size() );
+          indices_.push_back( invalid_handle );
+     }
+     else
+     {
+          handle = free_handles_.back();
+          free_handles_.pop_back();
+     }
+     indices_[ handle ] = static_cast< std::uint32_t >( handles_.size() );
+     positions_.push_back( Vec2f{} );
+     origins_.push_back( Vec2f{} );
+     scales_.push_back( Vec2f{ 1.0f, 1.0f } );
+     rotations_.push_back( 0.0f );
+     local_.push_back( Affine2D{} );
+     world_.push_back( Affine2D{} );
+     parents_.push_back( invalid_handle );
+     flags_.push_back( 0 );
+     versions_.push_back( 0 );
+     parent_versions_.push_back( 0 );
+     checked_.push_back( epoch_ - 1 );
+     handles_.push_back( handle );
+     return handle;
+}
+
+
+void TransformStorage2D::destroy( Handle handle ) noexcept
+{
+     std::uint32_t index = indices_[ handle ];
+     assert( index != invalid_handle );
+     // arrays are compacted by the next reordering
+     handles_[ index ] = invalid_handle;
+     indices_[ handle ] = invalid_handle;
+     free_handles_.push_back( handle );
+     order_dirty_ = true;
+}
+
+
+void TransformStorage2D::set_parent( Handle handle, Handle parent ) noexcept
+{
+     std::uint32_t index = indices_[ handle ];
+     std::uint32_t parent_index = parent == invalid_handle ? invalid_handle : indices_[ parent ];
+     parents_[ index ] = parent_index;
+     flags_[ index ] |= WorldDirty;
+     invalidate_checks();
+     if ( parent_index != invalid_handle && parent_index > index )
+     {
+          // parent must be updated before its children
+          order_dirty_ = true;
+     }
+}
+
+
+TransformStorage2D::Handle TransformStorage2D::get_parent( Handle handle ) const noexcept
+{
+     std::uint32_t parent_index = parents_[ indices_[ handle ] ];
+     return parent_index == invalid_handle ? invalid_handle : handles_[ parent_index ];
+}
+
+
+const Vec2f& TransformStorage2D::get_position( Handle handle ) const noexcept
+{
+     return positions_[ indices_[ handle ] ];
+}
+
+
+float TransformStorage2D::get_rotation( Handle handle ) const noexcept
+{
+     return rotations_[ indices_[ handle ] ];
+}
+
+
+const Vec2f& TransformStorage2D::get_scale( Handle handle ) const noexcept
+{
+     return scales_[ indices_[ handle ] ];
+}
+
+
+const Vec2f& TransformStorage2D::get_origin( Handle handle ) const noexcept
+{
+     return origins_[ indices_[ handle ] ];
+}
+
+
+void TransformStorage2D::set_position( Handle handle, const Vec2f& position ) noexcept
+{
+     std::uint32_t index = indices_[ handle ];
+     positions_[ index ] = position;
+     flags_[ index ] |= LocalDirty | WorldDirty | Transformed;
+     invalidate_checks();
+}
+
+
+void TransformStorage2D::set_rotation( Handle handle, float rotation ) noexcept
+{
+     std::uint32_t index = indices_[ handle ];
+     rotations_[ index ] = rotation;
+     flags_[ index ] |= LocalDirty | WorldDirty | Transformed;
+     invalidate_checks();
+}
+
+
+void TransformStorage2D::set_scale( Handle handle, const Vec2f& scale ) noexcept
+{
+     std::uint32_t index = indices_[ handle ];
+     scales_[ index ] = scale;
+     flags_[ index ] |= LocalDirty | WorldDirty | Transformed;
+     invalidate_checks();
+}
+
+
+void TransformStorage2D::set_origin( Handle handle, const Vec2f& origin ) noexcept
+{
+     std::uint32_t index = indices_[ handle ];
+     origins_[ index ] = origin;
+     flags_[ index ] |= LocalDirty | WorldDirty | Transformed;
+     invalidate_checks();
+}
+
+
+const Affine2D& TransformStorage2D::get_local_matr( Handle handle ) const noexcept
+{
+     return local_[ indices_[ handle ] ];
+}
+
+
+const Affine2D& TransformStorage2D::get_world_matr( Handle handle ) noexcept
+{
+     std::uint32_t index = indices_[ handle ];
+     calculate_world_at( index );
+     return world_[ index ];
+}
+
+
+std::uint32_t TransformStorage2D::get_world_version( Handle handle ) const noexcept
+{
+     return versions_[ indices_[ handle ] ];
+}
+
+
+bool TransformStorage2D::calculate_local( Handle handle ) noexcept
+{
+     std::uint32_t index = indices_[ handle ];
+     bool transformed = flags_[ index ] & Transformed;
+     if ( flags_[ index ] & LocalDirty )
+     {
+          calculate_local_at( index );
+     }
+     flags_[ index ] &= ~Transformed;
+     return transformed;
+}
+
+
+Affine2D TransformStorage2D::calculate_world( Handle handle, bool include_self ) const noexcept
+{
+     std::uint32_t index = indices_[ handle ];
+     Affine2D transform = include_self ? local_[ index ] : Affine2D{};
+     for ( std::uint32_t parent = parents_[ index ]; parent != invalid_handle; parent = parents_[ parent ] )
+     {
+          transform = local_[ parent ] * transform;
+     }
+     return transform;
+}
+
+
+void TransformStorage2D::update()
+{
+     PROFILE_16NAR_ZONE( "TransformStorage2D::update" );
+     if ( order_dirty_ )
+     {
+          reorder();
+     }
+     std::uint32_t count = static_cast< std::uint32_t >( handles_.size() );
+     for ( std::uint32_t i = 0; i < count; i++ )
+     {
+          std::uint32_t parent = parents_[ i ];
+          bool parent_changed = ( parent != invalid_handle && parent_versions_[ i ] != versions_[ parent ] );
+          if ( ( flags_[ i ] & ( LocalDirty | WorldDirty ) ) || parent_changed )
+          {
+               // parent is stored earlier, so its world matrix is already updated
+               update_world_at( i );
+          }
+          checked_[ i ] = epoch_;
+     }
+}
+
+
+std::size_t TransformStorage2D::get_size() const noexcept
+{
+     return handles_.size();
+}
+
+
+void TransformStorage2D::set_parallel( bool parallel ) noexcept
+{
+     parallel_ = parallel;
+     // changes made in parallel mode did not start new epochs
+     epoch_++;
+}
+
+
+void TransformStorage2D::reorder()
+{
+     PROFILE_16NAR_DETAIL( "TransformStorage2D::reorder" );
+     std::uint32_t count = static_cast< std::uint32_t >( handles_.size() );
+     auto get_alive_parent = [ this ]( std::uint32_t index )
+     {
+          std::uint32_t parent = parents_[ index ];
+          return parent != invalid_handle && handles_[ parent ] != invalid_handle ? parent : invalid_handle;
+     };
+
+     // children of each transformation are grouped by counting sort of parent indices
+     std::vector< std::uint32_t > offsets( count + 1, 0 );
+     for ( std::uint32_t i = 0; i < count; i++ )
+     {
+          std::uint32_t parent = get_alive_parent( i );
+          if ( handles_[ i ] != invalid_handle && parent != invalid_handle )
+          {
+               offsets[ parent + 1 ]++;
+          }
+     }
+     for ( std::uint32_t i = 0; i < count; i++ )
+     {
+          offsets[ i + 1 ] += offsets[ i ];
+     }
+     std::vector< std::uint32_t > children( offsets[ count ] );
+     std::vector< std::uint32_t > cursors( offsets.begin(), offsets.end() - 1 );
+     for ( std::uint32_t i = 0; i < count; i++ )
+     {
+          std::uint32_t parent = get_alive_parent( i );
+          if ( handles_[ i ] != invalid_handle && parent != invalid_handle )
+          {
+               children[ cursors[ parent ]++ ] = i;
+          }
+     }
+
+     // depth-first order keeps each subtree contiguous
+     std::vector< std::uint32_t > order;
+     order.reserve( count );
+     std::vector< std::uint32_t > stack;
+     for ( std::uint32_t root = 0; root < count; root++ )
+     {
+          if ( handles_[ root ] == invalid_handle || get_alive_parent( root ) != invalid_handle )
+          {
+               continue;
+          }
+          stack.push_back( root );
+          while ( !stack.empty() )
+          {
+               std::uint32_t index = stack.back();
+               stack.pop_back();
+               order.push_back( index );
+               for ( std::uint32_t child = offsets[ index + 1 ]; child > offsets[ index ]; child-- )
+               {
+                    stack.push_back( children[ child - 1 ] );
+               }
+          }
+     }
+
+     std::vector< std::uint32_t > new_indices( count, invalid_handle );
+     for ( std::uint32_t i = 0; i < order.size(); i++ )
+     {
+          new_indices[ order[ i ] ] = i;
+     }
+     std::vector< std::uint32_t > parents( order.size() );
+     for ( std::uint32_t i = 0; i < order.size(); i++ )
+     {
+          std::uint32_t parent = get_alive_parent( order[ i ] );
+          parents[ i ] = parent == invalid_handle ? invalid_handle : new_indices[ parent ];
+          if ( parent == invalid_handle && parents_[ order[ i ] ] != invalid_handle )
+          {
+               // parent was destroyed, transformation becomes root
+               flags_[ order[ i ] ] |= WorldDirty;
+          }
+     }
+     parents_.swap( parents );
+
+     auto permute = [ &order ]( auto& values )
+     {
+          std::remove_reference_t< decltype( values ) > permuted;
+          permuted.reserve( order.size() );
+          for ( std::uint32_t index : order )
+          {
+               permuted.push_back( values[ index ] );
+          }
+          values.swap( permuted );
+     };
+     permute( positions_ );
+     permute( origins_ );
+     permute( scales_ );
+     permute( rotations_ );
+     permute( local_ );
+     permute( world_ );
+     permute( flags_ );
+     permute( versions_ );
+     permute( parent_versions_ );
+     permute( checked_ );
+     permute( handles_ );
+     for ( std::uint32_t i = 0; i < handles_.size(); i++ )
+     {
+          indices_[ handles_[ i ] ] = i;
+     }
+     order_dirty_ = false;
+     invalidate_checks();
+}
+
+
+void TransformStorage2D::calculate_local_at( std::uint32_t index ) noexcept
+{
+     local_[ index ] = Affine2D::compose( positions_[ index ], deg2rad( rotations_[ index ] ), scales_[ index ] );
+     flags_[ index ] &= ~LocalDirty;
+}
+
+
+void TransformStorage2D::invalidate_checks() noexcept
+{
+     // epoch is shared by all transformations, so it is not changed by different threads
+     if ( !parallel_ )
+     {
+          epoch_++;
+     }
+}
+
+
+void TransformStorage2D::calculate_world_at( std::uint32_t index ) noexcept
+{
+     if ( !parallel_ && checked_[ index ] == epoch_ )
+     {
+          return;
+     }
+     // transformations which are not checked, from the requested one up to the root
+     std::uint32_t chain[ world_chain_size ];
+     std::size_t count = 0;
+     for ( std::uint32_t current = index; current != invalid_handle; current = parents_[ current ] )
+     {
+          if ( !parallel_ && checked_[ current ] == epoch_ )
+          {
+               break;
+          }
+          if ( count == world_chain_size )
+          {
+               // upper part of very deep hierarchy is calculated separately
+               calculate_world_at( current );
+               break;
+          }
+          chain[ count++ ] = current;
+     }
+     while ( count > 0 )
+     {
+          std::uint32_t current = chain[ --count ];
+          std::uint32_t parent = parents_[ current ];
+          bool parent_changed = ( parent != invalid_handle && parent_versions_[ current ] != versions_[ parent ] );
+          if ( ( flags_[ current ] & ( LocalDirty | WorldDirty ) ) || parent_changed )
+          {
+               update_world_at( current );
+          }
+          if ( !parallel_ )
+          {
+               checked_[ current ] = epoch_;
+          }
+     }
+}
+
+
+void TransformStorage2D::update_world_at( std::uint32_t index ) noexcept
+{
+     if ( flags_[ index ] & LocalDirty )
+     {
+          calculate_local_at( index );
+     }
+     std::uint32_t parent = parents_[ index ];
+     if ( parent == invalid_handle )
+     {
+          world_[ index ] = local_[ index ];
+     }
+     else
+     {
+          world_[ index ] = world_[ parent ] * local_[ index ];
+          parent_versions_[ index ] = versions_[ parent ];
+     }
+     versions_[ index ]++;
+     flags_[ index ] &= ~WorldDirty;
+}
+
+} // namespace _16nar::constructor2d
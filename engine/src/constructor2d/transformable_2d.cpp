@@ -1,149 +1,142 @@
 #include <16nar/constructor2d/transformable_2d.h>
 
-#include <16nar/math/math_functions.h>
-
 #include <cmath>
 
 namespace _16nar::constructor2d
 {
 
-Transformable2D::Transformable2D() noexcept:
-     matr_{}, position_{}, origin_{}, scale_{ 1.0f, 1.0f },
-     rotation_{ 0.0f }, transformed_{ false }
+Transformable2D::Transformable2D():
+     handle_{ TransformStorage2D::instance().create() }
 {}
 
 
+Transformable2D::~Transformable2D()
+{
+     TransformStorage2D::instance().destroy( handle_ );
+}
+
+
 bool Transformable2D::calculate_matr() noexcept
 {
-     if ( transformed_ )
-     {
-          matr_ = TransformMatrix{};
-          matr_.move( position_ ).rotate( deg2rad( rotation_ ) ).scale( scale_ );
-          transformed_ = false;
-          return true;
-     }
-     return false;
+     return TransformStorage2D::instance().calculate_local( handle_ );
 }
 
 
 const Vec2f& Transformable2D::get_position() const noexcept
 {
-     return position_;
+     return TransformStorage2D::instance().get_position( handle_ );
 }
 
 
 float Transformable2D::get_rotation() const noexcept
 {
-     return rotation_;
+     return TransformStorage2D::instance().get_rotation( handle_ );
 }
 
 
 const Vec2f& Transformable2D::get_scale() const noexcept
 {
-     return scale_;
+     return TransformStorage2D::instance().get_scale( handle_ );
 }
 
 
 const Vec2f& Transformable2D::get_origin() const noexcept
 {
-     return origin_;
+     return TransformStorage2D::instance().get_origin( handle_ );
+}
+
+
+const Affine2D& Transformable2D::get_transform_matr() const noexcept
+{
+     return TransformStorage2D::instance().get_local_matr( handle_ );
 }
 
 
-const TransformMatrix& Transformable2D::get_transform_matr() const noexcept
+Affine2D Transformable2D::get_inv_transform_matr() const noexcept
 {
-     return matr_;
+     return get_transform_matr().inv();
 }
 
 
-TransformMatrix Transformable2D::get_inv_transform_matr() const noexcept
+TransformStorage2D::Handle Transformable2D::get_transform_handle() const noexcept
 {
-     return matr_.inv();
+     return handle_;
 }
 
 
 void Transformable2D::set_position( float x, float y ) noexcept
 {
-     position_ = Vec2f{ x, y };
-     transformed_ = true;
+     TransformStorage2D::instance().set_position( handle_, Vec2f{ x, y } );
 }
 
 
 void Transformable2D::set_position( const Vec2f& position ) noexcept
 {
-     position_ = position;
-     transformed_ = true;
+     TransformStorage2D::instance().set_position( handle_, position );
 }
 
 
 void Transformable2D::set_rotation( float angle ) noexcept
 {
-     rotation_ = angle >= 0.0f ? std::fmod( angle, 360.0f ) : ( 360.0f - std::fmod( -angle, 360.0f ) );
-     transformed_ = true;
+     TransformStorage2D::instance().set_rotation( handle_,
+          angle >= 0.0f ? std::fmod( angle, 360.0f ) : ( 360.0f - std::fmod( -angle, 360.0f ) ) );
 }
 
 
 void Transformable2D::set_scale( float factor_x, float factor_y ) noexcept
 {
-     scale_ = Vec2f{ factor_x, factor_y };
-     transformed_ = true;
+     TransformStorage2D::instance().set_scale( handle_, Vec2f{ factor_x, factor_y } );
 }
 
 
 void Transformable2D::set_scale( const Vec2f& factors ) noexcept
 {
-     scale_ = factors;
-     transformed_ = true;
+     TransformStorage2D::instance().set_scale( handle_, factors );
 }
 
 
 void Transformable2D::set_origin( float x, float y ) noexcept
 {
-     origin_ = Vec2f{ x, y };
-     transformed_ = true;
+     TransformStorage2D::instance().set_origin( handle_, Vec2f{ x, y } );
 }
 
 
 void Transformable2D::set_origin( const Vec2f& origin ) noexcept
 {
-     origin_ = origin;
-     transformed_ = true;
+     TransformStorage2D::instance().set_origin( handle_, origin );
 }
 
 
 void Transformable2D::move( float offset_x, float offset_y ) noexcept
 {
-     position_ += Vec2f{ offset_x, offset_y };
-     transformed_ = true;
+     move( Vec2f{ offset_x, offset_y } );
 }
 
 
 void Transformable2D::move( const Vec2f& offset ) noexcept
 {
-     position_ += offset;
-     transformed_ = true;
+     TransformStorage2D& storage = TransformStorage2D::instance();
+     storage.set_position( handle_, storage.get_position( handle_ ) + offset );
 }
 
 
 void Transformable2D::rotate( float angle ) noexcept
 {
-     set_rotation( rotation_ + angle );
+     set_rotation( get_rotation() + angle );
 }
 
 
 void Transformable2D::scale( float factor_x, float factor_y ) noexcept
 {
-     scale_.x() *= factor_x;
-     scale_.y() *= factor_y;
-     transformed_ = true;
+     scale( Vec2f{ factor_x, factor_y } );
 }
 
 
 void Transformable2D::scale( const Vec2f& factor ) noexcept
 {
-     scale_.x() *= factor.x();
-     scale_.y() *= factor.y();
-     transformed_ = true;
+     TransformStorage2D& storage = TransformStorage2D::instance();
+     const Vec2f& current = storage.get_scale( handle_ );
+     storage.set_scale( handle_, Vec2f{ current.x() * factor.x(), current.y() * factor.y() } );
 }
 
 } // namespace _16nar::constructor2d
@@ -3,6 +3,7 @@
 #include <16nar/system/window.h>
 #include <16nar/system/iprofile.h>
 #include <16nar/system/iscene_reader.h>
+#include <16nar/system/job_system.h>
 #include <16nar/render/irender_api.h>
 #include <16nar/logger/logger.h>
 
@@ -33,6 +34,7 @@ GameConfig Game::config_{};
 
 
 Game::Game():
+     job_system_{},
      pkg_manager_{},
      profile_{},
      render_api_{},
@@ -44,6 +46,8 @@ Game::Game():
      // call for correct initialization order
      Logger::instance().log( ILogWriter::LogLevel::Info, "creating game object" );
 
+     job_system_ = std::make_unique< JobSystem >( config_.worker_threads, config_.worker_priority );
+
      pkg_manager_ = std::make_unique< PackageManager >( tools::create_asset_reader(
           config_.app_dir, config_.resources_format ) );
      pkg_manager_->set_package_dir( config_.app_dir );
@@ -65,6 +69,8 @@ void Game::finalize()
      render_api_.reset();
      profile_.reset();
      window_.reset();
+     // systems above may wait for their jobs when destroyed
+     job_system_.reset();
 }
 
 
@@ -116,10 +122,14 @@ void Game::init( const GameConfig& config )
      {
           throw std::runtime_error{ config_.app_data_dir + " already exists and is not a directory" };
      }
-     glfwSetErrorCallback( glfw_error_handler );
-     if ( !glfwInit() )
+     // headless game has no windows, so it does not need GLFW
+     if ( config_.render_api != RenderApiType::Null )
      {
-          throw std::runtime_error{ "GLFW error: failed to initialize" };
+          glfwSetErrorCallback( glfw_error_handler );
+          if ( !glfwInit() )
+          {
+               throw std::runtime_error{ "GLFW error: failed to initialize" };
+          }
      }
      initialized_ = true;
      LOG_16NAR_INFO( "16nar engine was initialized" );
@@ -132,7 +142,10 @@ void Game::deinit()
      {
           return;
      }
-     glfwTerminate();
+     if ( config_.render_api != RenderApiType::Null )
+     {
+          glfwTerminate();
+     }
      initialized_ = false;
      LOG_16NAR_INFO( "16nar engine was deinitialized" );
 }
@@ -158,6 +171,12 @@ Window& Game::get_window() noexcept
 }
 
 
+bool Game::has_window() const noexcept
+{
+     return static_cast< bool >( window_ );
+}
+
+
 ISceneReader& Game::get_scene_reader() noexcept
 {
      assert( scene_reader_ );
@@ -171,4 +190,11 @@ PackageManager& Game::get_pkg_manager() noexcept
      return *pkg_manager_;
 }
 
+
+JobSystem& Game::get_job_system() noexcept
+{
+     assert( job_system_ );
+     return *job_system_;
+}
+
 } // namespace _16nar
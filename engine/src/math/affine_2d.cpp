@@ -0,0 +1,185 @@
+#include <16nar/math/affine_2d.h>
+
+#include <cmath>
+
+#if defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && _M_IX86_FP >= 2 )
+#    include <emmintrin.h>
+#    define _16NAR_AFFINE_SSE
+#endif
+
+namespace _16nar
+{
+
+Affine2D Affine2D::compose( const Vec2f& position, float angle, const Vec2f& factors ) noexcept
+{
+     float cos = std::cos( angle );
+     float sin = std::sin( angle );
+     // rotation is applied to translation too, as in TransformMatrix 2D API
+     return Affine2D{ cos * factors.x(), sin * factors.x(),
+                      -sin * factors.y(), cos * factors.y(),
+                      cos * position.x() - sin * position.y(), sin * position.x() + cos * position.y() };
+}
+
+
+Affine2D& Affine2D::operator*=( const Affine2D& other ) noexcept
+{
+     const float *o = other.m_;
+     float result[ 6 ] = {
+          m_[ 0 ] * o[ 0 ] + m_[ 2 ] * o[ 1 ],
+          m_[ 1 ] * o[ 0 ] + m_[ 3 ] * o[ 1 ],
+          m_[ 0 ] * o[ 2 ] + m_[ 2 ] * o[ 3 ],
+          m_[ 1 ] * o[ 2 ] + m_[ 3 ] * o[ 3 ],
+          m_[ 0 ] * o[ 4 ] + m_[ 2 ] * o[ 5 ] + m_[ 4 ],
+          m_[ 1 ] * o[ 4 ] + m_[ 3 ] * o[ 5 ] + m_[ 5 ]
+     };
+     for ( std::size_t i = 0; i < 6; i++ )
+     {
+          m_[ i ] = result[ i ];
+     }
+     return *this;
+}
+
+
+FloatRect Affine2D::operator*( const FloatRect& rect ) const noexcept
+{
+     float half_width = rect.get_width() * 0.5f;
+     float half_height = rect.get_height() * 0.5f;
+     // half size of bounds is the half size transformed by absolute values of linear part
+#if defined( _16NAR_AFFINE_SSE )
+     // columns of linear part are multiplied by coordinates in one register, then summed by halves
+     const __m128 linear = _mm_loadu_ps( m_ );
+     const __m128 abs_mask = _mm_castsi128_ps( _mm_set1_epi32( 0x7fffffff ) );
+     float center_x = rect.get_pos().x() + half_width;
+     float center_y = rect.get_pos().y() + half_height;
+     __m128 center = _mm_mul_ps( linear, _mm_setr_ps( center_x, center_x, center_y, center_y ) );
+     center = _mm_add_ps( _mm_add_ps( center, _mm_movehl_ps( center, center ) ),
+                          _mm_setr_ps( m_[ 4 ], m_[ 5 ], 0.0f, 0.0f ) );
+     __m128 extent = _mm_and_ps( _mm_mul_ps( linear, _mm_setr_ps( half_width, half_width, half_height, half_height ) ),
+                                 abs_mask );
+     extent = _mm_add_ps( extent, _mm_movehl_ps( extent, extent ) );
+     alignas( 16 ) float bounds[ 4 ];
+     _mm_store_ps( bounds, _mm_movelh_ps( _mm_sub_ps( center, extent ), _mm_add_ps( extent, extent ) ) );
+     return FloatRect{ Vec2f{ bounds[ 0 ], bounds[ 1 ] }, bounds[ 2 ], bounds[ 3 ] };
+#else
+     Vec2f center = ( *this ) * Vec2f{ rect.get_pos().x() + half_width, rect.get_pos().y() + half_height };
+     float extent_x = std::fabs( m_[ 0 ] * half_width ) + std::fabs( m_[ 2 ] * half_height );
+     float extent_y = std::fabs( m_[ 1 ] * half_width ) + std::fabs( m_[ 3 ] * half_height );
+     return FloatRect{ Vec2f{ center.x() - extent_x, center.y() - extent_y }, extent_x * 2.0f, extent_y * 2.0f };
+#endif // _16NAR_AFFINE_SSE
+}
+
+
+Affine2D Affine2D::inv() const noexcept
+{
+     float inv_det = 1.0f / det();
+     float x0 = m_[ 3 ] * inv_det;
+     float y0 = -m_[ 1 ] * inv_det;
+     float x1 = -m_[ 2 ] * inv_det;
+     float y1 = m_[ 0 ] * inv_det;
+     return Affine2D{ x0, y0, x1, y1,
+                      -( x0 * m_[ 4 ] + x1 * m_[ 5 ] ), -( y0 * m_[ 4 ] + y1 * m_[ 5 ] ) };
+}
+
+
+TransformMatrix Affine2D::to_matr() const noexcept
+{
+     return TransformMatrix{ m_[ 0 ], m_[ 1 ], 0.0f, 0.0f,
+                             m_[ 2 ], m_[ 3 ], 0.0f, 0.0f,
+                             0.0f,    0.0f,    1.0f, 0.0f,
+                             m_[ 4 ], m_[ 5 ], 0.0f, 1.0f };
+}
+
+
+bool Affine2D::equals( const Affine2D& mat, float precision ) const noexcept
+{
+     for ( std::size_t i = 0; i < 6; i++ )
+     {
+          if ( std::fabs( m_[ i ] - mat.m_[ i ] ) > precision )
+          {
+               return false;
+          }
+     }
+     return true;
+}
+
+
+Affine2D& Affine2D::move( const Vec2f& offset ) noexcept
+{
+     m_[ 4 ] += m_[ 0 ] * offset.x() + m_[ 2 ] * offset.y();
+     m_[ 5 ] += m_[ 1 ] * offset.x() + m_[ 3 ] * offset.y();
+     return *this;
+}
+
+
+Affine2D& Affine2D::scale( const Vec2f& factors ) noexcept
+{
+     m_[ 0 ] *= factors.x();
+     m_[ 1 ] *= factors.x();
+     m_[ 2 ] *= factors.y();
+     m_[ 3 ] *= factors.y();
+     return *this;
+}
+
+
+Affine2D& Affine2D::scale( const Vec2f& factors, const Vec2f& pivot ) noexcept
+{
+     m_[ 4 ] -= pivot.x();
+     m_[ 5 ] -= pivot.y();
+     for ( std::size_t i = 0; i < 6; i += 2 )
+     {
+          m_[ i ] *= factors.x();
+          m_[ i + 1 ] *= factors.y();
+     }
+     m_[ 4 ] += pivot.x();
+     m_[ 5 ] += pivot.y();
+     return *this;
+}
+
+
+Affine2D& Affine2D::rotate( float angle ) noexcept
+{
+     float cos = std::cos( angle );
+     float sin = std::sin( angle );
+     for ( std::size_t i = 0; i < 6; i += 2 )
+     {
+          float x = m_[ i ];
+          float y = m_[ i + 1 ];
+          m_[ i ] = cos * x - sin * y;
+          m_[ i + 1 ] = sin * x + cos * y;
+     }
+     return *this;
+}
+
+
+Affine2D& Affine2D::rotate( float angle, const Vec2f& pivot ) noexcept
+{
+     m_[ 4 ] -= pivot.x();
+     m_[ 5 ] -= pivot.y();
+     rotate( angle );
+     m_[ 4 ] += pivot.x();
+     m_[ 5 ] += pivot.y();
+     return *this;
+}
+
+
+// Operators
+
+Affine2D operator*( const Affine2D& lhs, const Affine2D& rhs ) noexcept
+{
+     Affine2D tmp = lhs;
+     return tmp *= rhs;
+}
+
+
+bool operator==( const Affine2D& lhs, const Affine2D& rhs ) noexcept
+{
+     return lhs.equals( rhs );
+}
+
+
+bool operator!=( const Affine2D& lhs, const Affine2D& rhs ) noexcept
+{
+     return !( lhs == rhs );
+}
+
+} // namespace _16nar
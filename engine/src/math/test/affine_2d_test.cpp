@@ -0,0 +1,74 @@
+#include <catch2/catch_test_macros.hpp>
+#include <16nar/math/affine_2d.h>
+#include <16nar/math/math_functions.h>
+
+#ifndef TEST_PRECISION
+#    define TEST_PRECISION 0.0001f
+#endif
+
+TEST_CASE( "Affine matrix follows 2D API of transformation matrix", "[affine_2d]" )
+{
+     using namespace _16nar;
+
+     Affine2D affine;
+     TransformMatrix matr;
+     REQUIRE( affine.to_matr() == matr );
+
+     SECTION( "Translation, rotation and scale" )
+     {
+          affine.move( Vec2f{ 10.0f, -5.0f } ).rotate( deg2rad( 30.0f ) ).scale( Vec2f{ 2.0f, 0.5f } );
+          matr.move( Vec2f{ 10.0f, -5.0f } ).rotate( deg2rad( 30.0f ) ).scale( Vec2f{ 2.0f, 0.5f } );
+          REQUIRE( affine.to_matr().equals( matr, TEST_PRECISION ) );
+
+          Affine2D composed = Affine2D::compose( Vec2f{ 10.0f, -5.0f }, deg2rad( 30.0f ), Vec2f{ 2.0f, 0.5f } );
+          REQUIRE( composed.equals( affine, TEST_PRECISION ) );
+     }
+
+     SECTION( "Transformations with pivot" )
+     {
+          affine.move( Vec2f{ 1.0f, 2.0f } ).rotate( deg2rad( 45.0f ), Vec2f{ 3.0f, 4.0f } )
+                .scale( Vec2f{ 3.0f, 2.0f }, Vec2f{ -1.0f, 5.0f } );
+          matr.move( Vec2f{ 1.0f, 2.0f } ).rotate( deg2rad( 45.0f ), Vec2f{ 3.0f, 4.0f } )
+              .scale( Vec2f{ 3.0f, 2.0f }, Vec2f{ -1.0f, 5.0f } );
+          REQUIRE( affine.to_matr().equals( matr, TEST_PRECISION ) );
+     }
+
+     SECTION( "Multiplication" )
+     {
+          Affine2D other = Affine2D::compose( Vec2f{ -3.0f, 7.0f }, deg2rad( 120.0f ), Vec2f{ 1.5f, 1.5f } );
+          affine = Affine2D::compose( Vec2f{ 4.0f, 1.0f }, deg2rad( 10.0f ), Vec2f{ 1.0f, 2.0f } );
+          REQUIRE( ( affine * other ).to_matr().equals( affine.to_matr() * other.to_matr(), TEST_PRECISION ) );
+
+          Vec2f point = ( affine * other ) * Vec2f{ 2.0f, -1.0f };
+          Vec2f expected = affine.to_matr() * ( other.to_matr() * Vec2f{ 2.0f, -1.0f } );
+          REQUIRE( point.equals( expected, TEST_PRECISION ) );
+     }
+}
+
+
+TEST_CASE( "Affine matrix inverse", "[affine_2d]" )
+{
+     using namespace _16nar;
+
+     Affine2D affine = Affine2D::compose( Vec2f{ 15.0f, -2.0f }, deg2rad( 75.0f ), Vec2f{ 2.0f, 4.0f } );
+     REQUIRE( std::fabs( affine.det() - 8.0f ) <= TEST_PRECISION );
+     REQUIRE( ( affine * affine.inv() ).equals( Affine2D{}, TEST_PRECISION ) );
+     REQUIRE( affine.inv().to_matr().equals( affine.to_matr().affine_inv(), TEST_PRECISION ) );
+}
+
+
+TEST_CASE( "Affine matrix transforms bounding rectangles", "[affine_2d]" )
+{
+     using namespace _16nar;
+
+     FloatRect rect{ Vec2f{ 1.0f, 2.0f }, 4.0f, 6.0f };
+     for ( float angle : { 0.0f, 30.0f, 90.0f, 200.0f } )
+     {
+          Affine2D affine = Affine2D::compose( Vec2f{ 3.0f, -8.0f }, deg2rad( angle ), Vec2f{ 2.0f, -0.5f } );
+          FloatRect result = affine * rect;
+          FloatRect expected = affine.to_matr() * rect;
+          REQUIRE( result.get_pos().equals( expected.get_pos(), TEST_PRECISION ) );
+          REQUIRE( std::fabs( result.get_width() - expected.get_width() ) <= TEST_PRECISION );
+          REQUIRE( std::fabs( result.get_height() - expected.get_height() ) <= TEST_PRECISION );
+     }
+}
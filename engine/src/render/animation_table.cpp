@@ -0,0 +1,118 @@
+#include <16nar/render/animation_table.h>
+
+#include <16nar/game.h>
+#include <16nar/render/irender_api.h>
+#include <16nar/render/irender_device.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+
+namespace _16nar
+{
+
+std::size_t get_animation_frame( const AnimationClip& clip, float elapsed ) noexcept
+{
+     if ( clip.frame_count == 0 )
+     {
+          return 0;
+     }
+     long frame = static_cast< long >( std::floor( elapsed * clip.frame_rate ) );
+     long count = static_cast< long >( clip.frame_count );
+     if ( clip.loop )
+     {
+          return static_cast< std::size_t >( ( frame % count + count ) % count );
+     }
+     return static_cast< std::size_t >( std::clamp( frame, 0L, count - 1 ) );
+}
+
+
+AnimationTable::AnimationTable():
+     start_{ std::chrono::steady_clock::now() }, buffer_{}, frame_count_{ 0 }
+{}
+
+
+AnimationClip AnimationTable::add_clip( const std::vector< TextureRegion >& frames, float frame_rate, bool loop )
+{
+     if ( frames.empty() )
+     {
+          throw std::runtime_error{ "animation clip has no frames" };
+     }
+     if ( frame_count_ + frames.size() > AnimationBlock::max_frames )
+     {
+          throw std::runtime_error{ "no space for " + std::to_string( frames.size() ) + " frames in animation table" };
+     }
+     auto data = std::shared_ptr< float[] >( new float[ frames.size() * 4 ] );
+     for ( std::size_t i = 0; i < frames.size(); i++ )
+     {
+          if ( frames[ i ].texture != frames.front().texture || frames[ i ].rotated )
+          {
+               throw std::runtime_error{ "frames of animation clip must have the same texture and must not be rotated" };
+          }
+          data[ i * 4 ] = frames[ i ].position.x();
+          data[ i * 4 + 1 ] = frames[ i ].position.y();
+          data[ i * 4 + 2 ] = frames[ i ].size.x();
+          data[ i * 4 + 3 ] = frames[ i ].size.y();
+     }
+
+     auto& render_api = get_game().get_render_api();
+     if ( buffer_.id == 0 )
+     {
+          LoadParams< ResourceType::UniformBuffer > params{};
+          params.size = sizeof( AnimationBlock );
+          params.binding = uniform_bindings::animation;
+          buffer_ = render_api.load( ResourceType::UniformBuffer, params ).id;
+     }
+     std::size_t offset = offsetof( AnimationBlock, frames ) + frame_count_ * sizeof( AnimationBlock::frames[ 0 ] );
+     render_api.get_device().update_uniform_buffer( buffer_, offset, frames.size() * sizeof( AnimationBlock::frames[ 0 ] ),
+          DataSharedPtr{ data, reinterpret_cast< std::byte * >( data.get() ) } );
+
+     AnimationClip clip{};
+     clip.texture = frames.front().texture;
+     clip.first_frame = frame_count_;
+     clip.frame_count = frames.size();
+     clip.frame_rate = frame_rate;
+     clip.loop = loop;
+     frame_count_ += frames.size();
+     return clip;
+}
+
+
+float AnimationTable::get_time() const noexcept
+{
+     return std::chrono::duration< float >( std::chrono::steady_clock::now() - start_ ).count();
+}
+
+
+void AnimationTable::update()
+{
+     if ( buffer_.id == 0 )
+     {
+          return;
+     }
+     auto time = std::shared_ptr< float[] >( new float[ 4 ]{ get_time(), 0.0f, 0.0f, 0.0f } );
+     get_game().get_render_api().get_device().update_uniform_buffer( buffer_, offsetof( AnimationBlock, time ),
+          sizeof( AnimationBlock::time ), DataSharedPtr{ time, reinterpret_cast< std::byte * >( time.get() ) } );
+}
+
+
+void AnimationTable::reset()
+{
+     if ( buffer_.id != 0 )
+     {
+          get_game().get_render_api().unload( buffer_ );
+          buffer_ = 0;
+     }
+     frame_count_ = 0;
+     start_ = std::chrono::steady_clock::now();
+}
+
+
+std::size_t AnimationTable::get_frame_count() const noexcept
+{
+     return frame_count_;
+}
+
+} // namespace _16nar
@@ -108,33 +108,28 @@ void Camera2D::zoom( float factor ) noexcept
 }
 
 
-const TransformMatrix& Camera2D::get_transform_matr() const noexcept
+const Affine2D& Camera2D::get_transform_matr() const noexcept
 {
      return matr_;
 }
 
 
-TransformMatrix Camera2D::get_inverse_transform_matr() const noexcept
+Affine2D Camera2D::get_inverse_transform_matr() const noexcept
 {
-     return get_transform_matr().affine_inv();
+     return get_transform_matr().inv();
 }
 
 
 void Camera2D::params_calculate() noexcept
 {
-     matr_ = {};
-     matr_.move( -center_ )
-          .rotate( deg2rad( rotation_ ) )
-          .scale( Vec2f{ scale_, scale_ } );
-
-     TransformMatrix tmp;
-     tmp.rotate( deg2rad( rotation_ ) )
-          .scale( Vec2f{ scale_, scale_ } );
-     auto tmp2 = TransformMatrix{};
-     tmp2.move( center_ );
-     tmp2 *= tmp;
-
-     global_bounds_ = tmp2 * FloatRect{
+     float angle = deg2rad( rotation_ );
+     matr_ = Affine2D::compose( -center_, angle, Vec2f{ scale_, scale_ } );
+
+     Affine2D bounds_matr = Affine2D::compose( Vec2f{}, angle, Vec2f{ scale_, scale_ } );
+     bounds_matr.get( 2, 0 ) += center_.x();
+     bounds_matr.get( 2, 1 ) += center_.y();
+
+     global_bounds_ = bounds_matr * FloatRect{
           Vec2f{ -half_width_, -half_height_ },
           half_width_ * 2,
           half_height_ * 2
@@ -20,4 +20,16 @@ const Shader& Drawable::get_shader() const noexcept
      return shader_;
 }
 
+
+const Material& Drawable::get_material() const noexcept
+{
+     return material_;
+}
+
+
+void Drawable::set_material( const Material& material ) noexcept
+{
+     material_ = material;
+}
+
 } // namespace _16nar
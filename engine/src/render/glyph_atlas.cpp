@@ -0,0 +1,202 @@
+#include <16nar/render/glyph_atlas.h>
+
+#include <16nar/game.h>
+#include <16nar/render/irender_api.h>
+#include <16nar/tools/font_rasterizer.h>
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace _16nar
+{
+
+GlyphCells::GlyphCells( std::size_t count ):
+     cells_( count ), unpinned_{}, glyphs_{}
+{
+     clear();
+}
+
+
+std::pair< std::size_t, bool > GlyphCells::acquire( char32_t codepoint )
+{
+     auto iter = glyphs_.find( codepoint );
+     if ( iter != glyphs_.end() )
+     {
+          Cell& cell = cells_[ iter->second ];
+          if ( cell.users++ == 0 )
+          {
+               unpinned_.erase( cell.unpinned );
+          }
+          return { iter->second, false };
+     }
+     if ( unpinned_.empty() )
+     {
+          throw std::runtime_error{ "all " + std::to_string( cells_.size() ) + " glyph cells are used" };
+     }
+     std::size_t index = unpinned_.front();
+     unpinned_.pop_front();
+     Cell& cell = cells_[ index ];
+     if ( cell.assigned )
+     {
+          glyphs_.erase( cell.codepoint );
+     }
+     cell.codepoint = codepoint;
+     cell.users = 1;
+     cell.assigned = true;
+     glyphs_.emplace( codepoint, index );
+     return { index, true };
+}
+
+
+void GlyphCells::release( char32_t codepoint ) noexcept
+{
+     auto iter = glyphs_.find( codepoint );
+     if ( iter == glyphs_.end() )
+     {
+          return;
+     }
+     Cell& cell = cells_[ iter->second ];
+     if ( cell.users > 0 && --cell.users == 0 )
+     {
+          cell.unpinned = unpinned_.insert( unpinned_.end(), iter->second );
+     }
+}
+
+
+bool GlyphCells::contains( char32_t codepoint ) const noexcept
+{
+     return glyphs_.find( codepoint ) != glyphs_.cend();
+}
+
+
+std::size_t GlyphCells::get_users( char32_t codepoint ) const noexcept
+{
+     auto iter = glyphs_.find( codepoint );
+     return iter == glyphs_.cend() ? 0 : cells_[ iter->second ].users;
+}
+
+
+std::size_t GlyphCells::get_count() const noexcept
+{
+     return cells_.size();
+}
+
+
+void GlyphCells::clear() noexcept
+{
+     glyphs_.clear();
+     unpinned_.clear();
+     for ( std::size_t i = 0; i < cells_.size(); i++ )
+     {
+          cells_[ i ] = Cell{};
+          cells_[ i ].unpinned = unpinned_.insert( unpinned_.end(), i );
+     }
+}
+
+
+GlyphAtlas::GlyphAtlas( std::shared_ptr< const tools::FontRasterizer > font, int texture_size ):
+     font_{ std::move( font ) }, texture_size_{ texture_size },
+     // one texel of padding on each side keeps linear filtering inside the cell
+     cell_size_{ static_cast< int >( std::ceil( font_->get_line_height() ) ) + 2 },
+     cells_per_row_{ texture_size / cell_size_ },
+     cells_{ static_cast< std::size_t >( cells_per_row_ * cells_per_row_ ) },
+     glyphs_( cells_.get_count() ), texture_{}
+{
+     if ( cells_per_row_ == 0 )
+     {
+          throw std::runtime_error{ "glyph atlas of size " + std::to_string( texture_size )
+               + " cannot contain glyph cell of size " + std::to_string( cell_size_ ) };
+     }
+}
+
+
+const Glyph& GlyphAtlas::acquire( char32_t codepoint )
+{
+     auto& render_api = get_game().get_render_api();
+     if ( texture_.id == 0 )
+     {
+          LoadParams< ResourceType::Texture > params{};
+          params.format = BufferDataFormat::Rgba;
+          params.size = Vec2i{ texture_size_, texture_size_ };
+          texture_ = render_api.load( ResourceType::Texture, params ).id;
+     }
+     auto [ index, assigned ] = cells_.acquire( codepoint );
+     Glyph& glyph = glyphs_[ index ];
+     if ( !assigned )
+     {
+          return glyph;
+     }
+
+     tools::GlyphBitmap bitmap = font_->rasterize( codepoint );
+     // glyphs higher or wider than line are cut
+     int width = std::min( bitmap.size.x(), cell_size_ - 2 );
+     int height = std::min( bitmap.size.y(), cell_size_ - 2 );
+     Vec2i cell_pos{ static_cast< int >( index ) % cells_per_row_ * cell_size_,
+          static_cast< int >( index ) / cells_per_row_ * cell_size_ };
+
+     // whole cell is written, so padding of the previous glyph is cleared
+     std::size_t cell_texels = static_cast< std::size_t >( cell_size_ ) * cell_size_;
+     auto data = std::shared_ptr< std::byte[] >( new std::byte[ cell_texels * 4 ]{} );
+     for ( int y = 0; y < height; y++ )
+     {
+          for ( int x = 0; x < width; x++ )
+          {
+               std::size_t texel = ( static_cast< std::size_t >( y + 1 ) * cell_size_ + x + 1 ) * 4;
+               data[ texel ] = data[ texel + 1 ] = data[ texel + 2 ] = std::byte{ 255 };
+               data[ texel + 3 ] = static_cast< std::byte >( bitmap.coverage[ y * bitmap.size.x() + x ] );
+          }
+     }
+     UpdateParams< ResourceType::Texture > params{};
+     params.format = BufferDataFormat::Rgba;
+     params.offset = cell_pos;
+     params.size = Vec2i{ cell_size_, cell_size_ };
+     params.data = DataSharedPtr{ data, data.get() };
+     render_api.update( texture_, params );
+
+     float scale = 1.0f / texture_size_;
+     glyph.region.texture = texture_;
+     glyph.region.position = Vec2f{ ( cell_pos.x() + 1 ) * scale, ( cell_pos.y() + 1 ) * scale };
+     glyph.region.size = Vec2f{ width * scale, height * scale };
+     glyph.offset = Vec2f{ static_cast< float >( bitmap.offset.x() ), static_cast< float >( bitmap.offset.y() ) };
+     glyph.size = Vec2f{ static_cast< float >( width ), static_cast< float >( height ) };
+     glyph.advance = bitmap.advance;
+     return glyph;
+}
+
+
+void GlyphAtlas::release( char32_t codepoint ) noexcept
+{
+     cells_.release( codepoint );
+}
+
+
+const tools::FontRasterizer& GlyphAtlas::get_font() const noexcept
+{
+     return *font_;
+}
+
+
+Texture GlyphAtlas::get_texture() const noexcept
+{
+     return texture_;
+}
+
+
+std::size_t GlyphAtlas::get_capacity() const noexcept
+{
+     return cells_.get_count();
+}
+
+
+void GlyphAtlas::reset()
+{
+     if ( texture_.id != 0 )
+     {
+          get_game().get_render_api().unload( texture_ );
+          texture_ = 0;
+     }
+     cells_.clear();
+}
+
+} // namespace _16nar
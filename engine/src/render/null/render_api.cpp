@@ -0,0 +1,145 @@
+#include <16nar/render/null/render_api.h>
+
+#include <16nar/render/null/resource_manager.h>
+#include <16nar/render/null/render_device.h>
+
+#include <16nar/system/exceptions.h>
+#include <16nar/system/profiler.h>
+
+#include <stdexcept>
+
+namespace _16nar::null
+{
+namespace
+{
+
+/// @brief Get number of resources loaded by null resource manager.
+template < ResourceType R >
+std::size_t get_manager_size( const ResourceManagerMap& managers ) noexcept
+{
+     const auto *manager = get_typed_manager< R >( managers );
+     return manager ? manager->get_size() : 0;
+}
+
+} // anonymous namespace
+
+
+RenderApi::RenderApi( ProfileType profile )
+{
+     if ( profile != ProfileType::SingleThreaded && profile != ProfileType::MultiThreaded )
+     {
+          throw std::runtime_error{ "cannot create null render API, wrong profile" };
+     }
+     managers_.emplace( ResourceType::FrameBuffer,
+          std::make_unique< ResourceManager< ResourceType::FrameBuffer > >() );
+     managers_.emplace( ResourceType::VertexBuffer,
+          std::make_unique< ResourceManager< ResourceType::VertexBuffer > >() );
+     managers_.emplace( ResourceType::Texture,
+          std::make_unique< ResourceManager< ResourceType::Texture > >() );
+     managers_.emplace( ResourceType::Shader,
+          std::make_unique< ResourceManager< ResourceType::Shader > >() );
+     managers_.emplace( ResourceType::RenderBuffer,
+          std::make_unique< ResourceManager< ResourceType::RenderBuffer > >() );
+     managers_.emplace( ResourceType::Cubemap,
+          std::make_unique< ResourceManager< ResourceType::Cubemap > >() );
+     managers_.emplace( ResourceType::Material,
+          std::make_unique< ResourceManager< ResourceType::Material > >() );
+     managers_.emplace( ResourceType::UniformBuffer,
+          std::make_unique< ResourceManager< ResourceType::UniformBuffer > >() );
+     managers_.emplace( ResourceType::StreamBuffer,
+          std::make_unique< ResourceManager< ResourceType::StreamBuffer > >() );
+     managers_.emplace( ResourceType::TextureArray,
+          std::make_unique< ResourceManager< ResourceType::TextureArray > >() );
+
+     device_ = std::make_unique< RenderDevice >( managers_ );
+}
+
+
+Resource RenderApi::load( ResourceType type, const std::any& params )
+{
+     const auto iter = managers_.find( type );
+     if ( iter == managers_.cend() )
+     {
+          throw ResourceException{ "wrong resource type" };
+     }
+     return Resource{ type, iter->second->load( params ) };
+}
+
+
+void RenderApi::unload( const Resource& resource )
+{
+     const auto iter = managers_.find( resource.type );
+     if ( iter == managers_.cend() )
+     {
+          throw ResourceException{ "wrong resource type" };
+     }
+     iter->second->unload( resource.id );
+}
+
+
+void RenderApi::update( const Resource& resource, const std::any& params )
+{
+     const auto iter = managers_.find( resource.type );
+     if ( iter == managers_.cend() )
+     {
+          throw ResourceException{ "wrong resource type" };
+     }
+     iter->second->update( resource.id, params );
+}
+
+
+IRenderDevice& RenderApi::get_device() const noexcept
+{
+     return *device_;
+}
+
+
+void RenderApi::process()
+{
+     PROFILE_16NAR_MAIN( "RenderApi::process" );
+     // loads and draws take effect immediately, nothing is queued
+}
+
+
+void RenderApi::end_frame()
+{
+     device_->end_frame();
+}
+
+
+RenderDevice& RenderApi::get_recording_device() const noexcept
+{
+     return static_cast< RenderDevice& >( *device_ );
+}
+
+
+std::size_t RenderApi::get_resource_count( ResourceType type ) const noexcept
+{
+     switch ( type )
+     {
+          case ResourceType::FrameBuffer:
+               return get_manager_size< ResourceType::FrameBuffer >( managers_ );
+          case ResourceType::VertexBuffer:
+               return get_manager_size< ResourceType::VertexBuffer >( managers_ );
+          case ResourceType::Texture:
+               return get_manager_size< ResourceType::Texture >( managers_ );
+          case ResourceType::Shader:
+               return get_manager_size< ResourceType::Shader >( managers_ );
+          case ResourceType::RenderBuffer:
+               return get_manager_size< ResourceType::RenderBuffer >( managers_ );
+          case ResourceType::Cubemap:
+               return get_manager_size< ResourceType::Cubemap >( managers_ );
+          case ResourceType::Material:
+               return get_manager_size< ResourceType::Material >( managers_ );
+          case ResourceType::UniformBuffer:
+               return get_manager_size< ResourceType::UniformBuffer >( managers_ );
+          case ResourceType::StreamBuffer:
+               return get_manager_size< ResourceType::StreamBuffer >( managers_ );
+          case ResourceType::TextureArray:
+               return get_manager_size< ResourceType::TextureArray >( managers_ );
+          default:
+               return 0;
+     }
+}
+
+} // namespace _16nar::null
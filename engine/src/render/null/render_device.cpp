@@ -0,0 +1,266 @@
+#include <16nar/render/null/render_device.h>
+
+#include <16nar/render/null/shader_program.h>
+#include <16nar/system/exceptions.h>
+#include <16nar/tools/utils.h>
+
+namespace _16nar::null
+{
+
+RenderDevice::RenderDevice( const ResourceManagerMap& managers ):
+     textures_{ get_typed_manager< ResourceType::Texture >( managers ) },
+     texture_arrays_{ get_typed_manager< ResourceType::TextureArray >( managers ) },
+     vertex_buffers_{ get_typed_manager< ResourceType::VertexBuffer >( managers ) },
+     shaders_{ get_typed_manager< ResourceType::Shader >( managers ) },
+     framebuffers_{ get_typed_manager< ResourceType::FrameBuffer >( managers ) },
+     materials_{ get_typed_manager< ResourceType::Material >( managers ) },
+     uniform_buffers_{ get_typed_manager< ResourceType::UniformBuffer >( managers ) },
+     stream_buffers_{ get_typed_manager< ResourceType::StreamBuffer >( managers ) },
+     commands_{}, counters_{}, stream_offsets_{}, current_material_{},
+     shader_bound_{ false }, recording_{ false }
+{}
+
+
+void RenderDevice::render( const RenderParams& params )
+{
+     for ( const auto& texture : params.textures )
+     {
+          if ( !textures_->find_params( texture.id ) )
+          {
+               throw ResourceException{ "no texture with such id ", texture.id };
+          }
+     }
+     for ( const auto& array : params.texture_arrays )
+     {
+          if ( !texture_arrays_->find_params( array.id ) )
+          {
+               throw ResourceException{ "no texture array with such id ", array.id };
+          }
+     }
+
+     std::array< uint32_t, 4 > args{ static_cast< uint32_t >( params.primitive ),
+          static_cast< uint32_t >( params.vertex_count ), static_cast< uint32_t >( params.instance_count ),
+          static_cast< uint32_t >( params.stream_offset ) };
+     if ( params.stream_buffer.id != 0 )
+     {
+          if ( !stream_buffers_->find_params( params.stream_buffer.id ) )
+          {
+               throw ResourceException{ "no stream buffer with such id ", params.stream_buffer.id };
+          }
+          record( CommandType::RenderStream, params.stream_buffer.id, args );
+     }
+     else
+     {
+          if ( !vertex_buffers_->find_params( params.vertex_buffer.id ) )
+          {
+               throw ResourceException{ "no vertex buffer with such id ", params.vertex_buffer.id };
+          }
+          record( CommandType::Render, params.vertex_buffer.id, args );
+     }
+     counters_.draw_calls++;
+     counters_.vertices += params.vertex_count * params.instance_count;
+     counters_.instances += params.instance_count;
+     counters_.texture_binds += params.textures.size() + params.texture_arrays.size();
+}
+
+
+void RenderDevice::set_viewport( const IntRect& rect )
+{
+     record( CommandType::SetViewport, 0, { static_cast< uint32_t >( rect.get_pos().x() ),
+          static_cast< uint32_t >( rect.get_pos().y() ), static_cast< uint32_t >( rect.get_width() ),
+          static_cast< uint32_t >( rect.get_height() ) } );
+}
+
+
+void RenderDevice::set_depth_test_state( bool enable )
+{
+     record( CommandType::SetDepthTest, 0, { enable } );
+}
+
+
+void RenderDevice::bind_shader( const Shader& shader )
+{
+     current_material_ = {};
+     if ( shader.id == 0 )
+     {
+          shader_bound_ = false;
+          record( CommandType::BindShader, 0 );
+          return;
+     }
+     if ( !shaders_->find_params( shader.id ) )
+     {
+          throw ResourceException{ "no shader with such id ", shader.id };
+     }
+     shader_bound_ = true;
+     counters_.shader_binds++;
+     record( CommandType::BindShader, shader.id );
+}
+
+
+void RenderDevice::set_shader_params( const ShaderSetupFunction& setup )
+{
+     if ( !shader_bound_ )
+     {
+          return;
+     }
+     std::size_t uniforms = 0;
+     ShaderProgram program{ uniforms };
+     setup( program );
+     counters_.uniforms += uniforms;
+     record( CommandType::SetShaderParams, 0, { static_cast< uint32_t >( uniforms ) } );
+}
+
+
+void RenderDevice::set_object_uniforms( const ObjectUniforms& uniforms )
+{
+     if ( !shader_bound_ )
+     {
+          return;
+     }
+     std::size_t count = 0;
+     ShaderProgram program{ count };
+     uniforms.apply( program );
+     counters_.uniforms += count;
+     record( CommandType::SetShaderParams, 0, { static_cast< uint32_t >( count ) } );
+}
+
+
+void RenderDevice::bind_material( const Material& material )
+{
+     if ( material.id == current_material_.id )
+     {
+          return;
+     }
+     if ( material.id == 0 )
+     {
+          RenderDevice::bind_shader( Shader{} );
+          return;
+     }
+     if ( !materials_->find_params( material.id ) )
+     {
+          throw ResourceException{ "no material with such id ", material.id };
+     }
+     current_material_ = material;
+     shader_bound_ = true;
+     counters_.material_binds++;
+     record( CommandType::BindMaterial, material.id );
+}
+
+
+void RenderDevice::update_uniform_buffer( const UniformBuffer& buffer, std::size_t offset,
+     std::size_t size, const DataSharedPtr& )
+{
+     const auto *params = uniform_buffers_->find_params( buffer.id );
+     if ( !params )
+     {
+          throw ResourceException{ "no uniform buffer with such id ", buffer.id };
+     }
+     if ( offset + size > params->size )
+     {
+          throw ResourceException{ "data is out of uniform buffer bounds, id ", buffer.id };
+     }
+     counters_.uniform_buffer_bytes += size;
+     record( CommandType::UpdateUniformBuffer, buffer.id,
+          { static_cast< uint32_t >( offset ), static_cast< uint32_t >( size ) } );
+}
+
+
+std::size_t RenderDevice::append_stream_data( const StreamBuffer& buffer, std::size_t size,
+     const DataSharedPtr& )
+{
+     const auto *params = stream_buffers_->find_params( buffer.id );
+     if ( !params )
+     {
+          throw ResourceException{ "no stream buffer with such id ", buffer.id };
+     }
+     std::size_t vertex_size = 0;
+     for ( const auto& attr : params->attributes )
+     {
+          vertex_size += attr.size * tools::get_data_type_size( attr.data_type );
+     }
+     if ( vertex_size == 0 || params->size < vertex_size )
+     {
+          throw ResourceException{ "wrong stream buffer layout, id ", buffer.id };
+     }
+     // region size is computed the same way as in OpenGL stream buffer
+     std::size_t region_size = params->size - params->size % vertex_size;
+     std::size_t& free_offset = stream_offsets_[ buffer.id ];
+     std::size_t offset = free_offset;
+     if ( offset + size > region_size || size % vertex_size != 0 )
+     {
+          throw ResourceException{ "data does not fit region of stream buffer, id ", buffer.id };
+     }
+     free_offset += size;
+     counters_.stream_bytes += size;
+     record( CommandType::AppendStreamData, buffer.id,
+          { static_cast< uint32_t >( size ), static_cast< uint32_t >( offset ) } );
+     return offset;
+}
+
+
+void RenderDevice::bind_framebuffer( const FrameBuffer& framebuffer )
+{
+     if ( framebuffer.id != 0 && !framebuffers_->find_params( framebuffer.id ) )
+     {
+          throw ResourceException{ "no framebuffer with such id ", framebuffer.id };
+     }
+     counters_.framebuffer_binds++;
+     record( CommandType::BindFramebuffer, framebuffer.id );
+}
+
+
+void RenderDevice::clear( bool color, bool depth, bool stencil )
+{
+     counters_.clears++;
+     record( CommandType::Clear, 0, { color, depth, stencil } );
+}
+
+
+void RenderDevice::end_frame()
+{
+     stream_offsets_.clear();
+     counters_.frames++;
+     record( CommandType::EndFrame, 0 );
+}
+
+
+void RenderDevice::set_recording( bool recording ) noexcept
+{
+     recording_ = recording;
+}
+
+
+bool RenderDevice::is_recording() const noexcept
+{
+     return recording_;
+}
+
+
+const std::vector< RenderCommand >& RenderDevice::get_commands() const noexcept
+{
+     return commands_;
+}
+
+
+const RenderCounters& RenderDevice::get_counters() const noexcept
+{
+     return counters_;
+}
+
+
+void RenderDevice::reset() noexcept
+{
+     commands_.clear();
+     counters_ = RenderCounters{};
+}
+
+
+void RenderDevice::record( CommandType type, ResID resource, const std::array< uint32_t, 4 >& args )
+{
+     if ( recording_ )
+     {
+          commands_.push_back( RenderCommand{ type, resource, args } );
+     }
+}
+
+} // namespace _16nar::null
@@ -0,0 +1,136 @@
+#include <16nar/render/null/shader_program.h>
+
+namespace _16nar::null
+{
+
+ShaderProgram::ShaderProgram( std::size_t& counter ) noexcept:
+     counter_{ &counter }
+{}
+
+
+void ShaderProgram::set_uniform( std::string_view name, float value ) const noexcept
+{
+     count();
+}
+
+
+void ShaderProgram::set_uniform( std::string_view name, int value ) const noexcept
+{
+     count();
+}
+
+
+void ShaderProgram::set_uniform( std::string_view name, bool value ) const noexcept
+{
+     count();
+}
+
+
+void ShaderProgram::set_uniform( std::string_view name, const Vec2i& value ) const noexcept
+{
+     count();
+}
+
+
+void ShaderProgram::set_uniform( std::string_view name, const Vec2f& value ) const noexcept
+{
+     count();
+}
+
+
+void ShaderProgram::set_uniform( std::string_view name, const Vec3i& value ) const noexcept
+{
+     count();
+}
+
+
+void ShaderProgram::set_uniform( std::string_view name, const Vec3f& value ) const noexcept
+{
+     count();
+}
+
+
+void ShaderProgram::set_uniform( std::string_view name, const Vec4i& value ) const noexcept
+{
+     count();
+}
+
+
+void ShaderProgram::set_uniform( std::string_view name, const Vec4f& value ) const noexcept
+{
+     count();
+}
+
+
+void ShaderProgram::set_uniform( std::string_view name, const TransformMatrix& value ) const noexcept
+{
+     count();
+}
+
+
+void ShaderProgram::set_uniform( UniformId id, float value ) const noexcept
+{
+     count();
+}
+
+
+void ShaderProgram::set_uniform( UniformId id, int value ) const noexcept
+{
+     count();
+}
+
+
+void ShaderProgram::set_uniform( UniformId id, bool value ) const noexcept
+{
+     count();
+}
+
+
+void ShaderProgram::set_uniform( UniformId id, const Vec2i& value ) const noexcept
+{
+     count();
+}
+
+
+void ShaderProgram::set_uniform( UniformId id, const Vec2f& value ) const noexcept
+{
+     count();
+}
+
+
+void ShaderProgram::set_uniform( UniformId id, const Vec3i& value ) const noexcept
+{
+     count();
+}
+
+
+void ShaderProgram::set_uniform( UniformId id, const Vec3f& value ) const noexcept
+{
+     count();
+}
+
+
+void ShaderProgram::set_uniform( UniformId id, const Vec4i& value ) const noexcept
+{
+     count();
+}
+
+
+void ShaderProgram::set_uniform( UniformId id, const Vec4f& value ) const noexcept
+{
+     count();
+}
+
+
+void ShaderProgram::set_uniform( UniformId id, const TransformMatrix& value ) const noexcept
+{
+     count();
+}
+
+
+void ShaderProgram::count() const noexcept
+{
+     ( *counter_ )++;
+}
+
+} // namespace _16nar::null
@@ -0,0 +1,144 @@
+#include <16nar/render/null/render_api.h>
+#include <16nar/render/null/render_device.h>
+#include <16nar/render/ishader_program.h>
+#include <16nar/system/exceptions.h>
+#include <catch2/catch_test_macros.hpp>
+
+TEST_CASE( "Null render API keeps resources in memory", "[render_null]" )
+{
+     using namespace _16nar;
+
+     null::RenderApi api{ ProfileType::SingleThreaded };
+     LoadParams< ResourceType::UniformBuffer > ub_params{};
+     ub_params.size = 64;
+     Resource buffer = api.load( ResourceType::UniformBuffer, ub_params );
+     REQUIRE( buffer.id != 0 );
+     REQUIRE( api.get_resource_count( ResourceType::UniformBuffer ) == 1 );
+     REQUIRE_THROWS_AS( api.load( ResourceType::UniformBuffer, LoadParams< ResourceType::Texture >{} ),
+          ResourceException );
+     REQUIRE_THROWS_AS( api.load( ResourceType::Atlas, LoadParams< ResourceType::Atlas >{} ), ResourceException );
+
+     // only resources with update parameters can be updated
+     REQUIRE_NOTHROW( api.update( buffer, UpdateParams< ResourceType::UniformBuffer >{} ) );
+     REQUIRE_THROWS_AS( api.update( buffer, UpdateParams< ResourceType::Texture >{} ), ResourceException );
+     Resource shader = api.load( ResourceType::Shader, LoadParams< ResourceType::Shader >{} );
+     REQUIRE_THROWS_AS( api.update( shader, UpdateParams< ResourceType::Shader >{} ), ResourceException );
+
+     // ID of unloaded resource is not valid anymore, even if its slot is reused
+     api.unload( buffer );
+     REQUIRE( api.get_resource_count( ResourceType::UniformBuffer ) == 0 );
+     Resource other = api.load( ResourceType::UniformBuffer, ub_params );
+     REQUIRE( other.id != buffer.id );
+     REQUIRE_THROWS_AS( api.update( buffer, UpdateParams< ResourceType::UniformBuffer >{} ), ResourceException );
+     REQUIRE_THROWS_AS( api.get_device().update_uniform_buffer( UniformBuffer{ buffer.id }, 0, 16, nullptr ), ResourceException );
+     REQUIRE_NOTHROW( api.get_device().update_uniform_buffer( UniformBuffer{ other.id }, 48, 16, nullptr ) );
+     REQUIRE_THROWS_AS( api.get_device().update_uniform_buffer( UniformBuffer{ other.id }, 56, 16, nullptr ), ResourceException );
+}
+
+
+TEST_CASE( "Null render device records calls", "[render_null]" )
+{
+     using namespace _16nar;
+
+     null::RenderApi api{ ProfileType::MultiThreaded };
+     auto& device = api.get_recording_device();
+     device.set_recording( true );
+     LoadParams< ResourceType::VertexBuffer > vb_params{};
+     VertexBuffer quad{ api.load( ResourceType::VertexBuffer, vb_params ).id };
+     Material material{ api.load( ResourceType::Material, LoadParams< ResourceType::Material >{} ).id };
+     Texture texture{ api.load( ResourceType::Texture, LoadParams< ResourceType::Texture >{} ).id };
+
+     RenderParams params{};
+     params.vertex_buffer = quad;
+     params.textures.push_back( texture );
+     params.primitive = PrimitiveType::TriangleStrip;
+     params.vertex_count = 4;
+     params.instance_count = 3;
+
+     device.clear( true, false, false );
+     device.bind_material( material );
+     device.bind_material( material );
+     device.set_shader_params( []( const IShaderProgram& program )
+     {
+          program.set_uniform( "first", 1.0f );
+          program.set_uniform( "second", 2 );
+     } );
+     device.render( params );
+     device.render( params );
+     api.end_frame();
+
+     const auto& commands = device.get_commands();
+     REQUIRE( commands.size() == 6 );
+     REQUIRE( commands[ 0 ].type == null::CommandType::Clear );
+     REQUIRE( commands[ 0 ].args[ 0 ] == 1 );
+     REQUIRE( commands[ 1 ].type == null::CommandType::BindMaterial );
+     REQUIRE( commands[ 1 ].resource == material.id );
+     REQUIRE( commands[ 2 ].type == null::CommandType::SetShaderParams );
+     REQUIRE( commands[ 2 ].args[ 0 ] == 2 );
+     REQUIRE( commands[ 3 ].type == null::CommandType::Render );
+     REQUIRE( commands[ 3 ].resource == quad.id );
+     REQUIRE( commands[ 3 ].args[ 1 ] == 4 );
+     REQUIRE( commands[ 3 ].args[ 2 ] == 3 );
+     REQUIRE( commands[ 5 ].type == null::CommandType::EndFrame );
+
+     const auto& counters = device.get_counters();
+     REQUIRE( counters.frames == 1 );
+     REQUIRE( counters.draw_calls == 2 );
+     REQUIRE( counters.vertices == 24 );
+     REQUIRE( counters.instances == 6 );
+     REQUIRE( counters.material_binds == 1 );
+     REQUIRE( counters.texture_binds == 2 );
+     REQUIRE( counters.uniforms == 2 );
+     REQUIRE( counters.clears == 1 );
+
+     // counters are updated without recording
+     device.set_recording( false );
+     device.render( params );
+     REQUIRE( device.get_commands().size() == 6 );
+     REQUIRE( device.get_counters().draw_calls == 3 );
+
+     // missing resources are detected as by other render devices
+     api.unload( Resource{ ResourceType::Texture, texture.id } );
+     REQUIRE_THROWS_AS( device.render( params ), ResourceException );
+     REQUIRE_THROWS_AS( device.bind_shader( Shader{ 100 } ), ResourceException );
+
+     // uniforms of object are counted with its model matrix
+     ObjectUniforms uniforms{};
+     REQUIRE( uniforms.add( get_uniform_id( "third" ), 3.0f ) );
+     device.set_object_uniforms( uniforms );
+     REQUIRE( device.get_counters().uniforms == 4 );
+
+     device.reset();
+     REQUIRE( device.get_commands().empty() );
+     REQUIRE( device.get_counters().draw_calls == 0 );
+}
+
+
+TEST_CASE( "Null render device checks stream buffer regions", "[render_null]" )
+{
+     using namespace _16nar;
+
+     null::RenderApi api{ ProfileType::SingleThreaded };
+     auto& device = api.get_recording_device();
+     device.set_recording( true );
+     LoadParams< ResourceType::StreamBuffer > sb_params{};
+     sb_params.attributes.push_back( { 2, DataType::Float } );
+     sb_params.size = 100;    // region holds 12 vertices of 8 bytes
+     StreamBuffer stream{ api.load( ResourceType::StreamBuffer, sb_params ).id };
+
+     REQUIRE( device.append_stream_data( stream, 64, nullptr ) == 0 );
+     REQUIRE( device.append_stream_data( stream, 32, nullptr ) == 64 );
+     REQUIRE_THROWS_AS( device.append_stream_data( stream, 8, nullptr ), ResourceException );
+     REQUIRE_THROWS_AS( device.append_stream_data( stream, 4, nullptr ), ResourceException );
+
+     // offsets start from the beginning of region in the next frame
+     api.end_frame();
+     REQUIRE( device.append_stream_data( stream, 16, nullptr ) == 0 );
+
+     RenderParams params{};
+     params.stream_buffer = stream;
+     params.vertex_count = 2;
+     device.render( params );
+     REQUIRE( device.get_commands().back().type == null::CommandType::RenderStream );
+     REQUIRE( device.get_counters().stream_bytes == 112 );
+}
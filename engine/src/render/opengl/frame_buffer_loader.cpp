@@ -1,5 +1,6 @@
 #include <16nar/render/opengl/frame_buffer_loader.h>
 
+#include <16nar/render/opengl/typed_resource_manager.h>
 #include <16nar/render/opengl/glad.h>
 
 #include <16nar/system/exceptions.h>
@@ -22,14 +23,14 @@ bool load_attachment( const ResourceManagerMap& managers,
      unsigned int descriptor;
      switch ( params.resource.type )
      {
-          // managers are handled by render API, so at() must never throw here
+          // managers are handled by render API, so typed managers always exist here
           case ResourceType::RenderBuffer:
           {
-               std::any res_any = managers.at( ResourceType::RenderBuffer )->get_handler( params.resource.id );
-               const auto *ptr = std::any_cast< Handler< ResourceType::RenderBuffer > >( &res_any );
+               const auto *ptr = get_typed_manager< ResourceType::RenderBuffer >( managers )
+                    ->find_handler( params.resource.id );
                if ( !ptr )
                {
-                    LOG_16NAR_ERROR( "Wrong handler for render buffer id " << params.resource.id );
+                    LOG_16NAR_ERROR( "No render buffer with id " << params.resource.id );
                     return false;
                }
                descriptor = ptr->descriptor;
@@ -39,11 +40,11 @@ bool load_attachment( const ResourceManagerMap& managers,
           break;
           case ResourceType::Texture:
           {
-               std::any res_any = managers.at( ResourceType::Texture )->get_handler( params.resource.id );
-               const auto *ptr = std::any_cast< Handler< ResourceType::Texture > >( &res_any );
+               const auto *ptr = get_typed_manager< ResourceType::Texture >( managers )
+                    ->find_handler( params.resource.id );
                if ( !ptr )
                {
-                    LOG_16NAR_ERROR( "Wrong handler for texture id " << params.resource.id );
+                    LOG_16NAR_ERROR( "No texture with id " << params.resource.id );
                     return false;
                }
                descriptor = ptr->descriptor;
@@ -54,11 +55,11 @@ bool load_attachment( const ResourceManagerMap& managers,
           break;
           case ResourceType::Cubemap:
           {
-               std::any res_any = managers.at( ResourceType::Cubemap )->get_handler( params.resource.id );
-               const auto *ptr = std::any_cast< Handler< ResourceType::Cubemap > >( &res_any );
+               const auto *ptr = get_typed_manager< ResourceType::Cubemap >( managers )
+                    ->find_handler( params.resource.id );
                if ( !ptr )
                {
-                    LOG_16NAR_ERROR( "Wrong handler for cubemap id " << params.resource.id );
+                    LOG_16NAR_ERROR( "No cubemap with id " << params.resource.id );
                     return false;
                }
                descriptor = ptr->descriptor;
@@ -0,0 +1,67 @@
+#include <16nar/render/opengl/material_loader.h>
+
+#include <16nar/render/opengl/typed_resource_manager.h>
+
+#include <16nar/logger/logger.h>
+
+namespace _16nar::opengl
+{
+
+bool MaterialLoader::load( const ResourceManagerMap& managers, const LoadParamsType& params, HandlerType& handler )
+{
+     // managers are handled by render API, so typed managers always exist here
+     const auto *shader_ptr = get_typed_manager< ResourceType::Shader >( managers )
+          ->find_handler( params.shader.id );
+     if ( !shader_ptr )
+     {
+          LOG_16NAR_ERROR( "No shader with id " << params.shader.id );
+          return false;
+     }
+     handler.shader = params.shader;
+
+     const auto *textures = get_typed_manager< ResourceType::Texture >( managers );
+     for ( const auto& texture : params.textures )
+     {
+          if ( !textures->find_handler( texture.id ) )
+          {
+               LOG_16NAR_ERROR( "No texture with id " << texture.id );
+               return false;
+          }
+     }
+     handler.textures = params.textures;
+
+     const auto *texture_arrays = get_typed_manager< ResourceType::TextureArray >( managers );
+     for ( const auto& texture_array : params.texture_arrays )
+     {
+          if ( !texture_arrays->find_handler( texture_array.id ) )
+          {
+               LOG_16NAR_ERROR( "No texture array with id " << texture_array.id );
+               return false;
+          }
+     }
+     handler.texture_arrays = params.texture_arrays;
+
+     handler.uniforms.reserve( params.uniforms.size() );
+     for ( const auto& uniform : params.uniforms )
+     {
+          UniformId id = get_uniform_id( uniform.name );
+          if ( !shader_ptr->uniforms || find_uniform_location( *shader_ptr->uniforms, id ) < 0 )
+          {
+               // shader program may be reloaded with this uniform, so it is kept
+               LOG_16NAR_WARNING( "Uniform " << uniform.name << " is not active in shader program "
+                    << params.shader.id << ", it is ignored while the program is loaded" );
+          }
+          handler.uniforms.emplace_back( id, uniform.value );
+     }
+     LOG_16NAR_DEBUG( "Material with shader program " << params.shader.id << " was loaded" );
+     return true;
+}
+
+
+bool MaterialLoader::unload( const HandlerType& handler )
+{
+     LOG_16NAR_DEBUG( "Material with shader program " << handler.shader.id << " was unloaded" );
+     return true;
+}
+
+} // namespace _16nar::opengl
@@ -4,13 +4,17 @@
 namespace _16nar::opengl
 {
 
+// command is called with qualified name, because call through pointer to virtual member
+// would be dispatched back to MtRenderDevice and enqueue the command again.
 #define _16NAR_ENQUEUE_COMMAND( _cmd, ... )  \
      size_t next_index = ( frame_index_ + 1 ) % _16nar_saved_frames; \
-     render_queue_[ next_index ].push( std::bind( &StRenderDevice::_cmd, this, __VA_ARGS__ ) );
+     render_queue_[ next_index ].push( std::bind( \
+          []( StRenderDevice *device, const auto&... args ){ device->StRenderDevice::_cmd( args... ); }, \
+          this, __VA_ARGS__ ) );
 
 
 MtRenderDevice::MtRenderDevice( const ResourceManagerMap& managers ):
-     StRenderDevice::StRenderDevice( managers ), render_queue_{}, frame_index_{ 0 }
+     StRenderDevice::StRenderDevice( managers ), render_queue_{}, frame_stream_offsets_{}, frame_index_{ 0 }
 {}
 
 
@@ -44,6 +48,38 @@ void MtRenderDevice::set_shader_params( const ShaderSetupFunction& setup )
 }
 
 
+void MtRenderDevice::set_object_uniforms( const ObjectUniforms& uniforms )
+{
+     _16NAR_ENQUEUE_COMMAND( set_object_uniforms, uniforms );
+}
+
+
+void MtRenderDevice::bind_material( const Material& material )
+{
+     _16NAR_ENQUEUE_COMMAND( bind_material, material );
+}
+
+
+void MtRenderDevice::update_uniform_buffer( const UniformBuffer& buffer, std::size_t offset,
+     std::size_t size, const DataSharedPtr& data )
+{
+     _16NAR_ENQUEUE_COMMAND( update_uniform_buffer, buffer, offset, size, data );
+}
+
+
+std::size_t MtRenderDevice::append_stream_data( const StreamBuffer& buffer, std::size_t size,
+     const DataSharedPtr& data )
+{
+     size_t next_index = ( frame_index_ + 1 ) % _16nar_saved_frames;
+     std::size_t& free_offset = frame_stream_offsets_[ next_index ][ buffer.id ];
+     std::size_t offset = free_offset;
+     free_offset += size;
+     render_queue_[ next_index ].push( std::bind( &MtRenderDevice::write_stream_data,
+          this, buffer, offset, size, data ) );
+     return offset;
+}
+
+
 void MtRenderDevice::bind_framebuffer( const FrameBuffer& framebuffer )
 {
      _16NAR_ENQUEUE_COMMAND( bind_framebuffer, framebuffer );
@@ -69,7 +105,9 @@ void MtRenderDevice::process_render_queue()
 
 void MtRenderDevice::end_frame()
 {
+     StRenderDevice::end_frame();
      std::queue< Request >{}.swap( render_queue_[ frame_index_ ] );
+     frame_stream_offsets_[ frame_index_ ].clear();
      frame_index_ = ( frame_index_ + 1 ) % _16nar_saved_frames;
 }
 
@@ -8,17 +8,46 @@
 #include <16nar/render/opengl/vertex_buffer_loader.h>
 #include <16nar/render/opengl/render_buffer_loader.h>
 #include <16nar/render/opengl/texture_loader.h>
+#include <16nar/render/opengl/texture_array_loader.h>
 #include <16nar/render/opengl/shader_loader.h>
 #include <16nar/render/opengl/cubemap_loader.h>
+#include <16nar/render/opengl/material_loader.h>
+#include <16nar/render/opengl/uniform_buffer_loader.h>
+#include <16nar/render/opengl/stream_buffer_loader.h>
 #include <16nar/render/opengl/glad.h>
 
 #include <16nar/system/exceptions.h>
+#include <16nar/system/profiler.h>
 #include <16nar/logger/logger.h>
 
 #include <GLFW/glfw3.h>
 
 namespace _16nar::opengl
 {
+namespace
+{
+
+/// @brief Get name of profiler zone for load queue of resource manager.
+[[maybe_unused]] const char *get_load_zone_name( ResourceType type ) noexcept
+{
+     switch ( type )
+     {
+          case ResourceType::Texture:        return "load queue: Texture";
+          case ResourceType::Shader:         return "load queue: Shader";
+          case ResourceType::FrameBuffer:    return "load queue: FrameBuffer";
+          case ResourceType::VertexBuffer:   return "load queue: VertexBuffer";
+          case ResourceType::RenderBuffer:   return "load queue: RenderBuffer";
+          case ResourceType::Cubemap:        return "load queue: Cubemap";
+          case ResourceType::Material:       return "load queue: Material";
+          case ResourceType::UniformBuffer:  return "load queue: UniformBuffer";
+          case ResourceType::StreamBuffer:   return "load queue: StreamBuffer";
+          case ResourceType::TextureArray:   return "load queue: TextureArray";
+          default:                           return "load queue";
+     }
+}
+
+} // anonymous namespace
+
 
 RenderApi::RenderApi( ProfileType profile )
 {
@@ -43,6 +72,14 @@ RenderApi::RenderApi( ProfileType profile )
                     std::make_unique< StResourceManager< RenderBufferLoader > >( managers_ ) );
                managers_.emplace( ResourceType::Cubemap,
                     std::make_unique< StResourceManager< CubemapLoader > >( managers_ ) );
+               managers_.emplace( ResourceType::Material,
+                    std::make_unique< StResourceManager< MaterialLoader > >( managers_ ) );
+               managers_.emplace( ResourceType::UniformBuffer,
+                    std::make_unique< StResourceManager< UniformBufferLoader > >( managers_ ) );
+               managers_.emplace( ResourceType::StreamBuffer,
+                    std::make_unique< StResourceManager< StreamBufferLoader > >( managers_ ) );
+               managers_.emplace( ResourceType::TextureArray,
+                    std::make_unique< StResourceManager< TextureArrayLoader > >( managers_ ) );
 
                device_ = std::make_unique< StRenderDevice >( managers_ );
           }
@@ -61,6 +98,14 @@ RenderApi::RenderApi( ProfileType profile )
                     std::make_unique< MtResourceManager< RenderBufferLoader > >( managers_ ) );
                managers_.emplace( ResourceType::Cubemap,
                     std::make_unique< MtResourceManager< CubemapLoader > >( managers_ ) );
+               managers_.emplace( ResourceType::Material,
+                    std::make_unique< MtResourceManager< MaterialLoader > >( managers_ ) );
+               managers_.emplace( ResourceType::UniformBuffer,
+                    std::make_unique< MtResourceManager< UniformBufferLoader > >( managers_ ) );
+               managers_.emplace( ResourceType::StreamBuffer,
+                    std::make_unique< MtResourceManager< StreamBufferLoader > >( managers_ ) );
+               managers_.emplace( ResourceType::TextureArray,
+                    std::make_unique< MtResourceManager< TextureArrayLoader > >( managers_ ) );
 
                device_ = std::make_unique< MtRenderDevice >( managers_ );
           }
@@ -94,6 +139,17 @@ void RenderApi::unload( const Resource& resource )
 }
 
 
+void RenderApi::update( const Resource& resource, const std::any& params )
+{
+     const auto iter = managers_.find( resource.type );
+     if ( iter == managers_.cend() )
+     {
+          throw ResourceException{ "wrong resource type" };
+     }
+     iter->second->update( resource.id, params );
+}
+
+
 IRenderDevice& RenderApi::get_device() const noexcept
 {
      return *device_;
@@ -102,17 +158,29 @@ IRenderDevice& RenderApi::get_device() const noexcept
 
 void RenderApi::process()
 {
+     PROFILE_16NAR_MAIN( "RenderApi::process" );
      for ( auto& pair : managers_ )
      {
-          if ( pair.first != ResourceType::FrameBuffer )
+          if ( pair.first != ResourceType::FrameBuffer && pair.first != ResourceType::Material )
           {
+               PROFILE_16NAR_ZONE( get_load_zone_name( pair.first ) );
                pair.second->process_load_queue();
           }
      }
-     // process frame buffer after attachments are loaded in other managers.
-     managers_[ ResourceType::FrameBuffer ]->process_load_queue();
-
-     device_->process_render_queue();
+     // process frame buffers and materials after resources they refer to are loaded in other managers.
+     {
+          PROFILE_16NAR_ZONE( get_load_zone_name( ResourceType::FrameBuffer ) );
+          managers_[ ResourceType::FrameBuffer ]->process_load_queue();
+     }
+     {
+          PROFILE_16NAR_ZONE( get_load_zone_name( ResourceType::Material ) );
+          managers_[ ResourceType::Material ]->process_load_queue();
+     }
+     {
+          PROFILE_16NAR_ZONE( "process_render_queue" );
+          device_->process_render_queue();
+     }
+     PROFILE_16NAR_ZONE( "unload queues" );
      for ( auto& pair : managers_ )
      {
           pair.second->process_unload_queue();
@@ -6,6 +6,9 @@
 #include <16nar/logger/logger.h>
 
 #include <new>
+#include <algorithm>
+#include <string_view>
+#include <utility>
 
 namespace _16nar::opengl
 {
@@ -91,6 +94,71 @@ bool load_shader( const LoadParams< ResourceType::Shader >::ShaderParams& params
 }
 
 
+UniformLocations reflect_uniforms( unsigned int program )
+{
+     GLint count = 0;
+     GLint max_length = 0;
+     glGetProgramiv( program, GL_ACTIVE_UNIFORMS, &count );
+     glGetProgramiv( program, GL_ACTIVE_UNIFORM_MAX_LENGTH, &max_length );
+
+     UniformLocations locations;
+     locations.reserve( count );
+     std::vector< GLchar > name( max_length + 1 );
+     for ( GLint i = 0; i < count; i++ )
+     {
+          GLsizei length = 0;
+          GLint size = 0;
+          GLenum type = 0;
+          glGetActiveUniform( program, i, name.size(), &length, &size, &type, name.data() );
+          int location = glGetUniformLocation( program, name.data() );
+          if ( location < 0 )     // member of a uniform block
+          {
+               continue;
+          }
+          // arrays are reported as "name[0]", but are set by name of the array
+          std::string_view uniform_name{ name.data(), static_cast< std::size_t >( length ) };
+          if ( size > 1 && uniform_name.size() > 3 && uniform_name.substr( uniform_name.size() - 3 ) == "[0]" )
+          {
+               uniform_name.remove_suffix( 3 );
+          }
+          locations.emplace_back( get_uniform_id( uniform_name ), location );
+     }
+
+     std::sort( locations.begin(), locations.end(),
+          []( const auto& lhs, const auto& rhs ) { return lhs.first < rhs.first; } );
+     auto iter = std::adjacent_find( locations.cbegin(), locations.cend(),
+          []( const auto& lhs, const auto& rhs ) { return lhs.first == rhs.first; } );
+     if ( iter != locations.cend() )
+     {
+          LOG_16NAR_WARNING( "Shader program " << program << " has uniforms with equal identifiers "
+               << static_cast< uint32_t >( iter->first ) << ", only one of them can be set" );
+     }
+     return locations;
+}
+
+
+void bind_uniform_blocks( unsigned int program )
+{
+     GLint count = 0;
+     GLint max_length = 0;
+     glGetProgramiv( program, GL_ACTIVE_UNIFORM_BLOCKS, &count );
+     glGetProgramiv( program, GL_ACTIVE_UNIFORM_BLOCK_MAX_NAME_LENGTH, &max_length );
+
+     std::vector< GLchar > name( max_length + 1 );
+     for ( GLint i = 0; i < count; i++ )
+     {
+          GLsizei length = 0;
+          glGetActiveUniformBlockName( program, i, name.size(), &length, name.data() );
+          int binding = find_uniform_block_binding( std::string_view{ name.data(), static_cast< std::size_t >( length ) } );
+          // other blocks keep bindings set by the shader
+          if ( binding >= 0 )
+          {
+               glUniformBlockBinding( program, i, binding );
+          }
+     }
+}
+
+
 void unload_shaders( const std::vector< unsigned int >& shaders, unsigned int program )
 {
      for ( auto descriptor : shaders )
@@ -145,7 +213,21 @@ bool ShaderLoader::load( const ResourceManagerMap&, const LoadParamsType& params
           return false;
      }
 
-     LOG_16NAR_DEBUG( "Shader " << handler.descriptor << " was loaded" );
+     bind_uniform_blocks( handler.descriptor );
+     try
+     {
+          handler.uniforms = std::make_shared< const UniformLocations >( reflect_uniforms( handler.descriptor ) );
+     }
+     catch ( const std::bad_alloc& ex )
+     {
+          LOG_16NAR_ERROR( "Could not allocate memory for shader uniform locations: " << ex.what() );
+          glDeleteProgram( handler.descriptor );
+          handler.descriptor = 0;
+          return false;
+     }
+
+     LOG_16NAR_DEBUG( "Shader " << handler.descriptor << " was loaded with "
+          << handler.uniforms->size() << " active uniforms" );
      return true;
 }
 
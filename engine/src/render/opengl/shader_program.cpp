@@ -3,71 +3,165 @@
 #include <16nar/render/opengl/glad.h>
 #include <16nar/math/transform_matrix.h>
 
+#include <string>
+
 namespace _16nar::opengl
 {
 
-ShaderProgram::ShaderProgram( unsigned int descriptor ) noexcept:
-     descriptor_{ descriptor }
+ShaderProgram::ShaderProgram( const Handler< ResourceType::Shader >& handler ) noexcept:
+     descriptor_{ handler.descriptor }, uniforms_{ handler.uniforms.get() }
 {}
 
 
 void ShaderProgram::set_uniform( std::string_view name, float value ) const noexcept
 {
-     glUniform1f( glGetUniformLocation( descriptor_, name.data() ), value );
+     glUniform1f( get_location( name ), value );
 }
 
 
 void ShaderProgram::set_uniform( std::string_view name, int value ) const noexcept
 {
-     glUniform1i( glGetUniformLocation( descriptor_, name.data() ), value );
+     glUniform1i( get_location( name ), value );
 }
 
 
 void ShaderProgram::set_uniform( std::string_view name, bool value ) const noexcept
 {
-     glUniform1i( glGetUniformLocation( descriptor_, name.data() ), static_cast< int >( value ) );
+     glUniform1i( get_location( name ), static_cast< int >( value ) );
 }
 
 
 void ShaderProgram::set_uniform( std::string_view name, const Vec2i& value ) const noexcept
 {
-     glUniform2i( glGetUniformLocation( descriptor_, name.data() ), value.x(), value.y() );
+     glUniform2i( get_location( name ), value.x(), value.y() );
 }
 
 
 void ShaderProgram::set_uniform( std::string_view name, const Vec2f& value ) const noexcept
 {
-     glUniform2f( glGetUniformLocation( descriptor_, name.data() ), value.x(), value.y() );
+     glUniform2f( get_location( name ), value.x(), value.y() );
 }
 
 
 void ShaderProgram::set_uniform( std::string_view name, const Vec3i& value ) const noexcept
 {
-     glUniform3i( glGetUniformLocation( descriptor_, name.data() ), value.x(), value.y(), value.z() );
+     glUniform3i( get_location( name ), value.x(), value.y(), value.z() );
 }
 
 
 void ShaderProgram::set_uniform( std::string_view name, const Vec3f& value ) const noexcept
 {
-     glUniform3f( glGetUniformLocation( descriptor_, name.data() ), value.x(), value.y(), value.z() );
+     glUniform3f( get_location( name ), value.x(), value.y(), value.z() );
 }
 
 
 void ShaderProgram::set_uniform( std::string_view name, const Vec4i& value ) const noexcept
 {
-     glUniform4i( glGetUniformLocation( descriptor_, name.data() ), value.x(), value.y(), value.z(), value.w() );
+     glUniform4i( get_location( name ), value.x(), value.y(), value.z(), value.w() );
 }
 
 
 void ShaderProgram::set_uniform( std::string_view name, const Vec4f& value ) const noexcept
 {
-     glUniform4f( glGetUniformLocation( descriptor_, name.data() ), value.x(), value.y(), value.z(), value.w() );
+     glUniform4f( get_location( name ), value.x(), value.y(), value.z(), value.w() );
 }
 
 
 void ShaderProgram::set_uniform( std::string_view name, const TransformMatrix& value ) const noexcept
 {
-     glUniformMatrix4fv( glGetUniformLocation( descriptor_, name.data() ), 1, GL_FALSE, value.data() );
+     glUniformMatrix4fv( get_location( name ), 1, GL_FALSE, value.data() );
+}
+
+
+void ShaderProgram::set_uniform( UniformId id, float value ) const noexcept
+{
+     glUniform1f( get_location( id ), value );
+}
+
+
+void ShaderProgram::set_uniform( UniformId id, int value ) const noexcept
+{
+     glUniform1i( get_location( id ), value );
+}
+
+
+void ShaderProgram::set_uniform( UniformId id, bool value ) const noexcept
+{
+     glUniform1i( get_location( id ), static_cast< int >( value ) );
+}
+
+
+void ShaderProgram::set_uniform( UniformId id, const Vec2i& value ) const noexcept
+{
+     glUniform2i( get_location( id ), value.x(), value.y() );
+}
+
+
+void ShaderProgram::set_uniform( UniformId id, const Vec2f& value ) const noexcept
+{
+     glUniform2f( get_location( id ), value.x(), value.y() );
+}
+
+
+void ShaderProgram::set_uniform( UniformId id, const Vec3i& value ) const noexcept
+{
+     glUniform3i( get_location( id ), value.x(), value.y(), value.z() );
+}
+
+
+void ShaderProgram::set_uniform( UniformId id, const Vec3f& value ) const noexcept
+{
+     glUniform3f( get_location( id ), value.x(), value.y(), value.z() );
+}
+
+
+void ShaderProgram::set_uniform( UniformId id, const Vec4i& value ) const noexcept
+{
+     glUniform4i( get_location( id ), value.x(), value.y(), value.z(), value.w() );
+}
+
+
+void ShaderProgram::set_uniform( UniformId id, const Vec4f& value ) const noexcept
+{
+     glUniform4f( get_location( id ), value.x(), value.y(), value.z(), value.w() );
+}
+
+
+void ShaderProgram::set_uniform( UniformId id, const TransformMatrix& value ) const noexcept
+{
+     glUniformMatrix4fv( get_location( id ), 1, GL_FALSE, value.data() );
+}
+
+
+int ShaderProgram::get_location( std::string_view name ) const noexcept
+{
+     if ( uniforms_ )
+     {
+          int location = find_uniform_location( *uniforms_, get_uniform_id( name ) );
+          if ( location >= 0 )
+          {
+               return location;
+          }
+          // arrays are reflected by base name, so their elements are queried from OpenGL
+     }
+     try
+     {
+          return glGetUniformLocation( descriptor_, std::string{ name }.c_str() );
+     }
+     catch ( const std::bad_alloc& )
+     {
+          return -1;
+     }
+}
+
+
+int ShaderProgram::get_location( UniformId id ) const noexcept
+{
+     if ( uniforms_ )
+     {
+          return find_uniform_location( *uniforms_, id );
+     }
+     return -1;
 }
 
 } // namespace _16nar::opengl
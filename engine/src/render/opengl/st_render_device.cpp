@@ -4,51 +4,108 @@
 #include <16nar/render/opengl/glad.h>
 #include <16nar/system/exceptions.h>
 
+#include <algorithm>
+#include <cstring>
+
 namespace _16nar::opengl
 {
+namespace
+{
+
+void wait_fence( void *&fence )
+{
+     if ( !fence )
+     {
+          return;
+     }
+     GLsync sync = static_cast< GLsync >( fence );
+     while ( glClientWaitSync( sync, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000 ) == GL_TIMEOUT_EXPIRED ) {}
+     glDeleteSync( sync );
+     fence = nullptr;
+}
+
+} // anonymous namespace
+
 
 StRenderDevice::StRenderDevice( const ResourceManagerMap& managers ):
-     managers_{ managers }, current_shader_{}
+     textures_{ get_typed_manager< ResourceType::Texture >( managers ) },
+     texture_arrays_{ get_typed_manager< ResourceType::TextureArray >( managers ) },
+     vertex_buffers_{ get_typed_manager< ResourceType::VertexBuffer >( managers ) },
+     shaders_{ get_typed_manager< ResourceType::Shader >( managers ) },
+     framebuffers_{ get_typed_manager< ResourceType::FrameBuffer >( managers ) },
+     materials_{ get_typed_manager< ResourceType::Material >( managers ) },
+     uniform_buffers_{ get_typed_manager< ResourceType::UniformBuffer >( managers ) },
+     stream_buffers_{ get_typed_manager< ResourceType::StreamBuffer >( managers ) },
+     current_shader_{}, current_material_{}, material_textures_{ 0 },
+     stream_offsets_{}, written_streams_{}, stream_region_{ 0 }
 {}
 
 
 void StRenderDevice::render( const RenderParams& params )
 {
-     // managers are handled by render API, so at() must never throw here
-     const auto& texture_manager = managers_.at( ResourceType::Texture );
-     std::vector< Handler< ResourceType::Texture > > handlers;
-     handlers.reserve( params.textures.size() );
-     for ( const auto& texture : params.textures )
+     for ( std::size_t i = 0; i < params.textures.size(); i++ )
      {
-          std::any tex_param_any = texture_manager->get_handler( texture.id );
-          const auto *tex_param_ptr = std::any_cast< Handler< ResourceType::Texture > >( &tex_param_any );
-          if ( !tex_param_ptr )
+          const auto *tex_ptr = textures_->find_handler( params.textures[ i ].id );
+          if ( !tex_ptr )
           {
-               throw ResourceException{ "wrong handler for texture id ", texture.id };
+               throw ResourceException{ "no texture with such id ", params.textures[ i ].id };
           }
-          handlers.emplace_back( *tex_param_ptr );
+          glActiveTexture( GL_TEXTURE0 + material_textures_ + i );
+          glBindTexture( GL_TEXTURE_2D, tex_ptr->descriptor );
      }
-
-     std::any vb_any =
-          managers_.at( ResourceType::VertexBuffer )->get_handler( params.vertex_buffer.id );
-     const auto *vb_ptr = std::any_cast< Handler< ResourceType::VertexBuffer > >( &vb_any );
-     if ( !vb_ptr )
+     for ( std::size_t i = 0; i < params.texture_arrays.size(); i++ )
      {
-          throw ResourceException{ "wrong handler for vertex buffer id ", params.vertex_buffer.id };
+          const auto *arr_ptr = texture_arrays_->find_handler( params.texture_arrays[ i ].id );
+          if ( !arr_ptr )
+          {
+               throw ResourceException{ "no texture array with such id ", params.texture_arrays[ i ].id };
+          }
+          glActiveTexture( GL_TEXTURE0 + material_textures_ + params.textures.size() + i );
+          glBindTexture( GL_TEXTURE_2D_ARRAY, arr_ptr->descriptor );
      }
 
-     for ( std::size_t i = 0; i < handlers.size(); i++ )
+     if ( params.stream_buffer.id != 0 )
      {
-          glActiveTexture( GL_TEXTURE0 + i );
-          glBindTexture( GL_TEXTURE_2D, handlers[ i ].descriptor );
+          const auto *sb_ptr = stream_buffers_->find_handler( params.stream_buffer.id );
+          if ( !sb_ptr )
+          {
+               throw ResourceException{ "no stream buffer with such id ", params.stream_buffer.id };
+          }
+          std::size_t base = stream_region_ * sb_ptr->region_size + params.stream_offset;
+          glBindVertexArray( sb_ptr->vao_descriptor );
+          if ( !sb_ptr->instanced )
+          {
+               glDrawArraysInstanced( primitive_type_to_int( params.primitive ),
+                    base / sb_ptr->vertex_size, params.vertex_count, params.instance_count );
+          }
+          else if ( GLAD_GL_VERSION_4_2 )
+          {
+               glDrawArraysInstancedBaseInstance( primitive_type_to_int( params.primitive ),
+                    0, params.vertex_count, params.instance_count, base / sb_ptr->vertex_size );
+          }
+          else
+          {
+               // first instance cannot be set, so attributes are moved to written data
+               glBindBuffer( GL_ARRAY_BUFFER, sb_ptr->vbo_descriptor );
+               set_stream_attributes( *sb_ptr, base );
+               glDrawArraysInstanced( primitive_type_to_int( params.primitive ),
+                    0, params.vertex_count, params.instance_count );
+               glBindBuffer( GL_ARRAY_BUFFER, 0 );
+          }
+          return;
      }
 
+     const auto *vb_ptr = vertex_buffers_->find_handler( params.vertex_buffer.id );
+     if ( !vb_ptr )
+     {
+          throw ResourceException{ "no vertex buffer with such id ", params.vertex_buffer.id };
+     }
      glBindVertexArray( vb_ptr->vao_descriptor );
 
      if ( vb_ptr->ebo_descriptor != 0 )
      {
           glDrawElementsInstanced( primitive_type_to_int( params.primitive ),
-               params.vertex_count, GL_UNSIGNED_INT, nullptr, params.instance_count );
+               params.vertex_count, vb_ptr->index_type, nullptr, params.instance_count );
      }
      else
      {
@@ -79,6 +136,8 @@ void StRenderDevice::set_depth_test_state( bool enable )
 
 void StRenderDevice::bind_shader( const Shader& shader )
 {
+     current_material_ = {};
+     material_textures_ = 0;
      if ( shader.id == 0 )
      {
           glUseProgram( 0 );
@@ -86,12 +145,10 @@ void StRenderDevice::bind_shader( const Shader& shader )
           return;
      }
 
-     // managers are handled by render API, so at() must never throw here
-     std::any shader_handler_any = managers_.at( ResourceType::Shader )->get_handler( shader.id );
-     const auto *shader_handler = std::any_cast< Handler< ResourceType::Shader > >( &shader_handler_any );
+     const auto *shader_handler = shaders_->find_handler( shader.id );
      if ( !shader_handler )
      {
-          throw ResourceException{ "wrong handler for shader id ", shader.id };
+          throw ResourceException{ "no shader with such id ", shader.id };
      }
 
      current_shader_ = *shader_handler;
@@ -105,11 +162,116 @@ void StRenderDevice::set_shader_params( const std::function< void( const IShader
      {
           return;
      }
-     ShaderProgram shader{ current_shader_.descriptor };
+     ShaderProgram shader{ current_shader_ };
      setup( shader );
 }
 
 
+void StRenderDevice::set_object_uniforms( const ObjectUniforms& uniforms )
+{
+     if ( current_shader_.descriptor == 0 )
+     {
+          return;
+     }
+     ShaderProgram shader{ current_shader_ };
+     uniforms.apply( shader );
+}
+
+
+void StRenderDevice::bind_material( const Material& material )
+{
+     if ( material.id == current_material_.id )
+     {
+          return;
+     }
+     if ( material.id == 0 )
+     {
+          StRenderDevice::bind_shader( Shader{} );
+          return;
+     }
+
+     const auto *material_ptr = materials_->find_handler( material.id );
+     if ( !material_ptr )
+     {
+          throw ResourceException{ "no material with such id ", material.id };
+     }
+
+     // related resources are resolved on bind, so they may be reloaded while material exists
+     const auto *shader_ptr = shaders_->find_handler( material_ptr->shader.id );
+     if ( !shader_ptr )
+     {
+          throw ResourceException{ "no shader of material with such id ", material_ptr->shader.id };
+     }
+     for ( const auto& texture : material_ptr->textures )
+     {
+          if ( !textures_->find_handler( texture.id ) )
+          {
+               throw ResourceException{ "no texture of material with such id ", texture.id };
+          }
+     }
+     for ( const auto& texture_array : material_ptr->texture_arrays )
+     {
+          if ( !texture_arrays_->find_handler( texture_array.id ) )
+          {
+               throw ResourceException{ "no texture array of material with such id ", texture_array.id };
+          }
+     }
+
+     current_shader_ = *shader_ptr;
+     current_material_ = material;
+     material_textures_ = material_ptr->textures.size() + material_ptr->texture_arrays.size();
+     glUseProgram( shader_ptr->descriptor );
+     for ( std::size_t i = 0; i < material_ptr->textures.size(); i++ )
+     {
+          glActiveTexture( GL_TEXTURE0 + i );
+          glBindTexture( GL_TEXTURE_2D, textures_->find_handler( material_ptr->textures[ i ].id )->descriptor );
+     }
+     for ( std::size_t i = 0; i < material_ptr->texture_arrays.size(); i++ )
+     {
+          glActiveTexture( GL_TEXTURE0 + material_ptr->textures.size() + i );
+          glBindTexture( GL_TEXTURE_2D_ARRAY,
+               texture_arrays_->find_handler( material_ptr->texture_arrays[ i ].id )->descriptor );
+     }
+     for ( const auto& [ id, value ] : material_ptr->uniforms )
+     {
+          int location = shader_ptr->uniforms ? find_uniform_location( *shader_ptr->uniforms, id ) : -1;
+          if ( location >= 0 )
+          {
+               set_uniform_value( location, value );
+          }
+     }
+}
+
+
+void StRenderDevice::update_uniform_buffer( const UniformBuffer& buffer, std::size_t offset,
+     std::size_t size, const DataSharedPtr& data )
+{
+     const auto *ub_ptr = uniform_buffers_->find_handler( buffer.id );
+     if ( !ub_ptr )
+     {
+          throw ResourceException{ "no uniform buffer with such id ", buffer.id };
+     }
+     if ( offset + size > ub_ptr->size )
+     {
+          throw ResourceException{ "data is out of uniform buffer bounds, id ", buffer.id };
+     }
+     glBindBuffer( GL_UNIFORM_BUFFER, ub_ptr->descriptor );
+     glBufferSubData( GL_UNIFORM_BUFFER, offset, size, data.get() );
+     glBindBuffer( GL_UNIFORM_BUFFER, 0 );
+}
+
+
+std::size_t StRenderDevice::append_stream_data( const StreamBuffer& buffer, std::size_t size,
+     const DataSharedPtr& data )
+{
+     std::size_t& free_offset = stream_offsets_[ buffer.id ];
+     std::size_t offset = free_offset;
+     write_stream_data( buffer, offset, size, data );
+     free_offset += size;
+     return offset;
+}
+
+
 void StRenderDevice::bind_framebuffer( const FrameBuffer& framebuffer )
 {
      if ( framebuffer.id == 0 )
@@ -117,12 +279,10 @@ void StRenderDevice::bind_framebuffer( const FrameBuffer& framebuffer )
           glBindFramebuffer( GL_FRAMEBUFFER, 0 );
           return;
      }
-     // managers are handled by render API, so at() must never throw here
-     std::any fb_any = managers_.at( ResourceType::FrameBuffer )->get_handler( framebuffer.id );
-     const auto *fb_ptr = std::any_cast< Handler< ResourceType::FrameBuffer > >( &fb_any );
+     const auto *fb_ptr = framebuffers_->find_handler( framebuffer.id );
      if ( !fb_ptr )
      {
-          throw ResourceException{ "wrong handler for framebuffer id ", framebuffer.id };
+          throw ResourceException{ "no framebuffer with such id ", framebuffer.id };
      }
      glBindFramebuffer( GL_FRAMEBUFFER, fb_ptr->descriptor );
 }
@@ -140,4 +300,67 @@ void StRenderDevice::clear( bool color, bool depth, bool stencil )
      }
 }
 
+
+
+void StRenderDevice::end_frame()
+{
+     for ( const auto& buffer : written_streams_ )
+     {
+          const auto *sb_ptr = stream_buffers_->find_handler( buffer.id );
+          if ( sb_ptr )
+          {
+               sb_ptr->state->fences[ stream_region_ ] = glFenceSync( GL_SYNC_GPU_COMMANDS_COMPLETE, 0 );
+          }
+     }
+     written_streams_.clear();
+     stream_offsets_.clear();
+     stream_region_ = ( stream_region_ + 1 ) % stream_buffer_regions;
+}
+
+
+void StRenderDevice::write_stream_data( const StreamBuffer& buffer, std::size_t offset,
+     std::size_t size, const DataSharedPtr& data )
+{
+     const auto *sb_ptr = stream_buffers_->find_handler( buffer.id );
+     if ( !sb_ptr )
+     {
+          throw ResourceException{ "no stream buffer with such id ", buffer.id };
+     }
+     if ( offset + size > sb_ptr->region_size || size % sb_ptr->vertex_size != 0 )
+     {
+          throw ResourceException{ "data does not fit region of stream buffer, id ", buffer.id };
+     }
+     if ( size == 0 )
+     {
+          return;
+     }
+
+     auto& state = *sb_ptr->state;
+     if ( std::find( written_streams_.cbegin(), written_streams_.cend(), buffer ) == written_streams_.cend() )
+     {
+          wait_fence( state.fences[ stream_region_ ] );
+          written_streams_.push_back( buffer );
+     }
+     std::size_t begin = stream_region_ * sb_ptr->region_size + offset;
+     if ( state.mapped )
+     {
+          std::memcpy( state.mapped + begin, data.get(), size );
+          return;
+     }
+     // region is not used by GPU after the fence, so driver does not need to synchronize
+     glBindBuffer( GL_ARRAY_BUFFER, sb_ptr->vbo_descriptor );
+     void *ptr = glMapBufferRange( GL_ARRAY_BUFFER, begin, size,
+          GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT );
+     if ( ptr )
+     {
+          std::memcpy( ptr, data.get(), size );
+          glUnmapBuffer( GL_ARRAY_BUFFER );
+     }
+     glBindBuffer( GL_ARRAY_BUFFER, 0 );
+     if ( !ptr )
+     {
+          throw ResourceException{ "cannot map stream buffer, id ", buffer.id };
+     }
+}
+
 } // namespace _16nar::opengl
@@ -0,0 +1,95 @@
+#include <16nar/render/opengl/stream_buffer_loader.h>
+
+#include <16nar/render/opengl/glad.h>
+
+#include <16nar/logger/logger.h>
+
+namespace _16nar::opengl
+{
+
+bool StreamBufferLoader::load( const ResourceManagerMap&,
+     const LoadParamsType& params, HandlerType& handler )
+{
+     std::size_t vertex_size = 0;
+     std::size_t instanced_count = 0;
+     for ( const auto& attr : params.attributes )
+     {
+          vertex_size += attr.size * data_type_size( attr.data_type );
+          instanced_count += ( attr.divisor > 0 ? 1 : 0 );
+     }
+     if ( vertex_size == 0 || params.size < vertex_size )
+     {
+          LOG_16NAR_ERROR( "Stream buffer must have space for at least one vertex" );
+          return false;
+     }
+     // attributes are interleaved, so offset of written data selects either vertices or instances
+     if ( instanced_count != 0 && instanced_count != params.attributes.size() )
+     {
+          LOG_16NAR_ERROR( "Stream buffer attributes must be either all per-vertex or all per-instance" );
+          return false;
+     }
+     handler.state = std::make_shared< StreamBufferState >();
+     handler.vertex_size = vertex_size;
+     handler.instanced = ( instanced_count != 0 );
+     handler.attributes = std::make_shared< std::vector< LoadParamsType::AttribParams > >( params.attributes );
+     // every region starts with a whole vertex, so offsets can be converted to vertex indexes
+     handler.region_size = params.size - params.size % vertex_size;
+     std::size_t buffer_size = handler.region_size * stream_buffer_regions;
+
+     glGenVertexArrays( 1, &handler.vao_descriptor );
+     glGenBuffers( 1, &handler.vbo_descriptor );
+     glBindVertexArray( handler.vao_descriptor );
+     glBindBuffer( GL_ARRAY_BUFFER, handler.vbo_descriptor );
+     if ( GLAD_GL_VERSION_4_4 )
+     {
+          const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+          glBufferStorage( GL_ARRAY_BUFFER, buffer_size, nullptr, flags );
+          handler.state->mapped = static_cast< std::byte * >(
+               glMapBufferRange( GL_ARRAY_BUFFER, 0, buffer_size, flags ) );
+     }
+     else
+     {
+          glBufferData( GL_ARRAY_BUFFER, buffer_size, nullptr, GL_STREAM_DRAW );
+     }
+
+     set_stream_attributes( handler, 0 );
+     for ( std::size_t i = 0; i < params.attributes.size(); i++ )
+     {
+          glEnableVertexAttribArray( i );
+          if ( params.attributes[ i ].divisor > 0 )
+          {
+               glVertexAttribDivisor( i, params.attributes[ i ].divisor );
+          }
+     }
+
+     glBindVertexArray( 0 );
+     glBindBuffer( GL_ARRAY_BUFFER, 0 );
+
+     LOG_16NAR_DEBUG( "Stream buffer " << handler.vao_descriptor << " was loaded"
+          << ( handler.state->mapped ? " with persistent mapping" : "" ) );
+     return true;
+}
+
+
+bool StreamBufferLoader::unload( const HandlerType& handler )
+{
+     for ( void *fence : handler.state->fences )
+     {
+          if ( fence )
+          {
+               glDeleteSync( static_cast< GLsync >( fence ) );
+          }
+     }
+     if ( handler.state->mapped )
+     {
+          glBindBuffer( GL_ARRAY_BUFFER, handler.vbo_descriptor );
+          glUnmapBuffer( GL_ARRAY_BUFFER );
+          glBindBuffer( GL_ARRAY_BUFFER, 0 );
+     }
+     glDeleteBuffers( 1, &handler.vbo_descriptor );
+     glDeleteVertexArrays( 1, &handler.vao_descriptor );
+     LOG_16NAR_DEBUG( "Stream buffer " << handler.vao_descriptor << " was unloaded" );
+     return true;
+}
+
+} // namespace _16nar::opengl
@@ -0,0 +1,104 @@
+#include <catch2/catch_test_macros.hpp>
+#include <16nar/render/opengl/handle_table.h>
+#include <16nar/system/exceptions.h>
+
+namespace
+{
+
+using Table = _16nar::opengl::HandleTable< int >;
+
+
+TEST_CASE( "Acquire and release IDs", "[handle_table]" )
+{
+     Table table;
+     _16nar::ResID id1 = table.acquire();
+     _16nar::ResID id2 = table.acquire();
+     REQUIRE( id1 == 1 );     // slot 0 is reserved, first generation is 0
+     REQUIRE( id2 == 2 );
+
+     REQUIRE( table.release( id1 ) );
+     REQUIRE_FALSE( table.release( id1 ) );  // double release is detected
+     REQUIRE_FALSE( table.release( 0 ) );
+     REQUIRE_FALSE( table.release( 100 ) );  // never acquired
+
+     _16nar::ResID id3 = table.acquire();
+     REQUIRE( Table::get_index( id3 ) == Table::get_index( id1 ) );
+     REQUIRE( Table::get_generation( id3 ) == 1 );
+     REQUIRE( id3 != id1 );
+
+     table.reset();
+     REQUIRE( table.acquire() == 1 );
+}
+
+
+TEST_CASE( "Store and find handlers", "[handle_table]" )
+{
+     Table table;
+     _16nar::ResID id1 = table.acquire();
+     _16nar::ResID id2 = table.acquire();
+     REQUIRE( table.emplace( id1, 10 ) );
+     REQUIRE( table.emplace( id2, 20 ) );
+     REQUIRE_FALSE( table.emplace( id2, 30 ) );   // slot is occupied
+     REQUIRE_FALSE( table.emplace( 0, 30 ) );
+
+     REQUIRE( table.find( id1 ) != nullptr );
+     REQUIRE( *table.find( id1 ) == 10 );
+     REQUIRE( *table.find( id2 ) == 20 );
+     REQUIRE( table.find( 0 ) == nullptr );
+     REQUIRE( table.find( 100 ) == nullptr );
+
+     REQUIRE( table.erase( id1 ) );
+     REQUIRE_FALSE( table.erase( id1 ) );
+     REQUIRE( table.find( id1 ) == nullptr );
+     table.release( id1 );
+
+     _16nar::ResID id3 = table.acquire();
+     REQUIRE( table.emplace( id3, 30 ) );
+     REQUIRE( table.find( id1 ) == nullptr );     // stale ID does not match new generation
+     REQUIRE( *table.find( id3 ) == 30 );
+
+     int sum = 0;
+     table.for_each( [ &sum ]( _16nar::ResID, int value ) { sum += value; } );
+     REQUIRE( sum == 50 );
+
+     table.clear();
+     REQUIRE( table.find( id2 ) == nullptr );
+}
+
+
+TEST_CASE( "Slot is retired instead of wrapping generation", "[handle_table]" )
+{
+     Table table;
+     _16nar::ResID first = table.acquire();
+     _16nar::ResID id = first;
+     for ( _16nar::ResID generation = 0; generation < Table::generation_mask; generation++ )
+     {
+          REQUIRE( table.release( id ) );
+          id = table.acquire();
+          REQUIRE( Table::get_index( id ) == Table::get_index( first ) );
+     }
+     REQUIRE( Table::get_generation( id ) == Table::generation_mask );
+     REQUIRE( table.get_retired_count() == 0 );
+     REQUIRE( table.release( id ) );
+     REQUIRE( table.get_retired_count() == 1 );
+     REQUIRE_FALSE( table.release( id ) );
+     REQUIRE_FALSE( table.release( first ) );     // stale ID of generation 0 stays invalid
+
+     _16nar::ResID next = table.acquire();
+     REQUIRE( Table::get_index( next ) != Table::get_index( first ) );
+}
+
+
+TEST_CASE( "IDs exhaustion", "[handle_table]" )
+{
+     Table table;
+     for ( _16nar::ResID i = 1; i <= Table::index_mask; i++ )
+     {
+          table.acquire();
+     }
+     REQUIRE_THROWS_AS( table.acquire(), _16nar::ExceededIdException );
+     REQUIRE( table.release( Table::index_mask ) );
+     REQUIRE_NOTHROW( table.acquire() );     // released slot is reused
+}
+
+}
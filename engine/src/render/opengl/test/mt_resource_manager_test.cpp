@@ -1,5 +1,6 @@
 #include <catch2/catch_test_macros.hpp>
 #include <16nar/render/opengl/mt_resource_manager.h>
+#include "updatable_loader.h"
 
 #include <thread>
 #include <vector>
@@ -105,4 +106,34 @@ TEST_CASE( "Parallel load and unload", "[mt_resource_manager]" )
      REQUIRE_THROWS( manager.process_unload_queue() ); // should throw because unable to unload resources.
 }
 
+
+
+TEST_CASE( "Deferred update in place", "[mt_resource_manager]" )
+{
+     _16nar::opengl::MtResourceManager< UpdatableLoader > manager{ {} };
+     UpdatableLoader::updated_value = 0;
+     _16nar::ResID id = manager.load( UpdatableLoader::LoadParamsType{} );
+     REQUIRE_NOTHROW( manager.update( id, UpdatableLoader::UpdateParamsType{ 5 } ) );
+     REQUIRE_THROWS( manager.update( id, 5 ) );        // wrong parameters type is detected on request
+     REQUIRE( UpdatableLoader::updated_value == 0 );
+
+     manager.end_frame();
+     REQUIRE_NOTHROW( manager.process_load_queue() ); // resource is loaded, then updated in the same frame
+     REQUIRE( UpdatableLoader::updated_value == 5 );
+
+     manager.update( id, UpdatableLoader::UpdateParamsType{ -1 } );
+     manager.update( id + 1, UpdatableLoader::UpdateParamsType{ 1 } );
+     manager.end_frame();
+     REQUIRE_THROWS( manager.process_load_queue() );  // loader failed
+
+     manager.end_frame();
+     manager.update( id + 1, UpdatableLoader::UpdateParamsType{ 1 } );
+     manager.end_frame();
+     REQUIRE_NOTHROW( manager.process_load_queue() ); // missing resource is skipped
+     REQUIRE( UpdatableLoader::updated_value == -1 );
+
+     _16nar::opengl::MtResourceManager< MockLoader > fixed_manager{ {} };
+     REQUIRE_THROWS( fixed_manager.update( 1, UpdatableLoader::UpdateParamsType{ 1 } ) );   // not supported
+}
+
 }
@@ -1,5 +1,6 @@
 #include <catch2/catch_test_macros.hpp>
 #include <16nar/render/opengl/st_resource_manager.h>
+#include "updatable_loader.h"
 
 namespace
 {
@@ -25,6 +26,8 @@ struct MockLoader
 };
 bool MockLoader::unload_result = true;
 
+using Table = _16nar::opengl::HandleTable< MockLoader::HandlerType >;
+
 
 TEST_CASE( "Load and unload", "[st_resource_manager]" )
 {
@@ -39,19 +42,44 @@ TEST_CASE( "Load and unload", "[st_resource_manager]" )
      REQUIRE( id2 == 2 );     // check ID increment
 
      params.value = false;
-     REQUIRE_THROWS( manager.load( params ) );    // check error handling
+     REQUIRE_THROWS( manager.load( params ) );    // check error handling, ID with slot 3 is released
 
      REQUIRE_NOTHROW( manager.unload( id2 ) );    // should not be errors
+     REQUIRE_THROWS( manager.get_handler( id2 ) );     // unloaded resource is not accessible
+     REQUIRE_NOTHROW( manager.get_handler( id1 ) );
 
      params.value = true;
-     id2 = manager.load( params );
-     REQUIRE( id2 == 2 );     // check id decrement after previous unload (so it's still 2)
+     _16nar::ResID id3 = manager.load( params );
+     REQUIRE( Table::get_index( id3 ) == 3 );     // released slots are reused in order of release
+     REQUIRE( Table::get_generation( id3 ) == 1 );
+
+     _16nar::ResID id4 = manager.load( params );
+     REQUIRE( Table::get_index( id4 ) == Table::get_index( id2 ) );
+     REQUIRE( id4 != id2 );                       // check generation increment after previous unload
+     REQUIRE_THROWS( manager.get_handler( id2 ) );     // stale ID does not give access to new resource
+     REQUIRE_NOTHROW( manager.get_handler( id4 ) );
 
      MockLoader::unload_result = false;
-     REQUIRE_THROWS( manager.unload( id2 ) );     // should fail
+     REQUIRE_THROWS( manager.unload( id4 ) );     // should fail
+     REQUIRE_THROWS( manager.get_handler( id4 ) );     // resource is forgotten anyway
+}
+
+
+
+TEST_CASE( "Update in place", "[st_resource_manager]" )
+{
+     _16nar::opengl::StResourceManager< UpdatableLoader > manager{ {} };
+     _16nar::ResID id = manager.load( UpdatableLoader::LoadParamsType{} );
+
+     REQUIRE_NOTHROW( manager.update( id, UpdatableLoader::UpdateParamsType{ 5 } ) );
+     REQUIRE( UpdatableLoader::updated_value == 5 );   // update is made immediately
+     REQUIRE_THROWS( manager.update( id, UpdatableLoader::UpdateParamsType{ -1 } ) );   // loader failed
+     REQUIRE_THROWS( manager.update( id, 5 ) );        // wrong parameters type
+     REQUIRE_THROWS( manager.update( id + 1, UpdatableLoader::UpdateParamsType{ 1 } ) );   // no such resource
 
-     id2 = manager.load( params );
-     REQUIRE( id2 == 2 );     // check id decrement after previous unload (so it's still 2)
+     _16nar::opengl::StResourceManager< MockLoader > fixed_manager{ {} };
+     _16nar::ResID fixed_id = fixed_manager.load( MockLoader::LoadParamsType{ true } );
+     REQUIRE_THROWS( fixed_manager.update( fixed_id, UpdatableLoader::UpdateParamsType{ 1 } ) );   // not supported
 }
 
 }
@@ -0,0 +1,57 @@
+#include <catch2/catch_test_macros.hpp>
+#include <16nar/render/opengl/utils.h>
+
+#include <algorithm>
+
+namespace
+{
+
+using _16nar::UniformId;
+using _16nar::get_uniform_id;
+
+
+TEST_CASE( "Uniform identifiers", "[uniform_locations]" )
+{
+     static_assert( get_uniform_id( "view_matr" ) == _16nar::uniform_ids::view_matr );
+     static_assert( get_uniform_id( "proj_matr" ) == _16nar::uniform_ids::proj_matr );
+
+     REQUIRE( get_uniform_id( "color" ) == get_uniform_id( std::string{ "color" } ) );
+     REQUIRE( get_uniform_id( "color" ) != get_uniform_id( "colour" ) );
+     REQUIRE( get_uniform_id( "model_matr" ) != _16nar::uniform_ids::view_matr );
+     REQUIRE( _16nar::uniform_ids::view_matr != _16nar::uniform_ids::proj_matr );
+}
+
+
+TEST_CASE( "Find uniform locations", "[uniform_locations]" )
+{
+     _16nar::opengl::UniformLocations locations{
+          { get_uniform_id( "view_matr" ), 0 },
+          { get_uniform_id( "proj_matr" ), 1 },
+          { get_uniform_id( "color" ), 4 },
+          { get_uniform_id( "frame" ), 7 }
+     };
+     std::sort( locations.begin(), locations.end(),
+          []( const auto& lhs, const auto& rhs ) { return lhs.first < rhs.first; } );
+
+     REQUIRE( _16nar::opengl::find_uniform_location( locations, _16nar::uniform_ids::view_matr ) == 0 );
+     REQUIRE( _16nar::opengl::find_uniform_location( locations, _16nar::uniform_ids::proj_matr ) == 1 );
+     REQUIRE( _16nar::opengl::find_uniform_location( locations, get_uniform_id( "color" ) ) == 4 );
+     REQUIRE( _16nar::opengl::find_uniform_location( locations, get_uniform_id( "frame" ) ) == 7 );
+     REQUIRE( _16nar::opengl::find_uniform_location( locations, get_uniform_id( "model_matr" ) ) == -1 );
+     REQUIRE( _16nar::opengl::find_uniform_location( _16nar::opengl::UniformLocations{},
+          _16nar::uniform_ids::view_matr ) == -1 );
+}
+
+
+TEST_CASE( "Uniform blocks declared by engine have fixed bindings", "[uniform_locations]" )
+{
+     using _16nar::opengl::find_uniform_block_binding;
+
+     // program may declare both blocks, each of them gets its own binding point
+     REQUIRE( find_uniform_block_binding( "Camera" ) == static_cast< int >( _16nar::uniform_bindings::camera ) );
+     REQUIRE( find_uniform_block_binding( "Animation" ) == static_cast< int >( _16nar::uniform_bindings::animation ) );
+     REQUIRE( find_uniform_block_binding( "Camera" ) != find_uniform_block_binding( "Animation" ) );
+     REQUIRE( find_uniform_block_binding( "Lights" ) == -1 );
+}
+
+}
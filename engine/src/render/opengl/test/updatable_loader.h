@@ -0,0 +1,36 @@
+/// @file Header file with mock loader of updatable resources, shared by resource manager tests.
+#ifndef _16NAR_OPENGL_TEST_UPDATABLE_LOADER_H
+#define _16NAR_OPENGL_TEST_UPDATABLE_LOADER_H
+
+#include <16nar/render/render_defs.h>
+
+/// @brief Mock loader of resources which can be updated in place.
+/// @details Update fails for negative values, last updated value is saved.
+struct UpdatableLoader
+{
+     inline static int updated_value = 0;
+     struct HandlerType {};
+     struct LoadParamsType {};
+     struct UpdateParamsType
+     {
+          int value;
+     };
+
+     static bool unload( const HandlerType& handler )
+     {
+          return true;
+     }
+
+     static bool load( const _16nar::ResourceManagerMap&, const LoadParamsType& params, HandlerType& handler )
+     {
+          return true;
+     }
+
+     static bool update( const HandlerType& handler, const UpdateParamsType& params )
+     {
+          updated_value = params.value;
+          return params.value >= 0;
+     }
+};
+
+#endif // #ifndef _16NAR_OPENGL_TEST_UPDATABLE_LOADER_H
@@ -0,0 +1,21 @@
+#include <catch2/catch_test_macros.hpp>
+#include <16nar/render/opengl/utils.h>
+
+namespace
+{
+
+TEST_CASE( "Texture update region bounds", "[render_utils]" )
+{
+     using _16nar::Vec2i;
+     using _16nar::opengl::is_region_inside;
+
+     Vec2i bounds{ 64, 32 };
+     REQUIRE( is_region_inside( Vec2i{ 0, 0 }, bounds, bounds ) );
+     REQUIRE( is_region_inside( Vec2i{ 60, 30 }, Vec2i{ 4, 2 }, bounds ) );
+     REQUIRE_FALSE( is_region_inside( Vec2i{ 61, 30 }, Vec2i{ 4, 2 }, bounds ) );     // past right edge
+     REQUIRE_FALSE( is_region_inside( Vec2i{ 0, 31 }, Vec2i{ 4, 2 }, bounds ) );      // past bottom edge
+     REQUIRE_FALSE( is_region_inside( Vec2i{ -1, 0 }, Vec2i{ 4, 2 }, bounds ) );      // negative offset
+     REQUIRE_FALSE( is_region_inside( Vec2i{ 0, 0 }, Vec2i{ 0, 2 }, bounds ) );       // empty region
+}
+
+}
@@ -0,0 +1,75 @@
+#include <16nar/render/opengl/texture_array_loader.h>
+
+#include <16nar/render/opengl/glad.h>
+
+#include <16nar/system/exceptions.h>
+#include <16nar/logger/logger.h>
+
+namespace _16nar::opengl
+{
+
+bool TextureArrayLoader::load( const ResourceManagerMap&,
+     const LoadParamsType& params, HandlerType& handler )
+{
+     if ( params.data.empty() )
+     {
+          LOG_16NAR_ERROR( "Texture array must have at least one layer" );
+          return false;
+     }
+     glGenTextures( 1, &handler.descriptor );
+     handler.size = params.size;
+     handler.layers = params.data.size();
+     glBindTexture( GL_TEXTURE_2D_ARRAY, handler.descriptor );
+     // storage for all layers is allocated at once, then layers with data are filled
+     glTexImage3D( GL_TEXTURE_2D_ARRAY, 0, data_format_to_int( params.format ),
+          params.size.x(), params.size.y(), params.data.size(), 0,
+          data_format_to_int( params.format ), data_type_to_int( params.data_type ), nullptr );
+     for ( std::size_t i = 0; i < params.data.size(); i++ )
+     {
+          if ( params.data[ i ] )
+          {
+               glTexSubImage3D( GL_TEXTURE_2D_ARRAY, 0, 0, 0, i, params.size.x(), params.size.y(), 1,
+                    data_format_to_int( params.format ), data_type_to_int( params.data_type ),
+                    params.data[ i ].get() );
+          }
+     }
+     glTexParameteri( GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, tex_filter_to_int( params.min_filter ) );
+     glTexParameteri( GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, tex_filter_to_int( params.mag_filter ) );
+     glTexParameteri( GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, tex_wrap_to_int( params.wrap_x ) );
+     glTexParameteri( GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, tex_wrap_to_int( params.wrap_y ) );
+     glTexParameterfv( GL_TEXTURE_2D_ARRAY, GL_TEXTURE_BORDER_COLOR, params.border_color.data() );
+     glBindTexture( GL_TEXTURE_2D_ARRAY, 0 );
+     LOG_16NAR_DEBUG( "Texture array " << handler.descriptor << " with "
+          << params.data.size() << " layers was loaded" );
+     return true;
+}
+
+
+bool TextureArrayLoader::unload( const HandlerType& handler )
+{
+     glDeleteTextures( 1, &handler.descriptor );
+     LOG_16NAR_DEBUG( "Texture array " << handler.descriptor << " was unloaded" );
+     return true;
+}
+
+
+bool TextureArrayLoader::update( const HandlerType& handler, const UpdateParamsType& params )
+{
+     if ( !params.data )
+     {
+          LOG_16NAR_ERROR( "No data for update of texture array " << handler.descriptor );
+          return false;
+     }
+     if ( params.layer >= handler.layers || !is_region_inside( params.offset, params.size, handler.size ) )
+     {
+          throw ResourceException{ "region is out of texture array bounds, descriptor ", handler.descriptor };
+     }
+     glBindTexture( GL_TEXTURE_2D_ARRAY, handler.descriptor );
+     glTexSubImage3D( GL_TEXTURE_2D_ARRAY, 0, params.offset.x(), params.offset.y(), params.layer,
+          params.size.x(), params.size.y(), 1, data_format_to_int( params.format ),
+          data_type_to_int( params.data_type ), params.data.get() );
+     glBindTexture( GL_TEXTURE_2D_ARRAY, 0 );
+     return true;
+}
+
+} // namespace _16nar::opengl
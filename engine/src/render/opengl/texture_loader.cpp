@@ -5,6 +5,8 @@
 #include <16nar/system/exceptions.h>
 #include <16nar/logger/logger.h>
 
+#include <algorithm>
+
 namespace _16nar::opengl
 {
 
@@ -13,6 +15,8 @@ bool TextureLoader::load( const ResourceManagerMap&,
 {
      unsigned int texture_type = 0;
      glGenTextures( 1, &handler.descriptor );
+     handler.size = params.size;
+     handler.multisample = ( params.samples > 0 );
 
      if ( params.samples > 0 )
      {
@@ -25,8 +29,21 @@ bool TextureLoader::load( const ResourceManagerMap&,
      {
           texture_type = GL_TEXTURE_2D;
           glBindTexture( texture_type, handler.descriptor );
+          // rows are tightly packed, rows of RGB levels or levels of odd width are not aligned to 4 bytes
+          glPixelStorei( GL_UNPACK_ALIGNMENT, 1 );
           glTexImage2D( texture_type, 0, data_format_to_int( params.format ), params.size.x(), params.size.y(),
                0, data_format_to_int( params.format ), data_type_to_int( params.data_type ), params.data.get() );
+          // mip levels are prepared offline, so there is no need in glGenerateMipmap
+          for ( std::size_t i = 0; i < params.mipmaps.size(); i++ )
+          {
+               int level = static_cast< int >( i + 1 );
+               glTexImage2D( texture_type, level, data_format_to_int( params.format ),
+                    std::max( params.size.x() >> level, 1 ), std::max( params.size.y() >> level, 1 ), 0,
+                    data_format_to_int( params.format ), data_type_to_int( params.data_type ),
+                    params.mipmaps[ i ].get() );
+          }
+          glTexParameteri( texture_type, GL_TEXTURE_BASE_LEVEL, 0 );
+          glTexParameteri( texture_type, GL_TEXTURE_MAX_LEVEL, static_cast< int >( params.mipmaps.size() ) );
      }
      glTexParameteri( texture_type, GL_TEXTURE_MIN_FILTER, tex_filter_to_int( params.min_filter ) );
      glTexParameteri( texture_type, GL_TEXTURE_MAG_FILTER, tex_filter_to_int( params.mag_filter ) );
@@ -46,4 +63,28 @@ bool TextureLoader::unload( const HandlerType& handler )
      return true;
 }
 
+
+bool TextureLoader::update( const HandlerType& handler, const UpdateParamsType& params )
+{
+     if ( !params.data )
+     {
+          LOG_16NAR_ERROR( "No data for update of texture " << handler.descriptor );
+          return false;
+     }
+     if ( handler.multisample )
+     {
+          throw ResourceException{ "multisample texture cannot be updated, descriptor ", handler.descriptor };
+     }
+     if ( !is_region_inside( params.offset, params.size, handler.size ) )
+     {
+          throw ResourceException{ "region is out of texture bounds, descriptor ", handler.descriptor };
+     }
+     glBindTexture( GL_TEXTURE_2D, handler.descriptor );
+     glPixelStorei( GL_UNPACK_ALIGNMENT, 1 );
+     glTexSubImage2D( GL_TEXTURE_2D, 0, params.offset.x(), params.offset.y(), params.size.x(), params.size.y(),
+          data_format_to_int( params.format ), data_type_to_int( params.data_type ), params.data.get() );
+     glBindTexture( GL_TEXTURE_2D, 0 );
+     return true;
+}
+
 } // namespace _16nar::opengl
@@ -0,0 +1,52 @@
+#include <16nar/render/opengl/uniform_buffer_loader.h>
+
+#include <16nar/render/opengl/glad.h>
+
+#include <16nar/logger/logger.h>
+
+namespace _16nar::opengl
+{
+
+bool UniformBufferLoader::load( const ResourceManagerMap&,
+     const LoadParamsType& params, HandlerType& handler )
+{
+     if ( params.size == 0 )
+     {
+          LOG_16NAR_ERROR( "Uniform buffer cannot be empty" );
+          return false;
+     }
+     glGenBuffers( 1, &handler.descriptor );
+     glBindBuffer( GL_UNIFORM_BUFFER, handler.descriptor );
+     glBufferData( GL_UNIFORM_BUFFER, params.size, params.data.get(), buffer_type_to_int( params.type ) );
+     glBindBuffer( GL_UNIFORM_BUFFER, 0 );
+     glBindBufferBase( GL_UNIFORM_BUFFER, params.binding, handler.descriptor );
+     handler.size = params.size;
+
+     LOG_16NAR_DEBUG( "Uniform buffer " << handler.descriptor << " was loaded at binding point "
+          << params.binding );
+     return true;
+}
+
+
+bool UniformBufferLoader::unload( const HandlerType& handler )
+{
+     glDeleteBuffers( 1, &handler.descriptor );
+     LOG_16NAR_DEBUG( "Uniform buffer " << handler.descriptor << " was unloaded" );
+     return true;
+}
+
+
+bool UniformBufferLoader::update( const HandlerType& handler, const UpdateParamsType& params )
+{
+     if ( params.offset + params.size > handler.size || !params.data )
+     {
+          LOG_16NAR_ERROR( "Wrong data for update of uniform buffer " << handler.descriptor );
+          return false;
+     }
+     glBindBuffer( GL_UNIFORM_BUFFER, handler.descriptor );
+     glBufferSubData( GL_UNIFORM_BUFFER, params.offset, params.size, params.data.get() );
+     glBindBuffer( GL_UNIFORM_BUFFER, 0 );
+     return true;
+}
+
+} // namespace _16nar::opengl
@@ -5,8 +5,99 @@
 
 #include <16nar/logger/logger.h>
 
+#include <algorithm>
+
 namespace _16nar::opengl
 {
+namespace
+{
+
+/// @brief Visitor for setting uniform value of any type.
+struct UniformSetter
+{
+     int location;
+
+     void operator()( float value ) const noexcept { glUniform1f( location, value ); }
+     void operator()( int value ) const noexcept { glUniform1i( location, value ); }
+     void operator()( bool value ) const noexcept { glUniform1i( location, static_cast< int >( value ) ); }
+     void operator()( const Vec2i& value ) const noexcept { glUniform2i( location, value.x(), value.y() ); }
+     void operator()( const Vec2f& value ) const noexcept { glUniform2f( location, value.x(), value.y() ); }
+     void operator()( const Vec3i& value ) const noexcept
+     {
+          glUniform3i( location, value.x(), value.y(), value.z() );
+     }
+     void operator()( const Vec3f& value ) const noexcept
+     {
+          glUniform3f( location, value.x(), value.y(), value.z() );
+     }
+     void operator()( const Vec4i& value ) const noexcept
+     {
+          glUniform4i( location, value.x(), value.y(), value.z(), value.w() );
+     }
+     void operator()( const Vec4f& value ) const noexcept
+     {
+          glUniform4f( location, value.x(), value.y(), value.z(), value.w() );
+     }
+};
+
+} // anonymous namespace
+
+
+int find_uniform_location( const UniformLocations& locations, UniformId id ) noexcept
+{
+     auto iter = std::lower_bound( locations.cbegin(), locations.cend(), id,
+          []( const auto& elem, UniformId value ) { return elem.first < value; } );
+     if ( iter == locations.cend() || iter->first != id )
+     {
+          return -1;
+     }
+     return iter->second;
+}
+
+
+void set_uniform_value( int location, const UniformValue& value ) noexcept
+{
+     std::visit( UniformSetter{ location }, value );
+}
+
+
+bool is_region_inside( const Vec2i& offset, const Vec2i& size, const Vec2i& bounds ) noexcept
+{
+     return offset.x() >= 0 && offset.y() >= 0 && size.x() > 0 && size.y() > 0 &&
+            size.x() <= bounds.x() - offset.x() && size.y() <= bounds.y() - offset.y();
+}
+
+
+int find_uniform_block_binding( std::string_view name ) noexcept
+{
+     // blocks declared by engine have fixed binding points, so their buffers are shared by all programs
+     constexpr std::pair< std::string_view, unsigned int > blocks[] = {
+          { "Camera", uniform_bindings::camera },
+          { "Animation", uniform_bindings::animation }
+     };
+     for ( const auto& [ block_name, binding ] : blocks )
+     {
+          if ( block_name == name )
+          {
+               return static_cast< int >( binding );
+          }
+     }
+     return -1;
+}
+
+
+void set_stream_attributes( const Handler< ResourceType::StreamBuffer >& handler, std::size_t base ) noexcept
+{
+     std::size_t offset = base;
+     for ( std::size_t i = 0; i < handler.attributes->size(); i++ )
+     {
+          const auto& attr = ( *handler.attributes )[ i ];
+          glVertexAttribPointer( i, attr.size, data_type_to_int( attr.data_type ),
+               attr.normalized ? GL_TRUE : GL_FALSE, handler.vertex_size, reinterpret_cast< void * >( offset ) );
+          offset += attr.size * data_type_size( attr.data_type );
+     }
+}
+
 
 unsigned int tex_wrap_to_int( TextureWrap wrap )
 {
@@ -61,8 +152,11 @@ unsigned int data_type_to_int( DataType type )
 {
      switch ( type )
      {
-          case DataType::Byte:     return GL_UNSIGNED_BYTE;
-          case DataType::Float:    return GL_FLOAT;
+          case DataType::Byte:               return GL_UNSIGNED_BYTE;
+          case DataType::Float:              return GL_FLOAT;
+          case DataType::HalfFloat:          return GL_HALF_FLOAT;
+          case DataType::UnsignedShort:      return GL_UNSIGNED_SHORT;
+          case DataType::UnsignedInt:        return GL_UNSIGNED_INT;
      }
      LOG_16NAR_ERROR( "Wrong buffer data type parameter: "
           << static_cast< std::size_t >( type ) << ", will use GL_BYTE" );
@@ -70,6 +164,22 @@ unsigned int data_type_to_int( DataType type )
 }
 
 
+std::size_t data_type_size( DataType type )
+{
+     switch ( type )
+     {
+          case DataType::Byte:               return sizeof( std::uint8_t );
+          case DataType::Float:              return sizeof( float );
+          case DataType::HalfFloat:          return sizeof( std::uint16_t );
+          case DataType::UnsignedShort:      return sizeof( std::uint16_t );
+          case DataType::UnsignedInt:        return sizeof( std::uint32_t );
+     }
+     LOG_16NAR_ERROR( "Wrong buffer data type parameter: "
+          << static_cast< std::size_t >( type ) << ", will use size of byte" );
+     return sizeof( std::uint8_t );
+}
+
+
 unsigned int buffer_type_to_int( BufferType type )
 {
      switch ( type )
@@ -15,6 +15,7 @@ bool VertexBufferLoader::load( const ResourceManagerMap&,
      glGenVertexArrays( 1, &handler.vao_descriptor );
      glGenBuffers( ( params.index_buffer.data != nullptr ) ? 2 : 1, &buffers[ 0 ] );
      handler.vbo_descriptor = buffers[ 0 ];
+     handler.vbo_size = params.buffer.size;
 
      glBindVertexArray( handler.vao_descriptor );
      glBindBuffer( GL_ARRAY_BUFFER, handler.vbo_descriptor );
@@ -23,19 +24,23 @@ bool VertexBufferLoader::load( const ResourceManagerMap&,
      if ( params.index_buffer.data != nullptr )
      {
           handler.ebo_descriptor = buffers[ 1 ];
+          handler.ebo_size = params.index_buffer.size;
           glBindBuffer( GL_ELEMENT_ARRAY_BUFFER, handler.ebo_descriptor );
           glBufferData( GL_ELEMENT_ARRAY_BUFFER, params.index_buffer.size, params.index_buffer.data.get(),
                buffer_type_to_int( params.index_buffer.type ) );
+          handler.index_type = data_type_to_int( params.index_type );
      }
 
-     std::size_t offset = 0;
      for ( std::size_t i = 0; i < params.attributes.size(); i++ )
      {
           const auto& attr = params.attributes[ i ];
-          glVertexAttribPointer( i, attr.size, data_type_to_int( attr.data_type ),
-               attr.normalized ? GL_TRUE : GL_FALSE, 0, reinterpret_cast< void * >( offset ) );
+          glVertexAttribPointer( i, attr.size, data_type_to_int( attr.data_type ), attr.normalized ? GL_TRUE : GL_FALSE,
+               attr.stride, reinterpret_cast< void * >( attr.offset ) );
           glEnableVertexAttribArray( i );
-          offset += attr.size * ( attr.data_type == DataType::Byte ? sizeof( std::uint8_t ) : sizeof( float ) );
+          if ( attr.divisor > 0 )  // per-instance attribute, for example, layer of texture array
+          {
+               glVertexAttribDivisor( i, attr.divisor );
+          }
      }
 
      glBindVertexArray( 0 );
@@ -59,4 +64,25 @@ bool VertexBufferLoader::unload( const HandlerType& handler )
      return true;
 }
 
+
+bool VertexBufferLoader::update( const HandlerType& handler, const UpdateParamsType& params )
+{
+     unsigned int descriptor = params.index_buffer ? handler.ebo_descriptor : handler.vbo_descriptor;
+     if ( descriptor == 0 || !params.data )
+     {
+          LOG_16NAR_ERROR( "No buffer or data for update of vertex buffer " << handler.vao_descriptor );
+          return false;
+     }
+     std::size_t buffer_size = params.index_buffer ? handler.ebo_size : handler.vbo_size;
+     if ( params.offset > buffer_size || params.size > buffer_size - params.offset )
+     {
+          throw ResourceException{ "data is out of vertex buffer bounds, descriptor ", handler.vao_descriptor };
+     }
+     // element buffer binding is a part of vertex array state, so it is updated as array buffer
+     glBindBuffer( GL_ARRAY_BUFFER, descriptor );
+     glBufferSubData( GL_ARRAY_BUFFER, params.offset, params.size, params.data.get() );
+     glBindBuffer( GL_ARRAY_BUFFER, 0 );
+     return true;
+}
+
 } // namespace _16nar::opengl
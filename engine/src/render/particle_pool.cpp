@@ -0,0 +1,192 @@
+#include <16nar/render/particle_pool.h>
+
+#include <algorithm>
+
+#if defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && _M_IX86_FP >= 2 )
+#    include <emmintrin.h>
+#    define _16NAR_PARTICLES_SSE
+#endif
+
+namespace
+{
+
+/// @brief Move particles and make them older.
+void integrate( float *x, float *y, float *vx, float *vy, float *age, std::size_t count,
+     float delta, float ax, float ay ) noexcept
+{
+     std::size_t i = 0;
+#if defined( _16NAR_PARTICLES_SSE )
+     const __m128 dt = _mm_set1_ps( delta );
+     const __m128 dvx = _mm_set1_ps( ax * delta );
+     const __m128 dvy = _mm_set1_ps( ay * delta );
+     for ( ; i + 4 <= count; i += 4 )
+     {
+          __m128 vel_x = _mm_loadu_ps( vx + i );
+          __m128 vel_y = _mm_loadu_ps( vy + i );
+          _mm_storeu_ps( x + i, _mm_add_ps( _mm_loadu_ps( x + i ), _mm_mul_ps( vel_x, dt ) ) );
+          _mm_storeu_ps( y + i, _mm_add_ps( _mm_loadu_ps( y + i ), _mm_mul_ps( vel_y, dt ) ) );
+          _mm_storeu_ps( vx + i, _mm_add_ps( vel_x, dvx ) );
+          _mm_storeu_ps( vy + i, _mm_add_ps( vel_y, dvy ) );
+          _mm_storeu_ps( age + i, _mm_add_ps( _mm_loadu_ps( age + i ), dt ) );
+     }
+#endif // _16NAR_PARTICLES_SSE
+     for ( ; i < count; i++ )
+     {
+          x[ i ] += vx[ i ] * delta;
+          y[ i ] += vy[ i ] * delta;
+          vx[ i ] += ax * delta;
+          vy[ i ] += ay * delta;
+          age[ i ] += delta;
+     }
+}
+
+
+/// @brief Find minimum and maximum of values.
+void find_range( const float *values, std::size_t count, float& min, float& max ) noexcept
+{
+     std::size_t i = 0;
+     min = values[ 0 ];
+     max = values[ 0 ];
+#if defined( _16NAR_PARTICLES_SSE )
+     if ( count >= 4 )
+     {
+          __m128 min4 = _mm_loadu_ps( values );
+          __m128 max4 = min4;
+          for ( i = 4; i + 4 <= count; i += 4 )
+          {
+               __m128 value = _mm_loadu_ps( values + i );
+               min4 = _mm_min_ps( min4, value );
+               max4 = _mm_max_ps( max4, value );
+          }
+          alignas( 16 ) float mins[ 4 ];
+          alignas( 16 ) float maxs[ 4 ];
+          _mm_store_ps( mins, min4 );
+          _mm_store_ps( maxs, max4 );
+          min = std::min( std::min( mins[ 0 ], mins[ 1 ] ), std::min( mins[ 2 ], mins[ 3 ] ) );
+          max = std::max( std::max( maxs[ 0 ], maxs[ 1 ] ), std::max( maxs[ 2 ], maxs[ 3 ] ) );
+     }
+#endif // _16NAR_PARTICLES_SSE
+     for ( ; i < count; i++ )
+     {
+          min = std::min( min, values[ i ] );
+          max = std::max( max, values[ i ] );
+     }
+}
+
+} // anonymous namespace
+
+
+namespace _16nar
+{
+
+ParticlePool::ParticlePool( std::size_t capacity, uint32_t seed ):
+     x_( capacity ), y_( capacity ), vx_( capacity ), vy_( capacity ), age_( capacity ), lifetime_( capacity ),
+     size_{ 0 }, random_state_{ seed ? seed : 1 }
+{}
+
+
+std::size_t ParticlePool::emit( std::size_t count, const Vec2f& position, const Vec2f& velocity,
+     const Vec2f& spread, float lifetime )
+{
+     count = std::min( count, x_.size() - size_ );
+     for ( std::size_t i = size_; i < size_ + count; i++ )
+     {
+          x_[ i ] = position.x();
+          y_[ i ] = position.y();
+          vx_[ i ] = velocity.x() + spread.x() * random();
+          vy_[ i ] = velocity.y() + spread.y() * random();
+          age_[ i ] = 0.0f;
+          lifetime_[ i ] = lifetime;
+     }
+     size_ += count;
+     return count;
+}
+
+
+void ParticlePool::update( float delta, const Vec2f& acceleration )
+{
+     integrate( x_.data(), y_.data(), vx_.data(), vy_.data(), age_.data(), size_,
+          delta, acceleration.x(), acceleration.y() );
+     // dead particles are replaced by the last ones, so alive particles stay contiguous
+     std::size_t i = 0;
+     while ( i < size_ )
+     {
+          if ( age_[ i ] < lifetime_[ i ] )
+          {
+               i++;
+               continue;
+          }
+          size_--;
+          x_[ i ] = x_[ size_ ];
+          y_[ i ] = y_[ size_ ];
+          vx_[ i ] = vx_[ size_ ];
+          vy_[ i ] = vy_[ size_ ];
+          age_[ i ] = age_[ size_ ];
+          lifetime_[ i ] = lifetime_[ size_ ];
+     }
+}
+
+
+void ParticlePool::clear() noexcept
+{
+     size_ = 0;
+}
+
+
+FloatRect ParticlePool::get_bounds() const noexcept
+{
+     if ( size_ == 0 )
+     {
+          return FloatRect{ Vec2f{}, 0.0f, 0.0f };
+     }
+     float min_x = 0.0f, max_x = 0.0f, min_y = 0.0f, max_y = 0.0f;
+     find_range( x_.data(), size_, min_x, max_x );
+     find_range( y_.data(), size_, min_y, max_y );
+     return FloatRect{ Vec2f{ min_x, min_y }, max_x - min_x, max_y - min_y };
+}
+
+
+void ParticlePool::write_instances( float *out ) const noexcept
+{
+     for ( std::size_t i = 0; i < size_; i++ )
+     {
+          out[ i * instance_floats ] = x_[ i ];
+          out[ i * instance_floats + 1 ] = y_[ i ];
+          out[ i * instance_floats + 2 ] = age_[ i ] / lifetime_[ i ];
+     }
+}
+
+
+std::size_t ParticlePool::get_size() const noexcept
+{
+     return size_;
+}
+
+
+std::size_t ParticlePool::get_capacity() const noexcept
+{
+     return x_.size();
+}
+
+
+const float *ParticlePool::get_x() const noexcept
+{
+     return x_.data();
+}
+
+
+const float *ParticlePool::get_y() const noexcept
+{
+     return y_.data();
+}
+
+
+float ParticlePool::random() noexcept
+{
+     random_state_ ^= random_state_ << 13;
+     random_state_ ^= random_state_ >> 17;
+     random_state_ ^= random_state_ << 5;
+     return static_cast< float >( random_state_ ) / 2147483648.0f - 1.0f;
+}
+
+} // namespace _16nar
@@ -0,0 +1,1428 @@
+#include <16nar/render/render_capture.h>
+
+#include <16nar/render/ishader_program.h>
+#include <16nar/math/transform_matrix.h>
+#include <16nar/tools/utils.h>
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace
+{
+
+using namespace _16nar;
+
+constexpr char capture_magic[ 8 ] = { '1', '6', 'N', 'A', 'R', 'C', 'A', 'P' };
+constexpr uint32_t capture_version = 1;
+
+/// @brief How payload is stored in capture.
+enum class PayloadState : uint8_t
+{
+     Empty,         ///< there is no data.
+     Hashed,        ///< only size and hash of data are stored.
+     Stored         ///< data is stored after its size and hash.
+};
+
+
+/// @brief Compute FNV-1a hash of data.
+uint64_t get_hash( const std::byte *data, std::size_t size ) noexcept
+{
+     uint64_t hash = 14695981039346656037ull;
+     for ( std::size_t i = 0; i < size; i++ )
+     {
+          hash = ( hash ^ static_cast< uint8_t >( data[ i ] ) ) * 1099511628211ull;
+     }
+     return hash;
+}
+
+
+/// @brief Get size of image data.
+std::size_t get_image_size( BufferDataFormat format, DataType data_type, const Vec2i& size )
+{
+     std::size_t channels = ( format == BufferDataFormat::Depth || format == BufferDataFormat::DepthStencil ) ?
+          1 : static_cast< std::size_t >( tools::get_channel_count( format ) );
+     return channels * tools::get_data_type_size( data_type ) * std::max( size.x(), 0 ) * std::max( size.y(), 0 );
+}
+
+
+/// @brief Get size of mipmap level, each level is half the size of previous one.
+Vec2i get_mipmap_size( const Vec2i& size, std::size_t level ) noexcept
+{
+     return Vec2i{ std::max( size.x() >> level, 1 ), std::max( size.y() >> level, 1 ) };
+}
+
+
+/// @brief Check if value is written as raw bytes.
+template < typename T >
+constexpr bool is_raw_v = std::is_arithmetic_v< T > || std::is_enum_v< T >;
+
+
+/// @brief Writer of capture record data.
+class Writer
+{
+public:
+     explicit Writer( bool payloads ): data_{}, payloads_{ payloads } {}
+
+     template < typename T, typename = std::enable_if_t< is_raw_v< T > > >
+     void value( const T& val )
+     {
+          if constexpr ( std::is_same_v< T, std::size_t > )
+          {
+               raw( static_cast< uint64_t >( val ) );
+          }
+          else
+          {
+               raw( val );
+          }
+     }
+
+     void value( const std::string& str )
+     {
+          value( str.size() );
+          data_.append( str );
+     }
+
+     template < std::size_t N, typename T >
+     void value( const Vec< N, T >& vec )
+     {
+          for ( std::size_t i = 0; i < N; i++ )
+          {
+               value( vec[ i ] );
+          }
+     }
+
+     void value( const Resource& resource )
+     {
+          value( resource.type );
+          value( resource.id );
+     }
+
+     template < ResourceType R >
+     void value( const TypedResource< R >& resource )
+     {
+          value( resource.id );
+     }
+
+     void value( const UniformValue& uniform )
+     {
+          std::vector< float > floats;
+          std::vector< int > ints;
+          value( tools::get_uniform_components( uniform, floats, ints ) );
+          sequence( floats, [ this ]( float val ) { value( val ); } );
+          sequence( ints, [ this ]( int val ) { value( val ); } );
+     }
+
+     void blob( const DataSharedPtr& data, std::size_t size )
+     {
+          if ( !data )
+          {
+               value( PayloadState::Empty );
+               return;
+          }
+          value( payloads_ ? PayloadState::Stored : PayloadState::Hashed );
+          value( size );
+          value( get_hash( data.get(), size ) );
+          if ( payloads_ )
+          {
+               data_.append( reinterpret_cast< const char * >( data.get() ), size );
+          }
+     }
+
+     template < typename T, typename F >
+     void sequence( const std::vector< T >& values, F&& func )
+     {
+          value( values.size() );
+          for ( const auto& val : values )
+          {
+               func( val );
+          }
+     }
+
+     const std::string& get_data() const noexcept
+     {
+          return data_;
+     }
+
+private:
+     template < typename T >
+     void raw( const T& val )
+     {
+          data_.append( reinterpret_cast< const char * >( &val ), sizeof( T ) );
+     }
+
+     std::string data_;
+     bool payloads_;
+};
+
+
+/// @brief Reader of capture record data.
+class Reader
+{
+public:
+     Reader( const char *begin, const char *end ): pos_{ begin }, end_{ end }, payload_size_{ 0 } {}
+
+     template < typename T, typename = std::enable_if_t< is_raw_v< T > > >
+     void value( T& val )
+     {
+          if constexpr ( std::is_same_v< T, std::size_t > )
+          {
+               uint64_t wide = 0;
+               raw( wide );
+               val = static_cast< std::size_t >( wide );
+          }
+          else
+          {
+               raw( val );
+          }
+     }
+
+     void value( std::string& str )
+     {
+          std::size_t size = 0;
+          value( size );
+          check( size );
+          str.assign( pos_, size );
+          pos_ += size;
+     }
+
+     template < std::size_t N, typename T >
+     void value( Vec< N, T >& vec )
+     {
+          for ( std::size_t i = 0; i < N; i++ )
+          {
+               value( vec[ i ] );
+          }
+     }
+
+     void value( Resource& resource )
+     {
+          value( resource.type );
+          value( resource.id );
+     }
+
+     template < ResourceType R >
+     void value( TypedResource< R >& resource )
+     {
+          ResID id = 0;
+          value( id );
+          resource = id;
+     }
+
+     void value( UniformValue& uniform )
+     {
+          tools::UniformType type{};
+          std::vector< float > floats;
+          std::vector< int > ints;
+          value( type );
+          sequence( floats, [ this ]( float& val ) { value( val ); } );
+          sequence( ints, [ this ]( int& val ) { value( val ); } );
+          uniform = tools::make_uniform_value( type, floats, ints );
+     }
+
+     void blob( DataSharedPtr& data, std::size_t )
+     {
+          PayloadState state{};
+          value( state );
+          if ( state == PayloadState::Empty )
+          {
+               data = nullptr;
+               return;
+          }
+          std::size_t size = 0;
+          uint64_t hash = 0;
+          value( size );
+          value( hash );
+          // missing payload is replaced by zeros, so the load has the same size
+          auto buffer = std::shared_ptr< std::byte[] >( new std::byte[ std::max( size, std::size_t{ 1 } ) ]{} );
+          if ( state == PayloadState::Stored )
+          {
+               check( size );
+               std::memcpy( buffer.get(), pos_, size );
+               pos_ += size;
+          }
+          data = DataSharedPtr{ buffer, buffer.get() };
+          payload_size_ += size;
+     }
+
+     template < typename T, typename F >
+     void sequence( std::vector< T >& values, F&& func )
+     {
+          std::size_t size = 0;
+          value( size );
+          // every element takes at least one byte, so size is checked before allocation
+          check( size );
+          values.resize( size );
+          for ( auto& val : values )
+          {
+               func( val );
+          }
+     }
+
+     bool is_finished() const noexcept
+     {
+          return pos_ == end_;
+     }
+
+     std::size_t get_payload_size() const noexcept
+     {
+          return payload_size_;
+     }
+
+private:
+     template < typename T >
+     void raw( T& val )
+     {
+          check( sizeof( T ) );
+          std::memcpy( &val, pos_, sizeof( T ) );
+          pos_ += sizeof( T );
+     }
+
+     void check( std::size_t size ) const
+     {
+          if ( static_cast< std::size_t >( end_ - pos_ ) < size )
+          {
+               throw std::runtime_error{ "render capture is truncated" };
+          }
+     }
+
+     const char *pos_;
+     const char *end_;
+     std::size_t payload_size_;
+};
+
+
+template < typename A >
+void serialize( A& ar, LoadParams< ResourceType::Texture >& params )
+{
+     ar.value( params.format );
+     ar.value( params.min_filter );
+     ar.value( params.mag_filter );
+     ar.value( params.wrap_x );
+     ar.value( params.wrap_y );
+     ar.value( params.data_type );
+     ar.value( params.border_color );
+     ar.value( params.size );
+     ar.value( params.samples );
+     ar.blob( params.data, get_image_size( params.format, params.data_type, params.size ) );
+     std::size_t level = 0;
+     ar.sequence( params.mipmaps, [ &ar, &params, &level ]( auto& data )
+     {
+          level++;
+          ar.blob( data, get_image_size( params.format, params.data_type, get_mipmap_size( params.size, level ) ) );
+     } );
+}
+
+
+template < typename A >
+void serialize( A& ar, LoadParams< ResourceType::Cubemap >& params )
+{
+     ar.value( params.format );
+     ar.value( params.min_filter );
+     ar.value( params.mag_filter );
+     ar.value( params.wrap_x );
+     ar.value( params.wrap_y );
+     ar.value( params.wrap_z );
+     ar.value( params.data_type );
+     ar.value( params.border_color );
+     ar.value( params.size );
+     for ( auto& face : params.data )
+     {
+          ar.blob( face, get_image_size( params.format, params.data_type, params.size ) );
+     }
+}
+
+
+template < typename A >
+void serialize( A& ar, LoadParams< ResourceType::TextureArray >& params )
+{
+     ar.value( params.format );
+     ar.value( params.min_filter );
+     ar.value( params.mag_filter );
+     ar.value( params.wrap_x );
+     ar.value( params.wrap_y );
+     ar.value( params.data_type );
+     ar.value( params.border_color );
+     ar.value( params.size );
+     ar.sequence( params.data, [ &ar, &params ]( auto& layer )
+     {
+          ar.blob( layer, get_image_size( params.format, params.data_type, params.size ) );
+     } );
+}
+
+
+template < typename A >
+void serialize( A& ar, LoadParams< ResourceType::RenderBuffer >& params )
+{
+     ar.value( params.format );
+     ar.value( params.data_type );
+     ar.value( params.size );
+     ar.value( params.samples );
+}
+
+
+template < typename A >
+void serialize( A& ar, LoadParams< ResourceType::FrameBuffer >& params )
+{
+     ar.sequence( params.attachments, [ &ar ]( auto& attachment )
+     {
+          ar.value( attachment.resource );
+          ar.value( attachment.type );
+          ar.value( attachment.order );
+          ar.value( attachment.multisample );
+     } );
+}
+
+
+template < typename A >
+void serialize( A& ar, LoadParams< ResourceType::Shader >& params )
+{
+     ar.sequence( params.shaders, [ &ar ]( auto& shader )
+     {
+          ar.value( shader.entrypoint );
+          ar.value( shader.size );
+          ar.blob( shader.data, shader.size );
+          ar.value( shader.type );
+          ar.value( shader.from_source );
+     } );
+}
+
+
+template < typename A, typename P >
+void serialize_attributes( A& ar, P& attributes )
+{
+     ar.sequence( attributes, [ &ar ]( auto& attribute )
+     {
+          ar.value( attribute.size );
+          ar.value( attribute.data_type );
+          ar.value( attribute.normalized );
+          ar.value( attribute.divisor );
+          ar.value( attribute.offset );
+          ar.value( attribute.stride );
+     } );
+}
+
+
+template < typename A >
+void serialize( A& ar, LoadParams< ResourceType::VertexBuffer >& params )
+{
+     serialize_attributes( ar, params.attributes );
+     for ( auto *buffer : { &params.buffer, &params.index_buffer } )
+     {
+          ar.value( buffer->size );
+          ar.blob( buffer->data, buffer->size );
+          ar.value( buffer->type );
+     }
+     ar.value( params.index_type );
+}
+
+
+template < typename A >
+void serialize( A& ar, LoadParams< ResourceType::Material >& params )
+{
+     ar.value( params.shader );
+     ar.sequence( params.textures, [ &ar ]( auto& texture ) { ar.value( texture ); } );
+     ar.sequence( params.texture_arrays, [ &ar ]( auto& array ) { ar.value( array ); } );
+     ar.sequence( params.uniforms, [ &ar ]( auto& uniform )
+     {
+          ar.value( uniform.name );
+          ar.value( uniform.value );
+     } );
+     ar.value( params.shader_name );
+     ar.sequence( params.texture_names, [ &ar ]( auto& name ) { ar.value( name ); } );
+     ar.sequence( params.texture_array_names, [ &ar ]( auto& name ) { ar.value( name ); } );
+}
+
+
+template < typename A >
+void serialize( A& ar, LoadParams< ResourceType::UniformBuffer >& params )
+{
+     ar.value( params.size );
+     ar.value( params.binding );
+     ar.value( params.type );
+     ar.blob( params.data, params.size );
+}
+
+
+template < typename A >
+void serialize( A& ar, LoadParams< ResourceType::StreamBuffer >& params )
+{
+     serialize_attributes( ar, params.attributes );
+     ar.value( params.size );
+}
+
+
+template < typename A >
+void serialize( A& ar, UpdateParams< ResourceType::Texture >& params )
+{
+     ar.value( params.format );
+     ar.value( params.data_type );
+     ar.value( params.offset );
+     ar.value( params.size );
+     ar.blob( params.data, get_image_size( params.format, params.data_type, params.size ) );
+}
+
+
+template < typename A >
+void serialize( A& ar, UpdateParams< ResourceType::TextureArray >& params )
+{
+     ar.value( params.format );
+     ar.value( params.data_type );
+     ar.value( params.layer );
+     ar.value( params.offset );
+     ar.value( params.size );
+     ar.blob( params.data, get_image_size( params.format, params.data_type, params.size ) );
+}
+
+
+template < typename A >
+void serialize( A& ar, UpdateParams< ResourceType::VertexBuffer >& params )
+{
+     ar.value( params.offset );
+     ar.value( params.size );
+     ar.blob( params.data, params.size );
+     ar.value( params.index_buffer );
+}
+
+
+template < typename A >
+void serialize( A& ar, UpdateParams< ResourceType::UniformBuffer >& params )
+{
+     ar.value( params.offset );
+     ar.value( params.size );
+     ar.blob( params.data, params.size );
+}
+
+
+template < typename A >
+void serialize( A& ar, RenderParams& params )
+{
+     ar.sequence( params.textures, [ &ar ]( auto& texture ) { ar.value( texture ); } );
+     ar.sequence( params.texture_arrays, [ &ar ]( auto& array ) { ar.value( array ); } );
+     ar.value( params.vertex_buffer );
+     ar.value( params.primitive );
+     ar.value( params.vertex_count );
+     ar.value( params.instance_count );
+     ar.value( params.stream_buffer );
+     ar.value( params.stream_offset );
+}
+
+
+/// @brief Check if resources of the type can be updated.
+template < ResourceType R >
+constexpr bool is_updatable_v = !std::is_empty_v< UpdateParams< R > >;
+
+
+/// @brief Call function with resource type as compile-time constant.
+/// @throws std::runtime_error if resource is not a render resource.
+template < typename F >
+void visit_resource_type( ResourceType type, F&& func )
+{
+     switch ( type )
+     {
+          case ResourceType::Texture:
+               func( std::integral_constant< ResourceType, ResourceType::Texture >{} );
+               break;
+          case ResourceType::Shader:
+               func( std::integral_constant< ResourceType, ResourceType::Shader >{} );
+               break;
+          case ResourceType::FrameBuffer:
+               func( std::integral_constant< ResourceType, ResourceType::FrameBuffer >{} );
+               break;
+          case ResourceType::VertexBuffer:
+               func( std::integral_constant< ResourceType, ResourceType::VertexBuffer >{} );
+               break;
+          case ResourceType::RenderBuffer:
+               func( std::integral_constant< ResourceType, ResourceType::RenderBuffer >{} );
+               break;
+          case ResourceType::Cubemap:
+               func( std::integral_constant< ResourceType, ResourceType::Cubemap >{} );
+               break;
+          case ResourceType::Material:
+               func( std::integral_constant< ResourceType, ResourceType::Material >{} );
+               break;
+          case ResourceType::UniformBuffer:
+               func( std::integral_constant< ResourceType, ResourceType::UniformBuffer >{} );
+               break;
+          case ResourceType::StreamBuffer:
+               func( std::integral_constant< ResourceType, ResourceType::StreamBuffer >{} );
+               break;
+          case ResourceType::TextureArray:
+               func( std::integral_constant< ResourceType, ResourceType::TextureArray >{} );
+               break;
+          default:
+               throw std::runtime_error{ "resource type " + std::to_string( static_cast< int >( type ) )
+                    + " is not a render resource" };
+     }
+}
+
+
+/// @brief Uniform set by shader setup function.
+struct CapturedUniform
+{
+     std::string name;                       ///< name of the uniform, if set by name.
+     uint32_t id = 0;                        ///< identifier of the uniform, if set by identifier.
+     bool by_name = false;                   ///< is the uniform set by name.
+     bool matrix = false;                    ///< is the value a matrix.
+     UniformValue value;                     ///< value of the uniform, if it is not a matrix.
+     std::array< float, 16 > matrix_data{};  ///< value of the uniform, if it is a matrix.
+};
+
+
+template < typename A >
+void serialize( A& ar, std::vector< CapturedUniform >& uniforms )
+{
+     ar.sequence( uniforms, [ &ar ]( auto& uniform )
+     {
+          ar.value( uniform.by_name );
+          if ( uniform.by_name )
+          {
+               ar.value( uniform.name );
+          }
+          else
+          {
+               ar.value( uniform.id );
+          }
+          ar.value( uniform.matrix );
+          if ( uniform.matrix )
+          {
+               for ( auto& val : uniform.matrix_data )
+               {
+                    ar.value( val );
+               }
+          }
+          else
+          {
+               ar.value( uniform.value );
+          }
+     } );
+}
+
+
+/// @brief Shader program which records set uniforms.
+class UniformRecorder : public IShaderProgram
+{
+public:
+     explicit UniformRecorder( std::vector< CapturedUniform >& uniforms ) noexcept: uniforms_{ uniforms } {}
+
+     void set_uniform( std::string_view name, float value ) const noexcept override { add( name, value ); }
+     void set_uniform( std::string_view name, int value ) const noexcept override { add( name, value ); }
+     void set_uniform( std::string_view name, bool value ) const noexcept override { add( name, value ); }
+     void set_uniform( std::string_view name, const Vec2i& value ) const noexcept override { add( name, value ); }
+     void set_uniform( std::string_view name, const Vec2f& value ) const noexcept override { add( name, value ); }
+     void set_uniform( std::string_view name, const Vec3i& value ) const noexcept override { add( name, value ); }
+     void set_uniform( std::string_view name, const Vec3f& value ) const noexcept override { add( name, value ); }
+     void set_uniform( std::string_view name, const Vec4i& value ) const noexcept override { add( name, value ); }
+     void set_uniform( std::string_view name, const Vec4f& value ) const noexcept override { add( name, value ); }
+     void set_uniform( std::string_view name, const TransformMatrix& value ) const noexcept override { add( name, value ); }
+     void set_uniform( UniformId id, float value ) const noexcept override { add( id, value ); }
+     void set_uniform( UniformId id, int value ) const noexcept override { add( id, value ); }
+     void set_uniform( UniformId id, bool value ) const noexcept override { add( id, value ); }
+     void set_uniform( UniformId id, const Vec2i& value ) const noexcept override { add( id, value ); }
+     void set_uniform( UniformId id, const Vec2f& value ) const noexcept override { add( id, value ); }
+     void set_uniform( UniformId id, const Vec3i& value ) const noexcept override { add( id, value ); }
+     void set_uniform( UniformId id, const Vec3f& value ) const noexcept override { add( id, value ); }
+     void set_uniform( UniformId id, const Vec4i& value ) const noexcept override { add( id, value ); }
+     void set_uniform( UniformId id, const Vec4f& value ) const noexcept override { add( id, value ); }
+     void set_uniform( UniformId id, const TransformMatrix& value ) const noexcept override { add( id, value ); }
+
+private:
+     template < typename K, typename T >
+     void add( const K& key, const T& value ) const noexcept
+     {
+          // setup functions cannot report errors, so uniform is lost if memory is exhausted
+          try
+          {
+               CapturedUniform uniform{};
+               if constexpr ( std::is_same_v< K, UniformId > )
+               {
+                    uniform.id = static_cast< uint32_t >( key );
+               }
+               else
+               {
+                    uniform.by_name = true;
+                    uniform.name = std::string{ key };
+               }
+               if constexpr ( std::is_same_v< T, TransformMatrix > )
+               {
+                    uniform.matrix = true;
+                    std::copy( value.data(), value.data() + uniform.matrix_data.size(), uniform.matrix_data.begin() );
+               }
+               else
+               {
+                    uniform.value = value;
+               }
+               uniforms_.push_back( std::move( uniform ) );
+          }
+          catch ( const std::exception& ) {}
+     }
+
+     std::vector< CapturedUniform >& uniforms_;
+};
+
+
+/// @brief Set recorded uniforms to shader program.
+void apply_uniforms( const IShaderProgram& program, const std::vector< CapturedUniform >& uniforms )
+{
+     for ( const auto& uniform : uniforms )
+     {
+          auto set = [ &program, &uniform ]( const auto& value )
+          {
+               if ( uniform.by_name )
+               {
+                    program.set_uniform( uniform.name, value );
+               }
+               else
+               {
+                    program.set_uniform( static_cast< UniformId >( uniform.id ), value );
+               }
+          };
+          if ( uniform.matrix )
+          {
+               const auto& m = uniform.matrix_data;
+               set( TransformMatrix{ m[ 0 ], m[ 1 ], m[ 2 ], m[ 3 ], m[ 4 ], m[ 5 ], m[ 6 ], m[ 7 ],
+                    m[ 8 ], m[ 9 ], m[ 10 ], m[ 11 ], m[ 12 ], m[ 13 ], m[ 14 ], m[ 15 ] } );
+          }
+          else
+          {
+               std::visit( set, uniform.value );
+          }
+     }
+}
+
+
+/// @brief Get identifier given on replay to captured resource.
+/// @throws std::runtime_error if resource was not loaded on replay.
+ResID map_id( const RenderReplay::Context& context, ResourceType type, ResID id )
+{
+     if ( id == 0 )
+     {
+          return 0;
+     }
+     const auto iter = context.ids.find( Resource{ type, id } );
+     if ( iter == context.ids.cend() )
+     {
+          throw std::runtime_error{ "render capture refers to resource which is not loaded, id " + std::to_string( id ) };
+     }
+     return iter->second;
+}
+
+
+template < ResourceType R >
+void remap( const RenderReplay::Context& context, TypedResource< R >& resource )
+{
+     resource = map_id( context, R, resource.id );
+}
+
+
+void remap( const RenderReplay::Context& context, Resource& resource )
+{
+     resource.id = map_id( context, resource.type, resource.id );
+}
+
+
+template < typename P >
+void remap_params( const RenderReplay::Context&, P& ) {}
+
+
+void remap_params( const RenderReplay::Context& context, LoadParams< ResourceType::FrameBuffer >& params )
+{
+     for ( auto& attachment : params.attachments )
+     {
+          remap( context, attachment.resource );
+     }
+}
+
+
+void remap_params( const RenderReplay::Context& context, LoadParams< ResourceType::Material >& params )
+{
+     remap( context, params.shader );
+     for ( auto& texture : params.textures )
+     {
+          remap( context, texture );
+     }
+     for ( auto& array : params.texture_arrays )
+     {
+          remap( context, array );
+     }
+}
+
+
+void remap_params( const RenderReplay::Context& context, RenderParams& params )
+{
+     for ( auto& texture : params.textures )
+     {
+          remap( context, texture );
+     }
+     for ( auto& array : params.texture_arrays )
+     {
+          remap( context, array );
+     }
+     remap( context, params.vertex_buffer );
+     remap( context, params.stream_buffer );
+}
+
+
+/// @brief Read parameters of the record and make function executing it.
+std::function< void( RenderReplay::Context& ) > read_record( CaptureRecordType type, Reader& reader )
+{
+     using Context = RenderReplay::Context;
+     switch ( type )
+     {
+          case CaptureRecordType::Load:
+          {
+               Resource resource;
+               reader.value( resource );
+               std::function< void( Context& ) > execute;
+               visit_resource_type( resource.type, [ &reader, &execute, resource ]( auto tag )
+               {
+                    LoadParams< decltype( tag )::value > params{};
+                    serialize( reader, params );
+                    execute = [ resource, params ]( Context& context )
+                    {
+                         auto mapped = params;
+                         remap_params( context, mapped );
+                         context.ids[ resource ] = context.api->load( resource.type, mapped ).id;
+                    };
+               } );
+               return execute;
+          }
+          case CaptureRecordType::Unload:
+          {
+               Resource resource;
+               reader.value( resource );
+               return [ resource ]( Context& context )
+               {
+                    Resource mapped = resource;
+                    remap( context, mapped );
+                    context.api->unload( mapped );
+                    context.ids.erase( resource );
+               };
+          }
+          case CaptureRecordType::Update:
+          {
+               Resource resource;
+               reader.value( resource );
+               std::function< void( Context& ) > execute;
+               visit_resource_type( resource.type, [ &reader, &execute, resource ]( auto tag )
+               {
+                    if constexpr ( is_updatable_v< decltype( tag )::value > )
+                    {
+                         UpdateParams< decltype( tag )::value > params{};
+                         serialize( reader, params );
+                         execute = [ resource, params ]( Context& context )
+                         {
+                              Resource mapped = resource;
+                              remap( context, mapped );
+                              context.api->update( mapped, params );
+                         };
+                    }
+                    else
+                    {
+                         throw std::runtime_error{ "render capture has update of resource which cannot be updated" };
+                    }
+               } );
+               return execute;
+          }
+          case CaptureRecordType::Process:
+               return []( Context& context ) { context.api->process(); };
+          case CaptureRecordType::EndFrame:
+               return []( Context& context ) { context.api->end_frame(); };
+          case CaptureRecordType::Render:
+          {
+               RenderParams params{};
+               serialize( reader, params );
+               return [ params ]( Context& context )
+               {
+                    auto mapped = params;
+                    remap_params( context, mapped );
+                    context.api->get_device().render( mapped );
+               };
+          }
+          case CaptureRecordType::SetViewport:
+          {
+               Vec2i pos;
+               int width = 0, height = 0;
+               reader.value( pos );
+               reader.value( width );
+               reader.value( height );
+               return [ pos, width, height ]( Context& context )
+               {
+                    context.api->get_device().set_viewport( IntRect{ pos, width, height } );
+               };
+          }
+          case CaptureRecordType::SetDepthTest:
+          {
+               bool enable = false;
+               reader.value( enable );
+               return [ enable ]( Context& context ) { context.api->get_device().set_depth_test_state( enable ); };
+          }
+          case CaptureRecordType::BindShader:
+          {
+               Shader shader;
+               reader.value( shader );
+               return [ shader ]( Context& context )
+               {
+                    Shader mapped = shader;
+                    remap( context, mapped );
+                    context.api->get_device().bind_shader( mapped );
+               };
+          }
+          case CaptureRecordType::SetShaderParams:
+          {
+               auto uniforms = std::make_shared< std::vector< CapturedUniform > >();
+               serialize( reader, *uniforms );
+               return [ uniforms ]( Context& context )
+               {
+                    context.api->get_device().set_shader_params( [ uniforms ]( const IShaderProgram& program )
+                    {
+                         apply_uniforms( program, *uniforms );
+                    } );
+               };
+          }
+          case CaptureRecordType::BindMaterial:
+          {
+               Material material;
+               reader.value( material );
+               return [ material ]( Context& context )
+               {
+                    Material mapped = material;
+                    remap( context, mapped );
+                    context.api->get_device().bind_material( mapped );
+               };
+          }
+          case CaptureRecordType::UpdateUniformBuffer:
+          {
+               UpdateParams< ResourceType::UniformBuffer > params{};
+               UniformBuffer buffer;
+               reader.value( buffer );
+               serialize( reader, params );
+               return [ buffer, params ]( Context& context )
+               {
+                    UniformBuffer mapped = buffer;
+                    remap( context, mapped );
+                    context.api->get_device().update_uniform_buffer( mapped, params.offset, params.size, params.data );
+               };
+          }
+          case CaptureRecordType::AppendStreamData:
+          {
+               StreamBuffer buffer;
+               std::size_t size = 0;
+               DataSharedPtr data;
+               reader.value( buffer );
+               reader.value( size );
+               reader.blob( data, size );
+               return [ buffer, size, data ]( Context& context )
+               {
+                    StreamBuffer mapped = buffer;
+                    remap( context, mapped );
+                    context.api->get_device().append_stream_data( mapped, size, data );
+               };
+          }
+          case CaptureRecordType::BindFramebuffer:
+          {
+               FrameBuffer framebuffer;
+               reader.value( framebuffer );
+               return [ framebuffer ]( Context& context )
+               {
+                    FrameBuffer mapped = framebuffer;
+                    remap( context, mapped );
+                    context.api->get_device().bind_framebuffer( mapped );
+               };
+          }
+          case CaptureRecordType::Clear:
+          {
+               bool color = false, depth = false, stencil = false;
+               reader.value( color );
+               reader.value( depth );
+               reader.value( stencil );
+               return [ color, depth, stencil ]( Context& context )
+               {
+                    context.api->get_device().clear( color, depth, stencil );
+               };
+          }
+          default:
+               throw std::runtime_error{ "render capture has record of unknown type "
+                    + std::to_string( static_cast< int >( type ) ) };
+     }
+}
+
+} // anonymous namespace
+
+
+namespace _16nar
+{
+
+/// @brief Render device which records calls to device of wrapped render API.
+class CaptureRenderDevice : public IRenderDevice
+{
+public:
+     CaptureRenderDevice( CaptureRenderApi& api, IRenderDevice& device ) noexcept:
+          api_{ api }, device_{ device }
+     {}
+
+     void render( const RenderParams& params ) override
+     {
+          device_.render( params );
+          if ( api_.is_capturing() )
+          {
+               Writer writer{ api_.has_payloads() };
+               serialize( writer, const_cast< RenderParams& >( params ) );
+               api_.write_record( CaptureRecordType::Render, writer.get_data() );
+          }
+     }
+
+     void set_viewport( const IntRect& rect ) override
+     {
+          device_.set_viewport( rect );
+          if ( api_.is_capturing() )
+          {
+               Writer writer{ false };
+               writer.value( rect.get_pos() );
+               writer.value( rect.get_width() );
+               writer.value( rect.get_height() );
+               api_.write_record( CaptureRecordType::SetViewport, writer.get_data() );
+          }
+     }
+
+     void set_depth_test_state( bool enable ) override
+     {
+          device_.set_depth_test_state( enable );
+          if ( api_.is_capturing() )
+          {
+               Writer writer{ false };
+               writer.value( enable );
+               api_.write_record( CaptureRecordType::SetDepthTest, writer.get_data() );
+          }
+     }
+
+     void bind_shader( const Shader& shader ) override
+     {
+          device_.bind_shader( shader );
+          write_resource( CaptureRecordType::BindShader, shader );
+     }
+
+     void set_shader_params( const ShaderSetupFunction& setup ) override
+     {
+          device_.set_shader_params( setup );
+          if ( api_.is_capturing() )
+          {
+               std::vector< CapturedUniform > uniforms;
+               setup( UniformRecorder{ uniforms } );
+               Writer writer{ false };
+               serialize( writer, uniforms );
+               api_.write_record( CaptureRecordType::SetShaderParams, writer.get_data() );
+          }
+     }
+
+     void set_object_uniforms( const ObjectUniforms& uniforms ) override
+     {
+          device_.set_object_uniforms( uniforms );
+          if ( api_.is_capturing() )
+          {
+               // replayed as shader setup function, the same uniforms are set
+               std::vector< CapturedUniform > captured;
+               uniforms.apply( UniformRecorder{ captured } );
+               Writer writer{ false };
+               serialize( writer, captured );
+               api_.write_record( CaptureRecordType::SetShaderParams, writer.get_data() );
+          }
+     }
+
+     void bind_material( const Material& material ) override
+     {
+          device_.bind_material( material );
+          write_resource( CaptureRecordType::BindMaterial, material );
+     }
+
+     void update_uniform_buffer( const UniformBuffer& buffer, std::size_t offset,
+          std::size_t size, const DataSharedPtr& data ) override
+     {
+          device_.update_uniform_buffer( buffer, offset, size, data );
+          if ( api_.is_capturing() )
+          {
+               UpdateParams< ResourceType::UniformBuffer > params{ offset, size, data };
+               Writer writer{ api_.has_payloads() };
+               writer.value( buffer );
+               serialize( writer, params );
+               api_.write_record( CaptureRecordType::UpdateUniformBuffer, writer.get_data() );
+          }
+     }
+
+     std::size_t append_stream_data( const StreamBuffer& buffer, std::size_t size,
+          const DataSharedPtr& data ) override
+     {
+          std::size_t offset = device_.append_stream_data( buffer, size, data );
+          if ( api_.is_capturing() )
+          {
+               Writer writer{ api_.has_payloads() };
+               writer.value( buffer );
+               writer.value( size );
+               writer.blob( data, size );
+               api_.write_record( CaptureRecordType::AppendStreamData, writer.get_data() );
+          }
+          return offset;
+     }
+
+     void bind_framebuffer( const FrameBuffer& framebuffer ) override
+     {
+          device_.bind_framebuffer( framebuffer );
+          write_resource( CaptureRecordType::BindFramebuffer, framebuffer );
+     }
+
+     void clear( bool color, bool depth, bool stencil ) override
+     {
+          device_.clear( color, depth, stencil );
+          if ( api_.is_capturing() )
+          {
+               Writer writer{ false };
+               writer.value( color );
+               writer.value( depth );
+               writer.value( stencil );
+               api_.write_record( CaptureRecordType::Clear, writer.get_data() );
+          }
+     }
+
+     void process_render_queue() override
+     {
+          device_.process_render_queue();
+     }
+
+     void end_frame() override
+     {
+          device_.end_frame();
+     }
+
+private:
+     template < ResourceType R >
+     void write_resource( CaptureRecordType type, const TypedResource< R >& resource )
+     {
+          if ( api_.is_capturing() )
+          {
+               Writer writer{ false };
+               writer.value( resource );
+               api_.write_record( type, writer.get_data() );
+          }
+     }
+
+     CaptureRenderApi& api_;
+     IRenderDevice& device_;
+};
+
+
+const char *get_capture_record_name( CaptureRecordType type ) noexcept
+{
+     switch ( type )
+     {
+          case CaptureRecordType::Load:                return "load";
+          case CaptureRecordType::Unload:              return "unload";
+          case CaptureRecordType::Update:              return "update";
+          case CaptureRecordType::Process:             return "process";
+          case CaptureRecordType::EndFrame:            return "end_frame";
+          case CaptureRecordType::Render:              return "render";
+          case CaptureRecordType::SetViewport:         return "set_viewport";
+          case CaptureRecordType::SetDepthTest:        return "set_depth_test_state";
+          case CaptureRecordType::BindShader:          return "bind_shader";
+          case CaptureRecordType::SetShaderParams:     return "set_shader_params";
+          case CaptureRecordType::BindMaterial:        return "bind_material";
+          case CaptureRecordType::UpdateUniformBuffer: return "update_uniform_buffer";
+          case CaptureRecordType::AppendStreamData:    return "append_stream_data";
+          case CaptureRecordType::BindFramebuffer:     return "bind_framebuffer";
+          case CaptureRecordType::Clear:               return "clear";
+     }
+     return "unknown";
+}
+
+
+CaptureRenderApi::CaptureRenderApi( std::unique_ptr< IRenderApi >&& api, bool payloads, bool track_live ):
+     api_{ std::move( api ) }, live_loads_{}, live_order_{}, load_count_{ 0 },
+     output_{ nullptr }, frames_left_{ 0 }, payloads_{ payloads }, track_live_{ track_live }, mutex_{}
+{
+     if ( !api_ )
+     {
+          throw std::runtime_error{ "cannot capture calls, render API is not set" };
+     }
+     device_ = std::make_unique< CaptureRenderDevice >( *this, api_->get_device() );
+}
+
+
+CaptureRenderApi::~CaptureRenderApi()
+{
+     stop_capture();
+}
+
+
+Resource CaptureRenderApi::load( ResourceType type, const std::any& params )
+{
+     Resource resource = api_->load( type, params );
+     if ( !track_live_ && !is_capturing() )
+     {
+          // resource is not used by captures, so its load is not serialized
+          return resource;
+     }
+     Writer writer{ payloads_ };
+     writer.value( resource );
+     visit_resource_type( type, [ &writer, &params ]( auto tag )
+     {
+          const auto *params_ptr = std::any_cast< LoadParams< decltype( tag )::value > >( &params );
+          serialize( writer, const_cast< LoadParams< decltype( tag )::value >& >( *params_ptr ) );
+     } );
+
+     std::lock_guard< std::mutex > lock{ mutex_ };
+     live_order_[ resource ] = load_count_;
+     live_loads_[ load_count_ ] = writer.get_data();
+     load_count_++;
+     if ( output_ )
+     {
+          output_->put( static_cast< char >( CaptureRecordType::Load ) );
+          uint64_t size = writer.get_data().size();
+          output_->write( reinterpret_cast< const char * >( &size ), sizeof( size ) );
+          output_->write( writer.get_data().data(), writer.get_data().size() );
+     }
+     return resource;
+}
+
+
+void CaptureRenderApi::unload( const Resource& resource )
+{
+     api_->unload( resource );
+     {
+          std::lock_guard< std::mutex > lock{ mutex_ };
+          const auto iter = live_order_.find( resource );
+          if ( iter == live_order_.cend() )
+          {
+               return;
+          }
+          live_loads_.erase( iter->second );
+          live_order_.erase( iter );
+     }
+     Writer writer{ false };
+     writer.value( resource );
+     write_record( CaptureRecordType::Unload, writer.get_data() );
+}
+
+
+void CaptureRenderApi::update( const Resource& resource, const std::any& params )
+{
+     api_->update( resource, params );
+     if ( !is_capturing() )
+     {
+          return;
+     }
+     Writer writer{ payloads_ };
+     writer.value( resource );
+     visit_resource_type( resource.type, [ &writer, &params ]( auto tag )
+     {
+          if constexpr ( is_updatable_v< decltype( tag )::value > )
+          {
+               const auto *params_ptr = std::any_cast< UpdateParams< decltype( tag )::value > >( &params );
+               serialize( writer, const_cast< UpdateParams< decltype( tag )::value >& >( *params_ptr ) );
+          }
+     } );
+     write_record( CaptureRecordType::Update, writer.get_data() );
+}
+
+
+IRenderDevice& CaptureRenderApi::get_device() const noexcept
+{
+     return *device_;
+}
+
+
+void CaptureRenderApi::process()
+{
+     api_->process();
+     write_record( CaptureRecordType::Process, std::string{} );
+}
+
+
+void CaptureRenderApi::end_frame()
+{
+     api_->end_frame();
+     write_record( CaptureRecordType::EndFrame, std::string{} );
+     std::lock_guard< std::mutex > lock{ mutex_ };
+     if ( output_ && --frames_left_ == 0 )
+     {
+          output_->flush();
+          output_ = nullptr;
+     }
+}
+
+
+void CaptureRenderApi::start_capture( std::ostream& output, std::size_t frames )
+{
+     std::lock_guard< std::mutex > lock{ mutex_ };
+     if ( output_ )
+     {
+          throw std::runtime_error{ "render capture is already active" };
+     }
+     if ( frames == 0 )
+     {
+          throw std::runtime_error{ "cannot capture 0 frames" };
+     }
+     output.write( capture_magic, sizeof( capture_magic ) );
+     output.write( reinterpret_cast< const char * >( &capture_version ), sizeof( capture_version ) );
+     output.put( static_cast< char >( payloads_ ) );
+     // resources loaded before capture are loaded first on replay
+     for ( const auto& [ order, data ] : live_loads_ )
+     {
+          output.put( static_cast< char >( CaptureRecordType::Load ) );
+          uint64_t size = data.size();
+          output.write( reinterpret_cast< const char * >( &size ), sizeof( size ) );
+          output.write( data.data(), data.size() );
+     }
+     output_ = &output;
+     frames_left_ = frames;
+}
+
+
+void CaptureRenderApi::stop_capture()
+{
+     std::lock_guard< std::mutex > lock{ mutex_ };
+     if ( output_ )
+     {
+          output_->flush();
+          output_ = nullptr;
+     }
+}
+
+
+bool CaptureRenderApi::is_capturing() const noexcept
+{
+     std::lock_guard< std::mutex > lock{ mutex_ };
+     return output_ != nullptr;
+}
+
+
+IRenderApi& CaptureRenderApi::get_api() const noexcept
+{
+     return *api_;
+}
+
+
+bool CaptureRenderApi::has_payloads() const noexcept
+{
+     return payloads_;
+}
+
+
+void CaptureRenderApi::write_record( CaptureRecordType type, const std::string& data )
+{
+     std::lock_guard< std::mutex > lock{ mutex_ };
+     if ( !output_ )
+     {
+          return;
+     }
+     output_->put( static_cast< char >( type ) );
+     uint64_t size = data.size();
+     output_->write( reinterpret_cast< const char * >( &size ), sizeof( size ) );
+     output_->write( data.data(), data.size() );
+}
+
+
+RenderReplay::RenderReplay( std::istream& input ):
+     records_{}, timings_{}, frame_count_{ 0 }, payload_size_{ 0 }, payloads_{ false }
+{
+     std::string capture{ std::istreambuf_iterator< char >{ input }, std::istreambuf_iterator< char >{} };
+     Reader header{ capture.data(), capture.data() + capture.size() };
+     std::array< char, sizeof( capture_magic ) > magic{};
+     uint32_t version = 0;
+     for ( auto& c : magic )
+     {
+          header.value( c );
+     }
+     if ( !std::equal( magic.cbegin(), magic.cend(), capture_magic ) )
+     {
+          throw std::runtime_error{ "stream is not a render capture" };
+     }
+     header.value( version );
+     if ( version != capture_version )
+     {
+          throw std::runtime_error{ "unsupported render capture version " + std::to_string( version ) };
+     }
+     header.value( payloads_ );
+
+     const char *pos = capture.data() + sizeof( capture_magic ) + sizeof( version ) + sizeof( payloads_ );
+     const char *end = capture.data() + capture.size();
+     while ( pos != end )
+     {
+          Reader prefix{ pos, end };
+          CaptureRecordType type{};
+          std::size_t size = 0;
+          prefix.value( type );
+          prefix.value( size );
+          pos += sizeof( type ) + sizeof( uint64_t );
+          if ( static_cast< std::size_t >( end - pos ) < size )
+          {
+               throw std::runtime_error{ "render capture is truncated" };
+          }
+          Reader reader{ pos, pos + size };
+          records_.push_back( Record{ type, read_record( type, reader ) } );
+          if ( !reader.is_finished() )
+          {
+               throw std::runtime_error{ std::string{ "render capture has malformed record " }
+                    + get_capture_record_name( type ) };
+          }
+          payload_size_ += reader.get_payload_size();
+          frame_count_ += ( type == CaptureRecordType::EndFrame );
+          pos += size;
+     }
+}
+
+
+void RenderReplay::run( IRenderApi& api )
+{
+     timings_.clear();
+     timings_.reserve( records_.size() );
+     Context context{};
+     context.api = &api;
+     std::size_t frame = 0;
+     for ( const auto& record : records_ )
+     {
+          auto start = std::chrono::steady_clock::now();
+          record.execute( context );
+          auto duration = std::chrono::steady_clock::now() - start;
+          timings_.push_back( ReplayTiming{ record.type, frame,
+               std::chrono::duration_cast< std::chrono::nanoseconds >( duration ) } );
+          frame += ( record.type == CaptureRecordType::EndFrame );
+     }
+     for ( const auto& [ captured, id ] : context.ids )
+     {
+          api.unload( Resource{ captured.type, id } );
+     }
+}
+
+
+const std::vector< ReplayTiming >& RenderReplay::get_timings() const noexcept
+{
+     return timings_;
+}
+
+
+std::size_t RenderReplay::get_record_count() const noexcept
+{
+     return records_.size();
+}
+
+
+std::size_t RenderReplay::get_frame_count() const noexcept
+{
+     return frame_count_;
+}
+
+
+std::size_t RenderReplay::get_payload_size() const noexcept
+{
+     return payload_size_;
+}
+
+
+bool RenderReplay::has_payloads() const noexcept
+{
+     return payloads_;
+}
+
+} // namespace _16nar
@@ -0,0 +1,418 @@
+#include <16nar/render/render_graph.h>
+
+#include <16nar/game.h>
+#include <16nar/render/irender_api.h>
+#include <16nar/render/irender_device.h>
+
+#include <algorithm>
+#include <functional>
+#include <queue>
+#include <stdexcept>
+
+namespace
+{
+
+/// @brief Value of slot index of target without texture.
+constexpr std::size_t no_slot = static_cast< std::size_t >( -1 );
+
+} // anonymous namespace
+
+
+namespace _16nar
+{
+
+RenderGraph::RenderGraph():
+     targets_{}, passes_{}, outputs_( 1, false ), order_{}, target_slots_( 1, no_slot ), pool_{}, framebuffers_{}
+{}
+
+
+RenderTargetId RenderGraph::create_target( const RenderTargetDesc& desc )
+{
+     targets_.push_back( desc );
+     outputs_.push_back( false );
+     target_slots_.push_back( no_slot );
+     return targets_.size();
+}
+
+
+void RenderGraph::add_pass( const RenderPass& pass )
+{
+     passes_.push_back( pass );
+}
+
+
+void RenderGraph::set_output( RenderTargetId target )
+{
+     check_target( target, "output" );
+     outputs_[ target ] = true;
+}
+
+
+void RenderGraph::compile()
+{
+     std::vector< std::vector< std::size_t > > writers( targets_.size() + 1 );
+     for ( std::size_t i = 0; i < passes_.size(); i++ )
+     {
+          const auto& pass = passes_[ i ];
+          if ( pass.writes.empty() )
+          {
+               throw std::runtime_error{ "render pass " + pass.name + " writes no targets" };
+          }
+          for ( RenderTargetId target : pass.writes )
+          {
+               check_target( target, pass.name );
+               if ( target == screen && pass.writes.size() > 1 )
+               {
+                    throw std::runtime_error{ "render pass " + pass.name + " writes screen with other targets" };
+               }
+               writers[ target ].push_back( i );
+          }
+          for ( RenderTargetId target : pass.reads )
+          {
+               check_target( target, pass.name );
+               if ( target == screen ||
+                    std::find( pass.writes.cbegin(), pass.writes.cend(), target ) != pass.writes.cend() )
+               {
+                    throw std::runtime_error{ "render pass " + pass.name + " reads target "
+                         + std::to_string( target ) + " which it cannot read" };
+               }
+          }
+     }
+
+     // passes writing screen or outputs are needed, and so are passes producing their inputs
+     std::vector< bool > needed( passes_.size(), false );
+     std::vector< std::size_t > stack;
+     for ( std::size_t i = 0; i < passes_.size(); i++ )
+     {
+          for ( RenderTargetId target : passes_[ i ].writes )
+          {
+               if ( target == screen || outputs_[ target ] )
+               {
+                    needed[ i ] = true;
+                    stack.push_back( i );
+                    break;
+               }
+          }
+     }
+     while ( !stack.empty() )
+     {
+          std::size_t current = stack.back();
+          stack.pop_back();
+          auto require = [ & ]( std::size_t pass )
+          {
+               if ( !needed[ pass ] )
+               {
+                    needed[ pass ] = true;
+                    stack.push_back( pass );
+               }
+          };
+          for ( RenderTargetId target : passes_[ current ].reads )
+          {
+               if ( writers[ target ].empty() )
+               {
+                    throw std::runtime_error{ "render pass " + passes_[ current ].name + " reads target "
+                         + std::to_string( target ) + " which is never written" };
+               }
+               std::for_each( writers[ target ].cbegin(), writers[ target ].cend(), require );
+          }
+          // previous writers of the same target may draw what this pass draws over
+          for ( RenderTargetId target : passes_[ current ].writes )
+          {
+               for ( std::size_t writer : writers[ target ] )
+               {
+                    if ( writer < current )
+                    {
+                         require( writer );
+                    }
+               }
+          }
+     }
+
+     // writers of a target go in order of addition, all of them go before readers
+     std::vector< std::vector< std::size_t > > next( passes_.size() );
+     std::vector< std::size_t > dependencies( passes_.size(), 0 );
+     auto add_edge = [ & ]( std::size_t from, std::size_t to )
+     {
+          if ( needed[ from ] && needed[ to ] )
+          {
+               next[ from ].push_back( to );
+               dependencies[ to ]++;
+          }
+     };
+     for ( std::size_t i = 0; i < passes_.size(); i++ )
+     {
+          for ( RenderTargetId target : passes_[ i ].reads )
+          {
+               for ( std::size_t writer : writers[ target ] )
+               {
+                    add_edge( writer, i );
+               }
+          }
+          for ( RenderTargetId target : passes_[ i ].writes )
+          {
+               auto iter = std::find( writers[ target ].cbegin(), writers[ target ].cend(), i );
+               if ( iter != writers[ target ].cbegin() )
+               {
+                    add_edge( *( iter - 1 ), i );
+               }
+          }
+     }
+     std::priority_queue< std::size_t, std::vector< std::size_t >, std::greater< std::size_t > > ready;
+     std::size_t needed_count = 0;
+     for ( std::size_t i = 0; i < passes_.size(); i++ )
+     {
+          if ( needed[ i ] )
+          {
+               needed_count++;
+               if ( dependencies[ i ] == 0 )
+               {
+                    ready.push( i );
+               }
+          }
+     }
+     order_.clear();
+     while ( !ready.empty() )
+     {
+          std::size_t current = ready.top();
+          ready.pop();
+          order_.push_back( current );
+          for ( std::size_t pass : next[ current ] )
+          {
+               if ( --dependencies[ pass ] == 0 )
+               {
+                    ready.push( pass );
+               }
+          }
+     }
+     if ( order_.size() != needed_count )
+     {
+          order_.clear();
+          throw std::runtime_error{ "render passes have cyclic dependencies" };
+     }
+
+     // lifetime of target lasts from its first use to its last use, outputs are never released
+     std::vector< std::size_t > first( targets_.size() + 1, no_slot );
+     std::vector< std::size_t > last( targets_.size() + 1, 0 );
+     for ( std::size_t pos = 0; pos < order_.size(); pos++ )
+     {
+          const auto& pass = passes_[ order_[ pos ] ];
+          for ( const auto *targets : { &pass.reads, &pass.writes } )
+          {
+               for ( RenderTargetId target : *targets )
+               {
+                    first[ target ] = std::min( first[ target ], pos );
+                    last[ target ] = outputs_[ target ] ? order_.size() : std::max( last[ target ], pos );
+               }
+          }
+     }
+     std::fill( target_slots_.begin(), target_slots_.end(), no_slot );
+     std::vector< bool > busy( pool_.size(), false );
+     for ( auto& slot : pool_ )
+     {
+          slot.used = false;
+     }
+     for ( std::size_t pos = 0; pos < order_.size(); pos++ )
+     {
+          for ( RenderTargetId target = 1; target <= targets_.size(); target++ )
+          {
+               if ( first[ target ] != pos )
+               {
+                    continue;
+               }
+               std::size_t slot = 0;
+               while ( slot < pool_.size() && ( busy[ slot ] || pool_[ slot ].desc != targets_[ target - 1 ] ) )
+               {
+                    slot++;
+               }
+               if ( slot == pool_.size() )
+               {
+                    pool_.push_back( Slot{ targets_[ target - 1 ], Texture{}, false } );
+                    busy.push_back( false );
+               }
+               busy[ slot ] = true;
+               pool_[ slot ].used = true;
+               target_slots_[ target ] = slot;
+          }
+          for ( RenderTargetId target = 1; target <= targets_.size(); target++ )
+          {
+               if ( first[ target ] != no_slot && last[ target ] == pos )
+               {
+                    busy[ target_slots_[ target ] ] = false;
+               }
+          }
+     }
+}
+
+
+void RenderGraph::execute( const Vec2i& screen_size )
+{
+     auto& render_api = get_game().get_render_api();
+     auto& device = render_api.get_device();
+     for ( auto& slot : pool_ )
+     {
+          if ( slot.used && slot.texture.id == 0 )
+          {
+               LoadParams< ResourceType::Texture > params{};
+               params.format = slot.desc.format;
+               params.data_type = slot.desc.data_type;
+               params.size = slot.desc.size;
+               slot.texture = render_api.load( ResourceType::Texture, params ).id;
+          }
+     }
+     for ( std::size_t index : order_ )
+     {
+          const auto& pass = passes_[ index ];
+          if ( pass.writes.front() == screen )
+          {
+               device.bind_framebuffer( FrameBuffer{} );
+               device.set_viewport( IntRect{ Vec2i{}, screen_size.x(), screen_size.y() } );
+          }
+          else
+          {
+               device.bind_framebuffer( get_framebuffer( pass.writes ) );
+               const Vec2i& size = targets_[ pass.writes.front() - 1 ].size;
+               device.set_viewport( IntRect{ Vec2i{}, size.x(), size.y() } );
+          }
+          if ( pass.execute )
+          {
+               pass.execute( *this );
+          }
+     }
+     // drawing after the graph goes to the screen
+     device.bind_framebuffer( FrameBuffer{} );
+     device.set_viewport( IntRect{ Vec2i{}, screen_size.x(), screen_size.y() } );
+}
+
+
+void RenderGraph::clear() noexcept
+{
+     targets_.clear();
+     passes_.clear();
+     outputs_.assign( 1, false );
+     order_.clear();
+     target_slots_.assign( 1, no_slot );
+     for ( auto& slot : pool_ )
+     {
+          slot.used = false;
+     }
+}
+
+
+const std::vector< std::size_t >& RenderGraph::get_order() const noexcept
+{
+     return order_;
+}
+
+
+std::size_t RenderGraph::get_slot( RenderTargetId target ) const
+{
+     if ( target >= target_slots_.size() || target_slots_[ target ] == no_slot )
+     {
+          throw std::runtime_error{ "render target " + std::to_string( target ) + " has no texture" };
+     }
+     return target_slots_[ target ];
+}
+
+
+std::size_t RenderGraph::get_pool_size() const noexcept
+{
+     return pool_.size();
+}
+
+
+Texture RenderGraph::get_texture( RenderTargetId target ) const
+{
+     return pool_[ get_slot( target ) ].texture;
+}
+
+
+void RenderGraph::trim_pool()
+{
+     auto& render_api = get_game().get_render_api();
+     std::vector< std::size_t > new_slots( pool_.size(), no_slot );
+     std::vector< Slot > kept;
+     for ( std::size_t i = 0; i < pool_.size(); i++ )
+     {
+          if ( pool_[ i ].used )
+          {
+               new_slots[ i ] = kept.size();
+               kept.push_back( pool_[ i ] );
+               continue;
+          }
+          if ( pool_[ i ].texture.id == 0 )
+          {
+               continue;
+          }
+          for ( auto iter = framebuffers_.begin(); iter != framebuffers_.end(); )
+          {
+               if ( std::find( iter->first.cbegin(), iter->first.cend(), pool_[ i ].texture.id ) != iter->first.cend() )
+               {
+                    render_api.unload( iter->second );
+                    iter = framebuffers_.erase( iter );
+               }
+               else
+               {
+                    ++iter;
+               }
+          }
+          render_api.unload( pool_[ i ].texture );
+     }
+     pool_ = std::move( kept );
+     for ( auto& slot : target_slots_ )
+     {
+          slot = ( slot == no_slot ) ? no_slot : new_slots[ slot ];
+     }
+}
+
+
+void RenderGraph::reset()
+{
+     clear();
+     trim_pool();
+}
+
+
+FrameBuffer RenderGraph::get_framebuffer( const std::vector< RenderTargetId >& targets )
+{
+     std::vector< ResID > key;
+     for ( RenderTargetId target : targets )
+     {
+          key.push_back( get_texture( target ).id );
+     }
+     auto iter = framebuffers_.find( key );
+     if ( iter != framebuffers_.end() )
+     {
+          return iter->second;
+     }
+     LoadParams< ResourceType::FrameBuffer > params{};
+     std::size_t color_count = 0;
+     for ( RenderTargetId target : targets )
+     {
+          LoadParams< ResourceType::FrameBuffer >::AttachmentParams attachment{};
+          attachment.resource = get_texture( target );
+          switch ( targets_[ target - 1 ].format )
+          {
+               case BufferDataFormat::Depth:           attachment.type = AttachmentType::Depth;          break;
+               case BufferDataFormat::DepthStencil:    attachment.type = AttachmentType::DepthStencil;   break;
+               default:
+                    attachment.type = AttachmentType::Color;
+                    attachment.order = color_count++;
+               break;
+          }
+          params.attachments.push_back( attachment );
+     }
+     FrameBuffer framebuffer{ get_game().get_render_api().load( ResourceType::FrameBuffer, params ).id };
+     framebuffers_.emplace( std::move( key ), framebuffer );
+     return framebuffer;
+}
+
+
+void RenderGraph::check_target( RenderTargetId target, const std::string& pass ) const
+{
+     if ( target > targets_.size() )
+     {
+          throw std::runtime_error{ "unknown render target " + std::to_string( target ) + " in " + pass };
+     }
+}
+
+} // namespace _16nar
@@ -0,0 +1,58 @@
+#include <16nar/render/animation_table.h>
+#include <catch2/catch_test_macros.hpp>
+
+#include <stdexcept>
+
+TEST_CASE( "Frame selection of animation clip", "[animation_table]" )
+{
+     using namespace _16nar;
+
+     AnimationClip clip{};
+     clip.first_frame = 10;
+     clip.frame_count = 4;
+     clip.frame_rate = 8.0f;
+
+     REQUIRE( get_animation_frame( clip, 0.0f ) == 0 );
+     REQUIRE( get_animation_frame( clip, 0.124f ) == 0 );
+     REQUIRE( get_animation_frame( clip, 0.126f ) == 1 );
+     REQUIRE( get_animation_frame( clip, 0.49f ) == 3 );
+     REQUIRE( get_animation_frame( clip, 0.51f ) == 0 );
+     // negative rate plays the clip backwards
+     clip.frame_rate = -8.0f;
+     REQUIRE( get_animation_frame( clip, 0.01f ) == 3 );
+
+     clip.frame_rate = 8.0f;
+     clip.loop = false;
+     REQUIRE( get_animation_frame( clip, 0.49f ) == 3 );
+     REQUIRE( get_animation_frame( clip, 10.0f ) == 3 );
+     REQUIRE( get_animation_frame( clip, -1.0f ) == 0 );
+
+     clip.frame_count = 0;
+     REQUIRE( get_animation_frame( clip, 1.0f ) == 0 );
+}
+
+
+TEST_CASE( "Animation table without render API", "[animation_table]" )
+{
+     using namespace _16nar;
+
+     AnimationTable table{};
+     float time = table.get_time();
+     REQUIRE( time >= 0.0f );
+     REQUIRE( table.get_time() >= time );
+     REQUIRE( table.get_frame_count() == 0 );
+
+     // frames are checked before uniform buffer is created
+     REQUIRE_THROWS_AS( table.add_clip( {}, 10.0f ), std::runtime_error );
+     std::vector< TextureRegion > frames( AnimationBlock::max_frames + 1 );
+     REQUIRE_THROWS_AS( table.add_clip( frames, 10.0f ), std::runtime_error );
+     frames.resize( 2 );
+     frames[ 1 ].rotated = true;
+     REQUIRE_THROWS_AS( table.add_clip( frames, 10.0f ), std::runtime_error );
+     REQUIRE( table.get_frame_count() == 0 );
+
+     // nothing to update and unload without clips
+     table.update();
+     table.reset();
+     REQUIRE( table.get_frame_count() == 0 );
+}
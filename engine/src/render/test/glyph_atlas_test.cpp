@@ -0,0 +1,75 @@
+#include <16nar/render/glyph_atlas.h>
+#include <catch2/catch_test_macros.hpp>
+
+#include <stdexcept>
+
+TEST_CASE( "Assignment of glyph cells", "[glyph_atlas]" )
+{
+     using namespace _16nar;
+
+     GlyphCells cells{ 3 };
+     REQUIRE( cells.get_count() == 3 );
+     REQUIRE_FALSE( cells.contains( U'a' ) );
+
+     auto [ a_cell, a_new ] = cells.acquire( U'a' );
+     REQUIRE( a_new );
+     REQUIRE( cells.contains( U'a' ) );
+     // glyph already in cell is not written again
+     auto [ a_cell2, a_new2 ] = cells.acquire( U'a' );
+     REQUIRE( a_cell2 == a_cell );
+     REQUIRE_FALSE( a_new2 );
+     REQUIRE( cells.get_users( U'a' ) == 2 );
+
+     auto b_cell = cells.acquire( U'b' ).first;
+     auto c_cell = cells.acquire( U'c' ).first;
+     REQUIRE( a_cell != b_cell );
+     REQUIRE( b_cell != c_cell );
+     REQUIRE( a_cell != c_cell );
+     // all cells are pinned
+     REQUIRE_THROWS_AS( cells.acquire( U'd' ), std::runtime_error );
+
+     cells.release( U'a' );
+     REQUIRE_THROWS_AS( cells.acquire( U'd' ), std::runtime_error );
+     cells.release( U'a' );
+     REQUIRE( cells.get_users( U'a' ) == 0 );
+     REQUIRE( cells.contains( U'a' ) );
+     auto [ d_cell, d_new ] = cells.acquire( U'd' );
+     REQUIRE( d_new );
+     REQUIRE( d_cell == a_cell );
+     REQUIRE_FALSE( cells.contains( U'a' ) );
+
+     cells.clear();
+     REQUIRE_FALSE( cells.contains( U'b' ) );
+     REQUIRE( cells.get_users( U'd' ) == 0 );
+}
+
+
+TEST_CASE( "Eviction of least recently released glyphs", "[glyph_atlas]" )
+{
+     using namespace _16nar;
+
+     GlyphCells cells{ 3 };
+     cells.acquire( U'1' );
+     cells.acquire( U'2' );
+     cells.acquire( U'3' );
+     cells.release( U'2' );
+     cells.release( U'1' );
+     cells.release( U'3' );
+
+     // glyph without users is reused while it is still in the cell
+     REQUIRE_FALSE( cells.acquire( U'2' ).second );
+     cells.release( U'2' );
+
+     // order of release is now 1, 3, 2
+     cells.acquire( U'4' );
+     REQUIRE_FALSE( cells.contains( U'1' ) );
+     cells.acquire( U'5' );
+     REQUIRE_FALSE( cells.contains( U'3' ) );
+     REQUIRE( cells.contains( U'2' ) );
+     // releasing unknown glyph or glyph without users has no effect
+     cells.release( U'x' );
+     cells.release( U'2' );
+     cells.acquire( U'6' );
+     REQUIRE_FALSE( cells.contains( U'2' ) );
+     REQUIRE_THROWS_AS( cells.acquire( U'7' ), std::runtime_error );
+}
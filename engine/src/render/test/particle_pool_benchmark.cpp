@@ -0,0 +1,34 @@
+#include <16nar/render/particle_pool.h>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <string>
+#include <vector>
+
+TEST_CASE( "Particle pool simulation benchmark", "[particle_pool][!benchmark]" )
+{
+     using namespace _16nar;
+
+     for ( std::size_t count : { 100'000, 1'000'000 } )
+     {
+          ParticlePool pool{ count };
+          // long lifetime keeps all particles alive during benchmark
+          pool.emit( count, Vec2f{}, Vec2f{ 1.0f, 1.0f }, Vec2f{ 5.0f, 5.0f }, 1e6f );
+          std::vector< float > instances( count * ParticlePool::instance_floats );
+
+          BENCHMARK( "update " + std::to_string( count ) )
+          {
+               pool.update( 1.0f / 60.0f, Vec2f{ 0.0f, -9.8f } );
+               return pool.get_size();
+          };
+          BENCHMARK( "bounds " + std::to_string( count ) )
+          {
+               return pool.get_bounds();
+          };
+          BENCHMARK( "write instances " + std::to_string( count ) )
+          {
+               pool.write_instances( instances.data() );
+               return instances[ 0 ];
+          };
+     }
+}
@@ -0,0 +1,106 @@
+#include <16nar/render/particle_pool.h>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <algorithm>
+#include <vector>
+
+using Catch::Matchers::WithinAbs;
+
+TEST_CASE( "Emission of particles", "[particle_pool]" )
+{
+     using namespace _16nar;
+
+     ParticlePool pool{ 10 };
+     REQUIRE( pool.get_capacity() == 10 );
+     REQUIRE( pool.get_size() == 0 );
+     REQUIRE( pool.emit( 6, Vec2f{ 1.0f, 2.0f }, Vec2f{}, Vec2f{}, 1.0f ) == 6 );
+     // particles which do not fit are discarded
+     REQUIRE( pool.emit( 6, Vec2f{}, Vec2f{}, Vec2f{}, 1.0f ) == 4 );
+     REQUIRE( pool.get_size() == 10 );
+     REQUIRE( pool.get_x()[ 0 ] == 1.0f );
+     REQUIRE( pool.get_y()[ 5 ] == 2.0f );
+     pool.clear();
+     REQUIRE( pool.get_size() == 0 );
+}
+
+
+TEST_CASE( "Simulation of particles", "[particle_pool]" )
+{
+     using namespace _16nar;
+
+     // odd count checks both vectorized loop and its remainder
+     ParticlePool pool{ 7 };
+     pool.emit( 7, Vec2f{ 1.0f, 1.0f }, Vec2f{ 2.0f, 0.0f }, Vec2f{}, 1.0f );
+     pool.update( 0.5f, Vec2f{ 0.0f, -4.0f } );
+     REQUIRE( pool.get_size() == 7 );
+     for ( std::size_t i = 0; i < pool.get_size(); i++ )
+     {
+          REQUIRE_THAT( pool.get_x()[ i ], WithinAbs( 2.0f, 1e-6 ) );
+          REQUIRE_THAT( pool.get_y()[ i ], WithinAbs( 1.0f, 1e-6 ) );
+     }
+     // velocity was changed by acceleration on previous update
+     pool.update( 0.25f, Vec2f{ 0.0f, -4.0f } );
+     for ( std::size_t i = 0; i < pool.get_size(); i++ )
+     {
+          REQUIRE_THAT( pool.get_x()[ i ], WithinAbs( 2.5f, 1e-6 ) );
+          REQUIRE_THAT( pool.get_y()[ i ], WithinAbs( 0.5f, 1e-6 ) );
+     }
+
+     std::vector< float > instances( pool.get_size() * ParticlePool::instance_floats );
+     pool.write_instances( instances.data() );
+     REQUIRE_THAT( instances[ 0 ], WithinAbs( 2.5f, 1e-6 ) );
+     REQUIRE_THAT( instances[ 1 ], WithinAbs( 0.5f, 1e-6 ) );
+     REQUIRE_THAT( instances[ 2 ], WithinAbs( 0.75f, 1e-6 ) );
+
+     pool.update( 0.25f, Vec2f{} );
+     REQUIRE( pool.get_size() == 0 );
+}
+
+
+TEST_CASE( "Removal of dead particles", "[particle_pool]" )
+{
+     using namespace _16nar;
+
+     ParticlePool pool{ 16 };
+     pool.emit( 5, Vec2f{ 1.0f, 0.0f }, Vec2f{}, Vec2f{}, 1.0f );
+     pool.emit( 5, Vec2f{ 2.0f, 0.0f }, Vec2f{}, Vec2f{}, 3.0f );
+     pool.emit( 5, Vec2f{ 3.0f, 0.0f }, Vec2f{}, Vec2f{}, 1.0f );
+     pool.update( 2.0f, Vec2f{} );
+     REQUIRE( pool.get_size() == 5 );
+     for ( std::size_t i = 0; i < pool.get_size(); i++ )
+     {
+          REQUIRE( pool.get_x()[ i ] == 2.0f );
+     }
+}
+
+
+TEST_CASE( "Bounds of particles", "[particle_pool]" )
+{
+     using namespace _16nar;
+
+     ParticlePool pool{ 64, 42 };
+     FloatRect empty = pool.get_bounds();
+     REQUIRE( empty.get_width() == 0.0f );
+     REQUIRE( empty.get_height() == 0.0f );
+
+     pool.emit( 33, Vec2f{}, Vec2f{}, Vec2f{ 10.0f, 5.0f }, 10.0f );
+     pool.update( 1.0f, Vec2f{} );
+     float min_x = pool.get_x()[ 0 ], max_x = min_x, min_y = pool.get_y()[ 0 ], max_y = min_y;
+     for ( std::size_t i = 0; i < pool.get_size(); i++ )
+     {
+          REQUIRE( pool.get_x()[ i ] >= -10.0f );
+          REQUIRE( pool.get_x()[ i ] <= 10.0f );
+          REQUIRE( pool.get_y()[ i ] >= -5.0f );
+          REQUIRE( pool.get_y()[ i ] <= 5.0f );
+          min_x = std::min( min_x, pool.get_x()[ i ] );
+          max_x = std::max( max_x, pool.get_x()[ i ] );
+          min_y = std::min( min_y, pool.get_y()[ i ] );
+          max_y = std::max( max_y, pool.get_y()[ i ] );
+     }
+     FloatRect bounds = pool.get_bounds();
+     REQUIRE( bounds.get_pos().x() == min_x );
+     REQUIRE( bounds.get_pos().y() == min_y );
+     REQUIRE_THAT( bounds.get_width(), WithinAbs( max_x - min_x, 1e-5 ) );
+     REQUIRE_THAT( bounds.get_height(), WithinAbs( max_y - min_y, 1e-5 ) );
+}
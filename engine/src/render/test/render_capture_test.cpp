@@ -0,0 +1,188 @@
+#include <16nar/render/render_capture.h>
+#include <16nar/render/null/render_api.h>
+#include <16nar/render/null/render_device.h>
+#include <16nar/render/ishader_program.h>
+#include <16nar/math/transform_matrix.h>
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstring>
+#include <sstream>
+
+namespace
+{
+
+using namespace _16nar;
+
+/// @brief Draw one frame with given resources.
+void draw_frame( IRenderApi& api, const Material& material, const VertexBuffer& quad,
+     const UniformBuffer& buffer, float value )
+{
+     auto data = DataSharedPtr{ new std::byte[ 16 ]{}, std::default_delete< std::byte[] >() };
+     std::memcpy( data.get(), &value, sizeof( value ) );
+     RenderParams params{};
+     params.vertex_buffer = quad;
+     params.primitive = PrimitiveType::TriangleStrip;
+     params.vertex_count = 4;
+
+     auto& device = api.get_device();
+     device.clear( true, true, false );
+     device.bind_material( material );
+     device.set_shader_params( [ value ]( const IShaderProgram& program )
+     {
+          program.set_uniform( "value", value );
+          program.set_uniform( uniform_ids::model_matr, TransformMatrix{} );
+     } );
+     device.update_uniform_buffer( buffer, 0, 16, data );
+     device.render( params );
+     api.process();
+     api.end_frame();
+}
+
+} // anonymous namespace
+
+
+TEST_CASE( "Render capture is replayed with the same calls", "[render_capture]" )
+{
+     using namespace _16nar;
+
+     auto captured_api = std::make_unique< null::RenderApi >( ProfileType::SingleThreaded );
+     auto& captured_device = captured_api->get_recording_device();
+     CaptureRenderApi api{ std::move( captured_api ), true, true };
+
+     // resources loaded before the capture are written at its beginning
+     Shader shader{ api.load( ResourceType::Shader, LoadParams< ResourceType::Shader >{} ).id };
+     LoadParams< ResourceType::Material > material_params{};
+     material_params.shader = shader;
+     Material material{ api.load( ResourceType::Material, material_params ).id };
+     LoadParams< ResourceType::UniformBuffer > ub_params{};
+     ub_params.size = 16;
+     UniformBuffer buffer{ api.load( ResourceType::UniformBuffer, ub_params ).id };
+     Resource unloaded = api.load( ResourceType::Texture, LoadParams< ResourceType::Texture >{} );
+     api.unload( unloaded );
+     VertexBuffer empty{ api.load( ResourceType::VertexBuffer, LoadParams< ResourceType::VertexBuffer >{} ).id };
+     draw_frame( api, material, empty, buffer, 0.0f );
+
+     std::stringstream stream;
+     REQUIRE_THROWS( api.start_capture( stream, 0 ) );
+     api.start_capture( stream, 2 );
+     REQUIRE( api.is_capturing() );
+     REQUIRE_THROWS( api.start_capture( stream, 1 ) );
+     captured_device.reset();
+
+     LoadParams< ResourceType::VertexBuffer > vb_params{};
+     vb_params.buffer.size = 8;
+     vb_params.buffer.data = DataSharedPtr{ new std::byte[ 8 ]{}, std::default_delete< std::byte[] >() };
+     VertexBuffer quad{ api.load( ResourceType::VertexBuffer, vb_params ).id };
+     draw_frame( api, material, quad, buffer, 1.0f );
+     draw_frame( api, material, quad, buffer, 2.0f );
+     REQUIRE_FALSE( api.is_capturing() );
+     draw_frame( api, material, quad, buffer, 3.0f );
+
+     RenderReplay replay{ stream };
+     REQUIRE( replay.has_payloads() );
+     REQUIRE( replay.get_frame_count() == 2 );
+     // 4 live loads, 1 load during capture and 7 records per frame
+     REQUIRE( replay.get_record_count() == 19 );
+     REQUIRE( replay.get_payload_size() == 8 + 2 * 16 );
+
+     null::RenderApi replay_api{ ProfileType::SingleThreaded };
+     replay.run( replay_api );
+     REQUIRE( replay.get_timings().size() == replay.get_record_count() );
+     REQUIRE( replay.get_timings().back().type == CaptureRecordType::EndFrame );
+     REQUIRE( replay.get_timings().back().frame == 1 );
+
+     const auto& expected = captured_device.get_counters();
+     const auto& counters = replay_api.get_recording_device().get_counters();
+     REQUIRE( counters.frames == 2 );
+     REQUIRE( counters.draw_calls == expected.draw_calls - 1 );
+     // material stays bound since warm-up frame, but replay binds it once
+     REQUIRE( expected.material_binds == 0 );
+     REQUIRE( counters.material_binds == 1 );
+     REQUIRE( counters.uniforms == expected.uniforms - 2 );
+     REQUIRE( counters.uniform_buffer_bytes == expected.uniform_buffer_bytes - 16 );
+     REQUIRE( counters.clears == expected.clears - 1 );
+
+     // resources of replay are unloaded after it
+     REQUIRE( replay_api.get_resource_count( ResourceType::Material ) == 0 );
+     REQUIRE( replay_api.get_resource_count( ResourceType::VertexBuffer ) == 0 );
+}
+
+
+TEST_CASE( "Render capture without payloads keeps their sizes", "[render_capture]" )
+{
+     using namespace _16nar;
+
+     auto capture = []( bool payloads )
+     {
+          CaptureRenderApi api{ std::make_unique< null::RenderApi >( ProfileType::SingleThreaded ), payloads };
+          std::stringstream stream;
+          api.start_capture( stream, 1 );
+          LoadParams< ResourceType::UniformBuffer > ub_params{};
+          ub_params.size = 32;
+          ub_params.data = DataSharedPtr{ new std::byte[ 32 ]{}, std::default_delete< std::byte[] >() };
+          Resource buffer = api.load( ResourceType::UniformBuffer, ub_params );
+          api.update( buffer, UpdateParams< ResourceType::UniformBuffer >{ 16, 16, ub_params.data } );
+          api.end_frame();
+          return stream.str();
+     };
+
+     // capture without payloads holds only sizes and hashes of 48 bytes of data
+     std::string hashed = capture( false );
+     REQUIRE( capture( true ).size() == hashed.size() + 48 );
+     std::stringstream stream{ hashed };
+     RenderReplay replay{ stream };
+     REQUIRE_FALSE( replay.has_payloads() );
+     REQUIRE( replay.get_payload_size() == 48 );
+     null::RenderApi replay_api{ ProfileType::SingleThreaded };
+     REQUIRE_NOTHROW( replay.run( replay_api ) );
+}
+
+
+TEST_CASE( "Render capture keeps only captured loads without tracking", "[render_capture]" )
+{
+     using namespace _16nar;
+
+     CaptureRenderApi api{ std::make_unique< null::RenderApi >( ProfileType::SingleThreaded ) };
+     Resource before = api.load( ResourceType::Shader, LoadParams< ResourceType::Shader >{} );
+     std::stringstream stream;
+     api.start_capture( stream, 2 );
+     Resource during = api.load( ResourceType::Shader, LoadParams< ResourceType::Shader >{} );
+     api.end_frame();
+     // only resources known to capture are unloaded in it
+     api.unload( before );
+     api.unload( during );
+     api.end_frame();
+
+     RenderReplay replay{ stream };
+     // load during capture, unload and 2 ends of frames
+     REQUIRE( replay.get_record_count() == 4 );
+     null::RenderApi replay_api{ ProfileType::SingleThreaded };
+     REQUIRE_NOTHROW( replay.run( replay_api ) );
+}
+
+
+TEST_CASE( "Malformed render capture is rejected", "[render_capture]" )
+{
+     using namespace _16nar;
+
+     std::stringstream empty;
+     REQUIRE_THROWS( RenderReplay{ empty } );
+
+     CaptureRenderApi api{ std::make_unique< null::RenderApi >( ProfileType::SingleThreaded ) };
+     std::stringstream stream;
+     api.start_capture( stream, 1 );
+     Resource shader = api.load( ResourceType::Shader, LoadParams< ResourceType::Shader >{} );
+     api.get_device().bind_shader( Shader{ shader.id } );
+     api.end_frame();
+
+     std::string data = stream.str();
+     std::stringstream truncated{ data.substr( 0, data.size() - 3 ) };
+     REQUIRE_THROWS( RenderReplay{ truncated } );
+
+     // shader is bound, but its load is cut out of the capture
+     std::size_t load_size = 1 + 8 + 4 + 4 + 8;
+     std::stringstream broken{ data.substr( 0, 13 ) + data.substr( 13 + load_size ) };
+     RenderReplay replay{ broken };
+     null::RenderApi replay_api{ ProfileType::SingleThreaded };
+     REQUIRE_THROWS( replay.run( replay_api ) );
+}
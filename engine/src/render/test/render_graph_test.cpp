@@ -0,0 +1,138 @@
+#include <16nar/render/render_graph.h>
+#include <catch2/catch_test_macros.hpp>
+
+#include <stdexcept>
+#include <vector>
+
+TEST_CASE( "Ordering and culling of render passes", "[render_graph]" )
+{
+     using namespace _16nar;
+
+     RenderGraph graph;
+     RenderTargetDesc desc{ Vec2i{ 320, 240 } };
+     RenderTargetId scene = graph.create_target( desc );
+     RenderTargetId bloom = graph.create_target( desc );
+     RenderTargetId unused = graph.create_target( desc );
+
+     // passes are added out of order, writers must go before readers
+     graph.add_pass( RenderPass{ "compose", { scene, bloom }, { RenderGraph::screen }, {} } );   // 0
+     graph.add_pass( RenderPass{ "bloom", { scene }, { bloom }, {} } );                          // 1
+     graph.add_pass( RenderPass{ "scene", {}, { scene }, {} } );                                 // 2
+     graph.add_pass( RenderPass{ "debug", { scene }, { unused }, {} } );                         // 3
+     graph.compile();
+     REQUIRE( graph.get_order() == std::vector< std::size_t >{ 2, 1, 0 } );
+     REQUIRE_THROWS_AS( graph.get_slot( unused ), std::runtime_error );
+
+     // output target keeps its writer
+     graph.set_output( unused );
+     graph.compile();
+     REQUIRE( graph.get_order() == std::vector< std::size_t >{ 2, 1, 0, 3 } );
+     REQUIRE_NOTHROW( graph.get_slot( unused ) );
+}
+
+
+TEST_CASE( "Writers of the same target keep order", "[render_graph]" )
+{
+     using namespace _16nar;
+
+     RenderGraph graph;
+     RenderTargetId target = graph.create_target( RenderTargetDesc{ Vec2i{ 64, 64 } } );
+     graph.add_pass( RenderPass{ "present", { target }, { RenderGraph::screen }, {} } );
+     graph.add_pass( RenderPass{ "clear", {}, { target }, {} } );
+     graph.add_pass( RenderPass{ "draw", {}, { target }, {} } );
+     graph.add_pass( RenderPass{ "overlay", {}, { RenderGraph::screen }, {} } );
+     graph.compile();
+     REQUIRE( graph.get_order() == std::vector< std::size_t >{ 1, 2, 0, 3 } );
+}
+
+
+TEST_CASE( "Aliasing of transient targets", "[render_graph]" )
+{
+     using namespace _16nar;
+
+     RenderGraph graph;
+     RenderTargetDesc color{ Vec2i{ 128, 128 } };
+     RenderTargetDesc depth{ Vec2i{ 128, 128 }, BufferDataFormat::Depth, DataType::Float };
+     RenderTargetId a = graph.create_target( color );
+     RenderTargetId a_depth = graph.create_target( depth );
+     RenderTargetId b = graph.create_target( color );
+     RenderTargetId c = graph.create_target( color );
+     graph.add_pass( RenderPass{ "a", {}, { a, a_depth }, {} } );
+     graph.add_pass( RenderPass{ "b", { a }, { b }, {} } );
+     graph.add_pass( RenderPass{ "c", { b }, { c }, {} } );
+     graph.add_pass( RenderPass{ "present", { c }, { RenderGraph::screen }, {} } );
+     graph.compile();
+
+     // "a" is not used after pass "b", so "c" takes its texture
+     REQUIRE( graph.get_slot( a ) != graph.get_slot( b ) );
+     REQUIRE( graph.get_slot( b ) != graph.get_slot( c ) );
+     REQUIRE( graph.get_slot( a ) == graph.get_slot( c ) );
+     REQUIRE( graph.get_slot( a_depth ) != graph.get_slot( a ) );
+     REQUIRE( graph.get_pool_size() == 3 );
+
+     // pool is kept when graph is rebuilt
+     graph.clear();
+     RenderTargetId d = graph.create_target( color );
+     graph.add_pass( RenderPass{ "d", {}, { d }, {} } );
+     graph.add_pass( RenderPass{ "present", { d }, { RenderGraph::screen }, {} } );
+     graph.compile();
+     REQUIRE( graph.get_pool_size() == 3 );
+     REQUIRE( graph.get_slot( d ) == 0 );
+
+     // output is never shared
+     graph.clear();
+     RenderTargetId e = graph.create_target( color );
+     RenderTargetId f = graph.create_target( color );
+     graph.add_pass( RenderPass{ "e", {}, { e }, {} } );
+     graph.add_pass( RenderPass{ "f", { e }, { f }, {} } );
+     graph.set_output( f );
+     graph.set_output( e );
+     graph.compile();
+     REQUIRE( graph.get_slot( e ) != graph.get_slot( f ) );
+}
+
+
+TEST_CASE( "Errors of render graph", "[render_graph]" )
+{
+     using namespace _16nar;
+
+     RenderGraph graph;
+     RenderTargetDesc desc{ Vec2i{ 16, 16 } };
+     RenderTargetId a = graph.create_target( desc );
+     RenderTargetId b = graph.create_target( desc );
+     REQUIRE_THROWS_AS( graph.set_output( b + 1 ), std::runtime_error );
+
+     SECTION( "cycle" )
+     {
+          graph.add_pass( RenderPass{ "a", { b }, { a }, {} } );
+          graph.add_pass( RenderPass{ "b", { a }, { b }, {} } );
+          graph.add_pass( RenderPass{ "present", { b }, { RenderGraph::screen }, {} } );
+          REQUIRE_THROWS_AS( graph.compile(), std::runtime_error );
+          REQUIRE( graph.get_order().empty() );
+     }
+     SECTION( "read without writer" )
+     {
+          graph.add_pass( RenderPass{ "present", { a }, { RenderGraph::screen }, {} } );
+          REQUIRE_THROWS_AS( graph.compile(), std::runtime_error );
+     }
+     SECTION( "feedback" )
+     {
+          graph.add_pass( RenderPass{ "a", { a }, { a }, {} } );
+          REQUIRE_THROWS_AS( graph.compile(), std::runtime_error );
+     }
+     SECTION( "screen is read" )
+     {
+          graph.add_pass( RenderPass{ "a", { RenderGraph::screen }, { a }, {} } );
+          REQUIRE_THROWS_AS( graph.compile(), std::runtime_error );
+     }
+     SECTION( "screen with other targets" )
+     {
+          graph.add_pass( RenderPass{ "a", {}, { RenderGraph::screen, a }, {} } );
+          REQUIRE_THROWS_AS( graph.compile(), std::runtime_error );
+     }
+     SECTION( "unknown target" )
+     {
+          graph.add_pass( RenderPass{ "a", {}, { b + 1 }, {} } );
+          REQUIRE_THROWS_AS( graph.compile(), std::runtime_error );
+     }
+}
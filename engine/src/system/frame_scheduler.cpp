@@ -0,0 +1,140 @@
+#include <16nar/system/frame_scheduler.h>
+
+#include <algorithm>
+#include <thread>
+
+namespace
+{
+
+/// @brief Weight of the last frame in average frame time.
+constexpr float average_weight = 0.1f;
+
+
+/// @brief Convert time in seconds to clock duration, at least one tick.
+_16nar::FrameScheduler::Clock::duration to_duration( float seconds ) noexcept
+{
+     using Duration = _16nar::FrameScheduler::Clock::duration;
+     return std::max( std::chrono::round< Duration >( std::chrono::duration< float >( seconds ) ), Duration{ 1 } );
+}
+
+} // anonymous namespace
+
+
+namespace _16nar
+{
+
+FrameScheduler::FrameScheduler( float step, std::size_t max_steps ) noexcept:
+     step_{ to_duration( step ) }, accumulator_{ 0 }, spin_margin_{ std::chrono::milliseconds{ 2 } },
+     frame_start_{ Clock::now() }, max_steps_{ std::max( max_steps, std::size_t{ 1 } ) }, stats_{}
+{}
+
+
+void FrameScheduler::set_step( float step ) noexcept
+{
+     step_ = to_duration( step );
+}
+
+
+float FrameScheduler::get_step() const noexcept
+{
+     return std::chrono::duration< float >( step_ ).count();
+}
+
+
+void FrameScheduler::set_max_steps( std::size_t max_steps ) noexcept
+{
+     max_steps_ = std::max( max_steps, std::size_t{ 1 } );
+}
+
+
+void FrameScheduler::set_spin_margin( float margin ) noexcept
+{
+     spin_margin_ = margin > 0.0f ? to_duration( margin ) : Clock::duration{ 0 };
+}
+
+
+void FrameScheduler::reset() noexcept
+{
+     accumulator_ = Clock::duration{ 0 };
+     frame_start_ = Clock::now();
+     stats_ = FrameStats{};
+}
+
+
+std::size_t FrameScheduler::begin_frame() noexcept
+{
+     auto now = Clock::now();
+     auto elapsed = now - frame_start_;
+     frame_start_ = now;
+     return advance( elapsed );
+}
+
+
+std::size_t FrameScheduler::advance( Clock::duration elapsed ) noexcept
+{
+     float frame_time = std::chrono::duration< float >( elapsed ).count();
+     stats_.frame_count++;
+     stats_.last_frame_time = frame_time;
+     if ( stats_.frame_count == 1 )
+     {
+          stats_.average_frame_time = frame_time;
+          stats_.min_frame_time = frame_time;
+          stats_.max_frame_time = frame_time;
+     }
+     else
+     {
+          stats_.average_frame_time += ( frame_time - stats_.average_frame_time ) * average_weight;
+          stats_.min_frame_time = std::min( stats_.min_frame_time, frame_time );
+          stats_.max_frame_time = std::max( stats_.max_frame_time, frame_time );
+     }
+
+     accumulator_ += std::max( elapsed, Clock::duration{ 0 } );
+     std::size_t steps = static_cast< std::size_t >( accumulator_ / step_ );
+     accumulator_ -= step_ * steps;
+     // time of steps over the limit is dropped, so the game slows down instead of freezing
+     if ( steps > max_steps_ )
+     {
+          stats_.dropped_steps += steps - max_steps_;
+          steps = max_steps_;
+     }
+     stats_.step_count += steps;
+     return steps;
+}
+
+
+float FrameScheduler::get_alpha() const noexcept
+{
+     return std::chrono::duration< float >( accumulator_ ) / std::chrono::duration< float >( step_ );
+}
+
+
+FrameScheduler::Clock::duration FrameScheduler::get_time_to_next_step() const noexcept
+{
+     auto deadline = frame_start_ + ( step_ - accumulator_ );
+     return std::max( deadline - Clock::now(), Clock::duration{ 0 } );
+}
+
+
+void FrameScheduler::wait_next_step() const
+{
+     auto deadline = frame_start_ + ( step_ - accumulator_ );
+     for ( auto now = Clock::now(); now < deadline; now = Clock::now() )
+     {
+          if ( deadline - now > spin_margin_ )
+          {
+               std::this_thread::sleep_for( deadline - now - spin_margin_ );
+          }
+          else
+          {
+               std::this_thread::yield();
+          }
+     }
+}
+
+
+const FrameStats& FrameScheduler::get_stats() const noexcept
+{
+     return stats_;
+}
+
+} // namespace _16nar
@@ -1,4 +1,5 @@
 #include <16nar/system/game_config.h>
+#include <16nar/system/job_system.h>
 
 #include <stdexcept>
 
@@ -35,6 +36,15 @@ NLOHMANN_JSON_SERIALIZE_ENUM( ProfileType, {
      { ProfileType::MultiThreaded,      "multi_threaded" },
 } )
 
+NLOHMANN_JSON_SERIALIZE_ENUM( ThreadPriority, {
+     { ThreadPriority::Inherit,         "inherit" },
+     { ThreadPriority::Lowest,          "lowest" },
+     { ThreadPriority::Low,             "low" },
+     { ThreadPriority::Normal,          "normal" },
+     { ThreadPriority::High,            "high" },
+     { ThreadPriority::Highest,         "highest" },
+} )
+
 
 GameConfig::GameConfig():
      app_data_dir{ "." }, app_dir{ "." }, app_name{},
@@ -42,7 +52,9 @@ GameConfig::GameConfig():
      profile{ ProfileType::Unknown },
      log_level{ ILogWriter::LogLevel::Info },
      resources_format{ tools::PackageFormat::FlatBuffers },
-     resources_unpacked{ false }
+     resources_unpacked{ false },
+     worker_threads{ JobSystem::get_default_worker_count() },
+     worker_priority{ ThreadPriority::Inherit }
 {}
 
 
@@ -52,7 +64,9 @@ GameConfig::GameConfig( const std::string& name ):
      profile{ ProfileType::Unknown },
      log_level{ ILogWriter::LogLevel::Info },
      resources_format{ tools::PackageFormat::FlatBuffers },
-     resources_unpacked{ false }
+     resources_unpacked{ false },
+     worker_threads{ JobSystem::get_default_worker_count() },
+     worker_priority{ ThreadPriority::Inherit }
 {
      app_data_dir = ( get_app_data_dir() / app_name ).string();
      app_dir = get_app_dir().string();
@@ -76,6 +90,11 @@ GameConfig GameConfig::load_json( std::istream& input )
      }
      else
 #endif // NARENGINE_RENDER_OPENGL
+     if ( render_api == "null" )
+     {
+          config.render_api = RenderApiType::Null;
+     }
+     else
      {
           config.render_api = RenderApiType::Unknown;
      }
@@ -84,6 +103,9 @@ GameConfig GameConfig::load_json( std::istream& input )
      config.resources_format = json.at( "resources_format" ). template get< ::_16nar::tools::PackageFormat >();
      config.scene_format = json.at( "scene_format" ). template get< ::_16nar::tools::PackageFormat >();
      config.resources_unpacked = json.at( "resources_unpacked" );
+     // optional, so older configurations remain valid
+     config.worker_threads = json.value( "worker_threads", config.worker_threads );
+     config.worker_priority = json.value( "worker_priority", config.worker_priority );
      return config;
 }
 #endif // NARENGINE_TOOLS_JSON
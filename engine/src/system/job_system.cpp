@@ -0,0 +1,269 @@
+#include <16nar/system/job_system.h>
+
+#include <16nar/system/profiler.h>
+
+#include <algorithm>
+#include <string>
+
+namespace _16nar
+{
+
+namespace
+{
+
+/// @brief Number of subranges per thread in parallel loop, more subranges balance load better.
+constexpr std::size_t chunks_per_thread = 4;
+
+thread_local const JobSystem *current_system = nullptr;     ///< job system of calling worker thread.
+thread_local std::size_t current_index = 0;                  ///< index of calling worker thread.
+
+} // anonymous namespace
+
+
+JobGroup::JobGroup() noexcept:
+     pending_{ 0 }, error_mutex_{}, error_{}
+{}
+
+
+bool JobGroup::is_done() const noexcept
+{
+     return pending_.load( std::memory_order_acquire ) == 0;
+}
+
+
+std::size_t JobSystem::get_default_worker_count() noexcept
+{
+     unsigned int threads = std::thread::hardware_concurrency();
+     return threads > 1 ? threads - 1 : 0;
+}
+
+
+JobSystem::JobSystem( std::size_t worker_count, ThreadPriority worker_priority ):
+     queues_{}, workers_{}, queued_{ 0 }, stop_{ false }, worker_priority_{ worker_priority },
+     sleep_mutex_{}, sleep_cv_{}, wait_cv_{}, waiting_{ 0 }
+{
+     for ( std::size_t i = 0; i <= worker_count; i++ )
+     {
+          queues_.push_back( std::make_unique< TaskQueue >() );
+     }
+     workers_.reserve( worker_count );
+     for ( std::size_t i = 0; i < worker_count; i++ )
+     {
+          workers_.emplace_back( &JobSystem::worker_loop, this, i );
+     }
+}
+
+
+JobSystem::~JobSystem()
+{
+     {
+          std::lock_guard< std::mutex > lock{ sleep_mutex_ };
+          stop_ = true;
+     }
+     sleep_cv_.notify_all();
+     for ( auto& worker : workers_ )
+     {
+          worker.join();
+     }
+     // without workers jobs which were never waited for are executed here
+     Task task;
+     while ( take_task( workers_.size(), task ) )
+     {
+          execute( task );
+     }
+}
+
+
+std::size_t JobSystem::get_worker_count() const noexcept
+{
+     return workers_.size();
+}
+
+
+void JobSystem::submit( JobGroup& group, Job job )
+{
+     group.pending_.fetch_add( 1, std::memory_order_relaxed );
+     // counter is increased before push, so it never goes below zero when task is taken
+     queued_.fetch_add( 1, std::memory_order_release );
+     TaskQueue& queue = *queues_[ get_thread_index() ];
+     {
+          std::lock_guard< std::mutex > lock{ queue.mutex };
+          queue.tasks.push_back( Task{ std::move( job ), &group } );
+     }
+     bool has_waiting = false;
+     {
+          // critical section orders the counter with check of sleeping worker
+          std::lock_guard< std::mutex > lock{ sleep_mutex_ };
+          has_waiting = waiting_ > 0;
+     }
+     if ( !workers_.empty() )
+     {
+          sleep_cv_.notify_one();
+     }
+     if ( has_waiting )
+     {
+          // waiting threads help with new jobs, which may be nested jobs of their groups
+          wait_cv_.notify_all();
+     }
+}
+
+
+void JobSystem::wait( JobGroup& group )
+{
+     std::size_t index = get_thread_index();
+     Task task;
+     while ( !group.is_done() )
+     {
+          if ( take_task( index, task ) )
+          {
+               execute( task );
+               continue;
+          }
+          // jobs of the group are executed by other threads, sleep until the group
+          // is finished or there is a new job to help with
+          std::unique_lock< std::mutex > lock{ sleep_mutex_ };
+          waiting_++;
+          wait_cv_.wait( lock, [ this, &group ]()
+          {
+               return group.is_done() || queued_.load( std::memory_order_acquire ) > 0;
+          } );
+          waiting_--;
+     }
+     std::exception_ptr error;
+     {
+          std::lock_guard< std::mutex > lock{ group.error_mutex_ };
+          std::swap( error, group.error_ );
+     }
+     if ( error )
+     {
+          std::rethrow_exception( error );
+     }
+}
+
+
+bool JobSystem::run_pending()
+{
+     Task task;
+     if ( !take_task( get_thread_index(), task ) )
+     {
+          return false;
+     }
+     execute( task );
+     return true;
+}
+
+
+std::size_t JobSystem::get_default_grain( std::size_t size ) const noexcept
+{
+     std::size_t chunks = ( workers_.size() + 1 ) * chunks_per_thread;
+     return std::max( ( size + chunks - 1 ) / chunks, std::size_t{ 1 } );
+}
+
+
+bool JobSystem::take_task( std::size_t index, Task& task )
+{
+     if ( queued_.load( std::memory_order_acquire ) == 0 )
+     {
+          return false;
+     }
+     std::size_t shared_index = workers_.size();
+     if ( index != shared_index )
+     {
+          // own deque is used as stack
+          TaskQueue& queue = *queues_[ index ];
+          std::lock_guard< std::mutex > lock{ queue.mutex };
+          if ( !queue.tasks.empty() )
+          {
+               task = std::move( queue.tasks.back() );
+               queue.tasks.pop_back();
+               queued_.fetch_sub( 1, std::memory_order_relaxed );
+               return true;
+          }
+     }
+     // shared queue first, then steal the oldest tasks of other workers
+     for ( std::size_t i = 0; i < queues_.size(); i++ )
+     {
+          std::size_t victim = ( shared_index + i ) % queues_.size();
+          if ( victim == index && index != shared_index )
+          {
+               continue;
+          }
+          TaskQueue& queue = *queues_[ victim ];
+          std::lock_guard< std::mutex > lock{ queue.mutex };
+          if ( !queue.tasks.empty() )
+          {
+               task = std::move( queue.tasks.front() );
+               queue.tasks.pop_front();
+               queued_.fetch_sub( 1, std::memory_order_relaxed );
+               return true;
+          }
+     }
+     return false;
+}
+
+
+void JobSystem::execute( Task& task ) noexcept
+{
+     {
+          PROFILE_16NAR_DETAIL( "job" );
+          try
+          {
+               task.job();
+          }
+          catch ( ... )
+          {
+               std::lock_guard< std::mutex > lock{ task.group->error_mutex_ };
+               if ( !task.group->error_ )
+               {
+                    task.group->error_ = std::current_exception();
+               }
+          }
+     }
+     task.job = nullptr;
+     // group may be destroyed by waiting thread right after this
+     if ( task.group->pending_.fetch_sub( 1, std::memory_order_acq_rel ) != 1 )
+     {
+          return;
+     }
+     bool has_waiting = false;
+     {
+          // waiting thread checks the group under the lock, so the notification is not lost
+          std::lock_guard< std::mutex > lock{ sleep_mutex_ };
+          has_waiting = waiting_ > 0;
+     }
+     if ( has_waiting )
+     {
+          wait_cv_.notify_all();
+     }
+}
+
+
+void JobSystem::worker_loop( std::size_t index )
+{
+     current_system = this;
+     current_index = index;
+     apply_thread_settings( ThreadSettings{ "worker " + std::to_string( index ), worker_priority_, 0 } );
+     Task task;
+     while ( true )
+     {
+          if ( take_task( index, task ) )
+          {
+               execute( task );
+               continue;
+          }
+          std::unique_lock< std::mutex > lock{ sleep_mutex_ };
+          sleep_cv_.wait( lock, [ this ](){ return stop_ || queued_.load( std::memory_order_acquire ) > 0; } );
+          if ( stop_ && queued_.load( std::memory_order_acquire ) == 0 )
+          {
+               break;
+          }
+     }
+}
+
+
+std::size_t JobSystem::get_thread_index() const noexcept
+{
+     return current_system == this ? current_index : workers_.size();
+}
+
+} // namespace _16nar
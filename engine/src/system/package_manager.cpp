@@ -1,8 +1,10 @@
 #include <16nar/system/package_manager.h>
 
 #include <16nar/render/irender_api.h>
+#include <16nar/render/render_defs.h>
 #include <16nar/logger/logger.h>
 #include <16nar/system/exceptions.h>
+#include <16nar/system/profiler.h>
 #include <16nar/game.h>
 
 #include <fstream>
@@ -13,7 +15,7 @@ namespace _16nar
 {
 
 PackageManager::PackageManager( std::unique_ptr< tools::IAssetReader >&& reader ):
-     resources_{}, names_{}, packages_{}, pkg_dir_{},
+     resources_{}, names_{}, regions_{}, packages_{}, pkg_dir_{},
      reader_{ std::move( reader ) }, unpacked_mode_{ false }
 {}
 
@@ -26,6 +28,7 @@ PackageManager::~PackageManager()
 
 bool PackageManager::load_package( const std::string& name )
 {
+     PROFILE_16NAR_MAIN( "PackageManager::load_package" );
      if ( is_package_loaded( name ) )
      {
           LOG_16NAR_DEBUG( "Package '" << name << "' is already loaded" );
@@ -51,6 +54,7 @@ bool PackageManager::load_package( const std::string& name )
      bool ok = true;
      ResourceMap loaded;
      NameMap loaded_names;
+     RegionMap loaded_regions;
      tools::PackageData pkg{};
      try
      {
@@ -63,46 +67,24 @@ bool PackageManager::load_package( const std::string& name )
           return false;
      }
      auto& render_api = get_game().get_render_api();
+     std::vector< const tools::ResourceData * > materials;
      for ( const auto& load_data : pkg.resources )
      {
-          if ( loaded.find( load_data.name ) != loaded.cend() )
+          if ( load_data.type == ResourceType::Material || load_data.type == ResourceType::Atlas )
           {
-               LOG_16NAR_ERROR( "Asset '" << load_data.name << "' from package '"
-                    << name << "' has duplicate name" );
-               ok = false;
-               break;
-          }
-          Resource resource{};
-          try
-          {
-               resource = render_api.load( load_data.type, load_data.params );
-          }
-          catch ( const ResourceException& ex )
-          {
-               LOG_16NAR_ERROR( "Error loading asset '" << load_data.name << "' from package '"
-                    << name << "': " << ex.what() );
-               ok = false;
-               break;
-          }
-          std::string full_name = name + "/" + load_data.name;
-          auto [ new_iter, insert_ok ] = loaded.emplace( full_name, resource );
-          if ( !insert_ok )
-          {
-               LOG_16NAR_ERROR( "Asset '" << load_data.name << "' from package '"
-                    << name << "' cannot be saved" );
-               render_api.unload( resource );
-               ok = false;
-               break;
+               // materials and atlases refer to other resources of the package, so they are loaded last
+               materials.push_back( &load_data );
           }
-          if ( !loaded_names.emplace( resource, new_iter ).second )
+          else if ( !load_resource( name, load_data, loaded, loaded_names, loaded_regions ) )
           {
-               LOG_16NAR_ERROR( "Asset name '" << load_data.name << "' from package '"
-                    << name << "' cannot be saved" );
-               // unload will happen later because ok is false
                ok = false;
                break;
           }
      }
+     for ( std::size_t i = 0; ok && i < materials.size(); i++ )
+     {
+          ok = load_resource( name, *materials[ i ], loaded, loaded_names, loaded_regions );
+     }
      if ( ok && !packages_.emplace( name ).second )
      {
           LOG_16NAR_ERROR( "Package '" << name << "' cannot be saved" );
@@ -112,6 +94,7 @@ bool PackageManager::load_package( const std::string& name )
      {
           resources_.merge( loaded );
           names_.merge( loaded_names );
+          regions_.merge( loaded_regions );
           LOG_16NAR_INFO( "Package '" << name << "' loaded successfully" );
      }
      else
@@ -149,6 +132,10 @@ void PackageManager::unload_package( const std::string& name )
                ++iter;
           }
      }
+     for ( auto iter = regions_.cbegin(); iter != regions_.cend(); /* skip ++iter due to erase */ )
+     {
+          iter = ( iter->first.find( prefix ) == 0 ) ? regions_.erase( iter ) : std::next( iter );
+     }
      packages_.erase( pkg_iter );
      LOG_16NAR_INFO( "Package '" << name << "' unloaded successfully" );
 }
@@ -162,7 +149,7 @@ bool PackageManager::is_package_loaded( const std::string& name ) const
 
 bool PackageManager::is_resource_loaded( const std::string& name ) const
 {
-     return resources_.find( name ) != resources_.cend();
+     return resources_.find( name ) != resources_.cend() || regions_.find( name ) != regions_.cend();
 }
 
 
@@ -181,18 +168,43 @@ void PackageManager::set_package_dir( const std::string& dirname )
 Resource PackageManager::get_resource( const std::string& name ) const
 {
      auto iter = resources_.find( name );
-     if ( iter == resources_.cend() )
+     if ( iter != resources_.cend() )
+     {
+          return iter->second;
+     }
+     if ( regions_.find( name ) != regions_.cend() )
      {
-          LOG_16NAR_ERROR( "No such resource '" << name << "'" );
+          // whole page would be drawn instead of the sub-image
+          LOG_16NAR_ERROR( "Resource '" << name << "' is a sub-image of an atlas, it is got only as texture region" );
           return Resource{};
      }
-     return iter->second;
+     LOG_16NAR_ERROR( "No such resource '" << name << "'" );
+     return Resource{};
+}
+
+
+TextureRegion PackageManager::get_texture_region( const std::string& name ) const
+{
+     auto region_iter = regions_.find( name );
+     if ( region_iter != regions_.cend() )
+     {
+          return region_iter->second;
+     }
+     TextureRegion region{};
+     auto iter = resources_.find( name );
+     if ( iter == resources_.cend() || iter->second.type != ResourceType::Texture )
+     {
+          LOG_16NAR_ERROR( "No such texture '" << name << "'" );
+          return region;
+     }
+     region.texture = iter->second.id;
+     return region;
 }
 
 
 void PackageManager::clear()
 {
-     if ( resources_.empty() && names_.empty()
+     if ( resources_.empty() && names_.empty() && regions_.empty()
           && packages_.empty() && pkg_dir_.empty() )
      {
           return;
@@ -206,6 +218,7 @@ void PackageManager::clear()
           iter = resources_.erase( iter );
      }
      names_.clear();
+     regions_.clear();
      packages_.clear();
      pkg_dir_.clear();
      LOG_16NAR_INFO( "All resource packages unloaded successfully" );
@@ -218,6 +231,8 @@ bool PackageManager::load_unpacked( const std::string& dirname )
      bool ok = true;
      ResourceMap loaded;
      NameMap loaded_names;
+     RegionMap loaded_regions;
+     std::vector< tools::ResourceData > materials;
      auto& render_api = get_game().get_render_api();
      std::string path{ dirname };
      if ( !pkg_dir_.empty() )
@@ -241,7 +256,6 @@ bool PackageManager::load_unpacked( const std::string& dirname )
           }
 
           tools::ResourceData load_data{};
-          Resource resource{};
           try
           {
                load_data = reader_->read_asset( ifs );
@@ -253,43 +267,21 @@ bool PackageManager::load_unpacked( const std::string& dirname )
                ok = false;
                break;
           }
-          if ( loaded.find( load_data.name ) != loaded.cend() )
-          {
-               LOG_16NAR_ERROR( "Asset '" << dir_entry.path() << "' from package '"
-                    << dirname << "' has duplicate name" );
-               ok = false;
-               break;
-          }
-          try
-          {
-               resource = render_api.load( load_data.type, load_data.params );
-          }
-          catch ( const ResourceException& ex )
-          {
-               LOG_16NAR_ERROR( "Error loading asset '" << load_data.name << "' from package '"
-                    << dirname << "': " << ex.what() );
-               ok = false;
-               break;
-          }
-          std::string full_path = dirname + '/' + load_data.name;
-          auto [ new_iter, insert_ok ] = loaded.emplace( full_path, resource );
-          if ( !insert_ok )
+          if ( load_data.type == ResourceType::Material || load_data.type == ResourceType::Atlas )
           {
-               LOG_16NAR_ERROR( "Asset '" << load_data.name << "' from package '"
-                    << dirname << "' cannot be saved" );
-               render_api.unload( resource );
-               ok = false;
-               break;
+               // materials and atlases refer to other resources of the package, so they are loaded last
+               materials.push_back( std::move( load_data ) );
           }
-          if ( !loaded_names.emplace( resource, new_iter ).second )
+          else if ( !load_resource( dirname, load_data, loaded, loaded_names, loaded_regions ) )
           {
-               LOG_16NAR_ERROR( "Asset '" << load_data.name << "' from package '"
-                    << dirname << "' cannot be saved" );
-               // unload will happen later because ok is false
                ok = false;
                break;
           }
      }
+     for ( std::size_t i = 0; ok && i < materials.size(); i++ )
+     {
+          ok = load_resource( dirname, materials[ i ], loaded, loaded_names, loaded_regions );
+     }
      if ( ok && !packages_.emplace( dirname ).second )
      {
           LOG_16NAR_ERROR( "Package '" << dirname << "' cannot be saved" );
@@ -299,6 +291,7 @@ bool PackageManager::load_unpacked( const std::string& dirname )
      {
           resources_.merge( loaded );
           names_.merge( loaded_names );
+          regions_.merge( loaded_regions );
           LOG_16NAR_INFO( "Package '" << dirname << "' (unpacked) loaded successfully" );
      }
      else
@@ -312,4 +305,136 @@ bool PackageManager::load_unpacked( const std::string& dirname )
      return ok;
 }
 
+
+bool PackageManager::load_resource( const std::string& package, const tools::ResourceData& load_data,
+     ResourceMap& loaded, NameMap& loaded_names, RegionMap& loaded_regions ) const
+{
+     std::string full_name = package + '/' + load_data.name;
+     if ( loaded.find( full_name ) != loaded.cend() )
+     {
+          LOG_16NAR_ERROR( "Asset '" << load_data.name << "' from package '"
+               << package << "' has duplicate name" );
+          return false;
+     }
+     if ( load_data.type == ResourceType::Atlas )
+     {
+          try
+          {
+               load_atlas( package, load_data, loaded, loaded_regions );
+          }
+          catch ( const ResourceException& ex )
+          {
+               LOG_16NAR_ERROR( "Error loading atlas '" << load_data.name << "' from package '"
+                    << package << "': " << ex.what() );
+               return false;
+          }
+          return true;
+     }
+     auto& render_api = get_game().get_render_api();
+     Resource resource{};
+     try
+     {
+          if ( load_data.type == ResourceType::Material )
+          {
+               resource = render_api.load( load_data.type, resolve_material( package, load_data, loaded ) );
+          }
+          else
+          {
+               resource = render_api.load( load_data.type, load_data.params );
+          }
+     }
+     catch ( const ResourceException& ex )
+     {
+          LOG_16NAR_ERROR( "Error loading asset '" << load_data.name << "' from package '"
+               << package << "': " << ex.what() );
+          return false;
+     }
+     auto [ new_iter, insert_ok ] = loaded.emplace( full_name, resource );
+     if ( !insert_ok )
+     {
+          LOG_16NAR_ERROR( "Asset '" << load_data.name << "' from package '"
+               << package << "' cannot be saved" );
+          render_api.unload( resource );
+          return false;
+     }
+     if ( !loaded_names.emplace( resource, new_iter ).second )
+     {
+          LOG_16NAR_ERROR( "Asset name '" << load_data.name << "' from package '"
+               << package << "' cannot be saved" );
+          // unload will happen later, with all resources of the package
+          return false;
+     }
+     return true;
+}
+
+
+void PackageManager::load_atlas( const std::string& package, const tools::ResourceData& load_data,
+     const ResourceMap& loaded, RegionMap& loaded_regions ) const
+{
+     const auto *params_ptr = std::any_cast< LoadParams< ResourceType::Atlas > >( &load_data.params );
+     if ( !params_ptr )
+     {
+          throw ResourceException{ "wrong atlas load parameters" };
+     }
+     std::vector< Texture > pages;
+     for ( const auto& page_name : params_ptr->page_names )
+     {
+          pages.emplace_back( find_package_resource( package, page_name, ResourceType::Texture, loaded ) );
+     }
+     for ( const auto& region : params_ptr->regions )
+     {
+          if ( region.page >= pages.size() )
+          {
+               throw ResourceException{ "sub-image '" + region.name + "' refers to missing page" };
+          }
+          std::string full_name = package + '/' + region.name;
+          if ( loaded.find( full_name ) != loaded.cend() || resources_.find( full_name ) != resources_.cend()
+               || !loaded_regions.emplace( full_name,
+                    TextureRegion{ pages[ region.page ], region.position, region.size, region.rotated } ).second )
+          {
+               throw ResourceException{ "sub-image '" + region.name + "' has duplicate name" };
+          }
+     }
+}
+
+
+ResID PackageManager::find_package_resource( const std::string& package, const std::string& name,
+     ResourceType type, const ResourceMap& loaded ) const
+{
+     std::string full_name = ( name.find( '/' ) == std::string::npos ) ? package + '/' + name : name;
+     const auto& source = ( loaded.find( full_name ) != loaded.cend() ) ? loaded : resources_;
+     const auto iter = source.find( full_name );
+     if ( iter == source.cend() || iter->second.type != type )
+     {
+          throw ResourceException{ "no resource of required type with name '" + full_name + "'" };
+     }
+     return iter->second.id;
+}
+
+
+LoadParams< ResourceType::Material > PackageManager::resolve_material( const std::string& package,
+     const tools::ResourceData& load_data, const ResourceMap& loaded ) const
+{
+     const auto *params_ptr = std::any_cast< LoadParams< ResourceType::Material > >( &load_data.params );
+     if ( !params_ptr )
+     {
+          throw ResourceException{ "wrong material load parameters" };
+     }
+     LoadParams< ResourceType::Material > params = *params_ptr;
+     params.shader = find_package_resource( package, params.shader_name, ResourceType::Shader, loaded );
+     params.textures.clear();
+     for ( const auto& texture_name : params.texture_names )
+     {
+          params.textures.emplace_back(
+               find_package_resource( package, texture_name, ResourceType::Texture, loaded ) );
+     }
+     params.texture_arrays.clear();
+     for ( const auto& array_name : params.texture_array_names )
+     {
+          params.texture_arrays.emplace_back(
+               find_package_resource( package, array_name, ResourceType::TextureArray, loaded ) );
+     }
+     return params;
+}
+
 } // namespace _16nar
@@ -0,0 +1,286 @@
+#include <16nar/system/profiler.h>
+
+#include <new>
+#include <string>
+
+namespace
+{
+
+/// @brief Get time point in nanoseconds.
+int64_t to_ns( std::chrono::steady_clock::time_point time ) noexcept
+{
+     return std::chrono::duration_cast< std::chrono::nanoseconds >( time.time_since_epoch() ).count();
+}
+
+
+/// @brief Write string as content of JSON string.
+void write_escaped( std::ostream& output, std::string_view str )
+{
+     constexpr char hex[] = "0123456789abcdef";
+     for ( char c : str )
+     {
+          if ( c == '"' || c == '\\' )
+          {
+               output << '\\' << c;
+          }
+          else if ( static_cast< unsigned char >( c ) < 0x20 )
+          {
+               output << "\\u00" << hex[ ( c >> 4 ) & 0xf ] << hex[ c & 0xf ];
+          }
+          else
+          {
+               output << c;
+          }
+     }
+}
+
+
+/// @brief Write time in microseconds with fraction, independently of stream locale.
+void write_microseconds( std::ostream& output, int64_t ns )
+{
+     output << ns / 1000 << '.' << static_cast< char >( '0' + ns % 1000 / 100 )
+          << static_cast< char >( '0' + ns % 100 / 10 ) << static_cast< char >( '0' + ns % 10 );
+}
+
+} // anonymous namespace
+
+
+namespace _16nar
+{
+
+/// @brief Zones written by one thread.
+struct Profiler::ThreadBuffer
+{
+     /// @brief Finished zone.
+     struct Zone
+     {
+          const char *name;        ///< name of the zone.
+          int64_t begin;           ///< start time, in nanoseconds.
+          int64_t end;             ///< end time, in nanoseconds.
+     };
+
+     std::unique_ptr< Zone[] > zones;                  ///< zones of current capture, allocated on first write.
+     std::atomic< std::size_t > count{ 0 };            ///< number of written zones.
+     std::atomic< std::size_t > dropped{ 0 };          ///< number of zones which did not fit.
+     std::atomic< uint32_t > capture{ 0 };             ///< index of capture the zones belong to.
+     uint32_t thread_id = 0;                           ///< identifier of the thread in trace.
+     std::string name;                                 ///< name of the thread.
+};
+
+
+/// @brief Owner of buffer of a thread, returns the buffer to profiler when the thread exits.
+struct Profiler::ThreadBufferOwner
+{
+     ThreadBuffer *buffer = nullptr;                   ///< buffer of the thread.
+
+     /// @brief Destructor, releases the buffer.
+     ~ThreadBufferOwner()
+     {
+          if ( buffer )
+          {
+               Profiler::instance().release_thread_buffer( buffer );
+          }
+     }
+};
+
+
+Profiler& Profiler::instance()
+{
+     static Profiler profiler{};
+     return profiler;
+}
+
+
+void Profiler::start() noexcept
+{
+     std::lock_guard< std::mutex > lock{ mutex_ };
+     start_time_.store( to_ns( std::chrono::steady_clock::now() ), std::memory_order_relaxed );
+     capture_.fetch_add( 1, std::memory_order_relaxed );
+     enabled_.store( true, std::memory_order_release );
+}
+
+
+void Profiler::stop() noexcept
+{
+     enabled_.store( false, std::memory_order_release );
+}
+
+
+bool Profiler::is_enabled() const noexcept
+{
+     return enabled_.load( std::memory_order_acquire );
+}
+
+
+void Profiler::set_thread_name( std::string_view name )
+{
+     ThreadBuffer *buffer = get_thread_buffer();
+     if ( buffer )
+     {
+          std::lock_guard< std::mutex > lock{ mutex_ };
+          buffer->name = std::string{ name };
+     }
+}
+
+
+void Profiler::add_zone( const char *name, std::chrono::steady_clock::time_point begin,
+     std::chrono::steady_clock::time_point end ) noexcept
+{
+     if ( !is_enabled() )
+     {
+          return;
+     }
+     int64_t begin_ns = to_ns( begin );
+     if ( begin_ns < start_time_.load( std::memory_order_relaxed ) )
+     {
+          return;
+     }
+     ThreadBuffer *buffer = get_thread_buffer();
+     if ( !buffer )
+     {
+          return;
+     }
+     // only the owner thread writes to its buffer, so it resets zones of previous capture itself
+     uint32_t capture = capture_.load( std::memory_order_relaxed );
+     if ( buffer->capture.load( std::memory_order_relaxed ) != capture )
+     {
+          buffer->count.store( 0, std::memory_order_relaxed );
+          buffer->dropped.store( 0, std::memory_order_relaxed );
+          buffer->capture.store( capture, std::memory_order_release );
+     }
+     if ( !buffer->zones )
+     {
+          buffer->zones.reset( new ( std::nothrow ) ThreadBuffer::Zone[ zones_per_thread ] );
+     }
+     std::size_t count = buffer->count.load( std::memory_order_relaxed );
+     if ( !buffer->zones || count >= zones_per_thread )
+     {
+          buffer->dropped.fetch_add( 1, std::memory_order_relaxed );
+          return;
+     }
+     buffer->zones[ count ] = ThreadBuffer::Zone{ name, begin_ns, to_ns( end ) };
+     buffer->count.store( count + 1, std::memory_order_release );
+}
+
+
+std::size_t Profiler::get_zone_count() const noexcept
+{
+     std::lock_guard< std::mutex > lock{ mutex_ };
+     uint32_t capture = capture_.load( std::memory_order_relaxed );
+     std::size_t result = 0;
+     for ( const auto& buffer : buffers_ )
+     {
+          if ( buffer->capture.load( std::memory_order_acquire ) == capture )
+          {
+               result += buffer->count.load( std::memory_order_acquire ) + buffer->dropped.load( std::memory_order_relaxed );
+          }
+     }
+     return result;
+}
+
+
+std::size_t Profiler::get_dropped_count() const noexcept
+{
+     std::lock_guard< std::mutex > lock{ mutex_ };
+     uint32_t capture = capture_.load( std::memory_order_relaxed );
+     std::size_t result = 0;
+     for ( const auto& buffer : buffers_ )
+     {
+          if ( buffer->capture.load( std::memory_order_acquire ) == capture )
+          {
+               result += buffer->dropped.load( std::memory_order_relaxed );
+          }
+     }
+     return result;
+}
+
+
+void Profiler::write_chrome_trace( std::ostream& output ) const
+{
+     std::lock_guard< std::mutex > lock{ mutex_ };
+     uint32_t capture = capture_.load( std::memory_order_relaxed );
+     int64_t start_time = start_time_.load( std::memory_order_relaxed );
+     bool first = true;
+     output << "{\"traceEvents\":[";
+     for ( const auto& buffer : buffers_ )
+     {
+          if ( !buffer->name.empty() )
+          {
+               output << ( first ? "\n" : ",\n" ) << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":"
+                    << buffer->thread_id << ",\"args\":{\"name\":\"";
+               write_escaped( output, buffer->name );
+               output << "\"}}";
+               first = false;
+          }
+          if ( buffer->capture.load( std::memory_order_acquire ) != capture )
+          {
+               continue;
+          }
+          std::size_t count = buffer->count.load( std::memory_order_acquire );
+          for ( std::size_t i = 0; i < count; i++ )
+          {
+               const auto& zone = buffer->zones[ i ];
+               output << ( first ? "\n" : ",\n" ) << "{\"name\":\"";
+               write_escaped( output, zone.name );
+               output << "\",\"cat\":\"16nar\",\"ph\":\"X\",\"ts\":";
+               write_microseconds( output, zone.begin - start_time );
+               output << ",\"dur\":";
+               write_microseconds( output, zone.end - zone.begin );
+               output << ",\"pid\":1,\"tid\":" << buffer->thread_id << "}";
+               first = false;
+          }
+     }
+     output << "\n],\"displayTimeUnit\":\"ms\"}\n";
+}
+
+
+Profiler::ThreadBuffer *Profiler::get_thread_buffer() noexcept
+{
+     thread_local ThreadBufferOwner owner{};
+     if ( owner.buffer )
+     {
+          return owner.buffer;
+     }
+     try
+     {
+          std::lock_guard< std::mutex > lock{ mutex_ };
+          if ( !free_buffers_.empty() )
+          {
+               // thread identifier is reused as well, zones of threads do not overlap in time
+               owner.buffer = free_buffers_.back();
+               free_buffers_.pop_back();
+               owner.buffer->name.clear();
+               return owner.buffer;
+          }
+          auto created = std::make_unique< ThreadBuffer >();
+          created->thread_id = static_cast< uint32_t >( buffers_.size() + 1 );
+          free_buffers_.reserve( buffers_.size() + 1 );   // release must not allocate
+          buffers_.push_back( std::move( created ) );
+          owner.buffer = buffers_.back().get();
+     }
+     catch ( const std::exception& ) {}
+     return owner.buffer;
+}
+
+
+void Profiler::release_thread_buffer( ThreadBuffer *buffer ) noexcept
+{
+     std::lock_guard< std::mutex > lock{ mutex_ };
+     free_buffers_.push_back( buffer );
+}
+
+
+ProfileZone::ProfileZone( const char *name ) noexcept:
+     name_{ Profiler::instance().is_enabled() ? name : nullptr }, begin_{ std::chrono::steady_clock::now() }
+{}
+
+
+ProfileZone::~ProfileZone()
+{
+     if ( name_ )
+     {
+          Profiler::instance().add_zone( name_, begin_, std::chrono::steady_clock::now() );
+     }
+}
+
+} // namespace _16nar
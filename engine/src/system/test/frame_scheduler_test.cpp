@@ -0,0 +1,73 @@
+#include <16nar/system/frame_scheduler.h>
+#include <catch2/catch_test_macros.hpp>
+
+#include <cmath>
+
+#ifndef TEST_PRECISION
+#    define TEST_PRECISION 0.0001f
+#endif
+
+using namespace std::chrono_literals;
+
+TEST_CASE( "Frame scheduler accumulates time for fixed steps", "[frame_scheduler]" )
+{
+     using namespace _16nar;
+
+     FrameScheduler scheduler{ 0.01f, 3 };
+     REQUIRE( std::fabs( scheduler.get_step() - 0.01f ) <= TEST_PRECISION );
+     REQUIRE( scheduler.advance( 4ms ) == 0 );
+     REQUIRE( std::fabs( scheduler.get_alpha() - 0.4f ) <= TEST_PRECISION );
+
+     // time left from previous frames is not lost
+     REQUIRE( scheduler.advance( 7ms ) == 1 );
+     REQUIRE( std::fabs( scheduler.get_alpha() - 0.1f ) <= TEST_PRECISION );
+     REQUIRE( scheduler.advance( 25ms ) == 2 );
+     REQUIRE( std::fabs( scheduler.get_alpha() - 0.6f ) <= TEST_PRECISION );
+
+     const auto& stats = scheduler.get_stats();
+     REQUIRE( stats.frame_count == 3 );
+     REQUIRE( stats.step_count == 3 );
+     REQUIRE( stats.dropped_steps == 0 );
+     REQUIRE( std::fabs( stats.last_frame_time - 0.025f ) <= TEST_PRECISION );
+     REQUIRE( std::fabs( stats.min_frame_time - 0.004f ) <= TEST_PRECISION );
+     REQUIRE( std::fabs( stats.max_frame_time - 0.025f ) <= TEST_PRECISION );
+     REQUIRE( stats.average_frame_time > stats.min_frame_time );
+     REQUIRE( stats.average_frame_time < stats.max_frame_time );
+}
+
+
+TEST_CASE( "Frame scheduler limits catch-up steps", "[frame_scheduler]" )
+{
+     using namespace _16nar;
+
+     FrameScheduler scheduler{ 0.01f, 3 };
+     REQUIRE( scheduler.advance( 105ms ) == 3 );
+     REQUIRE( scheduler.get_stats().dropped_steps == 7 );
+     // only part of the step is kept after long frame
+     REQUIRE( std::fabs( scheduler.get_alpha() - 0.5f ) <= TEST_PRECISION );
+     REQUIRE( scheduler.advance( 5ms ) == 1 );
+     REQUIRE( std::fabs( scheduler.get_alpha() ) <= TEST_PRECISION );
+
+     scheduler.set_max_steps( 0 );
+     REQUIRE( scheduler.advance( 50ms ) == 1 );
+     scheduler.reset();
+     REQUIRE( scheduler.get_stats().frame_count == 0 );
+     REQUIRE( scheduler.get_alpha() == 0.0f );
+}
+
+
+TEST_CASE( "Frame scheduler waits until the next step", "[frame_scheduler]" )
+{
+     using namespace _16nar;
+
+     FrameScheduler scheduler{ 0.02f };
+     scheduler.set_spin_margin( 0.005f );
+     scheduler.reset();
+     REQUIRE( scheduler.get_time_to_next_step() > 10ms );
+     auto start = FrameScheduler::Clock::now();
+     scheduler.wait_next_step();
+     REQUIRE( FrameScheduler::Clock::now() - start >= 15ms );
+     REQUIRE( scheduler.get_time_to_next_step() == FrameScheduler::Clock::duration{ 0 } );
+     REQUIRE( scheduler.begin_frame() == 1 );
+     REQUIRE( scheduler.get_stats().last_frame_time >= 0.02f );
+}
@@ -0,0 +1,94 @@
+#include <16nar/system/job_system.h>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+/// @brief Get worker counts for scaling benchmark, up to number of hardware threads.
+std::vector< std::size_t > get_worker_counts()
+{
+     std::vector< std::size_t > counts{ 0 };
+     std::size_t max_count = _16nar::JobSystem::get_default_worker_count();
+     for ( std::size_t count = 1; count < max_count; count *= 2 )
+     {
+          counts.push_back( count );
+     }
+     if ( max_count > 0 )
+     {
+          counts.push_back( max_count );
+     }
+     return counts;
+}
+
+} // anonymous namespace
+
+
+TEST_CASE( "Job system scheduling overhead benchmark", "[job_system][!benchmark]" )
+{
+     using namespace _16nar;
+
+     JobSystem jobs{ JobSystem::get_default_worker_count() };
+     BENCHMARK( "submit and wait 1 empty job" )
+     {
+          JobGroup group;
+          jobs.submit( group, [](){} );
+          jobs.wait( group );
+          return group.is_done();
+     };
+     BENCHMARK( "submit and wait 10000 empty jobs" )
+     {
+          JobGroup group;
+          for ( int i = 0; i < 10'000; i++ )
+          {
+               jobs.submit( group, [](){} );
+          }
+          jobs.wait( group );
+          return group.is_done();
+     };
+     BENCHMARK( "nested fork/join 100x100 empty jobs" )
+     {
+          JobGroup outer;
+          for ( int i = 0; i < 100; i++ )
+          {
+               jobs.submit( outer, [ &jobs ]()
+               {
+                    JobGroup inner;
+                    for ( int j = 0; j < 100; j++ )
+                    {
+                         jobs.submit( inner, [](){} );
+                    }
+                    jobs.wait( inner );
+               } );
+          }
+          jobs.wait( outer );
+          return outer.is_done();
+     };
+}
+
+
+TEST_CASE( "Job system parallel loop scaling benchmark", "[job_system][!benchmark]" )
+{
+     using namespace _16nar;
+
+     std::vector< float > values( 1'000'000, 1.0f );
+     for ( std::size_t workers : get_worker_counts() )
+     {
+          JobSystem jobs{ workers };
+          BENCHMARK( "parallel_for 1000000 values, " + std::to_string( workers ) + " workers" )
+          {
+               jobs.parallel_for( 0, values.size(), 0, [ &values ]( std::size_t begin, std::size_t end )
+               {
+                    for ( std::size_t i = begin; i < end; i++ )
+                    {
+                         values[ i ] = std::sqrt( values[ i ] * 1.5f + 0.5f );
+                    }
+               } );
+               return values[ 0 ];
+          };
+     }
+}
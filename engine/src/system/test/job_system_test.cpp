@@ -0,0 +1,146 @@
+#include <16nar/system/job_system.h>
+#include <catch2/catch_test_macros.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#ifdef __linux__
+#    include <sys/resource.h>
+#    include <sys/syscall.h>
+#    include <unistd.h>
+#endif
+
+TEST_CASE( "Job system executes all jobs of a group", "[job_system]" )
+{
+     using namespace _16nar;
+
+     for ( std::size_t workers : { 0, 1, 4 } )
+     {
+          JobSystem jobs{ workers };
+          REQUIRE( jobs.get_worker_count() == workers );
+          JobGroup group;
+          REQUIRE( group.is_done() );
+          std::atomic_size_t counter{ 0 };
+          for ( int i = 0; i < 1000; i++ )
+          {
+               jobs.submit( group, [ &counter ](){ counter++; } );
+          }
+          jobs.wait( group );
+          REQUIRE( group.is_done() );
+          REQUIRE( counter == 1000 );
+     }
+}
+
+
+TEST_CASE( "Job system runs nested jobs and rethrows exceptions", "[job_system]" )
+{
+     using namespace _16nar;
+
+     JobSystem jobs{ 2 };
+     JobGroup outer;
+     std::atomic_size_t counter{ 0 };
+     for ( int i = 0; i < 8; i++ )
+     {
+          // jobs submitted from worker go to its own deque and may be stolen
+          jobs.submit( outer, [ &jobs, &counter ]()
+          {
+               JobGroup inner;
+               for ( int j = 0; j < 8; j++ )
+               {
+                    jobs.submit( inner, [ &counter ](){ counter++; } );
+               }
+               jobs.wait( inner );
+          } );
+     }
+     jobs.wait( outer );
+     REQUIRE( counter == 64 );
+
+     JobGroup failing;
+     jobs.submit( failing, [](){ throw std::runtime_error{ "job error" }; } );
+     jobs.submit( failing, [ &counter ](){ counter++; } );
+     REQUIRE_THROWS_AS( jobs.wait( failing ), std::runtime_error );
+     REQUIRE( counter == 65 );
+     // exception is reported only once
+     REQUIRE_NOTHROW( jobs.wait( failing ) );
+}
+
+
+TEST_CASE( "Job system parallel loop covers the whole range", "[job_system]" )
+{
+     using namespace _16nar;
+
+     JobSystem jobs{ 3 };
+     std::vector< int > visits( 10'007, 0 );
+     jobs.parallel_for( 0, visits.size(), 0, [ &visits ]( std::size_t begin, std::size_t end )
+     {
+          for ( std::size_t i = begin; i < end; i++ )
+          {
+               visits[ i ]++;
+          }
+     } );
+     for ( int visit : visits )
+     {
+          REQUIRE( visit == 1 );
+     }
+
+     std::atomic_size_t calls{ 0 };
+     jobs.parallel_for( 5, 5, 1, [ &calls ]( std::size_t, std::size_t ){ calls++; } );
+     REQUIRE( calls == 0 );
+     jobs.parallel_for( 0, 10, 3, [ &calls ]( std::size_t, std::size_t ){ calls++; } );
+     REQUIRE( calls == 4 );
+
+     REQUIRE_FALSE( jobs.run_pending() );
+}
+
+
+TEST_CASE( "Job system waits for jobs taken by workers", "[job_system]" )
+{
+     using namespace _16nar;
+
+     JobSystem jobs{ 2 };
+     JobGroup group;
+     std::atomic_size_t counter{ 0 };
+     for ( int i = 0; i < 4; i++ )
+     {
+          jobs.submit( group, [ &counter ]()
+          {
+               std::this_thread::sleep_for( std::chrono::milliseconds{ 20 } );
+               counter++;
+          } );
+     }
+     // waiting thread sleeps while workers finish the last jobs, and wakes up when group is done
+     jobs.wait( group );
+     REQUIRE( group.is_done() );
+     REQUIRE( counter == 4 );
+}
+
+
+#ifdef __linux__
+TEST_CASE( "Job system workers inherit priority by default", "[job_system]" )
+{
+     using namespace _16nar;
+
+     auto get_nice = [](){ return getpriority( PRIO_PROCESS, static_cast< id_t >( syscall( SYS_gettid ) ) ); };
+     int creator_nice = 0;
+     int worker_nice = 0;
+     // lowering priority does not need privileges, and thread does not affect other tests
+     std::thread creator{ [ & ]()
+     {
+          setpriority( PRIO_PROCESS, static_cast< id_t >( syscall( SYS_gettid ) ), get_nice() + 3 );
+          creator_nice = get_nice();
+          JobSystem jobs{ 1 };
+          JobGroup group;
+          jobs.submit( group, [ & ](){ worker_nice = get_nice(); } );
+          while ( !group.is_done() )
+          {
+               std::this_thread::yield();   // job must be executed by the worker, not by this thread
+          }
+          jobs.wait( group );
+     } };
+     creator.join();
+     REQUIRE( worker_nice == creator_nice );
+}
+#endif
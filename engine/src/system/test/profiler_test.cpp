@@ -0,0 +1,137 @@
+#include <16nar/system/profiler.h>
+#include <catch2/catch_test_macros.hpp>
+
+#include <sstream>
+#include <string>
+#include <thread>
+
+namespace
+{
+
+/// @brief Count occurrences of substring.
+std::size_t count_of( const std::string& str, const std::string& sub )
+{
+     std::size_t count = 0;
+     for ( auto pos = str.find( sub ); pos != std::string::npos; pos = str.find( sub, pos + sub.size() ) )
+     {
+          count++;
+     }
+     return count;
+}
+
+} // anonymous namespace
+
+
+TEST_CASE( "Profiler writes zones only during capture", "[profiler]" )
+{
+     using namespace _16nar;
+
+     auto& profiler = Profiler::instance();
+     {
+          ProfileZone zone{ "before capture" };
+     }
+     profiler.start();
+     REQUIRE( profiler.is_enabled() );
+     {
+          ProfileZone outer{ "outer" };
+          {
+               ProfileZone inner{ "inner" };
+          }
+          {
+               ProfileZone inner{ "inner" };
+          }
+     }
+     ProfileZone unfinished{ "stopped" };
+     profiler.stop();
+     REQUIRE_FALSE( profiler.is_enabled() );
+     {
+          ProfileZone zone{ "after capture" };
+     }
+     REQUIRE( profiler.get_zone_count() == 3 );
+     REQUIRE( profiler.get_dropped_count() == 0 );
+
+     std::stringstream trace;
+     profiler.write_chrome_trace( trace );
+     std::string str = trace.str();
+     REQUIRE( str.rfind( "{\"traceEvents\":[", 0 ) == 0 );
+     REQUIRE( count_of( str, "\"ph\":\"X\"" ) == 3 );
+     REQUIRE( count_of( str, "\"name\":\"inner\"" ) == 2 );
+     REQUIRE( count_of( str, "\"name\":\"outer\"" ) == 1 );
+     REQUIRE( str.find( "capture" ) == std::string::npos );
+     REQUIRE( str.find( "stopped" ) == std::string::npos );
+
+     // inner zone is written before outer one, and lies inside it
+     auto inner = str.find( "\"name\":\"inner\"" );
+     auto outer = str.find( "\"name\":\"outer\"" );
+     REQUIRE( inner < outer );
+     auto time_of = [ &str ]( std::size_t pos, const std::string& key )
+     {
+          auto begin = str.find( key, pos ) + key.size();
+          return std::stod( str.substr( begin, str.find( ',', begin ) - begin ) );
+     };
+     REQUIRE( time_of( outer, "\"ts\":" ) <= time_of( inner, "\"ts\":" ) );
+     REQUIRE( time_of( outer, "\"dur\":" ) >= time_of( inner, "\"dur\":" ) );
+}
+
+
+TEST_CASE( "Profiler keeps zones of each thread separately", "[profiler]" )
+{
+     using namespace _16nar;
+
+     auto& profiler = Profiler::instance();
+     profiler.start();
+     std::thread worker{ [ &profiler ]()
+     {
+          profiler.set_thread_name( "worker \"1\"" );
+          for ( int i = 0; i < 10; i++ )
+          {
+               ProfileZone zone{ "work" };
+          }
+     } };
+     {
+          ProfileZone zone{ "main" };
+     }
+     worker.join();
+     profiler.stop();
+     REQUIRE( profiler.get_zone_count() == 11 );
+
+     std::stringstream trace;
+     profiler.write_chrome_trace( trace );
+     std::string str = trace.str();
+     REQUIRE( count_of( str, "\"name\":\"work\"" ) == 10 );
+     REQUIRE( str.find( "\"name\":\"worker \\\"1\\\"\"" ) != std::string::npos );
+
+     // new capture discards zones of previous one, even of finished threads
+     profiler.start();
+     profiler.stop();
+     REQUIRE( profiler.get_zone_count() == 0 );
+}
+
+
+TEST_CASE( "Profiler reuses buffers of finished threads", "[profiler]" )
+{
+     using namespace _16nar;
+
+     auto& profiler = Profiler::instance();
+     profiler.start();
+     for ( int i = 0; i < 4; i++ )
+     {
+          std::thread worker{ []()
+          {
+               ProfileZone zone{ "short thread" };
+          } };
+          worker.join();
+     }
+     profiler.stop();
+     REQUIRE( profiler.get_zone_count() == 4 );
+
+     // threads did not run at once, so all of them wrote to the same buffer
+     std::stringstream trace;
+     profiler.write_chrome_trace( trace );
+     std::string str = trace.str();
+     REQUIRE( count_of( str, "\"name\":\"short thread\"" ) == 4 );
+     auto pos = str.find( "\"name\":\"short thread\"" );
+     auto tid_begin = str.find( "\"tid\":", pos );
+     std::string tid = str.substr( tid_begin, str.find( '}', tid_begin ) - tid_begin );
+     REQUIRE( count_of( str, tid + "}" ) == 4 );
+}
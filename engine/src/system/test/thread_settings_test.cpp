@@ -0,0 +1,24 @@
+#include <16nar/system/thread_settings.h>
+#include <catch2/catch_test_macros.hpp>
+
+#include <thread>
+
+TEST_CASE( "Thread settings are applied to calling thread", "[thread_settings]" )
+{
+     using namespace _16nar;
+
+     ThreadSettings settings;
+     settings.name = "test worker thread";
+     settings.priority = ThreadPriority::Low;
+     settings.affinity = ~std::uint64_t{ 0 };
+     bool applied = false;
+     // lowering priority does not need privileges, and mask with all CPUs always has allowed ones
+     std::thread worker{ [ &settings, &applied ](){ applied = apply_thread_settings( settings ); } };
+     worker.join();
+#ifdef __linux__
+     REQUIRE( applied );
+#else
+     // other platforms may reject CPUs outside of process mask or do not support settings
+     ( void ) applied;
+#endif
+}
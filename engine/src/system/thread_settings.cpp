@@ -0,0 +1,124 @@
+#include <16nar/system/thread_settings.h>
+
+#include <16nar/system/profiler.h>
+#include <16nar/logger/logger.h>
+
+#ifdef __linux__
+#    include <pthread.h>
+#    include <sched.h>
+#    include <sys/resource.h>
+#    include <sys/syscall.h>
+#    include <unistd.h>
+#elif _WIN32
+#    include <windows.h>
+#endif
+
+namespace _16nar
+{
+
+namespace
+{
+
+#ifdef __linux__
+
+/// @brief Get nice value of the thread priority, lower value means higher priority.
+int get_nice_value( ThreadPriority priority ) noexcept
+{
+     switch ( priority )
+     {
+     case ThreadPriority::Lowest:
+          return 10;
+     case ThreadPriority::Low:
+          return 5;
+     case ThreadPriority::High:
+          return -5;
+     case ThreadPriority::Highest:
+          return -10;
+     default:
+          return 0;
+     }
+}
+
+#elif _WIN32
+
+/// @brief Get Windows value of the thread priority.
+int get_priority_value( ThreadPriority priority ) noexcept
+{
+     switch ( priority )
+     {
+     case ThreadPriority::Lowest:
+          return THREAD_PRIORITY_LOWEST;
+     case ThreadPriority::Low:
+          return THREAD_PRIORITY_BELOW_NORMAL;
+     case ThreadPriority::High:
+          return THREAD_PRIORITY_ABOVE_NORMAL;
+     case ThreadPriority::Highest:
+          return THREAD_PRIORITY_HIGHEST;
+     default:
+          return THREAD_PRIORITY_NORMAL;
+     }
+}
+
+#endif
+
+} // anonymous namespace
+
+
+bool apply_thread_settings( const ThreadSettings& settings )
+{
+     bool success = true;
+     if ( !settings.name.empty() )
+     {
+          Profiler::instance().set_thread_name( settings.name );
+#ifdef __linux__
+          // name of thread is limited to 15 characters on Linux
+          pthread_setname_np( pthread_self(), settings.name.substr( 0, 15 ).c_str() );
+#endif
+     }
+#ifdef __linux__
+     // on Linux nice value is set for each thread separately
+     if ( settings.priority != ThreadPriority::Inherit &&
+          setpriority( PRIO_PROCESS, static_cast< id_t >( syscall( SYS_gettid ) ),
+                       get_nice_value( settings.priority ) ) != 0 )
+     {
+          LOG_16NAR_WARNING( "Cannot set priority of thread '" << settings.name << "'" );
+          success = false;
+     }
+     if ( settings.affinity != 0 )
+     {
+          cpu_set_t cpus;
+          CPU_ZERO( &cpus );
+          for ( std::size_t i = 0; i < 64 && i < CPU_SETSIZE; i++ )
+          {
+               if ( settings.affinity & ( std::uint64_t{ 1 } << i ) )
+               {
+                    CPU_SET( i, &cpus );
+               }
+          }
+          if ( pthread_setaffinity_np( pthread_self(), sizeof( cpus ), &cpus ) != 0 )
+          {
+               LOG_16NAR_WARNING( "Cannot set affinity of thread '" << settings.name << "'" );
+               success = false;
+          }
+     }
+#elif _WIN32
+     if ( settings.priority != ThreadPriority::Inherit &&
+          !SetThreadPriority( GetCurrentThread(), get_priority_value( settings.priority ) ) )
+     {
+          LOG_16NAR_WARNING( "Cannot set priority of thread '" << settings.name << "': error " << GetLastError() );
+          success = false;
+     }
+     if ( settings.affinity != 0
+       && !SetThreadAffinityMask( GetCurrentThread(), static_cast< DWORD_PTR >( settings.affinity ) ) )
+     {
+          LOG_16NAR_WARNING( "Cannot set affinity of thread '" << settings.name << "': error " << GetLastError() );
+          success = false;
+     }
+#else
+     success = ( settings.priority == ThreadPriority::Inherit || settings.priority == ThreadPriority::Normal )
+             && settings.affinity == 0;
+#endif
+     return success;
+}
+
+} // namespace _16nar
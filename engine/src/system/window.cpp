@@ -87,6 +87,16 @@ void Window::make_context_current()
 }
 
 
+void Window::release_context()
+{
+     if ( window_ && glfwGetCurrentContext() == window_ )
+     {
+          glfwMakeContextCurrent( nullptr );
+          LOG_16NAR_DEBUG( "Context released for window" );
+     }
+}
+
+
 void Window::swap_buffers()
 {
      if ( !window_ )
@@ -0,0 +1,284 @@
+/// @file
+/// @brief Utility for replaying render captures and measuring time of render calls.
+
+#include <16nar/16nardefs.h>
+#include <16nar/render/render_capture.h>
+#include <16nar/render/null/render_api.h>
+#if defined( NARENGINE_RENDER_OPENGL )
+#    include <16nar/game.h>
+#    include <16nar/system/game_config.h>
+#    include <16nar/system/window.h>
+#    include <16nar/render/opengl/render_api.h>
+#endif // NARENGINE_RENDER_OPENGL
+
+#include <vector>
+#include <string>
+#include <fstream>
+#include <iostream>
+#include <iomanip>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <cstdlib>
+#include <algorithm>
+
+namespace
+{
+
+constexpr char help_long[]    = "--help";
+constexpr char help_short[]   = "-h";
+constexpr char api_long[]     = "--api";
+constexpr char api_short[]    = "-a";
+constexpr char repeat_long[]  = "--repeat";
+constexpr char repeat_short[] = "-r";
+constexpr char top_long[]     = "--top";
+constexpr char quiet_long[]   = "--quiet";
+constexpr char quiet_short[]  = "-q";
+
+
+std::string api_name = "null";
+std::string capture_file;
+int repeat = 1;
+int top = 10;
+bool quiet = false;
+
+
+/// @brief Accumulated time of records of one type.
+struct TypeStats
+{
+     std::size_t count = 0;                       ///< number of records.
+     std::chrono::nanoseconds total{ 0 };         ///< total time of records.
+     std::chrono::nanoseconds max{ 0 };           ///< maximal time of one record.
+};
+
+
+bool str_to_int( const std::string& str, int min_value, int& value )
+{
+     try
+     {
+          std::size_t pos = 0;
+          int result = std::stoi( str, &pos );
+          if ( pos != str.size() || result < min_value )
+          {
+               return false;
+          }
+          value = result;
+     }
+     catch ( const std::exception& )
+     {
+          return false;
+     }
+     return true;
+}
+
+
+double to_ms( std::chrono::nanoseconds duration )
+{
+     return std::chrono::duration< double, std::milli >( duration ).count();
+}
+
+
+void print_usage( std::ostream& out )
+{
+     out << "Usage: 16nar_render_replay OPTIONS... CAPTURE_FILE\n"
+          << "\nUtility for replaying render captures as fast as possible and measuring time of each render call.\n"
+          << "\tOPTIONS:\n"
+          << "\t\t--help, -h\n\t\tDisplay this message and exit.\n"
+          << "\n\t\t--api API, -a API\n\t\tRender API executing the capture, default is null.\n"
+          << "\n\t\t--repeat COUNT, -r COUNT\n\t\tReplay the capture COUNT times, statistics of the fastest run are printed."
+          << " Default is 1.\n"
+          << "\n\t\t--top COUNT\n\t\tNumber of the slowest records to be printed, default is 10.\n"
+          << "\n\t\t--quiet, -q\n\t\tPrint only total time of replay.\n"
+          << "\n\tAPIS:\n"
+          << "\t\tnull\n\t\tRender API without graphics, measures overhead of the engine itself.\n"
+#if defined( NARENGINE_RENDER_OPENGL )
+          << "\n\t\topen_gl\n\t\tOpenGL render API, a window is created for its context.\n"
+#endif // NARENGINE_RENDER_OPENGL
+          ;
+}
+
+
+int parse_args( int argc, char **argv )
+{
+     for ( int i = 1; i < argc; i++ )
+     {
+          std::string arg = argv[ i ];
+          bool has_value = ( i + 1 < argc );
+          if ( arg == help_long || arg == help_short )
+          {
+               print_usage( std::cout );
+               std::exit( EXIT_SUCCESS );
+          }
+          else if ( ( arg == api_long || arg == api_short ) && has_value )
+          {
+               api_name = argv[ ++i ];
+          }
+          else if ( ( arg == repeat_long || arg == repeat_short ) && has_value )
+          {
+               if ( !str_to_int( argv[ ++i ], 1, repeat ) )
+               {
+                    std::cerr << "wrong repeat count: " << argv[ i ] << "\n";
+                    return EXIT_FAILURE;
+               }
+          }
+          else if ( arg == top_long && has_value )
+          {
+               if ( !str_to_int( argv[ ++i ], 0, top ) )
+               {
+                    std::cerr << "wrong number of records: " << argv[ i ] << "\n";
+                    return EXIT_FAILURE;
+               }
+          }
+          else if ( arg == quiet_long || arg == quiet_short )
+          {
+               quiet = true;
+          }
+          else if ( capture_file.empty() && !arg.empty() && arg[ 0 ] != '-' )
+          {
+               capture_file = arg;
+          }
+          else
+          {
+               std::cerr << "wrong argument: " << arg << "\n";
+               return EXIT_FAILURE;
+          }
+     }
+     if ( capture_file.empty() )
+     {
+          std::cerr << "capture file is not set\n";
+          print_usage( std::cerr );
+          return EXIT_FAILURE;
+     }
+     return EXIT_SUCCESS;
+}
+
+
+void print_stats( const _16nar::RenderReplay& replay, const std::vector< _16nar::ReplayTiming >& timings )
+{
+     std::vector< std::chrono::nanoseconds > frames( replay.get_frame_count() + 1 );
+     std::map< _16nar::CaptureRecordType, TypeStats > types;
+     for ( const auto& timing : timings )
+     {
+          frames[ timing.frame ] += timing.duration;
+          auto& stats = types[ timing.type ];
+          stats.count++;
+          stats.total += timing.duration;
+          stats.max = std::max( stats.max, timing.duration );
+     }
+
+     std::cout << std::fixed << std::setprecision( 3 ) << "\nFrames, ms:\n";
+     for ( std::size_t i = 0; i < replay.get_frame_count(); i++ )
+     {
+          std::cout << "\t" << i << "\t" << to_ms( frames[ i ] ) << "\n";
+     }
+     std::cout << "\nRecords by type:\n\t" << std::left << std::setw( 24 ) << "type"
+          << std::right << std::setw( 10 ) << "count" << std::setw( 14 ) << "total, ms" << std::setw( 14 ) << "max, ms\n";
+     for ( const auto& [ type, stats ] : types )
+     {
+          std::cout << "\t" << std::left << std::setw( 24 ) << _16nar::get_capture_record_name( type )
+               << std::right << std::setw( 10 ) << stats.count << std::setw( 14 ) << to_ms( stats.total )
+               << std::setw( 14 ) << to_ms( stats.max ) << "\n";
+     }
+
+     std::vector< std::size_t > order( timings.size() );
+     for ( std::size_t i = 0; i < order.size(); i++ )
+     {
+          order[ i ] = i;
+     }
+     std::size_t count = std::min( order.size(), static_cast< std::size_t >( top ) );
+     std::partial_sort( order.begin(), order.begin() + count, order.end(),
+          [ &timings ]( std::size_t lhs, std::size_t rhs ) { return timings[ lhs ].duration > timings[ rhs ].duration; } );
+     if ( count > 0 )
+     {
+          std::cout << "\nSlowest records:\n";
+     }
+     for ( std::size_t i = 0; i < count; i++ )
+     {
+          const auto& timing = timings[ order[ i ] ];
+          std::cout << "\t#" << order[ i ] << "\tframe " << timing.frame << "\t"
+               << _16nar::get_capture_record_name( timing.type ) << "\t" << to_ms( timing.duration ) << " ms\n";
+     }
+}
+
+
+int replay_capture( _16nar::RenderReplay& replay, _16nar::IRenderApi& api )
+{
+     std::chrono::nanoseconds best = std::chrono::nanoseconds::max();
+     std::vector< _16nar::ReplayTiming > best_timings;
+     for ( int i = 0; i < repeat; i++ )
+     {
+          replay.run( api );
+          std::chrono::nanoseconds total{ 0 };
+          for ( const auto& timing : replay.get_timings() )
+          {
+               total += timing.duration;
+          }
+          if ( total < best )
+          {
+               best = total;
+               best_timings = replay.get_timings();
+          }
+     }
+     std::cout << std::fixed << std::setprecision( 3 ) << "Replayed " << replay.get_record_count() << " records of "
+          << replay.get_frame_count() << " frames in " << to_ms( best ) << " ms\n";
+     if ( !quiet )
+     {
+          print_stats( replay, best_timings );
+     }
+     return EXIT_SUCCESS;
+}
+
+} // anonymous namespace
+
+
+int main( int argc, char **argv )
+{
+     if ( parse_args( argc, argv ) != EXIT_SUCCESS )
+     {
+          return EXIT_FAILURE;
+     }
+     try
+     {
+          std::ifstream input{ capture_file, std::ios::in | std::ios::binary };
+          if ( !input )
+          {
+               std::cerr << "cannot open capture file " << capture_file << "\n";
+               return EXIT_FAILURE;
+          }
+          _16nar::RenderReplay replay{ input };
+          if ( !quiet )
+          {
+               std::cout << "Capture " << capture_file << ": " << replay.get_record_count() << " records, "
+                    << replay.get_frame_count() << " frames, " << replay.get_payload_size() << " bytes of payloads"
+                    << ( replay.has_payloads() ? "\n" : " (replaced by zeros)\n" );
+          }
+          if ( api_name == "null" )
+          {
+               _16nar::null::RenderApi api{ _16nar::ProfileType::SingleThreaded };
+               return replay_capture( replay, api );
+          }
+#if defined( NARENGINE_RENDER_OPENGL )
+          if ( api_name == "open_gl" )
+          {
+               _16nar::GameConfig config{};
+               config.render_api = _16nar::RenderApiType::OpenGl;
+               _16nar::Game::init( config );
+               _16nar::OpenSettings settings{};
+               settings.focused = false;
+               _16nar::Window window{ _16nar::Vec2i{ 640, 480 }, "16nar render replay", settings };
+               window.make_context_current();
+               _16nar::opengl::RenderApi api{ _16nar::ProfileType::SingleThreaded };
+               int result = replay_capture( replay, api );
+               _16nar::Game::deinit();
+               return result;
+          }
+#endif // NARENGINE_RENDER_OPENGL
+          std::cerr << "unknown render API: " << api_name << "\n";
+          return EXIT_FAILURE;
+     }
+     catch ( const std::exception& ex )
+     {
+          std::cerr << "error replaying capture: " << ex.what() << "\n";
+     }
+     return EXIT_FAILURE;
+}
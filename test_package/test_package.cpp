@@ -65,9 +65,12 @@ int main( int argc, char *argv[] )
      const char *vertex_source = R"(
           #version 330 core
           layout (location = 0) in vec3 aPos;
-          uniform mat4 view_matr;
+          layout (std140) uniform Camera
+          {
+               mat4 view_matr;
+               mat4 proj_matr;
+          };
           uniform mat4 model_matr;
-          uniform mat4 proj_matr;
           void main()
           {
                vec4 pos = vec4(aPos.x, aPos.y, aPos.z, 1.0);
@@ -0,0 +1,111 @@
+/// @file
+/// @brief File with definition of AtlasPacker class and texture atlas creation.
+#ifndef _16NAR_TOOLS_ATLAS_PACKER_H
+#define _16NAR_TOOLS_ATLAS_PACKER_H
+
+#include <16nar/math/vec.h>
+#include <16nar/tools/resource_package.h>
+
+#include <string>
+#include <vector>
+
+namespace _16nar::tools
+{
+
+/// @brief Settings of texture atlas creation.
+struct AtlasSettings
+{
+     std::string name;                       ///< name of atlas resource, pages are named "<name>_page<N>".
+     Vec2i page_size{ 2048, 2048 };          ///< maximal size of atlas page in texels.
+     int padding = 2;                        ///< number of empty texels around each sub-image.
+     bool allow_rotation = false;            ///< can sub-images be rotated 90 degrees clockwise for better packing.
+};
+
+
+/// @brief Packer of rectangles into pages of limited size.
+/// @details Uses MaxRects algorithm with best short side fit heuristic,
+/// rectangles are packed from the largest to the smallest, new page is started
+/// when a rectangle does not fit into any of existing pages.
+class ENGINE_API AtlasPacker
+{
+public:
+     /// @brief Position of packed rectangle.
+     struct Placement
+     {
+          std::size_t page = 0;              ///< index of page containing the rectangle.
+          Vec2i position;                    ///< position of top left corner of the rectangle in the page.
+          bool rotated = false;              ///< is the rectangle rotated 90 degrees clockwise.
+     };
+
+     /// @brief Constructor.
+     /// @param[in] page_size maximal size of a page.
+     /// @param[in] padding number of empty texels around each rectangle.
+     /// @param[in] allow_rotation can rectangles be rotated for better packing.
+     AtlasPacker( const Vec2i& page_size, int padding, bool allow_rotation );
+
+     /// @brief Pack rectangles into pages, previously packed rectangles are discarded.
+     /// @param[in] sizes sizes of rectangles.
+     /// @throws std::runtime_error if some rectangle does not fit into empty page.
+     /// @return placements of rectangles, in the same order as sizes.
+     std::vector< Placement > pack( const std::vector< Vec2i >& sizes );
+
+     /// @brief Get number of pages used by packed rectangles.
+     /// @return number of pages.
+     std::size_t get_page_count() const noexcept;
+
+     /// @brief Get size of used part of the page, including padding.
+     /// @param[in] page index of the page.
+     /// @return size of used part of the page.
+     Vec2i get_used_size( std::size_t page ) const;
+
+private:
+     /// @brief Rectangle in a page.
+     struct Rect
+     {
+          int x = 0;
+          int y = 0;
+          int width = 0;
+          int height = 0;
+     };
+
+     /// @brief Page with free space.
+     struct Page
+     {
+          std::vector< Rect > free_rects;    ///< maximal free rectangles, they may overlap.
+          Vec2i used_size;                   ///< size of used part of the page.
+     };
+
+     /// @brief Find position for a rectangle in the page.
+     /// @param[in] page page where rectangle is placed.
+     /// @param[in] size size of the rectangle with padding.
+     /// @param[out] result found rectangle in the page.
+     /// @param[out] rotated is the rectangle rotated.
+     /// @return true if the rectangle fits into page, false otherwise.
+     bool find_position( const Page& page, const Vec2i& size, Rect& result, bool& rotated ) const;
+
+     /// @brief Place rectangle into page, splitting free rectangles it intersects.
+     /// @param[in,out] page page where rectangle is placed.
+     /// @param[in] used placed rectangle.
+     static void place( Page& page, const Rect& used );
+
+     std::vector< Page > pages_;             ///< pages with packed rectangles.
+     Vec2i page_size_;                       ///< maximal size of a page.
+     int padding_;                           ///< number of empty texels around each rectangle.
+     bool allow_rotation_;                   ///< can rectangles be rotated.
+};
+
+
+/// @brief Pack textures into pages of texture atlas.
+/// @details Textures must have the same format and data type. Pages get sampling parameters
+/// of the first texture, their size is cropped to the used area. Sub-images are named after
+/// the source textures and their regions are stored in the atlas resource.
+/// @param[in] textures texture resources to be packed.
+/// @param[in] settings settings of the atlas.
+/// @throws std::runtime_error if textures cannot be packed together.
+/// @return page textures followed by atlas resource.
+ENGINE_API std::vector< ResourceData > make_atlas( const std::vector< ResourceData >& textures,
+     const AtlasSettings& settings );
+
+} // namespace _16nar::tools
+
+#endif // #ifndef _16NAR_TOOLS_ATLAS_PACKER_H
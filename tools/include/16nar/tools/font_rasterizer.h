@@ -0,0 +1,76 @@
+/// @file
+/// @brief File with definition of FontRasterizer class.
+#ifndef _16NAR_TOOLS_FONT_RASTERIZER_H
+#define _16NAR_TOOLS_FONT_RASTERIZER_H
+
+#include <16nar/16nardefs.h>
+#include <16nar/render/render_defs.h>
+
+#include <string>
+#include <vector>
+#include <memory>
+
+struct stbtt_fontinfo;
+
+namespace _16nar::tools
+{
+
+/// @brief Glyph rasterized to bitmap.
+struct GlyphBitmap
+{
+     Vec2i size;                                  ///< size of the bitmap in pixels, may be zero for space.
+     Vec2i offset;                                ///< position of top left corner of the bitmap relative to pen on baseline.
+     float advance = 0.0f;                        ///< horizontal distance to pen position of the next glyph.
+     std::vector< unsigned char > coverage;       ///< coverage of pixels, row by row from the top.
+};
+
+
+/// @brief Rasterizer of glyphs of TrueType font with fixed pixel height.
+class ENGINE_API FontRasterizer
+{
+public:
+     /// @brief Constructor, which loads font from file.
+     /// @param[in] path path to TrueType font file or font collection.
+     /// @param[in] pixel_height height of glyphs from the highest ascender to the lowest descender, in pixels.
+     /// @param[in] index index of font in collection, 0 for single font.
+     /// @throws std::runtime_error if file cannot be read or it is not a valid font.
+     FontRasterizer( const std::string& path, float pixel_height, int index = 0 );
+
+     /// @brief Destructor.
+     ~FontRasterizer();
+
+     /// @brief Rasterize a glyph, font without the glyph gives its "missing glyph" image.
+     /// @param[in] codepoint Unicode code point of the glyph.
+     /// @return rasterized glyph.
+     GlyphBitmap rasterize( char32_t codepoint ) const;
+
+     /// @brief Get additional distance between pen positions of two glyphs.
+     /// @param[in] first code point of the first glyph.
+     /// @param[in] second code point of the second glyph.
+     /// @return kerning in pixels, usually negative or zero.
+     float get_kerning( char32_t first, char32_t second ) const;
+
+     /// @brief Get distance from top of a line to its baseline.
+     /// @return ascent in pixels.
+     float get_ascent() const noexcept;
+
+     /// @brief Get distance between baselines of consecutive lines.
+     /// @return line height in pixels.
+     float get_line_height() const noexcept;
+
+     /// @brief Get height of glyphs.
+     /// @return pixel height given in constructor.
+     float get_pixel_height() const noexcept;
+
+private:
+     DataSharedPtr data_;                         ///< data of the font file.
+     std::unique_ptr< stbtt_fontinfo > info_;     ///< parsed font.
+     float pixel_height_;                         ///< height of glyphs in pixels.
+     float scale_;                                ///< scale from font units to pixels.
+     float ascent_;                               ///< ascent in pixels.
+     float line_height_;                          ///< line height in pixels.
+};
+
+} // namespace _16nar::tools
+
+#endif // #ifndef _16NAR_TOOLS_FONT_RASTERIZER_H
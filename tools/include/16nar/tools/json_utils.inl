@@ -3,6 +3,8 @@
 
 #include <nlohmann/json.hpp>
 #include <16nar/render/render_defs.h>
+#include <16nar/tools/utils.h>
+#include <16nar/tools/vertex_format.h>
 
 namespace _16nar
 {
@@ -13,6 +15,9 @@ NLOHMANN_JSON_SERIALIZE_ENUM( ResourceType, {
      { ResourceType::Shader,       "shader" },
      { ResourceType::VertexBuffer, "vertex_buffer" },
      { ResourceType::Cubemap,      "cubemap" },
+     { ResourceType::Material,     "material" },
+     { ResourceType::Atlas,        "atlas" },
+     { ResourceType::TextureArray, "texture_array" },
 } )
 
 
@@ -43,8 +48,11 @@ NLOHMANN_JSON_SERIALIZE_ENUM( BufferDataFormat, {
 
 
 NLOHMANN_JSON_SERIALIZE_ENUM( DataType, {
-     { DataType::Byte,    "byte" },
-     { DataType::Float,   "float" },
+     { DataType::Byte,            "byte" },
+     { DataType::Float,           "float" },
+     { DataType::HalfFloat,       "half_float" },
+     { DataType::UnsignedShort,   "unsigned_short" },
+     { DataType::UnsignedInt,     "unsigned_int" },
 } )
 
 
@@ -69,4 +77,27 @@ NLOHMANN_JSON_SERIALIZE_ENUM( BufferType, {
 
 } // namespace _16nar
 
+
+namespace _16nar::tools
+{
+
+NLOHMANN_JSON_SERIALIZE_ENUM( UniformType, {
+     { UniformType::Float,  "float" },
+     { UniformType::Int,    "int" },
+     { UniformType::Bool,   "bool" },
+     { UniformType::Vec2i,  "vec2i" },
+     { UniformType::Vec2f,  "vec2f" },
+     { UniformType::Vec3i,  "vec3i" },
+     { UniformType::Vec3f,  "vec3f" },
+     { UniformType::Vec4i,  "vec4i" },
+     { UniformType::Vec4f,  "vec4f" },
+} )
+
+NLOHMANN_JSON_SERIALIZE_ENUM( VertexLayout, {
+     { VertexLayout::Interleaved,  "interleaved" },
+     { VertexLayout::Planar,       "planar" },
+} )
+
+} // namespace _16nar::tools
+
 #endif // #ifndef _16NAR_TOOLS_JSON_UTILS_INL
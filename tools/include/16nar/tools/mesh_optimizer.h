@@ -0,0 +1,51 @@
+/// @file
+/// @brief File with functions for offline optimization of indexed triangle meshes.
+#ifndef _16NAR_TOOLS_MESH_OPTIMIZER_H
+#define _16NAR_TOOLS_MESH_OPTIMIZER_H
+
+#include <16nar/render/render_defs.h>
+#include <16nar/tools/resource_package.h>
+
+#include <vector>
+#include <cstdint>
+
+namespace _16nar::tools
+{
+
+/// @brief Statistics of mesh optimization.
+struct MeshStatistics
+{
+     std::size_t vertices_before = 0;   ///< number of vertices before optimization.
+     std::size_t vertices_after = 0;    ///< number of vertices after welding of duplicates.
+     float acmr_before = 0.0f;          ///< average cache miss ratio before optimization.
+     float acmr_after = 0.0f;           ///< average cache miss ratio after optimization.
+};
+
+
+/// @brief Get average number of post-transform cache misses per triangle.
+/// @details Cache is simulated as FIFO of given size, so the result is 0.5 for the best
+/// mesh with big number of triangles, 3 for the worst one.
+/// @param[in] indexes indexes of triangle list.
+/// @param[in] cache_size number of vertices in cache.
+/// @return average cache miss ratio, 0 if there are no triangles.
+ENGINE_API float get_acmr( const std::vector< uint32_t >& indexes, std::size_t cache_size );
+
+
+/// @brief Optimize vertex buffer of a triangle list.
+/// @details Optimization includes the following steps:
+/// 1. Vertices with equal bytes of all attributes are welded, index buffer is rebuilt;
+/// if there was no index buffer, it is created.
+/// 2. Triangles are reordered for post-transform cache with Forsyth's algorithm.
+/// 3. Vertices are reordered in order of their first use for locality of vertex fetch.
+///
+/// Attributes are interleaved in the result, their data types are kept. Indexes keep their type
+/// if all of them fit into it, new index buffer uses UnsignedShort if possible.
+/// @param[in,out] resource vertex buffer resource.
+/// @throws std::runtime_error if resource is not a vertex buffer, it has per-instance attributes
+/// or its index buffer is not a valid triangle list.
+/// @return statistics of optimization.
+ENGINE_API MeshStatistics optimize_mesh( ResourceData& resource );
+
+} // namespace _16nar::tools
+
+#endif // #ifndef _16NAR_TOOLS_MESH_OPTIMIZER_H
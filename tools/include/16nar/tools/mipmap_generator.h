@@ -0,0 +1,30 @@
+/// @file
+/// @brief File with functions for offline generation of texture mip levels.
+#ifndef _16NAR_TOOLS_MIPMAP_GENERATOR_H
+#define _16NAR_TOOLS_MIPMAP_GENERATOR_H
+
+#include <16nar/render/render_defs.h>
+#include <16nar/tools/resource_package.h>
+
+namespace _16nar::tools
+{
+
+/// @brief Check if texture filter samples mip levels.
+/// @param[in] filter texture filter.
+/// @return true if filter uses mip levels, false otherwise.
+ENGINE_API bool uses_mipmaps( TextureFilter filter ) noexcept;
+
+
+/// @brief Generate full chain of texture mip levels with box filter.
+/// @details Each level is half the size of previous one (but at least one texel), the last level
+/// has size 1x1. Byte data of sRGB formats is converted to linear space before filtering and back
+/// after it, alpha channel is always filtered linearly. Previously generated levels are replaced.
+/// Data of levels is stored in mipmaps of texture load parameters, and their sizes are appended
+/// to data sizes of the resource after size of level 0.
+/// @param[in,out] texture texture resource.
+/// @throws std::runtime_error if resource is not a texture or it has no data.
+ENGINE_API void generate_mipmaps( ResourceData& texture );
+
+} // namespace _16nar::tools
+
+#endif // #ifndef _16NAR_TOOLS_MIPMAP_GENERATOR_H
@@ -9,10 +9,26 @@
 #include <16nar/tools/iasset_writer.h>
 
 #include <string>
+#include <vector>
 
 namespace _16nar::tools
 {
 
+/// @brief Type of uniform value in asset data, in order of UniformValue alternatives.
+enum class UniformType : uint8_t
+{
+     Float,
+     Int,
+     Bool,
+     Vec2i,
+     Vec2f,
+     Vec3i,
+     Vec3f,
+     Vec4i,
+     Vec4f
+};
+
+
 /// @brief Read raw data from file.
 /// @param[in] path path to file.
 /// @param[out] data_size size of read data.
@@ -44,6 +60,31 @@ ENGINE_API std::string correct_path( const std::string& base_dir, const std::str
 /// @return channel count used for the data format.
 ENGINE_API int get_channel_count( BufferDataFormat format );
 
+/// @brief Get size of one element of data type.
+/// @param[in] type data type.
+/// @throws std::runtime_error if data type is wrong.
+/// @return size of element in bytes.
+ENGINE_API std::size_t get_data_type_size( DataType type );
+
+/// @brief Split uniform value into components, as it is stored in asset data.
+/// @details Floating point components are appended to @b floats, integer and
+/// boolean components are appended to @b ints.
+/// @param[in] value uniform value.
+/// @param[out] floats floating point components.
+/// @param[out] ints integer components.
+/// @return type of uniform value.
+ENGINE_API UniformType get_uniform_components( const UniformValue& value,
+     std::vector< float >& floats, std::vector< int >& ints );
+
+/// @brief Make uniform value from its components.
+/// @param[in] type type of uniform value.
+/// @param[in] floats floating point components.
+/// @param[in] ints integer components.
+/// @throws std::runtime_error if number of components does not match the type.
+/// @return uniform value.
+ENGINE_API UniformValue make_uniform_value( UniformType type,
+     const std::vector< float >& floats, const std::vector< int >& ints );
+
 /// @brief Create asset reader of given format.
 /// @param[in] in_dir directory with input data, if needed by format.
 /// @param[in] format format of asset reader.
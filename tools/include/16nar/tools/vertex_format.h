@@ -0,0 +1,64 @@
+/// @file
+/// @brief File with functions for layout and compression of vertex buffer data.
+#ifndef _16NAR_TOOLS_VERTEX_FORMAT_H
+#define _16NAR_TOOLS_VERTEX_FORMAT_H
+
+#include <16nar/render/render_defs.h>
+#include <16nar/tools/resource_package.h>
+
+#include <cstdint>
+
+namespace _16nar::tools
+{
+
+/// @brief Layout of vertex attributes in a buffer.
+enum class VertexLayout
+{
+     Interleaved,   ///< values of all attributes of a vertex are stored together.
+     Planar         ///< values of each attribute are stored in a separate block, in order of attributes.
+};
+
+
+/// @brief Convert single precision float to half precision one, rounding to nearest even.
+/// @param[in] value single precision value.
+/// @return bits of half precision value.
+ENGINE_API uint16_t float_to_half( float value ) noexcept;
+
+
+/// @brief Convert half precision float to single precision one.
+/// @param[in] bits bits of half precision value.
+/// @return single precision value.
+ENGINE_API float half_to_float( uint16_t bits ) noexcept;
+
+
+/// @brief Get number of vertices stored in vertex buffer.
+/// @details Values of a planar attribute are not bounded by the block of the next one,
+/// so the smallest number of values of all attributes is used.
+/// @param[in] params vertex buffer load parameters.
+/// @throws std::runtime_error if attribute has wrong data type.
+/// @return number of vertices, 0 if buffer is too small for its attributes.
+ENGINE_API std::size_t get_vertex_count( const LoadParams< ResourceType::VertexBuffer >& params );
+
+
+/// @brief Set offsets and strides of attributes according to the layout.
+/// @details Attributes are tightly packed. For planar layout number of vertices is
+/// calculated from buffer size, all attributes have the same number of values.
+/// @param[in,out] params vertex buffer load parameters.
+/// @param[in] layout layout of attributes in the buffer.
+/// @throws std::runtime_error if buffer size does not match the layout.
+ENGINE_API void set_vertex_layout( LoadParams< ResourceType::VertexBuffer >& params, VertexLayout layout );
+
+
+/// @brief Convert vertex buffer to compact formats.
+/// @details Float attributes with all components in [0; 1] range are converted to normalized
+/// UnsignedShort, other float attributes are converted to HalfFloat, so precision of large
+/// values (for example, positions beyond 2048) is reduced. Attributes are interleaved,
+/// each of them is aligned to 4 bytes. UnsignedInt indexes are converted to UnsignedShort
+/// if all of them fit into 16 bits.
+/// @param[in,out] resource vertex buffer resource.
+/// @throws std::runtime_error if resource is not a vertex buffer or its data does not match attributes.
+ENGINE_API void compact_vertex_buffer( ResourceData& resource );
+
+} // namespace _16nar::tools
+
+#endif // #ifndef _16NAR_TOOLS_VERTEX_FORMAT_H
@@ -4,6 +4,10 @@
 #include <16nar/16nardefs.h>
 #include <16nar/tools/resource_package.h>
 #include <16nar/tools/utils.h>
+#include <16nar/tools/atlas_packer.h>
+#include <16nar/tools/mipmap_generator.h>
+#include <16nar/tools/vertex_format.h>
+#include <16nar/tools/mesh_optimizer.h>
 
 #include <vector>
 #include <string>
@@ -14,6 +18,7 @@
 #include <memory>
 #include <stdexcept>
 #include <cstdlib>
+#include <algorithm>
 
 namespace
 {
@@ -34,6 +39,15 @@ constexpr char unpack_long[]      = "--unpack";
 constexpr char unpack_short[]     = "-u";
 constexpr char quiet_long[]       = "--quiet";
 constexpr char quiet_short[]      = "-q";
+constexpr char atlas_long[]       = "--atlas";
+constexpr char atlas_short[]      = "-a";
+constexpr char atlas_size_long[]  = "--atlas-size";
+constexpr char padding_long[]     = "--padding";
+constexpr char rotate_long[]      = "--rotate";
+constexpr char mipmaps_long[]     = "--mipmaps";
+constexpr char mipmaps_short[]    = "-m";
+constexpr char compact_long[]     = "--compact-vertices";
+constexpr char optimize_long[]    = "--optimize-meshes";
 
 
 std::vector< std::string > files;
@@ -41,6 +55,10 @@ std::string out_dir = ".";
 std::string base_dir = ".";
 std::string package_name;
 bool quiet = false;
+bool mipmaps = false;
+bool compact_vertices = false;
+bool optimize_meshes = false;
+_16nar::tools::AtlasSettings atlas_settings{};
 
 
 bool str_to_format( const std::string& str, _16nar::tools::PackageFormat& format )
@@ -63,6 +81,26 @@ bool str_to_format( const std::string& str, _16nar::tools::PackageFormat& format
 }
 
 
+bool str_to_int( const std::string& str, int min_value, int& value )
+{
+     try
+     {
+          std::size_t pos = 0;
+          int result = std::stoi( str, &pos );
+          if ( pos != str.size() || result < min_value )
+          {
+               return false;
+          }
+          value = result;
+     }
+     catch ( const std::exception& )
+     {
+          return false;
+     }
+     return true;
+}
+
+
 void print_usage( std::ostream& out )
 {
      out << "Usage: 16nar_asset_tool OPTIONS... [ ARGS ] FILES...\n"
@@ -77,6 +115,17 @@ void print_usage( std::ostream& out )
           << " File extension of the package will be set depending on output format. PACKAGE_NAME is treated relative to output directory.\n"
           << "\n\t\t--unpack PACKAGE_NAME, -u PACKAGE_NAME\n\t\tUnpack package and place all resource files to output directory.\n"
           << "\n\t\t--quiet, -q\n\t\tDisable text output to terminal.\n"
+          << "\n\t\t--atlas ATLAS_NAME, -a ATLAS_NAME\n\t\tPack all input textures into pages of texture atlas with given name."
+          << " Pages are named ATLAS_NAME_pageN, sub-images keep names of the textures. Textures must have the same format.\n"
+          << "\n\t\t--atlas-size SIZE\n\t\tMaximal width and height of atlas page, default is 2048.\n"
+          << "\n\t\t--padding SIZE\n\t\tNumber of empty texels around each sub-image of atlas, default is 2.\n"
+          << "\n\t\t--rotate\n\t\tAllow rotation of sub-images of atlas by 90 degrees clockwise for better packing.\n"
+          << "\n\t\t--mipmaps, -m\n\t\tGenerate mip levels of textures which use mipmap minifying filter,"
+          << " including atlas pages. Levels are stored in the asset and loaded together with the texture.\n"
+          << "\n\t\t--compact-vertices\n\t\tConvert float vertex attributes to normalized 16-bit integers (if all values"
+          << " are in [0; 1] range) or half floats, interleave them and use 16-bit indices when possible.\n"
+          << "\n\t\t--optimize-meshes\n\t\tWeld duplicate vertices of vertex buffers with triangle lists, reorder triangles"
+          << " for post-transform cache and vertices for fetch locality. Buffers with per-instance attributes are skipped.\n"
           << "\n\tFORMATS:\n"
 #if defined( NARENGINE_TOOLS_JSON )
           << "\t\tjson\n\t\tJSON format. When used as output format, will generate binary assets without converting"
@@ -90,8 +139,161 @@ void print_usage( std::ostream& out )
 }
 
 
+int write_single( _16nar::tools::IAssetWriter& writer, const _16nar::tools::ResourceData& data )
+{
+     try
+     {
+          std::string out_file = ( std::filesystem::path{ out_dir } /
+               ( data.name + "." + writer.get_file_ext() ) ).string();
+          if ( !quiet )
+          {
+               std::cout << "\tWriting converted asset " << out_file << "...";
+          }
+          std::ofstream ofs{ out_file, std::ios::out | std::ios::binary };
+          writer.write_asset( ofs, data );
+          if ( !quiet )
+          {
+               std::cout << "done\n";
+          }
+     }
+     catch ( const std::exception& ex )
+     {
+          std::cerr << "error writing asset: " << ex.what() << "\n";
+          return EXIT_FAILURE;
+     }
+     return EXIT_SUCCESS;
+}
+
+
+int add_mipmaps( _16nar::tools::ResourceData& data )
+{
+     if ( !mipmaps || data.type != _16nar::ResourceType::Texture )
+     {
+          return EXIT_SUCCESS;
+     }
+     const auto& params = std::any_cast< const _16nar::LoadParams< _16nar::ResourceType::Texture >& >( data.params );
+     if ( params.samples != 0 || !_16nar::tools::uses_mipmaps( params.min_filter ) )
+     {
+          return EXIT_SUCCESS;
+     }
+     try
+     {
+          if ( !quiet )
+          {
+               std::cout << "\tGenerating mip levels of texture " << data.name << "...";
+          }
+          _16nar::tools::generate_mipmaps( data );
+          if ( !quiet )
+          {
+               std::cout << "done, " << data.data_sizes.size() - 1 << " levels\n";
+          }
+     }
+     catch ( const std::exception& ex )
+     {
+          std::cerr << "error generating mip levels: " << ex.what() << "\n";
+          return EXIT_FAILURE;
+     }
+     return EXIT_SUCCESS;
+}
+
+
+int optimize_buffer( _16nar::tools::ResourceData& data )
+{
+     if ( !optimize_meshes || data.type != _16nar::ResourceType::VertexBuffer )
+     {
+          return EXIT_SUCCESS;
+     }
+     const auto& params = std::any_cast< const _16nar::LoadParams< _16nar::ResourceType::VertexBuffer >& >( data.params );
+     if ( std::any_of( params.attributes.begin(), params.attributes.end(),
+          []( const auto& attr ){ return attr.divisor != 0; } ) )
+     {
+          return EXIT_SUCCESS;
+     }
+     try
+     {
+          if ( !quiet )
+          {
+               std::cout << "\tOptimizing mesh " << data.name << "...";
+          }
+          std::size_t old_size = data.data_sizes.at( 0 ) + data.data_sizes.at( 1 );
+          auto stats = _16nar::tools::optimize_mesh( data );
+          if ( !quiet )
+          {
+               std::cout << "done, " << stats.vertices_before << " -> " << stats.vertices_after << " vertices, "
+                    << old_size << " -> " << data.data_sizes.at( 0 ) + data.data_sizes.at( 1 ) << " bytes, ACMR "
+                    << stats.acmr_before << " -> " << stats.acmr_after << "\n";
+          }
+     }
+     catch ( const std::exception& ex )
+     {
+          std::cerr << "error optimizing mesh: " << ex.what() << "\n";
+          return EXIT_FAILURE;
+     }
+     return EXIT_SUCCESS;
+}
+
+
+int compact_buffer( _16nar::tools::ResourceData& data )
+{
+     if ( !compact_vertices || data.type != _16nar::ResourceType::VertexBuffer )
+     {
+          return EXIT_SUCCESS;
+     }
+     try
+     {
+          if ( !quiet )
+          {
+               std::cout << "\tCompacting vertex buffer " << data.name << "...";
+          }
+          std::size_t old_size = data.data_sizes.at( 0 ) + data.data_sizes.at( 1 );
+          _16nar::tools::compact_vertex_buffer( data );
+          if ( !quiet )
+          {
+               std::cout << "done, " << old_size << " -> " << data.data_sizes.at( 0 ) + data.data_sizes.at( 1 ) << " bytes\n";
+          }
+     }
+     catch ( const std::exception& ex )
+     {
+          std::cerr << "error compacting vertex buffer: " << ex.what() << "\n";
+          return EXIT_FAILURE;
+     }
+     return EXIT_SUCCESS;
+}
+
+
+int pack_atlas( std::vector< _16nar::tools::ResourceData >& resources )
+{
+     auto iter = std::stable_partition( resources.begin(), resources.end(),
+          []( const _16nar::tools::ResourceData& data ) { return data.type != _16nar::ResourceType::Texture; } );
+     std::vector< _16nar::tools::ResourceData > textures{ std::make_move_iterator( iter ),
+          std::make_move_iterator( resources.end() ) };
+     resources.erase( iter, resources.end() );
+     try
+     {
+          if ( !quiet )
+          {
+               std::cout << "Packing " << textures.size() << " textures into atlas " << atlas_settings.name << "...";
+          }
+          auto atlas = _16nar::tools::make_atlas( textures, atlas_settings );
+          if ( !quiet )
+          {
+               std::cout << "done, " << atlas.size() - 1 << " pages\n";
+          }
+          resources.insert( resources.end(), std::make_move_iterator( atlas.begin() ),
+               std::make_move_iterator( atlas.end() ) );
+     }
+     catch ( const std::exception& ex )
+     {
+          std::cerr << "error packing atlas: " << ex.what() << "\n";
+          return EXIT_FAILURE;
+     }
+     return EXIT_SUCCESS;
+}
+
+
 int simple_convert( _16nar::tools::IAssetReader& reader, _16nar::tools::IAssetWriter& writer )
 {
+     std::vector< _16nar::tools::ResourceData > atlas_textures;
      for ( const auto& filename : files )
      {
           if ( filename.empty() )
@@ -108,6 +310,10 @@ int simple_convert( _16nar::tools::IAssetReader& reader, _16nar::tools::IAssetWr
                }
                std::ifstream ifs{ filename, std::ios::in | std::ios::binary };
                data = reader.read_asset( ifs );
+               if ( !quiet )
+               {
+                    std::cout << "done\n";
+               }
           }
           catch ( const std::exception& ex )
           {
@@ -115,24 +321,30 @@ int simple_convert( _16nar::tools::IAssetReader& reader, _16nar::tools::IAssetWr
                return EXIT_FAILURE;
           }
 
-          try
+          if ( !atlas_settings.name.empty() && data.type == _16nar::ResourceType::Texture )
           {
-               std::string out_file = ( std::filesystem::path{ out_dir } /
-                    ( data.name + "." + writer.get_file_ext() ) ).string();
-               if ( !quiet )
-               {
-                    std::cout << "done\n\tWriting converted asset " << out_file << "...";
-               }
-               std::ofstream ofs{ out_file, std::ios::out | std::ios::binary };
-               writer.write_asset( ofs, data );
-               if ( !quiet )
-               {
-                    std::cout << "done\n";
-               }
+               // textures are written after all of them are packed into atlas
+               atlas_textures.emplace_back( std::move( data ) );
           }
-          catch ( const std::exception& ex )
+          else if ( add_mipmaps( data ) != EXIT_SUCCESS || optimize_buffer( data ) != EXIT_SUCCESS
+               || compact_buffer( data ) != EXIT_SUCCESS || write_single( writer, data ) != EXIT_SUCCESS )
+          {
+               return EXIT_FAILURE;
+          }
+     }
+
+     if ( atlas_textures.empty() )
+     {
+          return EXIT_SUCCESS;
+     }
+     if ( pack_atlas( atlas_textures ) != EXIT_SUCCESS )
+     {
+          return EXIT_FAILURE;
+     }
+     for ( auto& data : atlas_textures )
+     {
+          if ( add_mipmaps( data ) != EXIT_SUCCESS || write_single( writer, data ) != EXIT_SUCCESS )
           {
-               std::cerr << "error writing asset: " << ex.what() << "\n";
                return EXIT_FAILURE;
           }
      }
@@ -170,6 +382,19 @@ int pack_convert( _16nar::tools::IAssetReader& reader, _16nar::tools::IAssetWrit
           }
      }
 
+     if ( !atlas_settings.name.empty() && pack_atlas( package.resources ) != EXIT_SUCCESS )
+     {
+          return EXIT_FAILURE;
+     }
+     for ( auto& data : package.resources )
+     {
+          if ( add_mipmaps( data ) != EXIT_SUCCESS || optimize_buffer( data ) != EXIT_SUCCESS
+               || compact_buffer( data ) != EXIT_SUCCESS )
+          {
+               return EXIT_FAILURE;
+          }
+     }
+
      try
      {
           std::string file = ( std::filesystem::path{ out_dir } /
@@ -364,6 +589,58 @@ int main( int argc, char *argv[] )
                pack = true;
                i++;
           }
+          else if ( arg == atlas_long || arg == atlas_short )
+          {
+               if ( i + 1 >= argc )
+               {
+                    std::cerr << "Error: option " << arg << " requires an argument\n";
+                    print_usage( std::cerr );
+                    return EXIT_FAILURE;
+               }
+               atlas_settings.name = argv[ i + 1 ];
+               i++;
+          }
+          else if ( arg == atlas_size_long || arg == padding_long )
+          {
+               if ( i + 1 >= argc )
+               {
+                    std::cerr << "Error: option " << arg << " requires an argument\n";
+                    print_usage( std::cerr );
+                    return EXIT_FAILURE;
+               }
+               int value = 0;
+               if ( !str_to_int( std::string{ argv[ i + 1 ] }, ( arg == padding_long ) ? 0 : 1, value ) )
+               {
+                    std::cerr << "Error: incorrect value of option " << arg << " '" << argv[ i + 1 ] << "'\n";
+                    print_usage( std::cerr );
+                    return EXIT_FAILURE;
+               }
+               if ( arg == padding_long )
+               {
+                    atlas_settings.padding = value;
+               }
+               else
+               {
+                    atlas_settings.page_size = _16nar::Vec2i{ value, value };
+               }
+               i++;
+          }
+          else if ( arg == rotate_long )
+          {
+               atlas_settings.allow_rotation = true;
+          }
+          else if ( arg == mipmaps_long || arg == mipmaps_short )
+          {
+               mipmaps = true;
+          }
+          else if ( arg == compact_long )
+          {
+               compact_vertices = true;
+          }
+          else if ( arg == optimize_long )
+          {
+               optimize_meshes = true;
+          }
           else
           {
                files.push_back( arg );
@@ -383,6 +660,12 @@ int main( int argc, char *argv[] )
           error = true;
      }
 
+     if ( unpack && !atlas_settings.name.empty() )
+     {
+          std::cerr << "Error: atlas cannot be created when unpacking\n";
+          error = true;
+     }
+
      if ( out_dir.empty() || base_dir.empty() )
      {
           std::cerr << "Error: wrong directory specified\n";
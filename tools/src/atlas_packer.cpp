@@ -0,0 +1,283 @@
+#include <16nar/tools/atlas_packer.h>
+
+#include <16nar/render/render_defs.h>
+#include <16nar/tools/utils.h>
+
+#include <algorithm>
+#include <numeric>
+#include <limits>
+#include <cstring>
+#include <stdexcept>
+
+namespace
+{
+
+/// @brief Get texture load parameters of resource, checking its type.
+const _16nar::LoadParams< _16nar::ResourceType::Texture >& get_texture_params(
+     const _16nar::tools::ResourceData& resource )
+{
+     const auto *params = ( resource.type == _16nar::ResourceType::Texture ) ?
+          std::any_cast< _16nar::LoadParams< _16nar::ResourceType::Texture > >( &resource.params ) : nullptr;
+     if ( !params )
+     {
+          throw std::runtime_error{ "resource " + resource.name + " is not a texture" };
+     }
+     return *params;
+}
+
+} // anonymous namespace
+
+
+namespace _16nar::tools
+{
+
+AtlasPacker::AtlasPacker( const Vec2i& page_size, int padding, bool allow_rotation ):
+     pages_{}, page_size_{ page_size }, padding_{ padding }, allow_rotation_{ allow_rotation }
+{}
+
+
+std::vector< AtlasPacker::Placement > AtlasPacker::pack( const std::vector< Vec2i >& sizes )
+{
+     pages_.clear();
+     std::vector< std::size_t > order( sizes.size() );
+     std::iota( order.begin(), order.end(), 0 );
+     // larger rectangles first, so small ones fill the gaps
+     std::stable_sort( order.begin(), order.end(), [ &sizes ]( std::size_t lhs, std::size_t rhs )
+     {
+          return std::max( sizes[ lhs ].x(), sizes[ lhs ].y() ) > std::max( sizes[ rhs ].x(), sizes[ rhs ].y() );
+     } );
+
+     std::vector< Placement > placements( sizes.size() );
+     for ( std::size_t index : order )
+     {
+          // each rectangle keeps padding to its right and bottom, page keeps padding at left and top
+          Vec2i padded{ sizes[ index ].x() + padding_, sizes[ index ].y() + padding_ };
+          Rect rect{};
+          bool rotated = false;
+          std::size_t page = 0;
+          while ( page < pages_.size() && !find_position( pages_[ page ], padded, rect, rotated ) )
+          {
+               page++;
+          }
+          if ( page == pages_.size() )
+          {
+               Page new_page{};
+               new_page.free_rects.push_back( Rect{ padding_, padding_,
+                    page_size_.x() - padding_, page_size_.y() - padding_ } );
+               if ( !find_position( new_page, padded, rect, rotated ) )
+               {
+                    throw std::runtime_error{ "image of size " + std::to_string( sizes[ index ].x() ) + "x"
+                         + std::to_string( sizes[ index ].y() ) + " does not fit into atlas page" };
+               }
+               pages_.emplace_back( std::move( new_page ) );
+          }
+          place( pages_[ page ], rect );
+          placements[ index ] = Placement{ page, Vec2i{ rect.x, rect.y }, rotated };
+     }
+     return placements;
+}
+
+
+std::size_t AtlasPacker::get_page_count() const noexcept
+{
+     return pages_.size();
+}
+
+
+Vec2i AtlasPacker::get_used_size( std::size_t page ) const
+{
+     return pages_.at( page ).used_size;
+}
+
+
+bool AtlasPacker::find_position( const Page& page, const Vec2i& size, Rect& result, bool& rotated ) const
+{
+     int best_short = std::numeric_limits< int >::max();
+     int best_long = std::numeric_limits< int >::max();
+     auto try_fit = [ & ]( const Rect& free, int width, int height, bool rotate )
+     {
+          if ( width > free.width || height > free.height )
+          {
+               return;
+          }
+          int short_side = std::min( free.width - width, free.height - height );
+          int long_side = std::max( free.width - width, free.height - height );
+          if ( short_side < best_short || ( short_side == best_short && long_side < best_long ) )
+          {
+               best_short = short_side;
+               best_long = long_side;
+               result = Rect{ free.x, free.y, width, height };
+               rotated = rotate;
+          }
+     };
+     for ( const auto& free : page.free_rects )
+     {
+          try_fit( free, size.x(), size.y(), false );
+          if ( allow_rotation_ && size.x() != size.y() )
+          {
+               try_fit( free, size.y(), size.x(), true );
+          }
+     }
+     return best_short != std::numeric_limits< int >::max();
+}
+
+
+void AtlasPacker::place( Page& page, const Rect& used )
+{
+     std::vector< Rect > new_rects;
+     for ( auto iter = page.free_rects.begin(); iter != page.free_rects.end(); /* skip ++iter due to erase */ )
+     {
+          const Rect free = *iter;
+          if ( used.x >= free.x + free.width || used.x + used.width <= free.x
+               || used.y >= free.y + free.height || used.y + used.height <= free.y )
+          {
+               ++iter;
+               continue;
+          }
+          if ( used.x > free.x )
+          {
+               new_rects.push_back( Rect{ free.x, free.y, used.x - free.x, free.height } );
+          }
+          if ( used.x + used.width < free.x + free.width )
+          {
+               new_rects.push_back( Rect{ used.x + used.width, free.y,
+                    free.x + free.width - used.x - used.width, free.height } );
+          }
+          if ( used.y > free.y )
+          {
+               new_rects.push_back( Rect{ free.x, free.y, free.width, used.y - free.y } );
+          }
+          if ( used.y + used.height < free.y + free.height )
+          {
+               new_rects.push_back( Rect{ free.x, used.y + used.height,
+                    free.width, free.y + free.height - used.y - used.height } );
+          }
+          iter = page.free_rects.erase( iter );
+     }
+     page.free_rects.insert( page.free_rects.end(), new_rects.cbegin(), new_rects.cend() );
+
+     // remove free rectangles contained in other ones
+     auto contains = []( const Rect& outer, const Rect& inner )
+     {
+          return inner.x >= outer.x && inner.y >= outer.y && inner.x + inner.width <= outer.x + outer.width
+               && inner.y + inner.height <= outer.y + outer.height;
+     };
+     auto& rects = page.free_rects;
+     for ( std::size_t i = 0; i < rects.size(); i++ )
+     {
+          for ( std::size_t j = i + 1; j < rects.size(); j++ )
+          {
+               if ( contains( rects[ j ], rects[ i ] ) )
+               {
+                    rects.erase( rects.begin() + i );
+                    i--;
+                    break;
+               }
+               if ( contains( rects[ i ], rects[ j ] ) )
+               {
+                    rects.erase( rects.begin() + j );
+                    j--;
+               }
+          }
+     }
+     page.used_size.x() = std::max( page.used_size.x(), used.x + used.width );
+     page.used_size.y() = std::max( page.used_size.y(), used.y + used.height );
+}
+
+
+std::vector< ResourceData > make_atlas( const std::vector< ResourceData >& textures,
+     const AtlasSettings& settings )
+{
+     if ( textures.empty() )
+     {
+          throw std::runtime_error{ "no textures for atlas " + settings.name };
+     }
+     const auto& first = get_texture_params( textures.front() );
+     std::size_t texel_size = get_channel_count( first.format ) * get_data_type_size( first.data_type );
+     std::vector< Vec2i > sizes;
+     for ( const auto& texture : textures )
+     {
+          const auto& params = get_texture_params( texture );
+          if ( params.format != first.format || params.data_type != first.data_type )
+          {
+               throw std::runtime_error{ "texture " + texture.name + " has format different from other atlas textures" };
+          }
+          std::size_t data_size = params.size.x() * params.size.y() * texel_size;
+          if ( params.samples != 0 || !params.data || texture.data_sizes.empty()
+               || texture.data_sizes.front() < data_size )
+          {
+               throw std::runtime_error{ "texture " + texture.name + " has no data to be packed" };
+          }
+          sizes.push_back( params.size );
+     }
+
+     AtlasPacker packer{ settings.page_size, settings.padding, settings.allow_rotation };
+     auto placements = packer.pack( sizes );
+
+     std::vector< ResourceData > result;
+     LoadParams< ResourceType::Atlas > atlas_params{};
+     for ( std::size_t page = 0; page < packer.get_page_count(); page++ )
+     {
+          LoadParams< ResourceType::Texture > params = first;
+          params.size = packer.get_used_size( page );
+          std::size_t data_size = params.size.x() * params.size.y() * texel_size;
+          params.data = DataSharedPtr{ new std::byte[ data_size ](), std::default_delete< std::byte[] >() };
+
+          ResourceData page_data{};
+          page_data.name = settings.name + "_page" + std::to_string( page );
+          page_data.type = ResourceType::Texture;
+          page_data.data_sizes.emplace_back( static_cast< uint32_t >( data_size ) );
+          page_data.params = std::any{ params };
+          atlas_params.page_names.push_back( page_data.name );
+          result.emplace_back( std::move( page_data ) );
+     }
+
+     for ( std::size_t i = 0; i < textures.size(); i++ )
+     {
+          const auto& placement = placements[ i ];
+          const auto& src = get_texture_params( textures[ i ] );
+          const auto& page = std::any_cast< const LoadParams< ResourceType::Texture >& >(
+               result[ placement.page ].params );
+          const std::byte *src_data = src.data.get();
+          std::byte *dst_data = page.data.get();
+          std::size_t dst_row = page.size.x() * texel_size;
+          std::size_t src_row = src.size.x() * texel_size;
+          for ( int y = 0; y < src.size.y(); y++ )
+          {
+               if ( !placement.rotated )
+               {
+                    std::memcpy( dst_data + ( placement.position.y() + y ) * dst_row
+                         + placement.position.x() * texel_size, src_data + y * src_row, src_row );
+                    continue;
+               }
+               for ( int x = 0; x < src.size.x(); x++ )
+               {
+                    // clockwise rotation: texel (x, y) goes to (height - 1 - y, x)
+                    std::size_t dst_x = placement.position.x() + src.size.y() - 1 - y;
+                    std::size_t dst_y = placement.position.y() + x;
+                    std::memcpy( dst_data + dst_y * dst_row + dst_x * texel_size,
+                         src_data + y * src_row + x * texel_size, texel_size );
+               }
+          }
+
+          Vec2i stored_size = placement.rotated ? Vec2i{ src.size.y(), src.size.x() } : src.size;
+          LoadParams< ResourceType::Atlas >::RegionParams region{};
+          region.name = textures[ i ].name;
+          region.page = placement.page;
+          region.position = Vec2f( static_cast< float >( placement.position.x() ) / page.size.x(),
+               static_cast< float >( placement.position.y() ) / page.size.y() );
+          region.size = Vec2f( static_cast< float >( stored_size.x() ) / page.size.x(),
+               static_cast< float >( stored_size.y() ) / page.size.y() );
+          region.rotated = placement.rotated;
+          atlas_params.regions.emplace_back( std::move( region ) );
+     }
+
+     ResourceData atlas{};
+     atlas.name = settings.name;
+     atlas.type = ResourceType::Atlas;
+     atlas.params = std::any{ atlas_params };
+     result.emplace_back( std::move( atlas ) );
+     return result;
+}
+
+} // namespace _16nar::tools
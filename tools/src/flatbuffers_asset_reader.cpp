@@ -1,5 +1,6 @@
 #include <16nar/tools/flatbuffers_asset_reader.h>
 #include <16nar/tools/convertor_utils.inl>
+#include <16nar/tools/utils.h>
 
 #include <16nar/render/render_defs.h>
 #include <16nar/gen/flatbuffers/package_generated.h>
@@ -33,7 +34,10 @@ _16NAR_ENUM_CONVERTOR( _16nar::TextureWrap, _16nar::data::package::TextureWrap,
      { _16nar::data::package::TextureWrap::ClampToBorder,   _16nar::TextureWrap::ClampToBorder                 } )
 _16NAR_ENUM_CONVERTOR( _16nar::DataType, _16nar::data::package::DataType,
      { _16nar::data::package::DataType::Byte,               _16nar::DataType::Byte                             },
-     { _16nar::data::package::DataType::Float,              _16nar::DataType::Float                            } )
+     { _16nar::data::package::DataType::Float,              _16nar::DataType::Float                            },
+     { _16nar::data::package::DataType::HalfFloat,          _16nar::DataType::HalfFloat                        },
+     { _16nar::data::package::DataType::UnsignedShort,      _16nar::DataType::UnsignedShort                    },
+     { _16nar::data::package::DataType::UnsignedInt,        _16nar::DataType::UnsignedInt                      } )
 _16NAR_ENUM_CONVERTOR( _16nar::ShaderType, _16nar::data::package::ShaderType,
      { _16nar::data::package::ShaderType::Vertex,           _16nar::ShaderType::Vertex                         },
      { _16nar::data::package::ShaderType::Fragment,         _16nar::ShaderType::Fragment                       },
@@ -48,6 +52,16 @@ _16NAR_ENUM_CONVERTOR( _16nar::BufferType, _16nar::data::package::BufferType,
      { _16nar::data::package::BufferType::DynamicDraw,      _16nar::BufferType::DynamicDraw                    },
      { _16nar::data::package::BufferType::DynamicRead,      _16nar::BufferType::DynamicRead                    },
      { _16nar::data::package::BufferType::DynamicCopy,      _16nar::BufferType::DynamicCopy                    } )
+_16NAR_ENUM_CONVERTOR( _16nar::tools::UniformType, _16nar::data::package::UniformType,
+     { _16nar::data::package::UniformType::Float,           _16nar::tools::UniformType::Float                  },
+     { _16nar::data::package::UniformType::Int,             _16nar::tools::UniformType::Int                    },
+     { _16nar::data::package::UniformType::Bool,            _16nar::tools::UniformType::Bool                   },
+     { _16nar::data::package::UniformType::Vec2i,           _16nar::tools::UniformType::Vec2i                  },
+     { _16nar::data::package::UniformType::Vec2f,           _16nar::tools::UniformType::Vec2f                  },
+     { _16nar::data::package::UniformType::Vec3i,           _16nar::tools::UniformType::Vec3i                  },
+     { _16nar::data::package::UniformType::Vec3f,           _16nar::tools::UniformType::Vec3f                  },
+     { _16nar::data::package::UniformType::Vec4i,           _16nar::tools::UniformType::Vec4i                  },
+     { _16nar::data::package::UniformType::Vec4f,           _16nar::tools::UniformType::Vec4f                  } )
 
 
 void read_texture( const _16nar::data::package::Resource *res_buffer,
@@ -76,6 +90,7 @@ void read_texture( const _16nar::data::package::Resource *res_buffer,
 
      api_params.samples = params->samples();
      api_params.data = data.at( 0 );
+     api_params.mipmaps.assign( data.cbegin() + 1, data.cend() );
 
      resource.params = std::any{ api_params };
 }
@@ -121,6 +136,7 @@ void read_vertex_buffer( const _16nar::data::package::Resource *res_buffer,
      api_params.index_buffer.type = convert_enum( params->index_buffer_type() );
      api_params.index_buffer.data = data.at( 1 );
      api_params.index_buffer.size = resource.data_sizes.at( 1 );
+     api_params.index_type = convert_enum( params->index_type() );
 
      const auto& attrs = *params->attrs();
      for ( const auto& attr : attrs )
@@ -129,6 +145,9 @@ void read_vertex_buffer( const _16nar::data::package::Resource *res_buffer,
           api_attr.size = attr->size();
           api_attr.data_type = convert_enum( attr->data_type() );
           api_attr.normalized = attr->normalized();
+          api_attr.divisor = attr->divisor();
+          api_attr.offset = attr->offset();
+          api_attr.stride = attr->stride();
 
           api_params.attributes.emplace_back( api_attr );
      }
@@ -171,6 +190,110 @@ void read_cubemap( const _16nar::data::package::Resource *res_buffer,
 }
 
 
+void read_texture_array( const _16nar::data::package::Resource *res_buffer,
+     const std::vector< _16nar::DataSharedPtr >& data, _16nar::tools::ResourceData& resource )
+{
+     auto params = res_buffer->params_as_TextureArrayLoadParams();
+     _16nar::LoadParams< _16nar::ResourceType::TextureArray > api_params{};
+     resource.type = _16nar::ResourceType::TextureArray;
+
+     api_params.format = convert_enum( params->format() );
+     api_params.min_filter = convert_enum( params->min_filter() );
+     api_params.mag_filter = convert_enum( params->mag_filter() );
+     api_params.wrap_x = convert_enum( params->wrap_x() );
+     api_params.wrap_y = convert_enum( params->wrap_y() );
+     api_params.data_type = convert_enum( params->data_type() );
+
+     const auto& border_color = *params->border_color()->data();
+     api_params.border_color.x() = border_color[ 0 ];
+     api_params.border_color.y() = border_color[ 1 ];
+     api_params.border_color.z() = border_color[ 2 ];
+     api_params.border_color.w() = border_color[ 3 ];
+
+     const auto& size = *params->size()->data();
+     api_params.size.x() = size[ 0 ];
+     api_params.size.y() = size[ 1 ];
+
+     api_params.data = data;
+
+     resource.params = std::any{ api_params };
+}
+
+
+void read_material( const _16nar::data::package::Resource *res_buffer, _16nar::tools::ResourceData& resource )
+{
+     auto params = res_buffer->params_as_MaterialLoadParams();
+     _16nar::LoadParams< _16nar::ResourceType::Material > api_params{};
+     resource.type = _16nar::ResourceType::Material;
+
+     api_params.shader_name = params->shader()->c_str();
+     for ( const auto& texture : *params->textures() )
+     {
+          api_params.texture_names.emplace_back( texture->c_str() );
+     }
+     if ( params->texture_arrays() )
+     {
+          for ( const auto& texture_array : *params->texture_arrays() )
+          {
+               api_params.texture_array_names.emplace_back( texture_array->c_str() );
+          }
+     }
+
+     for ( const auto& uniform : *params->uniforms() )
+     {
+          std::vector< float > floats;
+          std::vector< int > ints;
+          if ( uniform->floats() )
+          {
+               floats.assign( uniform->floats()->cbegin(), uniform->floats()->cend() );
+          }
+          if ( uniform->ints() )
+          {
+               ints.assign( uniform->ints()->cbegin(), uniform->ints()->cend() );
+          }
+          _16nar::LoadParams< _16nar::ResourceType::Material >::UniformParams api_uniform{};
+          api_uniform.name = uniform->name()->c_str();
+          api_uniform.value = _16nar::tools::make_uniform_value( convert_enum( uniform->type() ), floats, ints );
+
+          api_params.uniforms.emplace_back( api_uniform );
+     }
+
+     resource.params = std::any{ api_params };
+}
+
+
+void read_atlas( const _16nar::data::package::Resource *res_buffer, _16nar::tools::ResourceData& resource )
+{
+     auto params = res_buffer->params_as_AtlasLoadParams();
+     _16nar::LoadParams< _16nar::ResourceType::Atlas > api_params{};
+     resource.type = _16nar::ResourceType::Atlas;
+
+     for ( const auto& page : *params->pages() )
+     {
+          api_params.page_names.emplace_back( page->c_str() );
+     }
+     for ( const auto& region : *params->regions() )
+     {
+          _16nar::LoadParams< _16nar::ResourceType::Atlas >::RegionParams api_region{};
+          api_region.name = region->name()->c_str();
+          api_region.page = region->page();
+          api_region.rotated = region->rotated();
+
+          const auto& position = *region->position()->data();
+          api_region.position.x() = position[ 0 ];
+          api_region.position.y() = position[ 1 ];
+
+          const auto& size = *region->size()->data();
+          api_region.size.x() = size[ 0 ];
+          api_region.size.y() = size[ 1 ];
+
+          api_params.regions.emplace_back( api_region );
+     }
+
+     resource.params = std::any{ api_params };
+}
+
+
 std::vector< uint8_t > read_header( std::istream& input, uint32_t& header_size )
 {
      input.read( reinterpret_cast< char * >( &header_size ), sizeof( header_size ) );
@@ -209,6 +332,15 @@ _16nar::tools::ResourceData read_resource( const _16nar::data::package::Resource
           case _16nar::data::package::AnyLoadParams::CubemapLoadParams:
                read_cubemap( res_buffer, data, resource );
                break;
+          case _16nar::data::package::AnyLoadParams::MaterialLoadParams:
+               read_material( res_buffer, resource );
+               break;
+          case _16nar::data::package::AnyLoadParams::AtlasLoadParams:
+               read_atlas( res_buffer, resource );
+               break;
+          case _16nar::data::package::AnyLoadParams::TextureArrayLoadParams:
+               read_texture_array( res_buffer, data, resource );
+               break;
           default:
                throw std::runtime_error{ "wrong resource type: "
                     + std::to_string( static_cast< std::size_t >( type ) ) };
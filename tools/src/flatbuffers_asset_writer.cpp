@@ -1,5 +1,6 @@
 #include <16nar/tools/flatbuffers_asset_writer.h>
 #include <16nar/tools/convertor_utils.inl>
+#include <16nar/tools/utils.h>
 
 #include <16nar/render/render_defs.h>
 #include <16nar/gen/flatbuffers/package_generated.h>
@@ -33,7 +34,10 @@ _16NAR_ENUM_CONVERTOR( _16nar::data::package::TextureWrap, _16nar::TextureWrap,
      { _16nar::TextureWrap::ClampToBorder,          _16nar::data::package::TextureWrap::ClampToBorder          } )
 _16NAR_ENUM_CONVERTOR( _16nar::data::package::DataType, _16nar::DataType,
      { _16nar::DataType::Byte,                      _16nar::data::package::DataType::Byte                      },
-     { _16nar::DataType::Float,                     _16nar::data::package::DataType::Float                     } )
+     { _16nar::DataType::Float,                     _16nar::data::package::DataType::Float                     },
+     { _16nar::DataType::HalfFloat,                 _16nar::data::package::DataType::HalfFloat                 },
+     { _16nar::DataType::UnsignedShort,             _16nar::data::package::DataType::UnsignedShort             },
+     { _16nar::DataType::UnsignedInt,               _16nar::data::package::DataType::UnsignedInt               } )
 _16NAR_ENUM_CONVERTOR( _16nar::data::package::ShaderType, _16nar::ShaderType,
      { _16nar::ShaderType::Vertex,                  _16nar::data::package::ShaderType::Vertex                  },
      { _16nar::ShaderType::Fragment,                _16nar::data::package::ShaderType::Fragment                },
@@ -48,6 +52,16 @@ _16NAR_ENUM_CONVERTOR( _16nar::data::package::BufferType, _16nar::BufferType,
      { _16nar::BufferType::DynamicDraw,             _16nar::data::package::BufferType::DynamicDraw             },
      { _16nar::BufferType::DynamicRead,             _16nar::data::package::BufferType::DynamicRead             },
      { _16nar::BufferType::DynamicCopy,             _16nar::data::package::BufferType::DynamicCopy             } )
+_16NAR_ENUM_CONVERTOR( _16nar::data::package::UniformType, _16nar::tools::UniformType,
+     { _16nar::tools::UniformType::Float,           _16nar::data::package::UniformType::Float                  },
+     { _16nar::tools::UniformType::Int,             _16nar::data::package::UniformType::Int                    },
+     { _16nar::tools::UniformType::Bool,            _16nar::data::package::UniformType::Bool                   },
+     { _16nar::tools::UniformType::Vec2i,           _16nar::data::package::UniformType::Vec2i                  },
+     { _16nar::tools::UniformType::Vec2f,           _16nar::data::package::UniformType::Vec2f                  },
+     { _16nar::tools::UniformType::Vec3i,           _16nar::data::package::UniformType::Vec3i                  },
+     { _16nar::tools::UniformType::Vec3f,           _16nar::data::package::UniformType::Vec3f                  },
+     { _16nar::tools::UniformType::Vec4i,           _16nar::data::package::UniformType::Vec4i                  },
+     { _16nar::tools::UniformType::Vec4f,           _16nar::data::package::UniformType::Vec4f                  } )
 
 
 flatbuffers::Offset< _16nar::data::package::Resource > write_texture(
@@ -85,6 +99,7 @@ flatbuffers::Offset< _16nar::data::package::Resource > write_texture(
      auto res = res_builder.Finish();
 
      data_units.emplace_back( params.data );
+     std::copy( params.mipmaps.cbegin(), params.mipmaps.cend(), std::back_inserter( data_units ) );
      return res;
 }
 
@@ -143,7 +158,9 @@ flatbuffers::Offset< _16nar::data::package::Resource > write_vertex_buffer(
      for ( const auto& attr : params.attributes )
      {
           attrs.emplace_back( _16nar::data::package::AttribParams{
-               static_cast< uint32_t >( attr.size ), convert_enum( attr.data_type ), attr.normalized } );
+               static_cast< uint32_t >( attr.size ), convert_enum( attr.data_type ), attr.normalized,
+               static_cast< uint32_t >( attr.divisor ), static_cast< uint32_t >( attr.offset ),
+               static_cast< uint32_t >( attr.stride ) } );
      }
 
      auto attrs_stored = builder.CreateVectorOfStructs( attrs.data(), attrs.size() );
@@ -151,6 +168,7 @@ flatbuffers::Offset< _16nar::data::package::Resource > write_vertex_buffer(
      vb_params_builder.add_attrs( attrs_stored );
      vb_params_builder.add_buffer_type( convert_enum( params.buffer.type ) );
      vb_params_builder.add_index_buffer_type( convert_enum( params.index_buffer.type ) );
+     vb_params_builder.add_index_type( convert_enum( params.index_type ) );
      auto vb_params = vb_params_builder.Finish();
 
      _16nar::data::package::ResourceBuilder res_builder{ builder };
@@ -205,6 +223,138 @@ flatbuffers::Offset< _16nar::data::package::Resource > write_cubemap(
 }
 
 
+flatbuffers::Offset< _16nar::data::package::Resource > write_texture_array(
+     const _16nar::tools::ResourceData& resource,
+     flatbuffers::FlatBufferBuilder& builder,
+     std::vector< _16nar::DataSharedPtr >& data_units )
+{
+     auto params = std::any_cast< _16nar::LoadParams< _16nar::ResourceType::TextureArray > >( resource.params );
+
+     auto data_sizes = builder.CreateVector( resource.data_sizes.data(), resource.data_sizes.size() );
+     auto name = builder.CreateString( resource.name );
+
+     auto border_color = _16nar::data::Vec4f{
+          flatbuffers::span< const float, _16nar::Vec4f::size >{ params.border_color.data(), _16nar::Vec4f::size } };
+     auto size = _16nar::data::Vec2i{
+          flatbuffers::span< const int32_t, _16nar::Vec2i::size >{ params.size.data(), _16nar::Vec2i::size } };
+
+     _16nar::data::package::TextureArrayLoadParamsBuilder array_builder{ builder };
+     array_builder.add_format( convert_enum( params.format ) );
+     array_builder.add_min_filter( convert_enum( params.min_filter ) );
+     array_builder.add_mag_filter( convert_enum( params.mag_filter ) );
+     array_builder.add_wrap_x( convert_enum( params.wrap_x ) );
+     array_builder.add_wrap_y( convert_enum( params.wrap_y ) );
+     array_builder.add_data_type( convert_enum( params.data_type ) );
+     array_builder.add_border_color( &border_color );
+     array_builder.add_size( &size );
+     auto texture_array = array_builder.Finish();
+
+     _16nar::data::package::ResourceBuilder res_builder{ builder };
+     res_builder.add_name( name );
+     res_builder.add_params_type( _16nar::data::package::AnyLoadParams::TextureArrayLoadParams );
+     res_builder.add_params( texture_array.Union() );
+     res_builder.add_data_sizes( data_sizes );
+     auto res = res_builder.Finish();
+
+     std::copy( params.data.cbegin(), params.data.cend(), std::back_inserter( data_units ) );
+     return res;
+}
+
+
+flatbuffers::Offset< _16nar::data::package::Resource > write_material(
+     const _16nar::tools::ResourceData& resource,
+     flatbuffers::FlatBufferBuilder& builder )
+{
+     auto params = std::any_cast< _16nar::LoadParams< _16nar::ResourceType::Material > >( resource.params );
+
+     auto data_sizes = builder.CreateVector( resource.data_sizes.data(), resource.data_sizes.size() );
+     auto name = builder.CreateString( resource.name );
+     auto shader = builder.CreateString( params.shader_name );
+     auto textures = builder.CreateVectorOfStrings( params.texture_names );
+     auto texture_arrays = builder.CreateVectorOfStrings( params.texture_array_names );
+
+     std::vector< flatbuffers::Offset< _16nar::data::package::Uniform > > uniforms;
+     uniforms.reserve( params.uniforms.size() );
+     for ( const auto& param : params.uniforms )
+     {
+          std::vector< float > float_values;
+          std::vector< int > int_values;
+          auto type = _16nar::tools::get_uniform_components( param.value, float_values, int_values );
+          auto uniform_name = builder.CreateString( param.name );
+          auto floats = builder.CreateVector( float_values );
+          auto ints = builder.CreateVector( int_values );
+          _16nar::data::package::UniformBuilder uniform_builder{ builder };
+          uniform_builder.add_name( uniform_name );
+          uniform_builder.add_type( convert_enum( type ) );
+          uniform_builder.add_floats( floats );
+          uniform_builder.add_ints( ints );
+          uniforms.emplace_back( uniform_builder.Finish() );
+     }
+
+     auto uniforms_stored = builder.CreateVector( uniforms );
+     _16nar::data::package::MaterialLoadParamsBuilder material_builder{ builder };
+     material_builder.add_shader( shader );
+     material_builder.add_textures( textures );
+     material_builder.add_uniforms( uniforms_stored );
+     material_builder.add_texture_arrays( texture_arrays );
+     auto material = material_builder.Finish();
+
+     _16nar::data::package::ResourceBuilder res_builder{ builder };
+     res_builder.add_name( name );
+     res_builder.add_params_type( _16nar::data::package::AnyLoadParams::MaterialLoadParams );
+     res_builder.add_params( material.Union() );
+     res_builder.add_data_sizes( data_sizes );
+     auto res = res_builder.Finish();
+
+     return res;
+}
+
+
+flatbuffers::Offset< _16nar::data::package::Resource > write_atlas(
+     const _16nar::tools::ResourceData& resource,
+     flatbuffers::FlatBufferBuilder& builder )
+{
+     auto params = std::any_cast< _16nar::LoadParams< _16nar::ResourceType::Atlas > >( resource.params );
+
+     auto data_sizes = builder.CreateVector( resource.data_sizes.data(), resource.data_sizes.size() );
+     auto name = builder.CreateString( resource.name );
+     auto pages = builder.CreateVectorOfStrings( params.page_names );
+
+     std::vector< flatbuffers::Offset< _16nar::data::package::AtlasRegion > > regions;
+     regions.reserve( params.regions.size() );
+     for ( const auto& region : params.regions )
+     {
+          auto region_name = builder.CreateString( region.name );
+          auto position = _16nar::data::Vec2f{
+               flatbuffers::span< const float, _16nar::Vec2f::size >{ region.position.data(), _16nar::Vec2f::size } };
+          auto size = _16nar::data::Vec2f{
+               flatbuffers::span< const float, _16nar::Vec2f::size >{ region.size.data(), _16nar::Vec2f::size } };
+          _16nar::data::package::AtlasRegionBuilder region_builder{ builder };
+          region_builder.add_name( region_name );
+          region_builder.add_page( static_cast< uint32_t >( region.page ) );
+          region_builder.add_position( &position );
+          region_builder.add_size( &size );
+          region_builder.add_rotated( region.rotated );
+          regions.emplace_back( region_builder.Finish() );
+     }
+
+     auto regions_stored = builder.CreateVector( regions );
+     _16nar::data::package::AtlasLoadParamsBuilder atlas_builder{ builder };
+     atlas_builder.add_pages( pages );
+     atlas_builder.add_regions( regions_stored );
+     auto atlas = atlas_builder.Finish();
+
+     _16nar::data::package::ResourceBuilder res_builder{ builder };
+     res_builder.add_name( name );
+     res_builder.add_params_type( _16nar::data::package::AnyLoadParams::AtlasLoadParams );
+     res_builder.add_params( atlas.Union() );
+     res_builder.add_data_sizes( data_sizes );
+     auto res = res_builder.Finish();
+
+     return res;
+}
+
+
 flatbuffers::Offset< _16nar::data::package::Resource > write_resource(
      const _16nar::tools::ResourceData& resource,
      flatbuffers::FlatBufferBuilder& builder,
@@ -225,6 +375,15 @@ flatbuffers::Offset< _16nar::data::package::Resource > write_resource(
           case _16nar::ResourceType::Cubemap:
                res_buffer = write_cubemap( resource, builder, data_units );
                break;
+          case _16nar::ResourceType::Material:
+               res_buffer = write_material( resource, builder );
+               break;
+          case _16nar::ResourceType::Atlas:
+               res_buffer = write_atlas( resource, builder );
+               break;
+          case _16nar::ResourceType::TextureArray:
+               res_buffer = write_texture_array( resource, builder, data_units );
+               break;
           default:
                throw std::runtime_error{ "wrong resource type: "
                     + std::to_string( static_cast< std::size_t >( resource.type ) ) };
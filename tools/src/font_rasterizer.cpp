@@ -0,0 +1,86 @@
+#include <16nar/tools/font_rasterizer.h>
+
+#include <16nar/tools/utils.h>
+
+#include <stb_truetype.h>
+
+#include <stdexcept>
+
+namespace _16nar::tools
+{
+
+FontRasterizer::FontRasterizer( const std::string& path, float pixel_height, int index ):
+     data_{}, info_{ std::make_unique< stbtt_fontinfo >() }, pixel_height_{ pixel_height },
+     scale_{ 0.0f }, ascent_{ 0.0f }, line_height_{ 0.0f }
+{
+     std::size_t data_size = 0;
+     data_ = read_binary( path, data_size );
+     const auto *font_data = reinterpret_cast< const unsigned char * >( data_.get() );
+     int offset = stbtt_GetFontOffsetForIndex( font_data, index );
+     if ( offset < 0 || !stbtt_InitFont( info_.get(), font_data, offset ) )
+     {
+          throw std::runtime_error{ "cannot load font " + std::to_string( index ) + " from file " + path };
+     }
+     scale_ = stbtt_ScaleForPixelHeight( info_.get(), pixel_height );
+     int ascent = 0, descent = 0, line_gap = 0;
+     stbtt_GetFontVMetrics( info_.get(), &ascent, &descent, &line_gap );
+     ascent_ = ascent * scale_;
+     line_height_ = ( ascent - descent + line_gap ) * scale_;
+}
+
+
+FontRasterizer::~FontRasterizer() = default;
+
+
+GlyphBitmap FontRasterizer::rasterize( char32_t codepoint ) const
+{
+     GlyphBitmap bitmap{};
+     int glyph = stbtt_FindGlyphIndex( info_.get(), static_cast< int >( codepoint ) );
+     int advance = 0, left_bearing = 0;
+     stbtt_GetGlyphHMetrics( info_.get(), glyph, &advance, &left_bearing );
+     bitmap.advance = advance * scale_;
+
+     int x0 = 0, y0 = 0, x1 = 0, y1 = 0;
+     stbtt_GetGlyphBitmapBox( info_.get(), glyph, scale_, scale_, &x0, &y0, &x1, &y1 );
+     bitmap.size = Vec2i{ x1 - x0, y1 - y0 };
+     bitmap.offset = Vec2i{ x0, y0 };
+     if ( bitmap.size.x() > 0 && bitmap.size.y() > 0 )
+     {
+          bitmap.coverage.resize( bitmap.size.x() * bitmap.size.y() );
+          stbtt_MakeGlyphBitmap( info_.get(), bitmap.coverage.data(), bitmap.size.x(), bitmap.size.y(),
+               bitmap.size.x(), scale_, scale_, glyph );
+     }
+     else
+     {
+          bitmap.size = Vec2i{};
+     }
+     return bitmap;
+}
+
+
+float FontRasterizer::get_kerning( char32_t first, char32_t second ) const
+{
+     int first_glyph = stbtt_FindGlyphIndex( info_.get(), static_cast< int >( first ) );
+     int second_glyph = stbtt_FindGlyphIndex( info_.get(), static_cast< int >( second ) );
+     return stbtt_GetGlyphKernAdvance( info_.get(), first_glyph, second_glyph ) * scale_;
+}
+
+
+float FontRasterizer::get_ascent() const noexcept
+{
+     return ascent_;
+}
+
+
+float FontRasterizer::get_line_height() const noexcept
+{
+     return line_height_;
+}
+
+
+float FontRasterizer::get_pixel_height() const noexcept
+{
+     return pixel_height_;
+}
+
+} // namespace _16nar::tools
@@ -13,6 +13,46 @@
 namespace
 {
 
+/// @brief Read image data from file, raw or in one of formats supported by stb_image.
+/// @details Size of image is updated when it is read from encoded file.
+_16nar::DataSharedPtr read_image( const std::string& file, bool raw, _16nar::BufferDataFormat format,
+     _16nar::DataType data_type, _16nar::Vec2i& size, std::size_t& data_size )
+{
+     if ( raw )
+     {
+          return _16nar::tools::read_binary( file, data_size );
+     }
+     if ( data_type != _16nar::DataType::Byte && data_type != _16nar::DataType::Float )
+     {
+          throw std::runtime_error{ "image from file " + file + " can be read only as byte or float data" };
+     }
+     int channels = 0;
+     int required_channels = _16nar::tools::get_channel_count( format );
+     std::byte *data = nullptr;
+     if ( data_type == _16nar::DataType::Byte )
+     {
+          data = reinterpret_cast< std::byte * >(
+               stbi_load( file.c_str(), &size.x(), &size.y(), &channels, required_channels ) );
+          data_size = size.x() * size.y() * required_channels * sizeof( std::byte );
+     }
+     else
+     {
+          data = reinterpret_cast< std::byte * >(
+               stbi_loadf( file.c_str(), &size.x(), &size.y(), &channels, required_channels ) );
+          data_size = size.x() * size.y() * required_channels * sizeof( float );
+     }
+
+     if ( !data )
+     {
+          throw std::runtime_error{ "cannot read image from file " + file };
+     }
+     _16nar::DataSharedPtr result{ new std::byte[ data_size ], std::default_delete< std::byte[] >() };
+     std::memcpy( result.get(), data, data_size );
+     stbi_image_free( data );
+     return result;
+}
+
+
 void read_texture( const nlohmann::json& json, const std::string& in_dir,
      _16nar::tools::ResourceData& resource )
 {
@@ -36,43 +76,24 @@ void read_texture( const nlohmann::json& json, const std::string& in_dir,
      params.border_color.z() = border_color[ 2 ];
      params.border_color.w() = border_color[ 3 ];
 
-     int channels = 0;
-     int required_channels = _16nar::tools::get_channel_count( params.format );
      std::size_t data_size = 0;
      std::string file = _16nar::tools::correct_path( in_dir, json.at( "file" ) );
-     if ( raw )
-     {
-          params.data = _16nar::tools::read_binary( file, data_size );
-     }
-     else
-     {
-          std::byte *data = nullptr;
-          if ( params.data_type == _16nar::DataType::Byte )
-          {
-               data = reinterpret_cast< std::byte * >(
-                    stbi_load( file.c_str(), &params.size.x(), &params.size.y(),
-                    &channels, required_channels ) );
-               data_size = params.size.x() * params.size.y() * required_channels * sizeof( std::byte );
-          }
-          else
-          {
-               data = reinterpret_cast< std::byte * >(
-                    stbi_loadf( file.c_str(), &params.size.x(), &params.size.y(),
-                    &channels, required_channels ) );
-               data_size = params.size.x() * params.size.y() * required_channels * sizeof( float );
-          }
+     params.data = read_image( file, raw, params.format, params.data_type, params.size, data_size );
+     resource.data_sizes.emplace_back( static_cast< uint32_t >( data_size ) );
 
-          if ( !data )
+     if ( json.contains( "mipmaps" ) )
+     {
+          for ( const std::string& path : json.at( "mipmaps" ) )
           {
-               throw std::runtime_error{ "cannot read image from file " + file };
+               std::string level_file = _16nar::tools::correct_path( in_dir, path );
+               _16nar::Vec2i level_size{};
+               params.mipmaps.emplace_back( read_image( level_file, raw, params.format, params.data_type,
+                    level_size, data_size ) );
+               resource.data_sizes.emplace_back( static_cast< uint32_t >( data_size ) );
           }
-          params.data = _16nar::DataSharedPtr{ new std::byte[ data_size ], std::default_delete< std::byte[] >() };
-          std::memcpy( params.data.get(), data, data_size );
-          stbi_image_free( data );
      }
 
      resource.params = std::any{ params };
-     resource.data_sizes.emplace_back( static_cast< uint32_t >( data_size ) );
      resource.type = _16nar::ResourceType::Texture;
 }
 
@@ -116,7 +137,12 @@ void read_vertex_buffer( const nlohmann::json& json, const std::string& in_dir,
      read_buffer_param( json[ "index_buffer" ], params.index_buffer );
      resource.data_sizes.emplace_back( static_cast< uint32_t >( params.buffer.size ) );
      resource.data_sizes.emplace_back( static_cast< uint32_t >( params.index_buffer.size ) );
+     if ( json.contains( "index_type" ) )
+     {
+          params.index_type = json.at( "index_type" ). template get< _16nar::DataType >();
+     }
 
+     bool explicit_layout = false;
      const auto& attributes = json.at( "attributes" );
      for ( const auto& json_attr : attributes )
      {
@@ -124,9 +150,24 @@ void read_vertex_buffer( const nlohmann::json& json, const std::string& in_dir,
           param.size = json_attr.at( "size" );
           param.data_type = json_attr.at( "data_type" ). template get< _16nar::DataType >();
           param.normalized = json_attr.at( "normalized" );
+          if ( json_attr.contains( "divisor" ) )
+          {
+               param.divisor = json_attr.at( "divisor" );
+          }
+          if ( json_attr.contains( "offset" ) || json_attr.contains( "stride" ) )
+          {
+               param.offset = json_attr.value( "offset", 0 );
+               param.stride = json_attr.value( "stride", 0 );
+               explicit_layout = true;
+          }
 
           params.attributes.emplace_back( param );
      }
+     if ( json.contains( "layout" ) || !explicit_layout )
+     {
+          auto layout = json.value( "layout", _16nar::tools::VertexLayout::Interleaved );
+          _16nar::tools::set_vertex_layout( params, layout );
+     }
 
      resource.params = std::any{ params };
      resource.type = _16nar::ResourceType::VertexBuffer;
@@ -162,45 +203,129 @@ void read_cubemap( const nlohmann::json& json, const std::string& in_dir,
      {
           std::string file = _16nar::tools::correct_path( in_dir, path );
           std::size_t data_size = 0;
-          if ( raw )
+          params.data[ file_num ] = read_image( file, raw, params.format, params.data_type,
+               params.size, data_size );
+          resource.data_sizes.emplace_back( static_cast< uint32_t >( data_size ) );
+          ++file_num;
+     }
+
+     resource.params = std::any{ params };
+     resource.type = _16nar::ResourceType::Cubemap;
+}
+
+
+void read_texture_array( const nlohmann::json& json, const std::string& in_dir,
+     _16nar::tools::ResourceData& resource )
+{
+     _16nar::LoadParams< _16nar::ResourceType::TextureArray > params{};
+     params.format = json.at( "format" ).template get< _16nar::BufferDataFormat >();
+     params.min_filter = json.at( "min_filter" ).template get< _16nar::TextureFilter >();
+     params.mag_filter = json.at( "mag_filter" ).template get< _16nar::TextureFilter >();
+     params.wrap_x = json.at( "wrap_x" ).template get< _16nar::TextureWrap >();
+     params.wrap_y = json.at( "wrap_y" ).template get< _16nar::TextureWrap >();
+     params.data_type = json.at( "data_type" ).template get< _16nar::DataType >();
+     bool raw = json.at( "raw" );
+
+     std::array< int, _16nar::Vec2i::size > size = json.at( "size" );
+     params.size.x() = size[ 0 ];
+     params.size.y() = size[ 1 ];
+
+     std::array< float, _16nar::Vec4f::size > border_color = json.at( "border_color" );
+     params.border_color.x() = border_color[ 0 ];
+     params.border_color.y() = border_color[ 1 ];
+     params.border_color.z() = border_color[ 2 ];
+     params.border_color.w() = border_color[ 3 ];
+
+     for ( const std::string& path : json.at( "files" ) )
+     {
+          std::string file = _16nar::tools::correct_path( in_dir, path );
+          std::size_t data_size = 0;
+          _16nar::Vec2i layer_size = params.size;
+          params.data.emplace_back( read_image( file, raw, params.format, params.data_type,
+               layer_size, data_size ) );
+          if ( layer_size != params.size )
+          {
+               throw std::runtime_error{ "layer " + file + " has size different from texture array size" };
+          }
+          resource.data_sizes.emplace_back( static_cast< uint32_t >( data_size ) );
+     }
+
+     resource.params = std::any{ params };
+     resource.type = _16nar::ResourceType::TextureArray;
+}
+
+
+void read_material( const nlohmann::json& json, _16nar::tools::ResourceData& resource )
+{
+     _16nar::LoadParams< _16nar::ResourceType::Material > params{};
+     params.shader_name = json.at( "shader" );
+     params.texture_names = json.at( "textures" ).template get< std::vector< std::string > >();
+     if ( json.contains( "texture_arrays" ) )
+     {
+          params.texture_array_names = json.at( "texture_arrays" ).template get< std::vector< std::string > >();
+     }
+
+     const auto& uniforms = json.at( "uniforms" );
+     for ( const auto& json_uniform : uniforms )
+     {
+          auto type = json_uniform.at( "type" ).template get< _16nar::tools::UniformType >();
+          const auto& json_value = json_uniform.at( "value" );
+          std::vector< float > floats;
+          std::vector< int > ints;
+          bool is_float = ( type == _16nar::tools::UniformType::Float || type == _16nar::tools::UniformType::Vec2f
+               || type == _16nar::tools::UniformType::Vec3f || type == _16nar::tools::UniformType::Vec4f );
+          if ( json_value.is_array() && is_float )
           {
-               params.data[ file_num ] = _16nar::tools::read_binary( file, data_size );
+               floats = json_value.template get< std::vector< float > >();
+          }
+          else if ( json_value.is_array() )
+          {
+               ints = json_value.template get< std::vector< int > >();
+          }
+          else if ( is_float )
+          {
+               floats.push_back( json_value.template get< float >() );
           }
           else
           {
-               int channels = 0;
-               int required_channels = _16nar::tools::get_channel_count( params.format );
-               std::byte *data = nullptr;
-               if ( params.data_type == _16nar::DataType::Byte )
-               {
-                    data = reinterpret_cast< std::byte * >(
-                         stbi_load( file.c_str(), &params.size.x(), &params.size.y(),
-                         &channels, required_channels ) );
-                    data_size = params.size.x() * params.size.y() * required_channels * sizeof( std::byte );
-               }
-               else
-               {
-                    data = reinterpret_cast< std::byte * >(
-                         stbi_loadf( file.c_str(), &params.size.x(), &params.size.y(),
-                         &channels, required_channels ) );
-                    data_size = params.size.x() * params.size.y() * required_channels * sizeof( float );
-               }
-
-               if ( !data )
-               {
-                    throw std::runtime_error{ "cannot read image from file " + file };
-               }
-               params.data[ file_num ] =
-                    _16nar::DataSharedPtr{ new std::byte[ data_size ], std::default_delete< std::byte[] >() };
-               std::memcpy( params.data[ file_num ].get(), data, data_size );
-               stbi_image_free( data );
+               ints.push_back( json_value.is_boolean() ? json_value.template get< bool >()
+                    : json_value.template get< int >() );
           }
-          resource.data_sizes.emplace_back( static_cast< uint32_t >( data_size ) );
-          ++file_num;
+
+          _16nar::LoadParams< _16nar::ResourceType::Material >::UniformParams param{};
+          param.name = json_uniform.at( "name" );
+          param.value = _16nar::tools::make_uniform_value( type, floats, ints );
+          params.uniforms.emplace_back( param );
      }
 
      resource.params = std::any{ params };
-     resource.type = _16nar::ResourceType::Cubemap;
+     resource.type = _16nar::ResourceType::Material;
+}
+
+
+void read_atlas( const nlohmann::json& json, _16nar::tools::ResourceData& resource )
+{
+     _16nar::LoadParams< _16nar::ResourceType::Atlas > params{};
+     params.page_names = json.at( "pages" ).template get< std::vector< std::string > >();
+     for ( const auto& json_region : json.at( "regions" ) )
+     {
+          _16nar::LoadParams< _16nar::ResourceType::Atlas >::RegionParams region{};
+          region.name = json_region.at( "name" );
+          region.page = json_region.at( "page" );
+          region.rotated = json_region.at( "rotated" );
+
+          std::array< float, _16nar::Vec2f::size > position = json_region.at( "position" );
+          region.position.x() = position[ 0 ];
+          region.position.y() = position[ 1 ];
+
+          std::array< float, _16nar::Vec2f::size > size = json_region.at( "size" );
+          region.size.x() = size[ 0 ];
+          region.size.y() = size[ 1 ];
+          params.regions.emplace_back( std::move( region ) );
+     }
+
+     resource.params = std::any{ params };
+     resource.type = _16nar::ResourceType::Atlas;
 }
 
 
@@ -223,6 +348,15 @@ _16nar::tools::ResourceData read_resource( const nlohmann::json& json, const std
           case _16nar::ResourceType::Cubemap:
                read_cubemap( json, in_dir, resource );
                break;
+          case _16nar::ResourceType::Material:
+               read_material( json, resource );
+               break;
+          case _16nar::ResourceType::Atlas:
+               read_atlas( json, resource );
+               break;
+          case _16nar::ResourceType::TextureArray:
+               read_texture_array( json, in_dir, resource );
+               break;
           default:
                throw std::runtime_error{ "wrong resource type: "
                     + std::to_string( static_cast< std::size_t >( type ) ) };
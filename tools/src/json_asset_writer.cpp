@@ -42,6 +42,20 @@ void write_texture( const _16nar::tools::ResourceData& resource,
      std::string path = _16nar::tools::correct_path( out_dir, file );
      json[ "file" ] = file;
      _16nar::tools::write_binary( path, params.data, resource.data_sizes.at( 0 ) );
+
+     if ( params.mipmaps.empty() )
+     {
+          return;
+     }
+     auto mipmaps = nlohmann::json::array();
+     for ( std::size_t i = 0; i < params.mipmaps.size(); i++ )
+     {
+          std::string level_file = resource.name + "_mipmap" + std::to_string( i + 1 ) + raw_ext;
+          std::string level_path = _16nar::tools::correct_path( out_dir, level_file );
+          mipmaps.push_back( level_file );
+          _16nar::tools::write_binary( level_path, params.mipmaps[ i ], resource.data_sizes.at( i + 1 ) );
+     }
+     json[ "mipmaps" ] = mipmaps;
 }
 
 
@@ -92,6 +106,7 @@ void write_vertex_buffer( const _16nar::tools::ResourceData& resource,
      index_buffer[ "file" ] = file;
      _16nar::tools::write_binary( path, params.index_buffer.data, params.index_buffer.size );
      json[ "index_buffer" ] = index_buffer;
+     json[ "index_type" ] = params.index_type;
 
      auto attributes = nlohmann::json::array();
      for ( std::size_t i = 0; i < params.attributes.size(); i++ )
@@ -100,6 +115,9 @@ void write_vertex_buffer( const _16nar::tools::ResourceData& resource,
           attr[ "data_type" ] = params.attributes.at( i ).data_type;
           attr[ "size" ] = params.attributes.at( i ).size;
           attr[ "normalized" ] = params.attributes.at( i ).normalized;
+          attr[ "divisor" ] = params.attributes.at( i ).divisor;
+          attr[ "offset" ] = params.attributes.at( i ).offset;
+          attr[ "stride" ] = params.attributes.at( i ).stride;
           attributes.push_back( attr );
      }
      json[ "attributes" ] = attributes;
@@ -144,6 +162,107 @@ void write_cubemap( const _16nar::tools::ResourceData& resource,
 }
 
 
+void write_texture_array( const _16nar::tools::ResourceData& resource,
+     const std::string& out_dir, nlohmann::json& json )
+{
+     auto params = std::any_cast< _16nar::LoadParams< _16nar::ResourceType::TextureArray > >( resource.params );
+
+     json[ "format" ] = params.format;
+     json[ "min_filter" ] = params.min_filter;
+     json[ "mag_filter" ] = params.mag_filter;
+     json[ "wrap_x" ] = params.wrap_x;
+     json[ "wrap_y" ] = params.wrap_y;
+     json[ "data_type" ] = params.data_type;
+     json[ "raw" ] = true;    // always raw, because we don't know desired format
+
+     std::array< int, _16nar::Vec2i::size > size{ params.size.x(), params.size.y() };
+     json[ "size" ] = size;
+
+     std::array< float, _16nar::Vec4f::size > border_color{
+          params.border_color.x(),
+          params.border_color.y(),
+          params.border_color.z(),
+          params.border_color.w()
+     };
+     json[ "border_color" ] = border_color;
+
+     auto files = nlohmann::json::array();
+     for ( std::size_t i = 0; i < params.data.size(); i++ )
+     {
+          std::string file = resource.name + "_layer" + std::to_string( i ) + raw_ext;
+          std::string path = _16nar::tools::correct_path( out_dir, file );
+          files.push_back( file );
+          _16nar::tools::write_binary( path, params.data.at( i ), resource.data_sizes.at( i ) );
+     }
+     json[ "files" ] = files;
+}
+
+
+void write_material( const _16nar::tools::ResourceData& resource, nlohmann::json& json )
+{
+     auto params = std::any_cast< _16nar::LoadParams< _16nar::ResourceType::Material > >( resource.params );
+
+     json[ "shader" ] = params.shader_name;
+     json[ "textures" ] = params.texture_names;
+     json[ "texture_arrays" ] = params.texture_array_names;
+
+     auto uniforms = nlohmann::json::array();
+     for ( const auto& param : params.uniforms )
+     {
+          std::vector< float > floats;
+          std::vector< int > ints;
+          auto type = _16nar::tools::get_uniform_components( param.value, floats, ints );
+
+          nlohmann::json uniform{};
+          uniform[ "name" ] = param.name;
+          uniform[ "type" ] = type;
+          if ( type == _16nar::tools::UniformType::Bool )
+          {
+               uniform[ "value" ] = static_cast< bool >( ints.front() );
+          }
+          else if ( floats.size() == 1 )
+          {
+               uniform[ "value" ] = floats.front();
+          }
+          else if ( ints.size() == 1 )
+          {
+               uniform[ "value" ] = ints.front();
+          }
+          else if ( !floats.empty() )
+          {
+               uniform[ "value" ] = floats;
+          }
+          else
+          {
+               uniform[ "value" ] = ints;
+          }
+          uniforms.push_back( uniform );
+     }
+     json[ "uniforms" ] = uniforms;
+}
+
+
+void write_atlas( const _16nar::tools::ResourceData& resource, nlohmann::json& json )
+{
+     auto params = std::any_cast< _16nar::LoadParams< _16nar::ResourceType::Atlas > >( resource.params );
+
+     json[ "pages" ] = params.page_names;
+     auto regions = nlohmann::json::array();
+     for ( const auto& region : params.regions )
+     {
+          nlohmann::json json_region{};
+          json_region[ "name" ] = region.name;
+          json_region[ "page" ] = region.page;
+          json_region[ "position" ] = std::array< float, _16nar::Vec2f::size >{
+               region.position.x(), region.position.y() };
+          json_region[ "size" ] = std::array< float, _16nar::Vec2f::size >{ region.size.x(), region.size.y() };
+          json_region[ "rotated" ] = region.rotated;
+          regions.push_back( json_region );
+     }
+     json[ "regions" ] = regions;
+}
+
+
 nlohmann::json write_resource( const _16nar::tools::ResourceData& resource, const std::string& out_dir )
 {
      nlohmann::json json{};
@@ -161,6 +280,15 @@ nlohmann::json write_resource( const _16nar::tools::ResourceData& resource, cons
           case _16nar::ResourceType::Cubemap:
                write_cubemap( resource, out_dir, json );
                break;
+          case _16nar::ResourceType::Material:
+               write_material( resource, json );
+               break;
+          case _16nar::ResourceType::Atlas:
+               write_atlas( resource, json );
+               break;
+          case _16nar::ResourceType::TextureArray:
+               write_texture_array( resource, out_dir, json );
+               break;
           default:
                throw std::runtime_error{ "wrong resource type: "
                     + std::to_string( static_cast< std::size_t >( resource.type ) ) };
@@ -0,0 +1,344 @@
+#include <16nar/tools/mesh_optimizer.h>
+
+#include <16nar/tools/vertex_format.h>
+#include <16nar/tools/utils.h>
+
+#include <algorithm>
+#include <numeric>
+#include <deque>
+#include <string>
+#include <unordered_map>
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+
+namespace
+{
+
+using VertexBufferParams = _16nar::LoadParams< _16nar::ResourceType::VertexBuffer >;
+
+constexpr std::size_t cache_size = 32;            ///< size of simulated post-transform cache.
+constexpr float cache_decay_power = 1.5f;         ///< power of score decay with position in cache.
+constexpr float last_triangle_score = 0.75f;      ///< score of vertices of the last triangle.
+constexpr float valence_boost_scale = 2.0f;       ///< scale of score of vertices with few triangles left.
+constexpr float valence_boost_power = 0.5f;       ///< power of score of vertices with few triangles left.
+
+
+/// @brief Get score of vertex for Forsyth's algorithm.
+/// @param[in] cache_position position of vertex in cache, -1 if it is not in cache.
+/// @param[in] remaining number of triangles of the vertex which are not emitted yet.
+float get_vertex_score( int cache_position, std::size_t remaining )
+{
+     if ( remaining == 0 )
+     {
+          return -1.0f;
+     }
+     float score = 0.0f;
+     if ( cache_position >= 0 && cache_position < 3 )
+     {
+          // vertices of the last triangle have fixed score, so the same triangle is not favoured twice
+          score = last_triangle_score;
+     }
+     else if ( cache_position >= 3 )
+     {
+          float scale = 1.0f / ( cache_size - 3 );
+          score = std::pow( 1.0f - ( cache_position - 3 ) * scale, cache_decay_power );
+     }
+     return score + valence_boost_scale * std::pow( static_cast< float >( remaining ), -valence_boost_power );
+}
+
+
+/// @brief Read indexes of vertex buffer, sequential indexes are made if there is no index buffer.
+std::vector< uint32_t > read_indexes( const VertexBufferParams& params, std::size_t vertex_count )
+{
+     std::vector< uint32_t > indexes;
+     if ( !params.index_buffer.data || params.index_buffer.size == 0 )
+     {
+          indexes.resize( vertex_count );
+          std::iota( indexes.begin(), indexes.end(), 0 );
+          return indexes;
+     }
+     if ( params.index_type == _16nar::DataType::Float || params.index_type == _16nar::DataType::HalfFloat )
+     {
+          throw std::runtime_error{ "indexes must have integer type" };
+     }
+     std::size_t index_size = _16nar::tools::get_data_type_size( params.index_type );
+     indexes.resize( params.index_buffer.size / index_size );
+     const std::byte *data = params.index_buffer.data.get();
+     for ( std::size_t i = 0; i < indexes.size(); i++ )
+     {
+          if ( index_size == sizeof( uint8_t ) )
+          {
+               indexes[ i ] = std::to_integer< uint32_t >( data[ i ] );
+          }
+          else if ( index_size == sizeof( uint16_t ) )
+          {
+               uint16_t index = 0;
+               std::memcpy( &index, data + i * index_size, index_size );
+               indexes[ i ] = index;
+          }
+          else
+          {
+               std::memcpy( &indexes[ i ], data + i * index_size, index_size );
+          }
+     }
+     return indexes;
+}
+
+
+/// @brief Write indexes to index buffer of given type.
+_16nar::DataSharedPtr write_indexes( const std::vector< uint32_t >& indexes, _16nar::DataType type, std::size_t& size )
+{
+     std::size_t index_size = _16nar::tools::get_data_type_size( type );
+     size = indexes.size() * index_size;
+     _16nar::DataSharedPtr data{ new std::byte[ size ], std::default_delete< std::byte[] >() };
+     for ( std::size_t i = 0; i < indexes.size(); i++ )
+     {
+          if ( index_size == sizeof( uint8_t ) )
+          {
+               data.get()[ i ] = static_cast< std::byte >( indexes[ i ] );
+          }
+          else if ( index_size == sizeof( uint16_t ) )
+          {
+               uint16_t index = static_cast< uint16_t >( indexes[ i ] );
+               std::memcpy( data.get() + i * index_size, &index, index_size );
+          }
+          else
+          {
+               std::memcpy( data.get() + i * index_size, &indexes[ i ], index_size );
+          }
+     }
+     return data;
+}
+
+
+/// @brief Reorder triangles for post-transform cache with Forsyth's linear-speed algorithm.
+/// @details The next triangle is the best scored one among triangles of vertices in cache,
+/// when there are no such triangles, the first one not emitted yet is taken.
+std::vector< uint32_t > optimize_triangle_order( const std::vector< uint32_t >& indexes, std::size_t vertex_count )
+{
+     std::size_t triangle_count = indexes.size() / 3;
+     std::vector< uint32_t > remaining( vertex_count, 0 );
+     for ( uint32_t index : indexes )
+     {
+          remaining[ index ]++;
+     }
+     // triangles of each vertex, not emitted ones are placed first in its range
+     std::vector< std::size_t > adjacency_offsets( vertex_count + 1, 0 );
+     for ( std::size_t v = 0; v < vertex_count; v++ )
+     {
+          adjacency_offsets[ v + 1 ] = adjacency_offsets[ v ] + remaining[ v ];
+     }
+     std::vector< uint32_t > adjacency( indexes.size() );
+     std::vector< std::size_t > fill_offsets( adjacency_offsets.begin(), adjacency_offsets.end() - 1 );
+     for ( std::size_t i = 0; i < indexes.size(); i++ )
+     {
+          adjacency[ fill_offsets[ indexes[ i ] ]++ ] = static_cast< uint32_t >( i / 3 );
+     }
+
+     std::vector< int > cache_positions( vertex_count, -1 );
+     std::vector< float > vertex_scores( vertex_count );
+     for ( std::size_t v = 0; v < vertex_count; v++ )
+     {
+          vertex_scores[ v ] = get_vertex_score( -1, remaining[ v ] );
+     }
+     std::vector< bool > emitted( triangle_count, false );
+     std::vector< uint32_t > result;
+     result.reserve( indexes.size() );
+     std::vector< uint32_t > cache;
+     std::vector< uint32_t > new_cache;
+     std::size_t cursor = 0;
+     std::size_t best = triangle_count;
+     while ( result.size() < indexes.size() )
+     {
+          if ( best == triangle_count )
+          {
+               while ( emitted[ cursor ] )
+               {
+                    cursor++;
+               }
+               best = cursor;
+          }
+          emitted[ best ] = true;
+          new_cache.clear();
+          for ( std::size_t k = 0; k < 3; k++ )
+          {
+               uint32_t v = indexes[ best * 3 + k ];
+               result.push_back( v );
+               new_cache.push_back( v );
+               auto begin = adjacency.begin() + adjacency_offsets[ v ];
+               auto end = begin + remaining[ v ];
+               std::iter_swap( std::find( begin, end, static_cast< uint32_t >( best ) ), end - 1 );
+               remaining[ v ]--;
+          }
+          for ( uint32_t v : cache )
+          {
+               if ( std::find( new_cache.begin(), new_cache.begin() + 3, v ) == new_cache.begin() + 3 )
+               {
+                    new_cache.push_back( v );
+               }
+          }
+          for ( std::size_t i = 0; i < new_cache.size(); i++ )
+          {
+               int position = ( i < cache_size ) ? static_cast< int >( i ) : -1;
+               cache_positions[ new_cache[ i ] ] = position;
+               vertex_scores[ new_cache[ i ] ] = get_vertex_score( position, remaining[ new_cache[ i ] ] );
+          }
+
+          best = triangle_count;
+          float best_score = -1.0f;
+          for ( std::size_t i = 0; i < std::min( new_cache.size(), cache_size ); i++ )
+          {
+               uint32_t v = new_cache[ i ];
+               for ( std::size_t j = 0; j < remaining[ v ]; j++ )
+               {
+                    uint32_t triangle = adjacency[ adjacency_offsets[ v ] + j ];
+                    float score = vertex_scores[ indexes[ triangle * 3 ] ] + vertex_scores[ indexes[ triangle * 3 + 1 ] ]
+                         + vertex_scores[ indexes[ triangle * 3 + 2 ] ];
+                    if ( score > best_score )
+                    {
+                         best_score = score;
+                         best = triangle;
+                    }
+               }
+          }
+          new_cache.resize( std::min( new_cache.size(), cache_size ) );
+          std::swap( cache, new_cache );
+     }
+     return result;
+}
+
+} // anonymous namespace
+
+
+namespace _16nar::tools
+{
+
+float get_acmr( const std::vector< uint32_t >& indexes, std::size_t cache_size )
+{
+     std::size_t triangle_count = indexes.size() / 3;
+     if ( triangle_count == 0 )
+     {
+          return 0.0f;
+     }
+     std::deque< uint32_t > cache;
+     std::size_t misses = 0;
+     for ( uint32_t index : indexes )
+     {
+          if ( std::find( cache.begin(), cache.end(), index ) != cache.end() )
+          {
+               continue;
+          }
+          misses++;
+          cache.push_back( index );
+          if ( cache.size() > cache_size )
+          {
+               cache.pop_front();
+          }
+     }
+     return static_cast< float >( misses ) / triangle_count;
+}
+
+
+MeshStatistics optimize_mesh( ResourceData& resource )
+{
+     auto *params = ( resource.type == ResourceType::VertexBuffer ) ?
+          std::any_cast< VertexBufferParams >( &resource.params ) : nullptr;
+     if ( !params )
+     {
+          throw std::runtime_error{ "resource " + resource.name + " is not a vertex buffer" };
+     }
+     std::size_t vertex_count = get_vertex_count( *params );
+     if ( !params->buffer.data || vertex_count == 0 )
+     {
+          throw std::runtime_error{ "vertex buffer " + resource.name + " has no data" };
+     }
+     std::size_t vertex_size = 0;
+     for ( const auto& attr : params->attributes )
+     {
+          if ( attr.divisor != 0 )
+          {
+               throw std::runtime_error{ "vertex buffer " + resource.name + " has per-instance attributes" };
+          }
+          vertex_size += attr.size * get_data_type_size( attr.data_type );
+     }
+     std::vector< uint32_t > indexes = read_indexes( *params, vertex_count );
+     if ( indexes.size() % 3 != 0 || std::any_of( indexes.begin(), indexes.end(),
+          [ vertex_count ]( uint32_t index ){ return index >= vertex_count; } ) )
+     {
+          throw std::runtime_error{ "indexes of vertex buffer " + resource.name + " are not a valid triangle list" };
+     }
+
+     MeshStatistics stats{};
+     stats.vertices_before = vertex_count;
+     stats.acmr_before = get_acmr( indexes, cache_size );
+
+     // welding, vertices with the same bytes of all attributes are merged
+     std::vector< std::byte > vertices;
+     std::vector< uint32_t > weld_map( vertex_count );
+     std::unordered_map< std::string, uint32_t > unique_vertices;
+     std::string key( vertex_size, '\0' );
+     const std::byte *src = params->buffer.data.get();
+     for ( std::size_t v = 0; v < vertex_count; v++ )
+     {
+          std::size_t key_offset = 0;
+          for ( const auto& attr : params->attributes )
+          {
+               std::size_t value_size = attr.size * get_data_type_size( attr.data_type );
+               std::size_t stride = attr.stride ? attr.stride : value_size;
+               std::memcpy( key.data() + key_offset, src + attr.offset + v * stride, value_size );
+               key_offset += value_size;
+          }
+          auto [ iter, inserted ] = unique_vertices.emplace( key, static_cast< uint32_t >( unique_vertices.size() ) );
+          weld_map[ v ] = iter->second;
+          if ( inserted )
+          {
+               const std::byte *key_data = reinterpret_cast< const std::byte * >( key.data() );
+               vertices.insert( vertices.end(), key_data, key_data + vertex_size );
+          }
+     }
+     for ( auto& index : indexes )
+     {
+          index = weld_map[ index ];
+     }
+
+     indexes = optimize_triangle_order( indexes, unique_vertices.size() );
+
+     // vertices are placed in order of first use, unused ones are removed
+     constexpr uint32_t unused = ~static_cast< uint32_t >( 0 );
+     std::vector< uint32_t > vertex_map( unique_vertices.size(), unused );
+     uint32_t next_vertex = 0;
+     for ( auto& index : indexes )
+     {
+          if ( vertex_map[ index ] == unused )
+          {
+               vertex_map[ index ] = next_vertex++;
+          }
+          index = vertex_map[ index ];
+     }
+     params->buffer.size = next_vertex * vertex_size;
+     params->buffer.data = DataSharedPtr{ new std::byte[ params->buffer.size ], std::default_delete< std::byte[] >() };
+     for ( std::size_t v = 0; v < vertex_map.size(); v++ )
+     {
+          if ( vertex_map[ v ] != unused )
+          {
+               std::memcpy( params->buffer.data.get() + vertex_map[ v ] * vertex_size,
+                    vertices.data() + v * vertex_size, vertex_size );
+          }
+     }
+     set_vertex_layout( *params, VertexLayout::Interleaved );
+
+     if ( !params->index_buffer.data || params->index_buffer.size == 0 )
+     {
+          params->index_type = ( next_vertex <= 0x10000 ) ? DataType::UnsignedShort : DataType::UnsignedInt;
+     }
+     params->index_buffer.data = write_indexes( indexes, params->index_type, params->index_buffer.size );
+     resource.data_sizes = { static_cast< uint32_t >( params->buffer.size ),
+          static_cast< uint32_t >( params->index_buffer.size ) };
+
+     stats.vertices_after = next_vertex;
+     stats.acmr_after = get_acmr( indexes, cache_size );
+     return stats;
+}
+
+} // namespace _16nar::tools
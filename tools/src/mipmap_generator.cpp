@@ -0,0 +1,167 @@
+#include <16nar/tools/mipmap_generator.h>
+
+#include <16nar/tools/utils.h>
+
+#include <algorithm>
+#include <array>
+#include <vector>
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+
+namespace
+{
+
+/// @brief Convert sRGB encoded value to linear space.
+float srgb_to_linear( float value )
+{
+     return ( value <= 0.04045f ) ? value / 12.92f : std::pow( ( value + 0.055f ) / 1.055f, 2.4f );
+}
+
+
+/// @brief Convert linear value to sRGB encoding.
+float linear_to_srgb( float value )
+{
+     return ( value <= 0.0031308f ) ? value * 12.92f : 1.055f * std::pow( value, 1.0f / 2.4f ) - 0.055f;
+}
+
+
+/// @brief Image in linear space with floating point channels.
+struct LinearImage
+{
+     std::vector< float > texels;  ///< channels of texels, row by row.
+     _16nar::Vec2i size;           ///< size of image in texels.
+};
+
+
+/// @brief Convert texture data to linear image.
+LinearImage to_linear( const std::byte *data, const _16nar::Vec2i& size, int channels, bool srgb, bool is_float )
+{
+     LinearImage image{ std::vector< float >( static_cast< std::size_t >( size.x() ) * size.y() * channels ), size };
+     if ( is_float )
+     {
+          std::memcpy( image.texels.data(), data, image.texels.size() * sizeof( float ) );
+          return image;
+     }
+     std::array< float, 256 > table{};
+     for ( std::size_t i = 0; i < table.size(); i++ )
+     {
+          table[ i ] = static_cast< float >( i ) / 255.0f;
+     }
+     std::array< float, 256 > srgb_table{};
+     for ( std::size_t i = 0; i < srgb_table.size(); i++ )
+     {
+          srgb_table[ i ] = srgb_to_linear( table[ i ] );
+     }
+     for ( std::size_t i = 0; i < image.texels.size(); i++ )
+     {
+          bool alpha = ( channels == 4 && i % 4 == 3 );
+          const auto& lookup = ( srgb && !alpha ) ? srgb_table : table;
+          image.texels[ i ] = lookup[ std::to_integer< std::size_t >( data[ i ] ) ];
+     }
+     return image;
+}
+
+
+/// @brief Convert linear image to texture data.
+_16nar::DataSharedPtr from_linear( const LinearImage& image, int channels, bool srgb, bool is_float,
+     std::size_t& data_size )
+{
+     data_size = image.texels.size() * ( is_float ? sizeof( float ) : sizeof( std::byte ) );
+     _16nar::DataSharedPtr data{ new std::byte[ data_size ], std::default_delete< std::byte[] >() };
+     if ( is_float )
+     {
+          std::memcpy( data.get(), image.texels.data(), data_size );
+          return data;
+     }
+     for ( std::size_t i = 0; i < image.texels.size(); i++ )
+     {
+          bool alpha = ( channels == 4 && i % 4 == 3 );
+          float value = std::clamp( image.texels[ i ], 0.0f, 1.0f );
+          value = ( srgb && !alpha ) ? linear_to_srgb( value ) : value;
+          data.get()[ i ] = static_cast< std::byte >( static_cast< int >( value * 255.0f + 0.5f ) );
+     }
+     return data;
+}
+
+
+/// @brief Make image of the next mip level with 2x2 box filter.
+/// @details Odd last row or column of the source is clamped, so it is averaged with its neighbour.
+LinearImage downsample( const LinearImage& src, int channels )
+{
+     _16nar::Vec2i size{ std::max( src.size.x() / 2, 1 ), std::max( src.size.y() / 2, 1 ) };
+     LinearImage dst{ std::vector< float >( static_cast< std::size_t >( size.x() ) * size.y() * channels ), size };
+     std::size_t src_row = static_cast< std::size_t >( src.size.x() ) * channels;
+     std::vector< float > row_sum( src_row );
+     for ( int y = 0; y < size.y(); y++ )
+     {
+          const float *row0 = src.texels.data() + std::min( 2 * y, src.size.y() - 1 ) * src_row;
+          const float *row1 = src.texels.data() + std::min( 2 * y + 1, src.size.y() - 1 ) * src_row;
+          // vertical pass goes over contiguous rows, so it is vectorized by compiler
+          for ( std::size_t i = 0; i < src_row; i++ )
+          {
+               row_sum[ i ] = row0[ i ] + row1[ i ];
+          }
+          float *out = dst.texels.data() + static_cast< std::size_t >( y ) * size.x() * channels;
+          for ( int x = 0; x < size.x(); x++ )
+          {
+               std::size_t left = static_cast< std::size_t >( std::min( 2 * x, src.size.x() - 1 ) ) * channels;
+               std::size_t right = static_cast< std::size_t >( std::min( 2 * x + 1, src.size.x() - 1 ) ) * channels;
+               for ( int c = 0; c < channels; c++ )
+               {
+                    out[ x * channels + c ] = 0.25f * ( row_sum[ left + c ] + row_sum[ right + c ] );
+               }
+          }
+     }
+     return dst;
+}
+
+} // anonymous namespace
+
+
+namespace _16nar::tools
+{
+
+bool uses_mipmaps( TextureFilter filter ) noexcept
+{
+     return filter == TextureFilter::NearestMipmapNearest || filter == TextureFilter::NearestMipmapLinear
+          || filter == TextureFilter::LinearMipmapNearest || filter == TextureFilter::LinearMipmapLinear;
+}
+
+
+void generate_mipmaps( ResourceData& texture )
+{
+     auto *params = ( texture.type == ResourceType::Texture ) ?
+          std::any_cast< LoadParams< ResourceType::Texture > >( &texture.params ) : nullptr;
+     if ( !params )
+     {
+          throw std::runtime_error{ "resource " + texture.name + " is not a texture" };
+     }
+     if ( params->data_type != DataType::Byte && params->data_type != DataType::Float )
+     {
+          throw std::runtime_error{ "texture " + texture.name + " must have byte or float data for mip levels" };
+     }
+     int channels = get_channel_count( params->format );
+     bool is_float = ( params->data_type == DataType::Float );
+     bool srgb = ( params->format == BufferDataFormat::Srgb || params->format == BufferDataFormat::Srgba );
+     std::size_t data_size = static_cast< std::size_t >( params->size.x() ) * params->size.y() * channels
+          * ( is_float ? sizeof( float ) : sizeof( std::byte ) );
+     if ( params->samples != 0 || !params->data || texture.data_sizes.empty()
+          || texture.data_sizes.front() < data_size || data_size == 0 )
+     {
+          throw std::runtime_error{ "texture " + texture.name + " has no data for mip levels" };
+     }
+
+     params->mipmaps.clear();
+     texture.data_sizes.resize( 1 );
+     LinearImage image = to_linear( params->data.get(), params->size, channels, srgb, is_float );
+     while ( image.size.x() > 1 || image.size.y() > 1 )
+     {
+          image = downsample( image, channels );
+          std::size_t level_size = 0;
+          params->mipmaps.emplace_back( from_linear( image, channels, srgb, is_float, level_size ) );
+          texture.data_sizes.emplace_back( static_cast< uint32_t >( level_size ) );
+     }
+}
+
+} // namespace _16nar::tools
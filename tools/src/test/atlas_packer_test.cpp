@@ -0,0 +1,136 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <16nar/tools/atlas_packer.h>
+#include <16nar/render/render_defs.h>
+
+#include <vector>
+#include <stdexcept>
+
+namespace
+{
+
+using Placement = _16nar::tools::AtlasPacker::Placement;
+using TextureParams = _16nar::LoadParams< _16nar::ResourceType::Texture >;
+using AtlasParams = _16nar::LoadParams< _16nar::ResourceType::Atlas >;
+
+
+bool overlap( const Placement& lhs, const _16nar::Vec2i& lhs_size,
+     const Placement& rhs, const _16nar::Vec2i& rhs_size, int padding )
+{
+     _16nar::Vec2i lsize = lhs.rotated ? _16nar::Vec2i{ lhs_size.y(), lhs_size.x() } : lhs_size;
+     _16nar::Vec2i rsize = rhs.rotated ? _16nar::Vec2i{ rhs_size.y(), rhs_size.x() } : rhs_size;
+     return lhs.page == rhs.page
+          && lhs.position.x() < rhs.position.x() + rsize.x() + padding
+          && rhs.position.x() < lhs.position.x() + lsize.x() + padding
+          && lhs.position.y() < rhs.position.y() + rsize.y() + padding
+          && rhs.position.y() < lhs.position.y() + lsize.y() + padding;
+}
+
+
+_16nar::tools::ResourceData make_texture( const std::string& name, int width, int height, std::byte value )
+{
+     TextureParams params{};
+     params.format = _16nar::BufferDataFormat::Rgba;
+     params.size = _16nar::Vec2i{ width, height };
+     std::size_t data_size = width * height * 4;
+     params.data = _16nar::DataSharedPtr{ new std::byte[ data_size ], std::default_delete< std::byte[] >() };
+     for ( std::size_t i = 0; i < data_size; i++ )
+     {
+          params.data.get()[ i ] = value;
+     }
+     _16nar::tools::ResourceData data{};
+     data.name = name;
+     data.type = _16nar::ResourceType::Texture;
+     data.data_sizes.push_back( static_cast< uint32_t >( data_size ) );
+     data.params = std::any{ params };
+     return data;
+}
+
+
+TEST_CASE( "Rectangles packing", "[atlas_packer]" )
+{
+     const int padding = 2;
+     std::vector< _16nar::Vec2i > sizes{ { 30, 20 }, { 60, 60 }, { 10, 50 }, { 25, 25 }, { 40, 10 }, { 8, 8 } };
+     _16nar::tools::AtlasPacker packer{ _16nar::Vec2i{ 128, 128 }, padding, false };
+     auto placements = packer.pack( sizes );
+     REQUIRE( placements.size() == sizes.size() );
+     REQUIRE( packer.get_page_count() == 1 );
+     for ( std::size_t i = 0; i < sizes.size(); i++ )
+     {
+          REQUIRE_FALSE( placements[ i ].rotated );
+          REQUIRE( placements[ i ].position.x() >= padding );
+          REQUIRE( placements[ i ].position.y() >= padding );
+          REQUIRE( placements[ i ].position.x() + sizes[ i ].x() + padding <= packer.get_used_size( 0 ).x() );
+          REQUIRE( placements[ i ].position.y() + sizes[ i ].y() + padding <= packer.get_used_size( 0 ).y() );
+          for ( std::size_t j = i + 1; j < sizes.size(); j++ )
+          {
+               REQUIRE_FALSE( overlap( placements[ i ], sizes[ i ], placements[ j ], sizes[ j ], padding ) );
+          }
+     }
+     REQUIRE( packer.get_used_size( 0 ).x() <= 128 );
+     REQUIRE( packer.get_used_size( 0 ).y() <= 128 );
+
+     // rectangles which do not fit together are placed on several pages
+     auto big = packer.pack( { { 100, 100 }, { 100, 100 }, { 20, 20 } } );
+     REQUIRE( packer.get_page_count() == 2 );
+     REQUIRE( big[ 0 ].page != big[ 1 ].page );
+     REQUIRE_THROWS_AS( packer.pack( { { 200, 10 } } ), std::runtime_error );
+
+     // tall rectangle fits into wide page only if rotated
+     _16nar::tools::AtlasPacker rotating{ _16nar::Vec2i{ 128, 32 }, 0, true };
+     auto rotated = rotating.pack( { { 16, 100 } } );
+     REQUIRE( rotated[ 0 ].rotated );
+     REQUIRE( rotating.get_used_size( 0 ) == _16nar::Vec2i{ 100, 16 } );
+}
+
+
+TEST_CASE( "Texture atlas creation", "[atlas_packer]" )
+{
+     std::vector< _16nar::tools::ResourceData > textures{
+          make_texture( "hero", 16, 8, std::byte{ 1 } ),
+          make_texture( "coin", 4, 4, std::byte{ 2 } )
+     };
+     _16nar::tools::AtlasSettings settings{};
+     settings.name = "sprites";
+     settings.page_size = _16nar::Vec2i{ 64, 64 };
+     settings.padding = 1;
+     auto result = _16nar::tools::make_atlas( textures, settings );
+     REQUIRE( result.size() == 2 );
+     REQUIRE( result[ 0 ].type == _16nar::ResourceType::Texture );
+     REQUIRE( result[ 0 ].name == "sprites_page0" );
+     REQUIRE( result[ 1 ].type == _16nar::ResourceType::Atlas );
+     REQUIRE( result[ 1 ].name == "sprites" );
+
+     auto page = std::any_cast< TextureParams >( result[ 0 ].params );
+     REQUIRE( page.format == _16nar::BufferDataFormat::Rgba );
+     REQUIRE( result[ 0 ].data_sizes.at( 0 ) == static_cast< uint32_t >( page.size.x() * page.size.y() * 4 ) );
+
+     auto atlas = std::any_cast< AtlasParams >( result[ 1 ].params );
+     REQUIRE( atlas.page_names == std::vector< std::string >{ "sprites_page0" } );
+     REQUIRE( atlas.regions.size() == 2 );
+     for ( std::size_t i = 0; i < textures.size(); i++ )
+     {
+          const auto& region = atlas.regions[ i ];
+          auto src = std::any_cast< TextureParams >( textures[ i ].params );
+          REQUIRE( region.name == textures[ i ].name );
+          REQUIRE( region.page == 0 );
+          REQUIRE_FALSE( region.rotated );
+          int x = static_cast< int >( region.position.x() * page.size.x() + 0.5f );
+          int y = static_cast< int >( region.position.y() * page.size.y() + 0.5f );
+          REQUIRE( static_cast< int >( region.size.x() * page.size.x() + 0.5f ) == src.size.x() );
+          REQUIRE( static_cast< int >( region.size.y() * page.size.y() + 0.5f ) == src.size.y() );
+          // all texels of sub-image are copied, texels around it are empty
+          REQUIRE( page.data.get()[ ( y * page.size.x() + x ) * 4 ] == src.data.get()[ 0 ] );
+          REQUIRE( page.data.get()[ ( ( y + src.size.y() - 1 ) * page.size.x() + x + src.size.x() - 1 ) * 4 + 3 ]
+               == src.data.get()[ 0 ] );
+          REQUIRE( page.data.get()[ ( ( y - 1 ) * page.size.x() + x ) * 4 ] == std::byte{ 0 } );
+     }
+
+     textures.push_back( make_texture( "other", 4, 4, std::byte{ 3 } ) );
+     auto other = std::any_cast< TextureParams >( textures.back().params );
+     other.data_type = _16nar::DataType::Float;
+     textures.back().params = std::any{ other };
+     REQUIRE_THROWS_AS( _16nar::tools::make_atlas( textures, settings ), std::runtime_error );
+}
+
+}
@@ -3,6 +3,7 @@
 #include <16nar/tools/json_asset_reader.h>
 #include <16nar/tools/flatbuffers_asset_reader.h>
 #include <16nar/tools/flatbuffers_asset_writer.h>
+#include <16nar/tools/mipmap_generator.h>
 #include <16nar/render/render_defs.h>
 
 #include <fstream>
@@ -52,6 +53,20 @@ TEST_CASE( "Textures reading and writing in flatbuffers format", "[flatbuffers_r
      REQUIRE( tex_data.samples == 0 );
      REQUIRE( tex_data.size == _16nar::Vec2i{ 64, 64 } );
      REQUIRE( tex_data.border_color == _16nar::Vec4f{ 0.8f, 0.24f, 0.55f, 1.0f } );
+     REQUIRE( tex_data.mipmaps.empty() );
+
+     // mip levels are stored as additional data units
+     _16nar::tools::generate_mipmaps( data );
+     std::ofstream mip_ofs{ "data/out/test_texture_mipmaps.narasset", std::ios::out | std::ios::binary };
+     writer.write_asset( mip_ofs, data );
+     mip_ofs.close();
+
+     std::ifstream mip_ifs{ "data/out/test_texture_mipmaps.narasset", std::ios::in | std::ios::binary };
+     read_data = reader.read_asset( mip_ifs );
+     mip_ifs.close();
+     REQUIRE( read_data.data_sizes == data.data_sizes );
+     tex_data = std::any_cast< _16nar::LoadParams< _16nar::ResourceType::Texture > >( read_data.params );
+     REQUIRE( tex_data.mipmaps.size() == 6 );
 }
 
 
@@ -133,9 +148,14 @@ TEST_CASE( "Vertex buffers reading and writing in flatbuffers format", "[flatbuf
      REQUIRE( vb_data.attributes[ 0 ].size == 2 );
      REQUIRE( vb_data.attributes[ 0 ].data_type == _16nar::DataType::Float );
      REQUIRE( vb_data.attributes[ 0 ].normalized == true );
+     REQUIRE( vb_data.attributes[ 0 ].divisor == 0 );
      REQUIRE( vb_data.attributes[ 1 ].size == 2 );
      REQUIRE( vb_data.attributes[ 1 ].data_type == _16nar::DataType::Float );
      REQUIRE( vb_data.attributes[ 1 ].normalized == false );
+     REQUIRE( vb_data.attributes[ 1 ].divisor == 0 );
+     REQUIRE( vb_data.attributes[ 1 ].offset == 8 );
+     REQUIRE( vb_data.attributes[ 1 ].stride == 16 );
+     REQUIRE( vb_data.index_type == _16nar::DataType::UnsignedInt );
      REQUIRE( vb_data.buffer.size == 16 );
      REQUIRE( vb_data.buffer.type == _16nar::BufferType::DynamicDraw );
      REQUIRE( vb_data.index_buffer.size == 16 );
@@ -143,6 +163,46 @@ TEST_CASE( "Vertex buffers reading and writing in flatbuffers format", "[flatbuf
 }
 
 
+TEST_CASE( "Compact and instanced vertex buffers reading and writing in flatbuffers format", "[flatbuffers_resources]" )
+{
+     if ( !fs::exists( "data/out" ) && !fs::create_directories( "data/out" ) )
+     {
+          throw std::runtime_error{ "cannot create output directory" };
+     }
+     _16nar::tools::JsonAssetReader json_reader{ "data" };
+     _16nar::tools::FlatBuffersAssetReader reader{};
+     _16nar::tools::FlatBuffersAssetWriter writer{};
+
+     std::ifstream json_ifs{ "data/test_vertex_buffer_compact.json" };
+     _16nar::tools::ResourceData data = json_reader.read_asset( json_ifs );
+     json_ifs.close();
+
+     std::ofstream ofs{ "data/out/test_vertex_buffer_compact.narasset", std::ios::out | std::ios::binary };
+     writer.write_asset( ofs, data );
+     ofs.close();
+
+     std::ifstream ifs{ "data/out/test_vertex_buffer_compact.narasset", std::ios::in | std::ios::binary };
+     _16nar::tools::ResourceData read_data = reader.read_asset( ifs );
+     ifs.close();
+
+     REQUIRE( read_data.type == _16nar::ResourceType::VertexBuffer );
+     REQUIRE( read_data.name == "test_vertex_buffer_compact" );
+
+     auto vb_data = std::any_cast< _16nar::LoadParams< _16nar::ResourceType::VertexBuffer > >( read_data.params );
+     REQUIRE( vb_data.attributes.size() == 2 );
+     REQUIRE( vb_data.attributes[ 0 ].data_type == _16nar::DataType::HalfFloat );
+     REQUIRE( vb_data.attributes[ 0 ].divisor == 0 );
+     REQUIRE( vb_data.attributes[ 0 ].offset == 0 );
+     REQUIRE( vb_data.attributes[ 0 ].stride == 8 );
+     REQUIRE( vb_data.attributes[ 1 ].data_type == _16nar::DataType::UnsignedShort );
+     REQUIRE( vb_data.attributes[ 1 ].normalized == true );
+     REQUIRE( vb_data.attributes[ 1 ].divisor == 1 );
+     REQUIRE( vb_data.attributes[ 1 ].offset == 4 );
+     REQUIRE( vb_data.attributes[ 1 ].stride == 8 );
+     REQUIRE( vb_data.index_type == _16nar::DataType::UnsignedShort );
+}
+
+
 TEST_CASE( "Cubemaps reading and writing in flatbuffers format", "[flatbuffers_resources]" )
 {
      if ( !fs::exists( "data/out" ) && !fs::create_directories( "data/out" ) )
@@ -188,6 +248,133 @@ TEST_CASE( "Cubemaps reading and writing in flatbuffers format", "[flatbuffers_r
 }
 
 
+TEST_CASE( "Texture arrays reading and writing in flatbuffers format", "[flatbuffers_resources]" )
+{
+     if ( !fs::exists( "data/out" ) && !fs::create_directories( "data/out" ) )
+     {
+          throw std::runtime_error{ "cannot create output directory" };
+     }
+     _16nar::tools::JsonAssetReader json_reader{ "data" };
+     _16nar::tools::FlatBuffersAssetReader reader{};
+     _16nar::tools::FlatBuffersAssetWriter writer{};
+
+     std::ifstream json_ifs{ "data/test_texture_array.json" };
+     _16nar::tools::ResourceData data = json_reader.read_asset( json_ifs );
+     json_ifs.close();
+
+     std::ofstream ofs{ "data/out/test_texture_array.narasset", std::ios::out | std::ios::binary };
+     writer.write_asset( ofs, data );
+     ofs.close();
+
+     std::ifstream ifs{ "data/out/test_texture_array.narasset", std::ios::in | std::ios::binary };
+     _16nar::tools::ResourceData read_data = reader.read_asset( ifs );
+     ifs.close();
+
+     REQUIRE( read_data.type == _16nar::ResourceType::TextureArray );
+     REQUIRE( read_data.data_sizes.size() == 3 );
+     REQUIRE( read_data.data_sizes.at( 0 ) == 64 * 64 * 3 * sizeof( std::byte ) );
+     REQUIRE( read_data.data_sizes.at( 2 ) == 64 * 64 * 3 * sizeof( std::byte ) );
+     REQUIRE( read_data.name == "test_texture_array" );
+
+     auto ta_data = std::any_cast< _16nar::LoadParams< _16nar::ResourceType::TextureArray > >( read_data.params );
+     REQUIRE( ta_data.format == _16nar::BufferDataFormat::Rgb );
+     REQUIRE( ta_data.min_filter == _16nar::TextureFilter::Linear );
+     REQUIRE( ta_data.mag_filter == _16nar::TextureFilter::Nearest );
+     REQUIRE( ta_data.wrap_x == _16nar::TextureWrap::ClampToEdge );
+     REQUIRE( ta_data.wrap_y == _16nar::TextureWrap::Repeat );
+     REQUIRE( ta_data.data_type == _16nar::DataType::Byte );
+     REQUIRE( ta_data.size == _16nar::Vec2i{ 64, 64 } );
+     REQUIRE( ta_data.border_color == _16nar::Vec4f{ 0.1f, 0.2f, 0.3f, 1.0f } );
+     REQUIRE( ta_data.data.size() == 3 );
+}
+
+
+TEST_CASE( "Materials reading and writing in flatbuffers format", "[flatbuffers_resources]" )
+{
+     if ( !fs::exists( "data/out" ) && !fs::create_directories( "data/out" ) )
+     {
+          throw std::runtime_error{ "cannot create output directory" };
+     }
+     _16nar::tools::JsonAssetReader json_reader{ "data" };
+     _16nar::tools::FlatBuffersAssetReader reader{};
+     _16nar::tools::FlatBuffersAssetWriter writer{};
+
+     std::ifstream json_ifs{ "data/test_material.json" };
+     _16nar::tools::ResourceData data = json_reader.read_asset( json_ifs );
+     json_ifs.close();
+
+     std::ofstream ofs{ "data/out/test_material.narasset", std::ios::out | std::ios::binary };
+     writer.write_asset( ofs, data );
+     ofs.close();
+
+     std::ifstream ifs{ "data/out/test_material.narasset", std::ios::in | std::ios::binary };
+     _16nar::tools::ResourceData read_data = reader.read_asset( ifs );
+     ifs.close();
+
+     REQUIRE( read_data.type == _16nar::ResourceType::Material );
+     REQUIRE( read_data.data_sizes.empty() );
+     REQUIRE( read_data.name == "test_material" );
+
+     auto mat_data = std::any_cast< _16nar::LoadParams< _16nar::ResourceType::Material > >( read_data.params );
+     REQUIRE( mat_data.shader_name == "test_shader" );
+     REQUIRE( mat_data.texture_names.size() == 2 );
+     REQUIRE( mat_data.texture_names.at( 0 ) == "test_texture" );
+     REQUIRE( mat_data.texture_names.at( 1 ) == "other_package/normal_map" );
+     REQUIRE( mat_data.texture_array_names == std::vector< std::string >{ "test_texture_array" } );
+     REQUIRE( mat_data.uniforms.size() == 4 );
+     REQUIRE( mat_data.uniforms.at( 0 ).name == "color" );
+     REQUIRE( std::get< _16nar::Vec4f >( mat_data.uniforms.at( 0 ).value ) == _16nar::Vec4f{ 1.0f, 0.5f, 0.25f, 1.0f } );
+     REQUIRE( mat_data.uniforms.at( 1 ).name == "frame" );
+     REQUIRE( std::get< int >( mat_data.uniforms.at( 1 ).value ) == 3 );
+     REQUIRE( mat_data.uniforms.at( 2 ).name == "flip" );
+     REQUIRE( std::get< bool >( mat_data.uniforms.at( 2 ).value ) == true );
+     REQUIRE( mat_data.uniforms.at( 3 ).name == "offset" );
+     REQUIRE( std::get< _16nar::Vec2i >( mat_data.uniforms.at( 3 ).value ) == _16nar::Vec2i{ -4, 8 } );
+}
+
+
+TEST_CASE( "Atlases reading and writing in flatbuffers format", "[flatbuffers_resources]" )
+{
+     if ( !fs::exists( "data/out" ) && !fs::create_directories( "data/out" ) )
+     {
+          throw std::runtime_error{ "cannot create output directory" };
+     }
+     _16nar::tools::JsonAssetReader json_reader{ "data" };
+     _16nar::tools::FlatBuffersAssetReader reader{};
+     _16nar::tools::FlatBuffersAssetWriter writer{};
+
+     std::ifstream json_ifs{ "data/test_atlas.json" };
+     _16nar::tools::ResourceData data = json_reader.read_asset( json_ifs );
+     json_ifs.close();
+
+     std::ofstream ofs{ "data/out/test_atlas.narasset", std::ios::out | std::ios::binary };
+     writer.write_asset( ofs, data );
+     ofs.close();
+
+     std::ifstream ifs{ "data/out/test_atlas.narasset", std::ios::in | std::ios::binary };
+     _16nar::tools::ResourceData read_data = reader.read_asset( ifs );
+     ifs.close();
+
+     REQUIRE( read_data.type == _16nar::ResourceType::Atlas );
+     REQUIRE( read_data.data_sizes.empty() );
+     REQUIRE( read_data.name == "test_atlas" );
+
+     auto atlas_data = std::any_cast< _16nar::LoadParams< _16nar::ResourceType::Atlas > >( read_data.params );
+     REQUIRE( atlas_data.page_names == std::vector< std::string >{ "test_atlas_page0", "test_atlas_page1" } );
+     REQUIRE( atlas_data.regions.size() == 2 );
+     REQUIRE( atlas_data.regions.at( 0 ).name == "hero" );
+     REQUIRE( atlas_data.regions.at( 0 ).page == 0 );
+     REQUIRE( atlas_data.regions.at( 0 ).position == _16nar::Vec2f{ 0.0f, 0.5f } );
+     REQUIRE( atlas_data.regions.at( 0 ).size == _16nar::Vec2f{ 0.25f, 0.5f } );
+     REQUIRE( atlas_data.regions.at( 0 ).rotated == false );
+     REQUIRE( atlas_data.regions.at( 1 ).name == "coin" );
+     REQUIRE( atlas_data.regions.at( 1 ).page == 1 );
+     REQUIRE( atlas_data.regions.at( 1 ).position == _16nar::Vec2f{ 0.5f, 0.0f } );
+     REQUIRE( atlas_data.regions.at( 1 ).size == _16nar::Vec2f{ 0.125f, 0.25f } );
+     REQUIRE( atlas_data.regions.at( 1 ).rotated == true );
+}
+
+
 TEST_CASE( "Packages reading and writing in flatbuffers format", "[flatbuffers_resources]" )
 {
      if ( !fs::exists( "data/out" ) && !fs::create_directories( "data/out" ) )
@@ -2,6 +2,7 @@
 
 #include <16nar/tools/json_asset_reader.h>
 #include <16nar/tools/json_asset_writer.h>
+#include <16nar/tools/mipmap_generator.h>
 #include <16nar/render/render_defs.h>
 
 #include <nlohmann/json.hpp>
@@ -9,6 +10,7 @@
 #include <fstream>
 #include <filesystem>
 #include <vector>
+#include <cstring>
 #include <stdexcept>
 
 namespace fs = std::filesystem;
@@ -61,6 +63,49 @@ TEST_CASE( "Textures reading and writing in JSON format", "[json_resources]" )
      REQUIRE( written[ "data_type" ] == "byte" );
      REQUIRE( written[ "raw" ] == true );
      REQUIRE( written[ "file" ] == "test_texture_texture.bin" );
+     REQUIRE_FALSE( written.contains( "mipmaps" ) );
+}
+
+
+TEST_CASE( "Textures with mip levels reading and writing in JSON format", "[json_resources]" )
+{
+     if ( !fs::exists( "data/out" ) && !fs::create_directories( "data/out" ) )
+     {
+          throw std::runtime_error{ "cannot create output directory" };
+     }
+     _16nar::tools::JsonAssetReader reader{ "data" };
+     _16nar::tools::JsonAssetWriter writer{ "data/out" };
+
+     std::ifstream ifs{ "data/test_texture.json" };
+     _16nar::tools::ResourceData data = reader.read_asset( ifs );
+     ifs.close();
+     _16nar::tools::generate_mipmaps( data );
+     REQUIRE( data.data_sizes.size() == 7 );
+     REQUIRE( data.data_sizes.at( 1 ) == 32 * 32 * 4 * sizeof( std::byte ) );
+     REQUIRE( data.data_sizes.at( 6 ) == 4 * sizeof( std::byte ) );
+
+     data.name = "test_texture_mipmaps";
+     std::ofstream ofs{ "data/out/" + data.name + "_out." + writer.get_file_ext() };
+     writer.write_asset( ofs, data );
+     ofs.close();
+
+     std::ifstream ifs_written{ "data/out/test_texture_mipmaps_out.json" };
+     auto written = nlohmann::json::parse( ifs_written );
+     ifs_written.close();
+     std::vector< std::string > files = written[ "mipmaps" ];
+     REQUIRE( files.size() == 6 );
+     REQUIRE( files.at( 0 ) == "test_texture_mipmaps_mipmap1.bin" );
+     REQUIRE( files.at( 5 ) == "test_texture_mipmaps_mipmap6.bin" );
+
+     _16nar::tools::JsonAssetReader out_reader{ "data/out" };
+     std::ifstream ifs_out{ "data/out/test_texture_mipmaps_out.json" };
+     auto read_data = out_reader.read_asset( ifs_out );
+     auto tex_data = std::any_cast< _16nar::LoadParams< _16nar::ResourceType::Texture > >( data.params );
+     auto read_tex_data = std::any_cast< _16nar::LoadParams< _16nar::ResourceType::Texture > >( read_data.params );
+     REQUIRE( read_data.data_sizes == data.data_sizes );
+     REQUIRE( read_tex_data.mipmaps.size() == 6 );
+     REQUIRE( std::memcmp( read_tex_data.mipmaps.at( 2 ).get(), tex_data.mipmaps.at( 2 ).get(),
+          data.data_sizes.at( 3 ) ) == 0 );
 }
 
 
@@ -148,9 +193,17 @@ TEST_CASE( "Vertex buffers reading and writing in JSON format", "[json_resources
      REQUIRE( vb_data.attributes[ 0 ].size == 2 );
      REQUIRE( vb_data.attributes[ 0 ].data_type == _16nar::DataType::Float );
      REQUIRE( vb_data.attributes[ 0 ].normalized == true );
+     REQUIRE( vb_data.attributes[ 0 ].divisor == 0 );
      REQUIRE( vb_data.attributes[ 1 ].size == 2 );
      REQUIRE( vb_data.attributes[ 1 ].data_type == _16nar::DataType::Float );
      REQUIRE( vb_data.attributes[ 1 ].normalized == false );
+     REQUIRE( vb_data.attributes[ 1 ].divisor == 0 );
+     // interleaved layout is used when offsets and strides are not set
+     REQUIRE( vb_data.attributes[ 0 ].offset == 0 );
+     REQUIRE( vb_data.attributes[ 0 ].stride == 16 );
+     REQUIRE( vb_data.attributes[ 1 ].offset == 8 );
+     REQUIRE( vb_data.attributes[ 1 ].stride == 16 );
+     REQUIRE( vb_data.index_type == _16nar::DataType::UnsignedInt );
      REQUIRE( vb_data.buffer.size == 16 );
      REQUIRE( vb_data.buffer.type == _16nar::BufferType::DynamicDraw );
      REQUIRE( vb_data.index_buffer.size == 16 );
@@ -169,6 +222,7 @@ TEST_CASE( "Vertex buffers reading and writing in JSON format", "[json_resources
      REQUIRE( written[ "buffer" ][ "type" ] == "dynamic_draw" );
      REQUIRE( written[ "index_buffer" ][ "file" ] == "test_vertex_buffer_index_buffer.bin" );
      REQUIRE( written[ "index_buffer" ][ "type" ] == "static_draw" );
+     REQUIRE( written[ "index_type" ] == "unsigned_int" );
 
      std::vector< nlohmann::json > attributes = written[ "attributes" ];
      REQUIRE( attributes.size() == 2 );
@@ -178,6 +232,63 @@ TEST_CASE( "Vertex buffers reading and writing in JSON format", "[json_resources
      REQUIRE( attributes[ 1 ][ "data_type" ] == "float" );
      REQUIRE( attributes[ 1 ][ "size" ] == 2 );
      REQUIRE( attributes[ 1 ][ "normalized" ] == false );
+     REQUIRE( attributes[ 1 ][ "divisor" ] == 0 );
+     REQUIRE( attributes[ 1 ][ "offset" ] == 8 );
+     REQUIRE( attributes[ 1 ][ "stride" ] == 16 );
+}
+
+
+TEST_CASE( "Compact and instanced vertex buffers reading and writing in JSON format", "[json_resources]" )
+{
+     if ( !fs::exists( "data/out" ) && !fs::create_directories( "data/out" ) )
+     {
+          throw std::runtime_error{ "cannot create output directory" };
+     }
+     _16nar::tools::JsonAssetReader reader{ "data" };
+     _16nar::tools::JsonAssetWriter writer{ "data/out" };
+
+     std::ifstream ifs{ "data/test_vertex_buffer_compact.json" };
+     _16nar::tools::ResourceData data = reader.read_asset( ifs );
+     ifs.close();
+
+     REQUIRE( data.type == _16nar::ResourceType::VertexBuffer );
+     REQUIRE( data.name == "test_vertex_buffer_compact" );
+
+     auto vb_data = std::any_cast< _16nar::LoadParams< _16nar::ResourceType::VertexBuffer > >( data.params );
+     REQUIRE( vb_data.attributes.size() == 2 );
+     REQUIRE( vb_data.attributes[ 0 ].size == 2 );
+     REQUIRE( vb_data.attributes[ 0 ].data_type == _16nar::DataType::HalfFloat );
+     REQUIRE( vb_data.attributes[ 0 ].normalized == false );
+     REQUIRE( vb_data.attributes[ 0 ].divisor == 0 );
+     REQUIRE( vb_data.attributes[ 0 ].offset == 0 );
+     REQUIRE( vb_data.attributes[ 0 ].stride == 8 );
+     REQUIRE( vb_data.attributes[ 1 ].size == 2 );
+     REQUIRE( vb_data.attributes[ 1 ].data_type == _16nar::DataType::UnsignedShort );
+     REQUIRE( vb_data.attributes[ 1 ].normalized == true );
+     REQUIRE( vb_data.attributes[ 1 ].divisor == 1 );
+     REQUIRE( vb_data.attributes[ 1 ].offset == 4 );
+     REQUIRE( vb_data.attributes[ 1 ].stride == 8 );
+     REQUIRE( vb_data.index_type == _16nar::DataType::UnsignedShort );
+
+     std::ofstream ofs{ "data/out/" + data.name + "_out." + writer.get_file_ext() };
+     writer.write_asset( ofs, data );
+     ofs.close();
+
+     std::ifstream ifs_written{ "data/out/test_vertex_buffer_compact_out.json" };
+     auto written = nlohmann::json::parse( ifs_written );
+     REQUIRE( written[ "index_type" ] == "unsigned_short" );
+
+     std::vector< nlohmann::json > attributes = written[ "attributes" ];
+     REQUIRE( attributes.size() == 2 );
+     REQUIRE( attributes[ 0 ][ "data_type" ] == "half_float" );
+     REQUIRE( attributes[ 0 ][ "divisor" ] == 0 );
+     REQUIRE( attributes[ 0 ][ "offset" ] == 0 );
+     REQUIRE( attributes[ 0 ][ "stride" ] == 8 );
+     REQUIRE( attributes[ 1 ][ "data_type" ] == "unsigned_short" );
+     REQUIRE( attributes[ 1 ][ "normalized" ] == true );
+     REQUIRE( attributes[ 1 ][ "divisor" ] == 1 );
+     REQUIRE( attributes[ 1 ][ "offset" ] == 4 );
+     REQUIRE( attributes[ 1 ][ "stride" ] == 8 );
 }
 
 
@@ -243,6 +354,169 @@ TEST_CASE( "Cubemaps reading and writing in JSON format", "[json_resources]" )
 }
 
 
+TEST_CASE( "Texture arrays reading and writing in JSON format", "[json_resources]" )
+{
+     if ( !fs::exists( "data/out" ) && !fs::create_directories( "data/out" ) )
+     {
+          throw std::runtime_error{ "cannot create output directory" };
+     }
+     _16nar::tools::JsonAssetReader reader{ "data" };
+     _16nar::tools::JsonAssetWriter writer{ "data/out" };
+
+     std::ifstream ifs{ "data/test_texture_array.json" };
+     _16nar::tools::ResourceData data = reader.read_asset( ifs );
+     ifs.close();
+
+     REQUIRE( data.type == _16nar::ResourceType::TextureArray );
+     REQUIRE( data.name == "test_texture_array" );
+     REQUIRE( data.data_sizes.size() == 3 );
+     REQUIRE( data.data_sizes.at( 0 ) == 64 * 64 * 3 * sizeof( std::byte ) );
+     REQUIRE( data.data_sizes.at( 2 ) == 64 * 64 * 3 * sizeof( std::byte ) );
+
+     auto ta_data = std::any_cast< _16nar::LoadParams< _16nar::ResourceType::TextureArray > >( data.params );
+     REQUIRE( ta_data.format == _16nar::BufferDataFormat::Rgb );
+     REQUIRE( ta_data.min_filter == _16nar::TextureFilter::Linear );
+     REQUIRE( ta_data.mag_filter == _16nar::TextureFilter::Nearest );
+     REQUIRE( ta_data.wrap_x == _16nar::TextureWrap::ClampToEdge );
+     REQUIRE( ta_data.wrap_y == _16nar::TextureWrap::Repeat );
+     REQUIRE( ta_data.data_type == _16nar::DataType::Byte );
+     REQUIRE( ta_data.size == _16nar::Vec2i{ 64, 64 } );
+     REQUIRE( ta_data.border_color == _16nar::Vec4f{ 0.1f, 0.2f, 0.3f, 1.0f } );
+     REQUIRE( ta_data.data.size() == 3 );
+
+     std::ofstream ofs{ "data/out/" + data.name + "_out." + writer.get_file_ext() };
+     writer.write_asset( ofs, data );
+     ofs.close();
+
+     std::ifstream ifs_written{ "data/out/test_texture_array_out.json" };
+     auto written = nlohmann::json::parse( ifs_written );
+     REQUIRE( written[ "type" ] == "texture_array" );
+     REQUIRE( written[ "name" ] == "test_texture_array" );
+     REQUIRE( written[ "wrap_y" ] == "repeat" );
+     REQUIRE( written[ "raw" ] == true );
+     REQUIRE( written[ "files" ] == std::vector< std::string >{
+          "test_texture_array_layer0.bin", "test_texture_array_layer1.bin", "test_texture_array_layer2.bin" } );
+
+     // raw layers written above are read back with the same data
+     std::ifstream ifs_raw{ "data/out/test_texture_array_out.json" };
+     _16nar::tools::JsonAssetReader raw_reader{ "data/out" };
+     auto raw_data = raw_reader.read_asset( ifs_raw );
+     auto raw_params = std::any_cast< _16nar::LoadParams< _16nar::ResourceType::TextureArray > >( raw_data.params );
+     REQUIRE( raw_data.data_sizes == data.data_sizes );
+     REQUIRE( std::memcmp( raw_params.data.at( 1 ).get(), ta_data.data.at( 1 ).get(), data.data_sizes.at( 1 ) ) == 0 );
+}
+
+
+TEST_CASE( "Materials reading and writing in JSON format", "[json_resources]" )
+{
+     if ( !fs::exists( "data/out" ) && !fs::create_directories( "data/out" ) )
+     {
+          throw std::runtime_error{ "cannot create output directory" };
+     }
+     _16nar::tools::JsonAssetReader reader{ "data" };
+     _16nar::tools::JsonAssetWriter writer{ "data/out" };
+
+     std::ifstream ifs{ "data/test_material.json" };
+     _16nar::tools::ResourceData data = reader.read_asset( ifs );
+     ifs.close();
+
+     REQUIRE( data.type == _16nar::ResourceType::Material );
+     REQUIRE( data.name == "test_material" );
+     REQUIRE( data.data_sizes.empty() );
+
+     auto mat_data = std::any_cast< _16nar::LoadParams< _16nar::ResourceType::Material > >( data.params );
+     REQUIRE( mat_data.shader_name == "test_shader" );
+     REQUIRE( mat_data.texture_names.size() == 2 );
+     REQUIRE( mat_data.texture_names.at( 0 ) == "test_texture" );
+     REQUIRE( mat_data.texture_names.at( 1 ) == "other_package/normal_map" );
+     REQUIRE( mat_data.texture_array_names == std::vector< std::string >{ "test_texture_array" } );
+     REQUIRE( mat_data.uniforms.size() == 4 );
+     REQUIRE( mat_data.uniforms.at( 0 ).name == "color" );
+     REQUIRE( std::get< _16nar::Vec4f >( mat_data.uniforms.at( 0 ).value ) == _16nar::Vec4f{ 1.0f, 0.5f, 0.25f, 1.0f } );
+     REQUIRE( mat_data.uniforms.at( 1 ).name == "frame" );
+     REQUIRE( std::get< int >( mat_data.uniforms.at( 1 ).value ) == 3 );
+     REQUIRE( mat_data.uniforms.at( 2 ).name == "flip" );
+     REQUIRE( std::get< bool >( mat_data.uniforms.at( 2 ).value ) == true );
+     REQUIRE( mat_data.uniforms.at( 3 ).name == "offset" );
+     REQUIRE( std::get< _16nar::Vec2i >( mat_data.uniforms.at( 3 ).value ) == _16nar::Vec2i{ -4, 8 } );
+
+     std::ofstream ofs{ "data/out/" + data.name + "_out." + writer.get_file_ext() };
+     writer.write_asset( ofs, data );
+     ofs.close();
+
+     std::ifstream ifs_written{ "data/out/test_material_out.json" };
+     auto written = nlohmann::json::parse( ifs_written );
+     REQUIRE( written[ "type" ] == "material" );
+     REQUIRE( written[ "name" ] == "test_material" );
+     REQUIRE( written[ "shader" ] == "test_shader" );
+     REQUIRE( written[ "textures" ] == std::vector< std::string >{ "test_texture", "other_package/normal_map" } );
+     REQUIRE( written[ "texture_arrays" ] == std::vector< std::string >{ "test_texture_array" } );
+
+     std::vector< nlohmann::json > uniforms = written[ "uniforms" ];
+     REQUIRE( uniforms.size() == 4 );
+     REQUIRE( uniforms[ 0 ][ "name" ] == "color" );
+     REQUIRE( uniforms[ 0 ][ "type" ] == "vec4f" );
+     REQUIRE( uniforms[ 0 ][ "value" ] == std::vector< float >{ 1.0f, 0.5f, 0.25f, 1.0f } );
+     REQUIRE( uniforms[ 1 ][ "type" ] == "int" );
+     REQUIRE( uniforms[ 1 ][ "value" ] == 3 );
+     REQUIRE( uniforms[ 2 ][ "type" ] == "bool" );
+     REQUIRE( uniforms[ 2 ][ "value" ] == true );
+     REQUIRE( uniforms[ 3 ][ "type" ] == "vec2i" );
+     REQUIRE( uniforms[ 3 ][ "value" ] == std::vector< int >{ -4, 8 } );
+}
+
+
+TEST_CASE( "Atlases reading and writing in JSON format", "[json_resources]" )
+{
+     if ( !fs::exists( "data/out" ) && !fs::create_directories( "data/out" ) )
+     {
+          throw std::runtime_error{ "cannot create output directory" };
+     }
+     _16nar::tools::JsonAssetReader reader{ "data" };
+     _16nar::tools::JsonAssetWriter writer{ "data/out" };
+
+     std::ifstream ifs{ "data/test_atlas.json" };
+     _16nar::tools::ResourceData data = reader.read_asset( ifs );
+     ifs.close();
+
+     REQUIRE( data.type == _16nar::ResourceType::Atlas );
+     REQUIRE( data.name == "test_atlas" );
+     REQUIRE( data.data_sizes.empty() );
+
+     auto atlas_data = std::any_cast< _16nar::LoadParams< _16nar::ResourceType::Atlas > >( data.params );
+     REQUIRE( atlas_data.page_names == std::vector< std::string >{ "test_atlas_page0", "test_atlas_page1" } );
+     REQUIRE( atlas_data.regions.size() == 2 );
+     REQUIRE( atlas_data.regions.at( 0 ).name == "hero" );
+     REQUIRE( atlas_data.regions.at( 0 ).page == 0 );
+     REQUIRE( atlas_data.regions.at( 0 ).position == _16nar::Vec2f{ 0.0f, 0.5f } );
+     REQUIRE( atlas_data.regions.at( 0 ).size == _16nar::Vec2f{ 0.25f, 0.5f } );
+     REQUIRE( atlas_data.regions.at( 0 ).rotated == false );
+     REQUIRE( atlas_data.regions.at( 1 ).name == "coin" );
+     REQUIRE( atlas_data.regions.at( 1 ).page == 1 );
+     REQUIRE( atlas_data.regions.at( 1 ).position == _16nar::Vec2f{ 0.5f, 0.0f } );
+     REQUIRE( atlas_data.regions.at( 1 ).size == _16nar::Vec2f{ 0.125f, 0.25f } );
+     REQUIRE( atlas_data.regions.at( 1 ).rotated == true );
+
+     std::ofstream ofs{ "data/out/" + data.name + "_out." + writer.get_file_ext() };
+     writer.write_asset( ofs, data );
+     ofs.close();
+
+     std::ifstream ifs_written{ "data/out/test_atlas_out.json" };
+     auto written = nlohmann::json::parse( ifs_written );
+     REQUIRE( written[ "type" ] == "atlas" );
+     REQUIRE( written[ "name" ] == "test_atlas" );
+     REQUIRE( written[ "pages" ] == std::vector< std::string >{ "test_atlas_page0", "test_atlas_page1" } );
+
+     std::vector< nlohmann::json > regions = written[ "regions" ];
+     REQUIRE( regions.size() == 2 );
+     REQUIRE( regions[ 1 ][ "name" ] == "coin" );
+     REQUIRE( regions[ 1 ][ "page" ] == 1 );
+     REQUIRE( regions[ 1 ][ "position" ] == std::vector< float >{ 0.5f, 0.0f } );
+     REQUIRE( regions[ 1 ][ "size" ] == std::vector< float >{ 0.125f, 0.25f } );
+     REQUIRE( regions[ 1 ][ "rotated" ] == true );
+}
+
+
 TEST_CASE( "Packages reading and writing in JSON format", "[json_resources]" )
 {
      if ( !fs::exists( "data/out" ) && !fs::create_directories( "data/out" ) )
@@ -0,0 +1,128 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <16nar/tools/mesh_optimizer.h>
+#include <16nar/render/render_defs.h>
+
+#include <vector>
+#include <array>
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+namespace
+{
+
+using VertexBufferParams = _16nar::LoadParams< _16nar::ResourceType::VertexBuffer >;
+using Triangle = std::array< float, 6 >;
+
+
+/// @brief Make grid of size x size quads as triangle list without index buffer.
+_16nar::tools::ResourceData make_grid( int size )
+{
+     std::vector< float > positions;
+     for ( int y = 0; y < size; y++ )
+     {
+          for ( int x = 0; x < size; x++ )
+          {
+               float x0 = static_cast< float >( x ), y0 = static_cast< float >( y );
+               positions.insert( positions.end(), { x0, y0, x0 + 1, y0, x0, y0 + 1 } );
+               positions.insert( positions.end(), { x0 + 1, y0, x0 + 1, y0 + 1, x0, y0 + 1 } );
+          }
+     }
+     VertexBufferParams params{};
+     params.attributes.resize( 1 );
+     params.attributes[ 0 ].size = 2;
+     params.buffer.size = positions.size() * sizeof( float );
+     params.buffer.data = _16nar::DataSharedPtr{ new std::byte[ params.buffer.size ], std::default_delete< std::byte[] >() };
+     std::memcpy( params.buffer.data.get(), positions.data(), params.buffer.size );
+
+     _16nar::tools::ResourceData data{};
+     data.name = "grid";
+     data.type = _16nar::ResourceType::VertexBuffer;
+     data.data_sizes = { static_cast< uint32_t >( params.buffer.size ), 0 };
+     data.params = std::any{ params };
+     return data;
+}
+
+
+/// @brief Get sorted triangles of indexed mesh with float2 positions.
+std::vector< Triangle > get_triangles( const VertexBufferParams& params )
+{
+     std::vector< Triangle > triangles;
+     const float *positions = reinterpret_cast< const float * >( params.buffer.data.get() );
+     std::size_t index_count = params.index_buffer.size / sizeof( uint16_t );
+     for ( std::size_t i = 0; i < index_count; i += 3 )
+     {
+          Triangle triangle{};
+          for ( std::size_t k = 0; k < 3; k++ )
+          {
+               uint16_t index = 0;
+               std::memcpy( &index, params.index_buffer.data.get() + ( i + k ) * sizeof( index ), sizeof( index ) );
+               triangle[ k * 2 ] = positions[ index * 2 ];
+               triangle[ k * 2 + 1 ] = positions[ index * 2 + 1 ];
+          }
+          triangles.push_back( triangle );
+     }
+     std::sort( triangles.begin(), triangles.end() );
+     return triangles;
+}
+
+
+TEST_CASE( "Average cache miss ratio", "[mesh_optimizer]" )
+{
+     REQUIRE( _16nar::tools::get_acmr( {}, 32 ) == 0.0f );
+     REQUIRE( _16nar::tools::get_acmr( { 0, 1, 2, 2, 1, 3 }, 32 ) == 2.0f );
+     // with FIFO cache of 3 vertices reloading of vertex 0 evicts vertex 1, so both of them are missed
+     REQUIRE( _16nar::tools::get_acmr( { 0, 1, 2, 1, 2, 3, 0, 1, 3 }, 3 ) == 2.0f );
+     REQUIRE( _16nar::tools::get_acmr( { 0, 1, 2, 1, 2, 3, 0, 1, 3 }, 4 ) == 4.0f / 3 );
+}
+
+
+TEST_CASE( "Optimization of triangle mesh", "[mesh_optimizer]" )
+{
+     constexpr int size = 16;
+     auto data = make_grid( size );
+     auto stats = _16nar::tools::optimize_mesh( data );
+
+     REQUIRE( stats.vertices_before == size * size * 6 );
+     REQUIRE( stats.vertices_after == ( size + 1 ) * ( size + 1 ) );
+     REQUIRE( stats.acmr_before == 3.0f );
+     REQUIRE( stats.acmr_after < 1.0f );
+
+     auto params = std::any_cast< VertexBufferParams >( data.params );
+     REQUIRE( params.index_type == _16nar::DataType::UnsignedShort );
+     REQUIRE( params.buffer.size == stats.vertices_after * 2 * sizeof( float ) );
+     REQUIRE( params.index_buffer.size == size * size * 6 * sizeof( uint16_t ) );
+     REQUIRE( data.data_sizes == std::vector< uint32_t >{ static_cast< uint32_t >( params.buffer.size ),
+          static_cast< uint32_t >( params.index_buffer.size ) } );
+     REQUIRE( params.attributes[ 0 ].stride == 2 * sizeof( float ) );
+
+     // vertices are numbered in order of first use
+     uint16_t first_indexes[ 3 ] = {};
+     std::memcpy( first_indexes, params.index_buffer.data.get(), sizeof( first_indexes ) );
+     REQUIRE( first_indexes[ 0 ] == 0 );
+     REQUIRE( first_indexes[ 1 ] == 1 );
+     REQUIRE( first_indexes[ 2 ] == 2 );
+
+     // geometry is not changed, only order of triangles
+     auto expected = make_grid( size );
+     auto optimized = get_triangles( params );
+     auto& expected_params = std::any_cast< VertexBufferParams& >( expected.params );
+     std::vector< Triangle > expected_triangles;
+     const float *positions = reinterpret_cast< const float * >( expected_params.buffer.data.get() );
+     for ( std::size_t i = 0; i < stats.vertices_before; i += 3 )
+     {
+          expected_triangles.push_back( Triangle{ positions[ i * 2 ], positions[ i * 2 + 1 ], positions[ i * 2 + 2 ],
+               positions[ i * 2 + 3 ], positions[ i * 2 + 4 ], positions[ i * 2 + 5 ] } );
+     }
+     std::sort( expected_triangles.begin(), expected_triangles.end() );
+     REQUIRE( optimized == expected_triangles );
+
+     // optimization of optimized mesh does not weld anything
+     REQUIRE( _16nar::tools::optimize_mesh( data ).vertices_after == stats.vertices_after );
+
+     expected_params.attributes[ 0 ].divisor = 1;
+     REQUIRE_THROWS_AS( _16nar::tools::optimize_mesh( expected ), std::runtime_error );
+}
+
+}
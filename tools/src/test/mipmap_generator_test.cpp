@@ -0,0 +1,91 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <16nar/tools/mipmap_generator.h>
+#include <16nar/render/render_defs.h>
+
+#include <vector>
+#include <stdexcept>
+
+namespace
+{
+
+using TextureParams = _16nar::LoadParams< _16nar::ResourceType::Texture >;
+
+
+_16nar::tools::ResourceData make_texture( _16nar::BufferDataFormat format, const _16nar::Vec2i& size,
+     const std::vector< int >& texels )
+{
+     TextureParams params{};
+     params.format = format;
+     params.min_filter = _16nar::TextureFilter::LinearMipmapLinear;
+     params.size = size;
+     params.data = _16nar::DataSharedPtr{ new std::byte[ texels.size() ], std::default_delete< std::byte[] >() };
+     for ( std::size_t i = 0; i < texels.size(); i++ )
+     {
+          params.data.get()[ i ] = static_cast< std::byte >( texels[ i ] );
+     }
+     _16nar::tools::ResourceData data{};
+     data.name = "texture";
+     data.type = _16nar::ResourceType::Texture;
+     data.data_sizes.push_back( static_cast< uint32_t >( texels.size() ) );
+     data.params = std::any{ params };
+     return data;
+}
+
+
+TEST_CASE( "Mip levels of linear texture", "[mipmap_generator]" )
+{
+     REQUIRE( _16nar::tools::uses_mipmaps( _16nar::TextureFilter::NearestMipmapLinear ) );
+     REQUIRE_FALSE( _16nar::tools::uses_mipmaps( _16nar::TextureFilter::Linear ) );
+
+     // 4x2 RGBA texture, two left columns are black, two right ones are white
+     std::vector< int > texels;
+     for ( int i = 0; i < 8; i++ )
+     {
+          int value = ( i % 4 < 2 ) ? 0 : 255;
+          texels.insert( texels.end(), { value, value, value, 100 } );
+     }
+     auto texture = make_texture( _16nar::BufferDataFormat::Rgba, _16nar::Vec2i{ 4, 2 }, texels );
+     _16nar::tools::generate_mipmaps( texture );
+
+     auto params = std::any_cast< TextureParams >( texture.params );
+     REQUIRE( params.mipmaps.size() == 2 );
+     REQUIRE( texture.data_sizes == std::vector< uint32_t >{ 32, 8, 4 } );
+     const std::byte *level1 = params.mipmaps[ 0 ].get();
+     REQUIRE( level1[ 0 ] == std::byte{ 0 } );
+     REQUIRE( level1[ 3 ] == std::byte{ 100 } );
+     REQUIRE( level1[ 4 ] == std::byte{ 255 } );
+     const std::byte *level2 = params.mipmaps[ 1 ].get();
+     REQUIRE( level2[ 0 ] == std::byte{ 128 } );
+     REQUIRE( level2[ 3 ] == std::byte{ 100 } );
+
+     // generation replaces previous levels
+     _16nar::tools::generate_mipmaps( texture );
+     REQUIRE( std::any_cast< TextureParams >( texture.params ).mipmaps.size() == 2 );
+     REQUIRE( texture.data_sizes.size() == 3 );
+}
+
+
+TEST_CASE( "Mip levels of sRGB texture", "[mipmap_generator]" )
+{
+     // average of black and white is 0.5 in linear space, which is encoded as 188 in sRGB
+     auto texture = make_texture( _16nar::BufferDataFormat::Srgb, _16nar::Vec2i{ 2, 1 }, { 0, 0, 0, 255, 255, 255 } );
+     _16nar::tools::generate_mipmaps( texture );
+     auto params = std::any_cast< TextureParams >( texture.params );
+     REQUIRE( params.mipmaps.size() == 1 );
+     REQUIRE( texture.data_sizes == std::vector< uint32_t >{ 6, 3 } );
+     REQUIRE( params.mipmaps[ 0 ].get()[ 0 ] == std::byte{ 188 } );
+     REQUIRE( params.mipmaps[ 0 ].get()[ 2 ] == std::byte{ 188 } );
+
+     // odd size is rounded down, last column is clamped
+     auto odd = make_texture( _16nar::BufferDataFormat::Rgb, _16nar::Vec2i{ 3, 1 }, { 0, 0, 0, 0, 0, 0, 9, 9, 9 } );
+     _16nar::tools::generate_mipmaps( odd );
+     REQUIRE( odd.data_sizes == std::vector< uint32_t >{ 9, 3 } );
+
+     _16nar::tools::ResourceData shader{};
+     shader.type = _16nar::ResourceType::Shader;
+     shader.params = std::any{ _16nar::LoadParams< _16nar::ResourceType::Shader >{} };
+     REQUIRE_THROWS_AS( _16nar::tools::generate_mipmaps( shader ), std::runtime_error );
+}
+
+}
@@ -0,0 +1,137 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <16nar/tools/vertex_format.h>
+#include <16nar/render/render_defs.h>
+
+#include <vector>
+#include <cstring>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace
+{
+
+using VertexBufferParams = _16nar::LoadParams< _16nar::ResourceType::VertexBuffer >;
+
+
+template < typename T >
+_16nar::DataSharedPtr make_data( const std::vector< T >& values )
+{
+     _16nar::DataSharedPtr data{ new std::byte[ values.size() * sizeof( T ) ], std::default_delete< std::byte[] >() };
+     std::memcpy( data.get(), values.data(), values.size() * sizeof( T ) );
+     return data;
+}
+
+
+template < typename T >
+T read_value( const _16nar::DataSharedPtr& data, std::size_t offset )
+{
+     T value{};
+     std::memcpy( &value, data.get() + offset, sizeof( T ) );
+     return value;
+}
+
+
+TEST_CASE( "Half precision conversion", "[vertex_format]" )
+{
+     using _16nar::tools::float_to_half;
+     using _16nar::tools::half_to_float;
+
+     REQUIRE( float_to_half( 1.0f ) == 0x3c00 );
+     REQUIRE( float_to_half( -2.0f ) == 0xc000 );
+     REQUIRE( float_to_half( 0.0f ) == 0x0000 );
+     REQUIRE( float_to_half( 65504.0f ) == 0x7bff );
+     REQUIRE( float_to_half( 1.0e6f ) == 0x7c00 );
+     REQUIRE( float_to_half( std::ldexp( 1.0f, -24 ) ) == 0x0001 );
+     // 1 + 2^-11 is exactly between two half values, it is rounded to even one
+     REQUIRE( float_to_half( 1.0f + std::ldexp( 1.0f, -11 ) ) == 0x3c00 );
+
+     REQUIRE( half_to_float( 0x3800 ) == 0.5f );
+     REQUIRE( half_to_float( 0x7bff ) == 65504.0f );
+     REQUIRE( half_to_float( 0x0001 ) == std::ldexp( 1.0f, -24 ) );
+     REQUIRE( half_to_float( 0xfc00 ) == -std::numeric_limits< float >::infinity() );
+     REQUIRE( half_to_float( float_to_half( 0.333f ) ) == half_to_float( 0x3554 ) );
+}
+
+
+TEST_CASE( "Interleaved and planar vertex layouts", "[vertex_format]" )
+{
+     VertexBufferParams params{};
+     params.attributes.resize( 2 );
+     params.attributes[ 0 ].size = 3;
+     params.attributes[ 0 ].data_type = _16nar::DataType::Float;
+     params.attributes[ 1 ].size = 4;
+     params.attributes[ 1 ].data_type = _16nar::DataType::Byte;
+     params.buffer.size = 4 * 16;
+
+     _16nar::tools::set_vertex_layout( params, _16nar::tools::VertexLayout::Interleaved );
+     REQUIRE( params.attributes[ 0 ].offset == 0 );
+     REQUIRE( params.attributes[ 0 ].stride == 16 );
+     REQUIRE( params.attributes[ 1 ].offset == 12 );
+     REQUIRE( params.attributes[ 1 ].stride == 16 );
+
+     _16nar::tools::set_vertex_layout( params, _16nar::tools::VertexLayout::Planar );
+     REQUIRE( params.attributes[ 0 ].offset == 0 );
+     REQUIRE( params.attributes[ 0 ].stride == 0 );
+     REQUIRE( params.attributes[ 1 ].offset == 4 * 12 );
+     REQUIRE( params.attributes[ 1 ].stride == 0 );
+
+     params.buffer.size = 4 * 16 + 1;
+     REQUIRE_THROWS_AS( _16nar::tools::set_vertex_layout( params, _16nar::tools::VertexLayout::Planar ),
+          std::runtime_error );
+}
+
+
+TEST_CASE( "Compaction of vertex buffer", "[vertex_format]" )
+{
+     // planar float positions and texture coordinates of 4 vertices
+     VertexBufferParams params{};
+     params.attributes.resize( 2 );
+     params.attributes[ 0 ].size = 2;
+     params.attributes[ 0 ].data_type = _16nar::DataType::Float;
+     params.attributes[ 1 ].size = 2;
+     params.attributes[ 1 ].data_type = _16nar::DataType::Float;
+     params.buffer.data = make_data< float >( { -10.0f, 20.0f, 100.0f, 20.0f, 100.0f, 0.5f, -10.0f, 0.5f,
+          0.0f, 0.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.5f } );
+     params.buffer.size = 16 * sizeof( float );
+     _16nar::tools::set_vertex_layout( params, _16nar::tools::VertexLayout::Planar );
+     params.index_buffer.data = make_data< uint32_t >( { 0, 1, 2, 2, 3, 0 } );
+     params.index_buffer.size = 6 * sizeof( uint32_t );
+
+     _16nar::tools::ResourceData data{};
+     data.name = "vertex_buffer";
+     data.type = _16nar::ResourceType::VertexBuffer;
+     data.data_sizes = { 64, 24 };
+     data.params = std::any{ params };
+     _16nar::tools::compact_vertex_buffer( data );
+
+     auto compact = std::any_cast< VertexBufferParams >( data.params );
+     REQUIRE( data.data_sizes == std::vector< uint32_t >{ 32, 12 } );
+     REQUIRE( compact.attributes[ 0 ].data_type == _16nar::DataType::HalfFloat );
+     REQUIRE( compact.attributes[ 0 ].normalized == false );
+     REQUIRE( compact.attributes[ 0 ].offset == 0 );
+     REQUIRE( compact.attributes[ 0 ].stride == 8 );
+     REQUIRE( compact.attributes[ 1 ].data_type == _16nar::DataType::UnsignedShort );
+     REQUIRE( compact.attributes[ 1 ].normalized == true );
+     REQUIRE( compact.attributes[ 1 ].offset == 4 );
+     REQUIRE( compact.attributes[ 1 ].stride == 8 );
+
+     // the third vertex
+     REQUIRE( _16nar::tools::half_to_float( read_value< uint16_t >( compact.buffer.data, 16 ) ) == 100.0f );
+     REQUIRE( _16nar::tools::half_to_float( read_value< uint16_t >( compact.buffer.data, 18 ) ) == 0.5f );
+     REQUIRE( read_value< uint16_t >( compact.buffer.data, 20 ) == 65535 );
+     REQUIRE( read_value< uint16_t >( compact.buffer.data, 22 ) == 65535 );
+     // the fourth vertex
+     REQUIRE( read_value< uint16_t >( compact.buffer.data, 30 ) == 32768 );
+
+     REQUIRE( compact.index_type == _16nar::DataType::UnsignedShort );
+     REQUIRE( compact.index_buffer.size == 12 );
+     REQUIRE( read_value< uint16_t >( compact.index_buffer.data, 4 ) == 2 );
+
+     data.params = std::any{ _16nar::LoadParams< _16nar::ResourceType::Shader >{} };
+     data.type = _16nar::ResourceType::Shader;
+     REQUIRE_THROWS_AS( _16nar::tools::compact_vertex_buffer( data ), std::runtime_error );
+}
+
+}
@@ -12,6 +12,7 @@
 #include <fstream>
 #include <filesystem>
 #include <stdexcept>
+#include <type_traits>
 
 namespace _16nar::tools
 {
@@ -87,6 +88,99 @@ int get_channel_count( BufferDataFormat format )
 }
 
 
+std::size_t get_data_type_size( DataType type )
+{
+     switch ( type )
+     {
+          case DataType::Byte:
+               return sizeof( uint8_t );
+          case DataType::HalfFloat:
+          case DataType::UnsignedShort:
+               return sizeof( uint16_t );
+          case DataType::Float:
+               return sizeof( float );
+          case DataType::UnsignedInt:
+               return sizeof( uint32_t );
+          default:
+               throw std::runtime_error{ "wrong data type: "
+                    + std::to_string( static_cast< std::size_t >( type ) ) };
+     }
+     return sizeof( uint8_t );
+}
+
+
+UniformType get_uniform_components( const UniformValue& value,
+     std::vector< float >& floats, std::vector< int >& ints )
+{
+     std::visit( [ &floats, &ints ]( const auto& val )
+     {
+          using T = std::decay_t< decltype( val ) >;
+          if constexpr ( std::is_same_v< T, float > )
+          {
+               floats.push_back( val );
+          }
+          else if constexpr ( std::is_same_v< T, int > || std::is_same_v< T, bool > )
+          {
+               ints.push_back( static_cast< int >( val ) );
+          }
+          else if constexpr ( std::is_same_v< typename T::type, float > )
+          {
+               floats.insert( floats.end(), val.data(), val.data() + T::size );
+          }
+          else
+          {
+               ints.insert( ints.end(), val.data(), val.data() + T::size );
+          }
+     }, value );
+     return static_cast< UniformType >( value.index() );
+}
+
+
+UniformValue make_uniform_value( UniformType type,
+     const std::vector< float >& floats, const std::vector< int >& ints )
+{
+     auto check_size = [ &floats, &ints, type ]( std::size_t float_count, std::size_t int_count )
+     {
+          if ( floats.size() != float_count || ints.size() != int_count )
+          {
+               throw std::runtime_error{ "wrong number of components for uniform type "
+                    + std::to_string( static_cast< std::size_t >( type ) ) };
+          }
+     };
+     switch ( type )
+     {
+          case UniformType::Float:
+               check_size( 1, 0 );
+               return floats[ 0 ];
+          case UniformType::Int:
+               check_size( 0, 1 );
+               return ints[ 0 ];
+          case UniformType::Bool:
+               check_size( 0, 1 );
+               return ints[ 0 ] != 0;
+          case UniformType::Vec2i:
+               check_size( 0, 2 );
+               return Vec2i{ ints[ 0 ], ints[ 1 ] };
+          case UniformType::Vec2f:
+               check_size( 2, 0 );
+               return Vec2f{ floats[ 0 ], floats[ 1 ] };
+          case UniformType::Vec3i:
+               check_size( 0, 3 );
+               return Vec3i{ ints[ 0 ], ints[ 1 ], ints[ 2 ] };
+          case UniformType::Vec3f:
+               check_size( 3, 0 );
+               return Vec3f{ floats[ 0 ], floats[ 1 ], floats[ 2 ] };
+          case UniformType::Vec4i:
+               check_size( 0, 4 );
+               return Vec4i{ ints[ 0 ], ints[ 1 ], ints[ 2 ], ints[ 3 ] };
+          case UniformType::Vec4f:
+               check_size( 4, 0 );
+               return Vec4f{ floats[ 0 ], floats[ 1 ], floats[ 2 ], floats[ 3 ] };
+     }
+     throw std::runtime_error{ "wrong uniform type: " + std::to_string( static_cast< std::size_t >( type ) ) };
+}
+
+
 std::unique_ptr< IAssetReader > create_asset_reader( const std::string& in_dir,
      PackageFormat format )
 {
@@ -0,0 +1,269 @@
+#include <16nar/tools/vertex_format.h>
+
+#include <16nar/tools/utils.h>
+
+#include <algorithm>
+#include <vector>
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+
+namespace
+{
+
+using VertexBufferParams = _16nar::LoadParams< _16nar::ResourceType::VertexBuffer >;
+
+
+/// @brief Get size of one value of attribute in bytes.
+std::size_t get_value_size( const VertexBufferParams::AttribParams& attr )
+{
+     return attr.size * _16nar::tools::get_data_type_size( attr.data_type );
+}
+
+
+/// @brief Get number of attribute values stored in the buffer.
+std::size_t get_value_count( const VertexBufferParams::AttribParams& attr, std::size_t buffer_size )
+{
+     std::size_t value_size = get_value_size( attr );
+     std::size_t stride = attr.stride ? attr.stride : value_size;
+     if ( value_size == 0 || buffer_size < attr.offset + value_size )
+     {
+          return 0;
+     }
+     return ( buffer_size - attr.offset - value_size ) / stride + 1;
+}
+
+
+/// @brief Round size up to multiple of 4 bytes.
+std::size_t align4( std::size_t size )
+{
+     return ( size + 3 ) & ~static_cast< std::size_t >( 3 );
+}
+
+} // anonymous namespace
+
+
+namespace _16nar::tools
+{
+
+uint16_t float_to_half( float value ) noexcept
+{
+     uint32_t bits = 0;
+     std::memcpy( &bits, &value, sizeof( bits ) );
+     uint32_t sign = ( bits >> 16 ) & 0x8000;
+     int exponent = static_cast< int >( ( bits >> 23 ) & 0xff );
+     uint32_t mantissa = bits & 0x7fffff;
+     if ( exponent == 0xff )       // infinity or NaN
+     {
+          return static_cast< uint16_t >( sign | 0x7c00 | ( mantissa ? 0x200 : 0 ) );
+     }
+     int half_exponent = exponent - 127 + 15;
+     if ( half_exponent >= 0x1f )  // too large, becomes infinity
+     {
+          return static_cast< uint16_t >( sign | 0x7c00 );
+     }
+     if ( half_exponent <= 0 )     // subnormal half or zero
+     {
+          if ( half_exponent < -10 )
+          {
+               return static_cast< uint16_t >( sign );
+          }
+          mantissa |= 0x800000;
+          int shift = 14 - half_exponent;
+          uint32_t half_mantissa = mantissa >> shift;
+          uint32_t rest = mantissa & ( ( 1u << shift ) - 1 );
+          uint32_t halfway = 1u << ( shift - 1 );
+          if ( rest > halfway || ( rest == halfway && ( half_mantissa & 1 ) ) )
+          {
+               half_mantissa++;
+          }
+          return static_cast< uint16_t >( sign | half_mantissa );
+     }
+     uint32_t half = sign | ( static_cast< uint32_t >( half_exponent ) << 10 ) | ( mantissa >> 13 );
+     uint32_t rest = mantissa & 0x1fff;
+     if ( rest > 0x1000 || ( rest == 0x1000 && ( half & 1 ) ) )
+     {
+          half++;  // carry to exponent is correct, the largest values are rounded to infinity
+     }
+     return static_cast< uint16_t >( half );
+}
+
+
+float half_to_float( uint16_t bits ) noexcept
+{
+     uint32_t sign = static_cast< uint32_t >( bits & 0x8000 ) << 16;
+     uint32_t exponent = ( bits >> 10 ) & 0x1f;
+     uint32_t mantissa = bits & 0x3ff;
+     uint32_t result = 0;
+     if ( exponent == 0 )
+     {
+          float value = std::ldexp( static_cast< float >( mantissa ), -24 );
+          return sign ? -value : value;
+     }
+     else if ( exponent == 0x1f )
+     {
+          result = sign | 0x7f800000 | ( mantissa << 13 );
+     }
+     else
+     {
+          result = sign | ( ( exponent + 127 - 15 ) << 23 ) | ( mantissa << 13 );
+     }
+     float value = 0.0f;
+     std::memcpy( &value, &result, sizeof( value ) );
+     return value;
+}
+
+
+std::size_t get_vertex_count( const LoadParams< ResourceType::VertexBuffer >& params )
+{
+     if ( params.attributes.empty() )
+     {
+          return 0;
+     }
+     std::size_t vertex_count = get_value_count( params.attributes.front(), params.buffer.size );
+     for ( const auto& attr : params.attributes )
+     {
+          vertex_count = std::min( vertex_count, get_value_count( attr, params.buffer.size ) );
+     }
+     return vertex_count;
+}
+
+
+void set_vertex_layout( LoadParams< ResourceType::VertexBuffer >& params, VertexLayout layout )
+{
+     std::size_t vertex_size = 0;
+     for ( const auto& attr : params.attributes )
+     {
+          vertex_size += get_value_size( attr );
+     }
+     if ( vertex_size == 0 || params.buffer.size % vertex_size != 0 )
+     {
+          throw std::runtime_error{ "size of vertex buffer " + std::to_string( params.buffer.size )
+               + " is not a multiple of vertex size " + std::to_string( vertex_size ) };
+     }
+     std::size_t vertex_count = params.buffer.size / vertex_size;
+     std::size_t offset = 0;
+     for ( auto& attr : params.attributes )
+     {
+          attr.offset = offset;
+          if ( layout == VertexLayout::Interleaved )
+          {
+               attr.stride = vertex_size;
+               offset += get_value_size( attr );
+          }
+          else
+          {
+               attr.stride = 0;
+               offset += get_value_size( attr ) * vertex_count;
+          }
+     }
+}
+
+
+void compact_vertex_buffer( ResourceData& resource )
+{
+     auto *params = ( resource.type == ResourceType::VertexBuffer ) ?
+          std::any_cast< VertexBufferParams >( &resource.params ) : nullptr;
+     if ( !params )
+     {
+          throw std::runtime_error{ "resource " + resource.name + " is not a vertex buffer" };
+     }
+     if ( params->attributes.empty() || !params->buffer.data )
+     {
+          throw std::runtime_error{ "vertex buffer " + resource.name + " has no data" };
+     }
+     std::size_t vertex_count = get_vertex_count( *params );
+     if ( vertex_count == 0 )
+     {
+          throw std::runtime_error{ "vertex buffer " + resource.name + " is too small for its attributes" };
+     }
+
+     const std::byte *src = params->buffer.data.get();
+     std::vector< VertexBufferParams::AttribParams > attributes = params->attributes;
+     std::size_t vertex_size = 0;
+     for ( std::size_t i = 0; i < attributes.size(); i++ )
+     {
+          auto& attr = attributes[ i ];
+          const auto& src_attr = params->attributes[ i ];
+          if ( attr.data_type == DataType::Float )
+          {
+               bool unit_range = true;
+               std::size_t src_stride = src_attr.stride ? src_attr.stride : get_value_size( src_attr );
+               for ( std::size_t v = 0; v < vertex_count && unit_range; v++ )
+               {
+                    for ( std::size_t c = 0; c < attr.size; c++ )
+                    {
+                         float value = 0.0f;
+                         std::memcpy( &value, src + src_attr.offset + v * src_stride + c * sizeof( float ),
+                              sizeof( value ) );
+                         unit_range = unit_range && value >= 0.0f && value <= 1.0f;
+                    }
+               }
+               attr.data_type = unit_range ? DataType::UnsignedShort : DataType::HalfFloat;
+               attr.normalized = unit_range;
+          }
+          attr.offset = vertex_size;
+          vertex_size = align4( vertex_size + get_value_size( attr ) );
+     }
+
+     std::size_t buffer_size = vertex_size * vertex_count;
+     DataSharedPtr buffer{ new std::byte[ buffer_size ](), std::default_delete< std::byte[] >() };
+     for ( std::size_t i = 0; i < attributes.size(); i++ )
+     {
+          auto& attr = attributes[ i ];
+          const auto& src_attr = params->attributes[ i ];
+          std::size_t src_size = get_value_size( src_attr );
+          std::size_t src_stride = src_attr.stride ? src_attr.stride : src_size;
+          for ( std::size_t v = 0; v < vertex_count; v++ )
+          {
+               const std::byte *src_value = src + src_attr.offset + v * src_stride;
+               std::byte *dst_value = buffer.get() + v * vertex_size + attr.offset;
+               if ( src_attr.data_type != DataType::Float )
+               {
+                    std::memcpy( dst_value, src_value, src_size );
+                    continue;
+               }
+               for ( std::size_t c = 0; c < attr.size; c++ )
+               {
+                    float value = 0.0f;
+                    std::memcpy( &value, src_value + c * sizeof( float ), sizeof( value ) );
+                    uint16_t packed = ( attr.data_type == DataType::HalfFloat ) ? float_to_half( value )
+                         : static_cast< uint16_t >( std::lround( value * 65535.0f ) );
+                    std::memcpy( dst_value + c * sizeof( packed ), &packed, sizeof( packed ) );
+               }
+          }
+          attr.stride = vertex_size;
+     }
+     params->attributes = std::move( attributes );
+     params->buffer.data = buffer;
+     params->buffer.size = buffer_size;
+
+     std::size_t index_count = params->index_buffer.size / sizeof( uint32_t );
+     const std::byte *indexes = params->index_buffer.data.get();
+     bool short_indexes = ( params->index_type == DataType::UnsignedInt && indexes );
+     for ( std::size_t i = 0; i < index_count && short_indexes; i++ )
+     {
+          uint32_t index = 0;
+          std::memcpy( &index, indexes + i * sizeof( index ), sizeof( index ) );
+          short_indexes = ( index <= 0xffff );
+     }
+     if ( short_indexes )
+     {
+          DataSharedPtr index_buffer{ new std::byte[ index_count * sizeof( uint16_t ) ],
+               std::default_delete< std::byte[] >() };
+          for ( std::size_t i = 0; i < index_count; i++ )
+          {
+               uint32_t index = 0;
+               std::memcpy( &index, indexes + i * sizeof( index ), sizeof( index ) );
+               uint16_t short_index = static_cast< uint16_t >( index );
+               std::memcpy( index_buffer.get() + i * sizeof( short_index ), &short_index, sizeof( short_index ) );
+          }
+          params->index_buffer.data = index_buffer;
+          params->index_buffer.size = index_count * sizeof( uint16_t );
+          params->index_type = DataType::UnsignedShort;
+     }
+     resource.data_sizes = { static_cast< uint32_t >( params->buffer.size ),
+          static_cast< uint32_t >( params->index_buffer.size ) };
+}
+
+} // namespace _16nar::tools